@@ -0,0 +1,284 @@
+#include "Arena.hpp"
+#include <cstdlib>
+
+const int Arena::MinSnakesPerThread = 2048;
+
+static const Cell Directions[4] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 } };
+
+
+Arena::Arena(const ArenaConfig& config)
+	: mConfig(config)
+	, mOwners(static_cast<std::size_t>(config.gridWidth) * config.gridHeight, -1)
+	, mFoodIndex(static_cast<std::size_t>(config.gridWidth) * config.gridHeight, -1)
+	, mClaims(new std::atomic<std::uint32_t>[static_cast<std::size_t>(config.gridWidth) * config.gridHeight])
+	, mStamp(0)
+	, mRandom(config.seed)
+	, mTick(0)
+	, mAliveCount(0)
+	, mDeathCount(0)
+	, mParallel(config.threads)
+{
+	mSnakes.reserve(config.snakeCount);
+	for (int i = 0; i < config.snakeCount; ++i) {
+		mSnakes.emplace_back(config.maxLength);
+	}
+	reset();
+}
+
+void Arena::reset() {
+	std::size_t cellCount = mOwners.size();
+	for (std::size_t i = 0; i < cellCount; ++i) {
+		mOwners[i] = -1;
+		mFoodIndex[i] = -1;
+		mClaims[i].store(0, std::memory_order_relaxed);
+	}
+	mFood.clear();
+	mStamp = 0;
+	mRandom.seed(mConfig.seed);
+	mTick = 0;
+	mAliveCount = 0;
+	mDeathCount = 0;
+
+	for (int i = 0; i < getSnakeCount(); ++i) {
+		ArenaSnake& snake = mSnakes[i];
+		snake.body.clear();
+		snake.alive = false;
+		snake.respawnIn = 0;
+		snake.score = 0;
+		snake.random.seed(Random::hash(mConfig.seed ^ Random::hash(static_cast<std::uint64_t>(i) + 1)));
+		snake.moving = snake.eats = snake.grows = snake.dies = false;
+		spawn(i);
+	}
+
+	Cell cell;
+	while (static_cast<int>(mFood.size()) < mConfig.foodCount && randomFreeCell(cell)) {
+		addFood(cell);
+	}
+}
+
+void Arena::turn(int snake, int directionX, int directionY) {
+	ArenaSnake& s = mSnakes[snake];
+	if (directionX == -s.direction.x && directionY == -s.direction.y && (directionX != 0 || directionY != 0)) {
+		return;
+	}
+	s.nextDirection = { directionX, directionY };
+}
+
+
+void Arena::step() {
+	mTick++;
+	if (++mStamp >= (1u << 30)) {
+		for (std::size_t i = 0; i < mOwners.size(); ++i) {
+			mClaims[i].store(0, std::memory_order_relaxed);
+		}
+		mStamp = 1;
+	}
+
+	// Each pass only reads what earlier passes wrote, so the snakes can be split any way
+	int count = getSnakeCount();
+	mParallel.run(count, MinSnakesPerThread, [this](int begin, int end) { decide(begin, end); });
+	mParallel.run(count, MinSnakesPerThread, [this](int begin, int end) { plan(begin, end); });
+	mParallel.run(count, MinSnakesPerThread, [this](int begin, int end) { resolve(begin, end); });
+	mParallel.run(count, MinSnakesPerThread, [this](int begin, int end) { release(begin, end); });
+	mParallel.run(count, MinSnakesPerThread, [this](int begin, int end) { advance(begin, end); });
+
+	// Scores, food and respawns share one random sequence, so they stay on this thread
+	for (int i = 0; i < count; ++i) {
+		ArenaSnake& snake = mSnakes[i];
+		if (snake.alive && snake.dies) {
+			snake.alive = false;
+			snake.respawnIn = mConfig.respawnDelay;
+			mAliveCount--;
+			mDeathCount++;
+		}
+		else if (snake.alive && snake.eats) {
+			removeFood(snake.next);
+			snake.score++;
+		}
+		else if (!snake.alive && --snake.respawnIn <= 0) {
+			spawn(i);
+		}
+	}
+
+	Cell cell;
+	while (static_cast<int>(mFood.size()) < mConfig.foodCount && randomFreeCell(cell)) {
+		addFood(cell);
+	}
+}
+
+// Bots pick their direction; the player's was set by turn()
+void Arena::decide(int begin, int end) {
+	for (int i = begin; i < end; ++i) {
+		if (mSnakes[i].alive && !(i == 0 && mConfig.hasPlayer)) {
+			steerBot(mSnakes[i]);
+		}
+	}
+}
+
+// Work out where every head goes, and claim the cell so two heads arriving together both die
+void Arena::plan(int begin, int end) {
+	for (int i = begin; i < end; ++i) {
+		ArenaSnake& snake = mSnakes[i];
+		snake.moving = snake.eats = snake.grows = snake.dies = false;
+		if (!snake.alive || (snake.nextDirection.x == 0 && snake.nextDirection.y == 0)) {
+			continue;
+		}
+
+		snake.direction = snake.nextDirection;
+		snake.next = { snake.body.head().x + snake.direction.x, snake.body.head().y + snake.direction.y };
+		snake.moving = true;
+		if (!inBounds(snake.next)) {
+			snake.dies = true;
+			continue;
+		}
+
+		snake.eats = hasFood(snake.next);
+		snake.grows = snake.eats && !snake.body.isFull();
+
+		std::atomic<std::uint32_t>& claim = mClaims[cellIndex(snake.next)];
+		std::uint32_t seen = claim.load(std::memory_order_relaxed);
+		std::uint32_t desired;
+		do {
+			desired = (seen >> 1) == mStamp ? (mStamp << 1) | 1 : mStamp << 1;
+		} while (!claim.compare_exchange_weak(seen, desired, std::memory_order_relaxed));
+	}
+}
+
+// A head dies on a contested cell or on any body cell, except a tail that moves away this tick.
+// Two heads swapping cells collide too: a snake of length one has its tail at its head, and
+// that tail only leaves by moving into the cell this head is leaving.
+void Arena::resolve(int begin, int end) {
+	for (int i = begin; i < end; ++i) {
+		ArenaSnake& snake = mSnakes[i];
+		if (!snake.moving || snake.dies) {
+			continue;
+		}
+
+		int index = cellIndex(snake.next);
+		if (mClaims[index].load(std::memory_order_relaxed) & 1) {
+			snake.dies = true;
+			continue;
+		}
+
+		int owner = mOwners[index];
+		if (owner >= 0) {
+			const ArenaSnake& other = mSnakes[owner];
+			bool tailLeaves = other.moving && !other.grows && other.body.tail() == snake.next && other.next != snake.body.head();
+			snake.dies = !tailLeaves;
+		}
+	}
+}
+
+// Free the cells of dead snakes and the tails of the ones moving on
+void Arena::release(int begin, int end) {
+	for (int i = begin; i < end; ++i) {
+		ArenaSnake& snake = mSnakes[i];
+		if (!snake.alive) {
+			continue;
+		}
+
+		if (snake.dies) {
+			for (std::size_t s = 0; s < snake.body.size(); ++s) {
+				mOwners[cellIndex(snake.body[s])] = -1;
+			}
+			snake.body.clear();
+		}
+		else if (snake.moving && !snake.grows) {
+			mOwners[cellIndex(snake.body.popTail())] = -1;
+		}
+	}
+}
+
+// Claimed cells are unique, so every head can be written at once
+void Arena::advance(int begin, int end) {
+	for (int i = begin; i < end; ++i) {
+		ArenaSnake& snake = mSnakes[i];
+		if (snake.alive && snake.moving && !snake.dies) {
+			snake.body.pushHead(snake.next);
+			mOwners[cellIndex(snake.next)] = i;
+		}
+	}
+}
+
+
+// Head for a target piece of food, never reversing and avoiding cells that are taken now
+void Arena::steerBot(ArenaSnake& snake) {
+	const Cell& head = snake.body.head();
+
+	if (mFood.empty() == false && (!inBounds(snake.target) || !hasFood(snake.target) || snake.random.nextBelow(64) == 0)) {
+		snake.target = mFood[snake.random.nextBelow(static_cast<int>(mFood.size()))];
+	}
+
+	Cell best = snake.direction;
+	int bestScore = -(1 << 30);
+	for (const Cell& direction : Directions) {
+		if (direction.x == -snake.direction.x && direction.y == -snake.direction.y) continue;
+
+		Cell next = { head.x + direction.x, head.y + direction.y };
+		if (!inBounds(next)) continue;
+
+		int owner = mOwners[cellIndex(next)];
+		if (owner >= 0 && mSnakes[owner].body.tail() != next) continue;
+
+		int score = -(std::abs(snake.target.x - next.x) + std::abs(snake.target.y - next.y)) * 4 + snake.random.nextBelow(3);
+		if (score > bestScore) {
+			bestScore = score;
+			best = direction;
+		}
+	}
+	snake.nextDirection = best;
+}
+
+bool Arena::spawn(int index) {
+	Cell cell;
+	if (!randomFreeCell(cell)) {
+		mSnakes[index].respawnIn = 1;  // Board is crowded; try again next tick
+		return false;
+	}
+
+	ArenaSnake& snake = mSnakes[index];
+	snake.body.clear();
+	snake.body.pushHead(cell);
+	mOwners[cellIndex(cell)] = index;
+	snake.alive = true;
+	snake.target = cell;
+
+	// The player starts still and waits for input; bots set off right away
+	if (index == 0 && mConfig.hasPlayer) {
+		snake.direction = snake.nextDirection = { 0, 0 };
+	}
+	else {
+		snake.direction = snake.nextDirection = Directions[snake.random.nextBelow(4)];
+	}
+	mAliveCount++;
+	return true;
+}
+
+bool Arena::randomFreeCell(Cell& cell) {
+	for (int attempt = 0; attempt < 64; ++attempt) {
+		cell = { mRandom.nextBelow(mConfig.gridWidth), mRandom.nextBelow(mConfig.gridHeight) };
+		if (mOwners[cellIndex(cell)] < 0 && !hasFood(cell)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void Arena::addFood(const Cell& cell) {
+	mFoodIndex[cellIndex(cell)] = static_cast<int>(mFood.size());
+	mFood.push_back(cell);
+}
+
+void Arena::removeFood(const Cell& cell) {
+	int index = mFoodIndex[cellIndex(cell)];
+	if (index < 0) {
+		return;
+	}
+
+	// Swap the last piece into the gap
+	const Cell& last = mFood.back();
+	mFood[index] = last;
+	mFoodIndex[cellIndex(last)] = index;
+	mFood.pop_back();
+	mFoodIndex[cellIndex(cell)] = -1;
+}
@@ -0,0 +1,119 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include "Cell.hpp"
+#include "ParallelFor.hpp"
+#include "Random.hpp"
+#include "SnakeBody.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct ArenaConfig {
+    int gridWidth;
+    int gridHeight;
+    int snakeCount;
+    int foodCount;       // Food kept on the board at all times
+    int maxLength;       // Snakes stop growing here
+    int respawnDelay;    // Ticks a dead snake waits before coming back
+    bool hasPlayer;      // Snake 0 is steered with turn() instead of by a bot
+    std::uint64_t seed;
+    int threads;         // Zero uses every core
+};
+
+// Many snakes on one board. A shared grid records which snake covers each cell, so moving
+// every snake and resolving every collision is one linear pass over the snakes per tick,
+// however many there are. The passes are split across threads for large arenas, and the
+// outcome does not depend on how many threads are used.
+class Arena {
+public:
+    explicit Arena(const ArenaConfig& config);
+
+    // Put every snake back at a random spot and refill the food
+    void reset();
+
+    // Steer a snake, e.g. the player's; a turn that would reverse it is ignored
+    void turn(int snake, int directionX, int directionY);
+
+    // Advance every snake by one tick
+    void step();
+
+    int getGridWidth() const { return mConfig.gridWidth; }
+    int getGridHeight() const { return mConfig.gridHeight; }
+    int getSnakeCount() const { return static_cast<int>(mSnakes.size()); }
+    std::uint64_t getTick() const { return mTick; }
+    int getAliveCount() const { return mAliveCount; }
+    std::uint64_t getDeathCount() const { return mDeathCount; }
+    int getThreadCount() const { return mParallel.getThreadCount(); }
+    bool hasPlayer() const { return mConfig.hasPlayer; }
+
+    // Snake covering the cell, or -1
+    int getOwner(const Cell& cell) const { return mOwners[cellIndex(cell)]; }
+    bool hasFood(const Cell& cell) const { return mFoodIndex[cellIndex(cell)] >= 0; }
+
+    bool isAlive(int snake) const { return mSnakes[snake].alive; }
+    const SnakeBody& getBody(int snake) const { return mSnakes[snake].body; }
+    Cell getDirection(int snake) const { return mSnakes[snake].direction; }
+    int getScore(int snake) const { return mSnakes[snake].score; }
+
+private:
+    struct ArenaSnake {
+        explicit ArenaSnake(int maxLength) : body(maxLength) {}
+
+        SnakeBody body;
+        Cell direction;      // Direction of the last move; zero before the first
+        Cell nextDirection;  // Direction for the coming tick
+        bool alive;
+        int respawnIn;
+        int score;
+        Random random;       // Bot decisions
+        Cell target;         // Food the bot is heading for
+
+        // Worked out during a tick
+        Cell next;
+        bool moving;
+        bool eats;
+        bool grows;
+        bool dies;
+    };
+
+    int cellIndex(const Cell& cell) const { return cell.y * mConfig.gridWidth + cell.x; }
+    bool inBounds(const Cell& cell) const {
+        return cell.x >= 0 && cell.x < mConfig.gridWidth && cell.y >= 0 && cell.y < mConfig.gridHeight;
+    }
+
+    // Passes over a range of snakes
+    void decide(int begin, int end);
+    void plan(int begin, int end);
+    void resolve(int begin, int end);
+    void release(int begin, int end);
+    void advance(int begin, int end);
+
+    void steerBot(ArenaSnake& snake);
+    bool spawn(int snake);
+    bool randomFreeCell(Cell& cell);
+    void addFood(const Cell& cell);
+    void removeFood(const Cell& cell);
+
+private:
+    ArenaConfig mConfig;
+    std::vector<ArenaSnake> mSnakes;
+    std::vector<int> mOwners;     // Snake per cell, -1 when free
+    std::vector<int> mFoodIndex;  // Position of each cell in mFood, -1 without food
+    std::vector<Cell> mFood;
+
+    // Cells claimed by a head this tick: the tick stamp shifted left, plus 1 if claimed twice
+    std::unique_ptr<std::atomic<std::uint32_t>[]> mClaims;
+    std::uint32_t mStamp;
+
+    Random mRandom;  // Spawning and food, only used on the calling thread
+    std::uint64_t mTick;
+    int mAliveCount;
+    std::uint64_t mDeathCount;
+    ParallelFor mParallel;
+
+    static const int MinSnakesPerThread;
+};
+
+#endif // ARENA_HPP
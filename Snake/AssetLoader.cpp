@@ -0,0 +1,125 @@
+#include "AssetLoader.hpp"
+#include "EmbeddedAssets.hpp"
+#include "PerfStats.hpp"
+#include "StartupTimer.hpp"
+#include "Trace.hpp"
+#include <SDL2/SDL_image.h>
+#include <iostream>
+
+static SDL_RWops* openAsset(const char* name) {
+	const unsigned char* data;
+	std::size_t size;
+	if (!EmbeddedAssets::find(name, data, size)) {
+		return nullptr;
+	}
+	return SDL_RWFromConstMem(data, static_cast<int>(size));
+}
+
+static SDL_Surface* decodeImage(const char* name) {
+	SDL_RWops* file = openAsset(name);
+	return file ? IMG_Load_RW(file, 1) : nullptr;
+}
+
+static TTF_Font* openFont(const char* name, int pointSize) {
+	SDL_RWops* file = openAsset(name);
+	return file ? TTF_OpenFontRW(file, 1, pointSize) : nullptr;
+}
+
+
+AssetLoader::AssetLoader()
+	: mAssets()
+{
+}
+
+AssetLoader::~AssetLoader() {
+	if (mWorker.joinable()) {
+		mWorker.join();
+	}
+	release();
+}
+
+void AssetLoader::start() {
+	if (mWorker.joinable()) {
+		mWorker.join();
+	}
+	release();
+	mError.clear();
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+	decode();  // The single-threaded web build has no threads to decode on
+#else
+	mWorker = std::thread(&AssetLoader::decode, this);
+#endif
+}
+
+bool AssetLoader::finish(DecodedAssets& assets) {
+	if (mWorker.joinable()) {
+		mWorker.join();
+	}
+
+	if (!mError.empty()) {
+		std::cout << mError << std::endl;
+		release();
+		return false;
+	}
+
+	assets = mAssets;
+	mAssets = DecodedAssets();
+	return true;
+}
+
+void AssetLoader::decode() {
+	if (Trace::isEnabled()) {
+		Trace::setThreadName("Asset loader");
+	}
+	TRACE_SCOPE("decodeAssets");
+	std::uint64_t start = Trace::now();
+
+	mAssets.icon = decodeImage("Snake_Head.png");
+
+	// Pack the snake sprite sheet and the food into one atlas so a frame needs a single texture
+	SDL_Surface* snakeSurface = decodeImage("Snake.png");
+	SDL_Surface* foodSurface = decodeImage("Food.png");
+	if (snakeSurface && foodSurface) {
+		mAssets.atlas = SDL_CreateRGBSurfaceWithFormat(0, snakeSurface->w + foodSurface->w,
+			snakeSurface->h > foodSurface->h ? snakeSurface->h : foodSurface->h, 32, SDL_PIXELFORMAT_RGBA32);
+	}
+	if (mAssets.atlas) {
+		// Copy the pixels as they are, alpha included
+		SDL_SetSurfaceBlendMode(snakeSurface, SDL_BLENDMODE_NONE);
+		SDL_SetSurfaceBlendMode(foodSurface, SDL_BLENDMODE_NONE);
+
+		SDL_Rect snakeDest = { 0, 0, snakeSurface->w, snakeSurface->h };
+		SDL_Rect foodDest = { snakeSurface->w, 0, foodSurface->w, foodSurface->h };
+		SDL_BlitSurface(snakeSurface, NULL, mAssets.atlas, &snakeDest);
+		SDL_BlitSurface(foodSurface, NULL, mAssets.atlas, &foodDest);
+		mAssets.foodRect = foodDest;  // Food sprite right of the sheet
+	}
+	else {
+		mError = std::string("Unable to load sprites! SDL_image Error: ") + IMG_GetError();
+	}
+	SDL_FreeSurface(snakeSurface);
+	SDL_FreeSurface(foodSurface);
+
+	mAssets.font = openFont("BigSpace.ttf", 48);
+	if (!mAssets.font && mError.empty()) {
+		mError = std::string("Failed to load font: ") + TTF_GetError();
+	}
+#if SNAKE_PERF
+	mAssets.smallFont = openFont("BigSpace.ttf", 14);  // The overlay just goes without text if this fails
+#endif
+
+	StartupTimer::record("decode assets (worker)", start, Trace::now());
+}
+
+void AssetLoader::release() {
+	SDL_FreeSurface(mAssets.icon);
+	SDL_FreeSurface(mAssets.atlas);
+	if (mAssets.font) {
+		TTF_CloseFont(mAssets.font);
+	}
+	if (mAssets.smallFont) {
+		TTF_CloseFont(mAssets.smallFont);
+	}
+	mAssets = DecodedAssets();
+}
@@ -0,0 +1,45 @@
+#ifndef ASSET_LOADER_HPP
+#define ASSET_LOADER_HPP
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <string>
+#include <thread>
+
+struct DecodedAssets {
+    SDL_Surface* icon;    // Window icon, or null if it could not be decoded
+    SDL_Surface* atlas;   // Snake sprite sheet with the food to its right
+    SDL_Rect foodRect;    // The food's place in the atlas
+    TTF_Font* font;       // Score and game over text
+    TTF_Font* smallFont;  // Performance overlay, only in builds with SNAKE_PERF
+};
+
+// Decodes the embedded sprites and fonts on a worker thread while the window and renderer
+// are created. Surfaces and fonts can be made on any thread; only turning the atlas into a
+// texture has to wait for the renderer.
+class AssetLoader {
+public:
+    AssetLoader();
+    ~AssetLoader();  // Waits for the worker and frees anything not handed over
+
+    // SDL_ttf and SDL_image must be initialized first
+    void start();
+
+    // Wait for the worker and hand over what it decoded, which the caller then frees.
+    // Returns false, with nothing to free, if a sprite or the font could not be decoded.
+    bool finish(DecodedAssets& assets);
+
+private:
+    AssetLoader(const AssetLoader&);             // Not copyable
+    AssetLoader& operator=(const AssetLoader&);
+
+    void decode();
+    void release();
+
+private:
+    std::thread mWorker;
+    DecodedAssets mAssets;
+    std::string mError;  // Set by the worker, printed by finish
+};
+
+#endif // ASSET_LOADER_HPP
@@ -0,0 +1,29 @@
+# Compiles the assets the game loads into Snake/EmbeddedAssets.cpp, so the game starts
+# without reading files. Run it again after changing one of them:
+#
+#   cmake -P Snake/Assets/Embed.cmake
+
+set(ASSET_DIR "${CMAKE_CURRENT_LIST_DIR}")
+set(OUTPUT "${ASSET_DIR}/../EmbeddedAssets.cpp")
+set(ASSETS Snake.png Food.png Snake_Head.png BigSpace.ttf)
+
+# Sixteen bytes to a line
+set(LINE "")
+foreach(I RANGE 15)
+    string(APPEND LINE "0x[0-9a-f][0-9a-f], ")
+endforeach()
+
+set(ARRAYS "")
+set(TABLE "")
+foreach(ASSET ${ASSETS})
+    string(MAKE_C_IDENTIFIER "${ASSET}" NAME)
+    file(READ "${ASSET_DIR}/${ASSET}" HEX HEX)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1, " BYTES "${HEX}")
+    string(REGEX REPLACE "(${LINE})" "\\1\n\t" BYTES "${BYTES}")
+    string(REGEX REPLACE " \n" "\n" BYTES "${BYTES}")
+    string(REGEX REPLACE "[, \t\n]+$" "" BYTES "${BYTES}")
+    string(APPEND ARRAYS "static const unsigned char ${NAME}[] = {\n\t${BYTES}\n};\n\n")
+    string(APPEND TABLE "\t{ \"${ASSET}\", ${NAME}, sizeof(${NAME}) },\n")
+endforeach()
+
+file(WRITE "${OUTPUT}" "// Generated by Assets/Embed.cmake; do not edit.\n#include \"EmbeddedAssets.hpp\"\n#include <cstring>\n\n${ARRAYS}struct EmbeddedAsset {\n\tconst char* name;\n\tconst unsigned char* data;\n\tstd::size_t size;\n};\n\nstatic const EmbeddedAsset Assets[] = {\n${TABLE}};\n\nbool EmbeddedAssets::find(const char* name, const unsigned char*& data, std::size_t& size) {\n\tfor (const EmbeddedAsset& asset : Assets) {\n\t\tif (std::strcmp(asset.name, name) == 0) {\n\t\t\tdata = asset.data;\n\t\t\tsize = asset.size;\n\t\t\treturn true;\n\t\t}\n\t}\n\treturn false;\n}\n")
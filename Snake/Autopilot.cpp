@@ -0,0 +1,366 @@
+#include "Autopilot.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+static const Cell Directions[4] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 } };
+
+static long long nowMicroseconds() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+Autopilot::Autopilot(Strategy strategy, int budgetMicroseconds, int gridWidth, int gridHeight)
+	: mStrategy(strategy)
+	, mBudgetMicroseconds(budgetMicroseconds)
+	, mDeadline(0)
+	, mExpansions(0)
+	, mGridWidth(0)
+	, mGridHeight(0)
+	, mStamp(0)
+{
+	buildCycle(gridWidth, gridHeight);
+}
+
+void Autopilot::setBoardSize(int gridWidth, int gridHeight) {
+	if (gridWidth != mGridWidth || gridHeight != mGridHeight) {
+		buildCycle(gridWidth, gridHeight);
+	}
+}
+
+const char* Autopilot::getStrategyName(Strategy strategy) {
+	switch (strategy) {
+	case GreedyBfs: return "bfs";
+	case AStarSafe: return "astar";
+	case Hamiltonian: return "hamiltonian";
+	}
+	return "unknown";
+}
+
+bool Autopilot::parseStrategy(const char* name, Strategy& strategy) {
+	for (Strategy candidate : { GreedyBfs, AStarSafe, Hamiltonian }) {
+		if (std::strcmp(name, getStrategyName(candidate)) == 0) {
+			strategy = candidate;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+Cell Autopilot::decide(const Simulation& sim) {
+	// Building the cycle for another board is O(cells), too slow for a decision's budget
+	if (sim.getGridWidth() != mGridWidth || sim.getGridHeight() != mGridHeight) {
+		return safeMove(sim);
+	}
+
+	mDeadline = nowMicroseconds() + mBudgetMicroseconds;
+	mExpansions = 0;
+
+	// Odd by odd boards have no cycle to follow, so search instead
+	Strategy strategy = mStrategy;
+	if (strategy == Hamiltonian && mCycleNext.empty()) {
+		strategy = AStarSafe;
+	}
+
+	Cell step;
+	switch (strategy) {
+	case GreedyBfs:
+		if (findPathBfs(sim, step)) {
+			return step;
+		}
+		break;
+
+	case AStarSafe:
+		if (findPathAStar(sim, step)) {
+			// Only chase the food if the snake still has room to fit afterwards
+			Cell next = { sim.getHead().x + step.x, sim.getHead().y + step.y };
+			// A count cut short by the budget says nothing about the room, so keep the path to the food
+			int length = static_cast<int>(sim.getSnake().size());
+			int room;
+			if (!floodFill(sim, next, length, room) || room >= length) {
+				return step;
+			}
+		}
+		if (!isPastDeadline()) {
+			// Otherwise head for the most open space, unless the counts are cut short
+			Cell best = { 0, 0 };
+			int bestRoom = -1;
+			bool isComplete = true;
+			for (const Cell& direction : Directions) {
+				Cell next = { sim.getHead().x + direction.x, sim.getHead().y + direction.y };
+				if (direction.x == -sim.getDirectionX() && direction.y == -sim.getDirectionY()) continue;
+				if (!isFree(sim, next)) continue;
+
+				int room;
+				if (!floodFill(sim, next, static_cast<int>(sim.getSnake().size()) + 1, room)) {
+					isComplete = false;
+					break;
+				}
+				if (room > bestRoom) {
+					bestRoom = room;
+					best = direction;
+				}
+			}
+			if (isComplete && bestRoom >= 0) {
+				return best;
+			}
+		}
+		break;
+
+	case Hamiltonian:
+		break;
+	}
+
+	return cycleMove(sim);
+}
+
+
+bool Autopilot::isFree(const Simulation& sim, const Cell& cell) const {
+	if (cell.x < 0 || cell.x >= sim.getGridWidth() || cell.y < 0 || cell.y >= sim.getGridHeight()) {
+		return false;
+	}
+	// The tail moves out of the way on the next tick
+	return !sim.isOccupied(cell) || cell == sim.getSnake().tail();
+}
+
+// Start a search with a fresh visited stamp, clearing the stamps when the counter wraps
+void Autopilot::newSearch() {
+	if (++mStamp == 0) {
+		std::fill(mVisited.begin(), mVisited.end(), 0u);
+		mStamp = 1;
+	}
+}
+
+// Checked every few expansions so the clock is not read per node
+bool Autopilot::outOfTime() {
+	return mBudgetMicroseconds > 0 && (++mExpansions & 63) == 0 && nowMicroseconds() > mDeadline;
+}
+
+// Reads the clock every time, for checks between searches
+bool Autopilot::isPastDeadline() const {
+	return mBudgetMicroseconds > 0 && nowMicroseconds() > mDeadline;
+}
+
+Cell Autopilot::firstStepTo(const Simulation& sim, int target) const {
+	int headIndex = sim.getHead().y * mGridWidth + sim.getHead().x;
+
+	int cell = target;
+	while (mParent[cell] != headIndex) {
+		cell = mParent[cell];
+	}
+	return { cell % mGridWidth - sim.getHead().x, cell / mGridWidth - sim.getHead().y };
+}
+
+
+bool Autopilot::findPathBfs(const Simulation& sim, Cell& firstStep) {
+	const Cell& head = sim.getHead();
+	int headIndex = head.y * mGridWidth + head.x;
+	int foodIndex = sim.getFood().y * mGridWidth + sim.getFood().x;
+
+	newSearch();
+	mQueue.clear();
+	mQueue.push_back(headIndex);
+	mVisited[headIndex] = mStamp;
+
+	for (std::size_t front = 0; front < mQueue.size(); ++front) {
+		if (outOfTime()) {
+			return false;
+		}
+
+		int current = mQueue[front];
+		Cell cell = { current % mGridWidth, current / mGridWidth };
+
+		for (const Cell& direction : Directions) {
+			if (current == headIndex && direction.x == -sim.getDirectionX() && direction.y == -sim.getDirectionY()) continue;
+
+			Cell next = { cell.x + direction.x, cell.y + direction.y };
+			if (!isFree(sim, next)) continue;
+
+			int nextIndex = next.y * mGridWidth + next.x;
+			if (mVisited[nextIndex] == mStamp) continue;
+
+			mVisited[nextIndex] = mStamp;
+			mParent[nextIndex] = current;
+			if (nextIndex == foodIndex) {
+				firstStep = firstStepTo(sim, foodIndex);
+				return true;
+			}
+			mQueue.push_back(nextIndex);
+		}
+	}
+	return false;
+}
+
+bool Autopilot::findPathAStar(const Simulation& sim, Cell& firstStep) {
+	const Cell& head = sim.getHead();
+	const Cell& food = sim.getFood();
+	int headIndex = head.y * mGridWidth + head.x;
+	int foodIndex = food.y * mGridWidth + food.x;
+
+	newSearch();
+	mOpen.clear();
+	mVisited[headIndex] = mStamp;
+	mCost[headIndex] = 0;
+	mOpen.push_back({ -(std::abs(food.x - head.x) + std::abs(food.y - head.y)), headIndex });
+
+	while (!mOpen.empty()) {
+		if (outOfTime()) {
+			return false;
+		}
+
+		std::pop_heap(mOpen.begin(), mOpen.end());
+		int current = mOpen.back().second;
+		mOpen.pop_back();
+
+		if (current == foodIndex) {
+			firstStep = firstStepTo(sim, foodIndex);
+			return true;
+		}
+
+		Cell cell = { current % mGridWidth, current / mGridWidth };
+		for (const Cell& direction : Directions) {
+			if (current == headIndex && direction.x == -sim.getDirectionX() && direction.y == -sim.getDirectionY()) continue;
+
+			Cell next = { cell.x + direction.x, cell.y + direction.y };
+			if (!isFree(sim, next)) continue;
+
+			int nextIndex = next.y * mGridWidth + next.x;
+			int cost = mCost[current] + 1;
+			if (mVisited[nextIndex] == mStamp && mCost[nextIndex] <= cost) continue;
+
+			mVisited[nextIndex] = mStamp;
+			mCost[nextIndex] = cost;
+			mParent[nextIndex] = current;
+
+			int estimate = cost + std::abs(food.x - next.x) + std::abs(food.y - next.y);
+			mOpen.push_back({ -estimate, nextIndex });
+			std::push_heap(mOpen.begin(), mOpen.end());
+		}
+	}
+	return false;
+}
+
+bool Autopilot::floodFill(const Simulation& sim, const Cell& start, int limit, int& room) {
+	room = 0;
+	if (!isFree(sim, start)) {
+		return true;
+	}
+
+	int startIndex = start.y * mGridWidth + start.x;
+	int headIndex = sim.getHead().y * mGridWidth + sim.getHead().x;
+
+	newSearch();
+	mQueue.clear();
+	mQueue.push_back(startIndex);
+	mVisited[startIndex] = mStamp;
+	mVisited[headIndex] = mStamp;  // The head becomes body once the snake moves
+
+	bool isComplete = true;
+	for (std::size_t front = 0; front < mQueue.size() && static_cast<int>(mQueue.size()) < limit; ++front) {
+		if (outOfTime()) {
+			isComplete = false;
+			break;
+		}
+
+		int current = mQueue[front];
+		Cell cell = { current % mGridWidth, current / mGridWidth };
+		for (const Cell& direction : Directions) {
+			Cell next = { cell.x + direction.x, cell.y + direction.y };
+			if (!isFree(sim, next)) continue;
+
+			int nextIndex = next.y * mGridWidth + next.x;
+			if (mVisited[nextIndex] == mStamp) continue;
+
+			mVisited[nextIndex] = mStamp;
+			mQueue.push_back(nextIndex);
+		}
+	}
+	room = static_cast<int>(mQueue.size());
+	return isComplete;
+}
+
+
+Cell Autopilot::cycleMove(const Simulation& sim) {
+	if (!mCycleNext.empty()) {
+		const Cell& head = sim.getHead();
+		int next = mCycleNext[head.y * mGridWidth + head.x];
+		Cell step = { next % mGridWidth - head.x, next / mGridWidth - head.y };
+		Cell target = { head.x + step.x, head.y + step.y };
+
+		bool reverses = step.x == -sim.getDirectionX() && step.y == -sim.getDirectionY();
+		if (!reverses && isFree(sim, target)) {
+			return step;
+		}
+	}
+	return safeMove(sim);
+}
+
+Cell Autopilot::safeMove(const Simulation& sim) {
+	for (const Cell& direction : Directions) {
+		if (direction.x == -sim.getDirectionX() && direction.y == -sim.getDirectionY()) continue;
+
+		Cell next = { sim.getHead().x + direction.x, sim.getHead().y + direction.y };
+		if (isFree(sim, next)) {
+			return direction;
+		}
+	}
+
+	// Boxed in; keep going
+	if (sim.getDirectionX() != 0 || sim.getDirectionY() != 0) {
+		return { sim.getDirectionX(), sim.getDirectionY() };
+	}
+	return Directions[0];
+}
+
+
+// Serpentine through every column but the first, then return up the first column.
+// This needs an even number of rows; a board with an odd row count but even column
+// count is walked transposed. Odd by odd boards have no Hamiltonian cycle at all.
+void Autopilot::buildCycle(int gridWidth, int gridHeight) {
+	mGridWidth = gridWidth;
+	mGridHeight = gridHeight;
+
+	std::size_t cellCount = static_cast<std::size_t>(gridWidth) * gridHeight;
+	mVisited.assign(cellCount, 0);
+	mStamp = 0;
+	mParent.assign(cellCount, -1);
+	mCost.assign(cellCount, 0);
+	mCycleNext.clear();
+
+	bool transpose = (gridHeight % 2 != 0);
+	int columns = transpose ? gridHeight : gridWidth;
+	int rows = transpose ? gridWidth : gridHeight;
+	if (rows % 2 != 0 || columns < 2) {
+		return;
+	}
+
+	std::vector<Cell> order;
+	order.reserve(cellCount);
+	for (int x = 0; x < columns; ++x) {
+		order.push_back({ x, 0 });
+	}
+	for (int y = 1; y < rows; ++y) {
+		if (y % 2 == 1) {
+			for (int x = columns - 1; x >= 1; --x) order.push_back({ x, y });
+		}
+		else {
+			for (int x = 1; x < columns; ++x) order.push_back({ x, y });
+		}
+	}
+	for (int y = rows - 1; y >= 1; --y) {
+		order.push_back({ 0, y });
+	}
+
+	mCycleNext.assign(cellCount, 0);
+	for (std::size_t i = 0; i < order.size(); ++i) {
+		Cell from = order[i];
+		Cell to = order[(i + 1) % order.size()];
+		if (transpose) {
+			std::swap(from.x, from.y);
+			std::swap(to.x, to.y);
+		}
+		mCycleNext[from.y * gridWidth + from.x] = to.y * gridWidth + to.x;
+	}
+}
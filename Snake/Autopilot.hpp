@@ -0,0 +1,72 @@
+#ifndef AUTOPILOT_HPP
+#define AUTOPILOT_HPP
+
+#include "Cell.hpp"
+#include "Simulation.hpp"
+#include <vector>
+
+// Picks the snake's next move for unattended play. Each decision is limited to a time budget;
+// a search that runs out of time falls back to the cheap Hamiltonian-cycle move.
+class Autopilot {
+public:
+    enum Strategy {
+        GreedyBfs,    // Shortest path to the food, avoiding the body
+        AStarSafe,    // A* to the food, only taken if the snake keeps enough room afterwards
+        Hamiltonian   // Follow a cycle through every cell; never dies, but slow to eat
+    };
+
+    // A budget of zero or less never cuts a search short, which keeps decisions reproducible.
+    // The cycle and search space for the board are built here, outside any decision's budget.
+    Autopilot(Strategy strategy, int budgetMicroseconds, int gridWidth, int gridHeight);
+
+    // Direction to move in next, as a unit vector. On a board of another size than the one
+    // set up this only picks a safe neighbour; call setBoardSize first.
+    Cell decide(const Simulation& sim);
+
+    void setBoardSize(int gridWidth, int gridHeight);
+
+    Strategy getStrategy() const { return mStrategy; }
+    void setStrategy(Strategy strategy) { mStrategy = strategy; }
+
+    static const char* getStrategyName(Strategy strategy);
+    static bool parseStrategy(const char* name, Strategy& strategy);
+
+private:
+    // Both return false if the food cannot be reached or the budget ran out
+    bool findPathBfs(const Simulation& sim, Cell& firstStep);
+    bool findPathAStar(const Simulation& sim, Cell& firstStep);
+
+    // Count the free cells reachable from start into room, stopping early once limit is
+    // reached. Returns false if the budget ran out first, when room is only a lower bound.
+    bool floodFill(const Simulation& sim, const Cell& start, int limit, int& room);
+
+    // Follow the precomputed cycle, or any safe move when the board has none
+    Cell cycleMove(const Simulation& sim);
+    Cell safeMove(const Simulation& sim);
+
+    void buildCycle(int gridWidth, int gridHeight);
+    bool isFree(const Simulation& sim, const Cell& cell) const;
+    void newSearch();
+    bool outOfTime();
+    bool isPastDeadline() const;
+    Cell firstStepTo(const Simulation& sim, int target) const;
+
+private:
+    Strategy mStrategy;
+    int mBudgetMicroseconds;
+    long long mDeadline;  // Steady clock time in microseconds
+    int mExpansions;
+
+    int mGridWidth, mGridHeight;
+    std::vector<int> mCycleNext;  // Next cell on the Hamiltonian cycle, empty if the board has none
+
+    // Search scratch space, kept between decisions to avoid allocating
+    std::vector<unsigned> mVisited;  // Stamp per cell, equal to mStamp when visited this search
+    unsigned mStamp;
+    std::vector<int> mParent;
+    std::vector<int> mCost;
+    std::vector<int> mQueue;
+    std::vector<std::pair<int, int>> mOpen;  // (-priority, cell) max-heap
+};
+
+#endif // AUTOPILOT_HPP
@@ -0,0 +1,401 @@
+// Micro-benchmarks for the hot paths: ticking, food placement, arena ticks and (with SDL) rendering.
+// Prints one JSON document so results can be stored and compared between releases.
+//
+//   snake_bench [--quick] [--filter tick|food|fixed|env|arena|render] > results.json
+
+#include "Arena.hpp"
+#include "FixedSimulation.hpp"
+#include "Random.hpp"
+#include "VectorEnv.hpp"
+#include "Simulation.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef SNAKE_HAVE_SDL
+#include "Game.hpp"
+#endif
+
+struct BenchResult {
+	std::string name;
+	int gridWidth;
+	int gridHeight;
+	int length;           // Snake length, filled cells for food placement, snakes in an arena or boards in an env
+	std::uint64_t iterations;
+	double nanosecondsPerOp;
+};
+
+// Serpentine walk over the board: right along even rows, left along odd ones, then back up
+// the first column. Boards with an even row count make it a closed cycle the snake can
+// follow forever.
+static int cycleIndex(int x, int y, int width, int height) {
+	if (x == 0) return y == 0 ? 0 : width * height - y;
+	return y % 2 == 0 ? y * (width - 1) + x : y * (width - 1) + (width - x);
+}
+
+static std::vector<Cell> buildCycle(int width, int height) {
+	std::vector<Cell> cycle(static_cast<std::size_t>(width) * height);
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			cycle[cycleIndex(x, y, width, height)] = { x, y };
+		}
+	}
+	return cycle;
+}
+
+// Lay a snake of the given length along the cycle, head at cycle position start
+template <typename Sim>
+static void laySnake(Sim& sim, const std::vector<Cell>& cycle, std::size_t start, int length) {
+	std::vector<Cell> cells(length);
+	for (int i = 0; i < length; ++i) {
+		cells[i] = cycle[(start + cycle.size() - i) % cycle.size()];
+	}
+	const Cell& head = cells[0];
+	const Cell& next = cycle[(start + 1) % cycle.size()];
+	sim.setSnake(cells, next.x - head.x, next.y - head.y);
+}
+
+template <typename Sim>
+static void steer(Sim& sim, const Cell& from, const Cell& to) {
+	int x = to.x - from.x;
+	int y = to.y - from.y;
+	if (x == sim.getDirectionX() && y == sim.getDirectionY()) return;
+
+	if (y < 0) sim.turnUp();
+	else if (y > 0) sim.turnDown();
+	else if (x < 0) sim.turnLeft();
+	else sim.turnRight();
+}
+
+// Position of each board cell along the cycle
+static std::vector<int> cyclePositions(const std::vector<Cell>& cycle, int width) {
+	std::vector<int> positions(cycle.size());
+	for (std::size_t i = 0; i < cycle.size(); ++i) {
+		positions[cycle[i].y * width + cycle[i].x] = static_cast<int>(i);
+	}
+	return positions;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Cost of Simulation::step for a snake of a given length following the cycle. The snake
+// is laid out again every lap so eating does not change its length much.
+static BenchResult benchTick(int width, int height, int length, std::uint64_t ticks) {
+	Simulation sim(width, height, 1);
+	std::vector<Cell> cycle = buildCycle(width, height);
+	std::vector<int> positions = cyclePositions(cycle, width);
+
+	std::size_t start = static_cast<std::size_t>(length - 1);
+	laySnake(sim, cycle, start, length);
+
+	auto begin = std::chrono::steady_clock::now();
+	double setupSeconds = 0.0;
+	for (std::uint64_t i = 0; i < ticks; ++i) {
+		const Cell& head = sim.getHead();
+		steer(sim, head, cycle[(positions[head.y * width + head.x] + 1) % cycle.size()]);
+		sim.step();
+
+		if (sim.isGameOver() || sim.getSnake().size() > static_cast<std::size_t>(length) + length / 8 + 8) {
+			auto setup = std::chrono::steady_clock::now();
+			laySnake(sim, cycle, start, length);
+			setupSeconds += secondsSince(setup);
+		}
+	}
+	double seconds = secondsSince(begin) - setupSeconds;
+
+	return { "tick", width, height, length, ticks, seconds * 1e9 / ticks };
+}
+
+// Cost of placing food on a board with the given fraction of cells taken
+static BenchResult benchFood(int width, int height, double fill, std::uint64_t placements) {
+	Simulation sim(width, height, 1);
+	std::vector<Cell> cycle = buildCycle(width, height);
+	int length = static_cast<int>(cycle.size() * fill);
+	laySnake(sim, cycle, static_cast<std::size_t>(length - 1), length);
+
+	auto begin = std::chrono::steady_clock::now();
+	for (std::uint64_t i = 0; i < placements; ++i) {
+		sim.placeFood();
+	}
+	double seconds = secondsSince(begin);
+
+	return { "food", width, height, length, placements, seconds * 1e9 / placements };
+}
+
+// Simulation::step and placeFood against FixedSimulation on the same board, ticking a snake of
+// a given length around the cycle or placing food with a given fraction of the board taken
+template <int Width, int Height>
+static void benchFixed(std::vector<BenchResult>& results, std::uint64_t scale) {
+	std::vector<Cell> cycle = buildCycle(Width, Height);
+	std::vector<int> positions = cyclePositions(cycle, Width);
+	std::unique_ptr<FixedSimulation<Width, Height>> sim(new FixedSimulation<Width, Height>(1));  // Too big for the stack on large boards
+
+	const int lengths[] = { 1, 100, 10000 };
+	for (int length : lengths) {
+		if (length > Width * Height / 2) {
+			continue;
+		}
+		results.push_back(benchTick(Width, Height, length, 500000 * scale));
+
+		std::uint64_t ticks = 500000 * scale;
+		std::size_t start = static_cast<std::size_t>(length - 1);
+		laySnake(*sim, cycle, start, length);
+
+		auto begin = std::chrono::steady_clock::now();
+		double setupSeconds = 0.0;
+		for (std::uint64_t i = 0; i < ticks; ++i) {
+			const Cell& head = sim->getHead();
+			steer(*sim, head, cycle[(positions[head.y * Width + head.x] + 1) % cycle.size()]);
+			sim->step();
+
+			if (sim->isGameOver() || sim->getLength() > length + length / 8 + 8) {
+				auto setup = std::chrono::steady_clock::now();
+				laySnake(*sim, cycle, start, length);
+				setupSeconds += secondsSince(setup);
+			}
+		}
+		double seconds = secondsSince(begin) - setupSeconds;
+		results.push_back({ "fixed-tick", Width, Height, length, ticks, seconds * 1e9 / ticks });
+	}
+
+	const double fills[] = { 0.10, 0.50, 0.99 };
+	for (double fill : fills) {
+		std::uint64_t placements = (fill > 0.9 ? 2000 : 200000) * scale;
+		results.push_back(benchFood(Width, Height, fill, placements));
+
+		int length = static_cast<int>(cycle.size() * fill);
+		laySnake(*sim, cycle, static_cast<std::size_t>(length - 1), length);
+
+		auto begin = std::chrono::steady_clock::now();
+		for (std::uint64_t i = 0; i < placements; ++i) {
+			sim->placeFood();
+		}
+		double seconds = secondsSince(begin);
+		results.push_back({ "fixed-food", Width, Height, length, placements, seconds * 1e9 / placements });
+	}
+}
+
+// Play the same games on Simulation and FixedSimulation and count the games where they differ
+// at any tick. Half of them start from a snake that covers most of the board, so food placement
+// also takes the scan over the free cells.
+template <int Width, int Height>
+static std::uint64_t verifyFixed(std::uint64_t games) {
+	std::vector<Cell> cycle = buildCycle(Width, Height);
+	std::unique_ptr<FixedSimulation<Width, Height>> fixed(new FixedSimulation<Width, Height>());
+	Simulation sim(Width, Height);
+	Random turns(Width * 1000 + Height);
+
+	std::uint64_t mismatches = 0;
+	for (std::uint64_t game = 0; game < games; ++game) {
+		sim.reset(game);
+		fixed->reset(game);
+		if (game % 2 == 1) {
+			int length = static_cast<int>(cycle.size()) - 2 - static_cast<int>(game % 16);
+			laySnake(sim, cycle, static_cast<std::size_t>(length - 1), length);
+			laySnake(*fixed, cycle, static_cast<std::size_t>(length - 1), length);
+		}
+
+		bool same = true;
+		for (int tick = 0; same && !sim.isGameOver() && tick < 20 * Width * Height; ++tick) {
+			// Mostly go straight, otherwise turn at random, which also hits walls and the body
+			int turn = turns.nextBelow(8);
+			if (turn == 0) { sim.turnUp(); fixed->turnUp(); }
+			else if (turn == 1) { sim.turnDown(); fixed->turnDown(); }
+			else if (turn == 2) { sim.turnLeft(); fixed->turnLeft(); }
+			else if (turn == 3) { sim.turnRight(); fixed->turnRight(); }
+			sim.step();
+			fixed->step();
+
+			same = sim.isGameOver() == fixed->isGameOver() && sim.getOutcome() == fixed->getOutcome() &&
+				sim.getScore() == fixed->getScore() && sim.getTick() == fixed->getTick() &&
+				sim.getTimePerTick() == fixed->getTimePerTick() && sim.getHead() == fixed->getHead() &&
+				sim.getFood() == fixed->getFood() && sim.getSnake().size() == static_cast<std::size_t>(fixed->getLength()) &&
+				sim.getSnake().tail() == fixed->getSegment(fixed->getLength() - 1);
+		}
+		if (!same) {
+			mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+// Cost of stepping one board of a VectorEnv with random actions, on one thread or every core
+static BenchResult benchEnv(int width, int height, int envCount, int threads, std::uint64_t steps) {
+	VectorEnvConfig config = { envCount, width, height, 1, threads };
+	VectorEnv env(config);
+	std::vector<std::uint8_t> observations(static_cast<std::size_t>(envCount) * env.getObservationSize());
+	std::vector<float> rewards(envCount);
+	std::vector<std::uint8_t> terminals(envCount), truncations(envCount);
+
+	// A few steps' worth of actions, reused in turn
+	Random random(1);
+	std::vector<std::int32_t> actions(static_cast<std::size_t>(envCount) * 16);
+	for (std::int32_t& action : actions) {
+		action = random.nextBelow(VectorEnv::Straight + 1);
+	}
+
+	env.reset(observations.data());
+	auto begin = std::chrono::steady_clock::now();
+	for (std::uint64_t i = 0; i < steps; ++i) {
+		env.step(&actions[(i % 16) * envCount], observations.data(), rewards.data(), terminals.data(), truncations.data());
+	}
+	double seconds = secondsSince(begin);
+
+	return { threads == 1 ? "env" : "env-parallel", width, height, envCount, steps * envCount, seconds * 1e9 / (steps * envCount) };
+}
+
+// Cost of one arena tick with every snake run by a bot, on every core
+static BenchResult benchArena(int width, int height, int snakes, std::uint64_t ticks) {
+	ArenaConfig config = { width, height, snakes, snakes, 64, 20, false, 1, 0 };
+	Arena arena(config);
+
+	auto begin = std::chrono::steady_clock::now();
+	for (std::uint64_t i = 0; i < ticks; ++i) {
+		arena.step();
+	}
+	double seconds = secondsSince(begin);
+
+	return { "arena", width, height, snakes, ticks, seconds * 1e9 / ticks };
+}
+
+#ifdef SNAKE_HAVE_SDL
+// Cost of drawing a frame through the software renderer into an offscreen surface. With dirty
+// rectangles the snake moves a cell every frame, or there would be nothing to draw at all.
+static bool benchRender(int width, int height, int length, bool dirtyRects, std::uint64_t frames, BenchResult& result) {
+	SDL_Surface* target = SDL_CreateRGBSurfaceWithFormat(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, SDL_PIXELFORMAT_RGBA32);
+	if (!target) {
+		return false;
+	}
+
+	Game* game = new Game(width, height);
+	game->setDirtyRects(dirtyRects);
+	bool ready = game->initOffscreen(target);
+	if (ready) {
+		Simulation& sim = game->getSimulation();
+		std::vector<Cell> cycle = buildCycle(width, height);
+		std::vector<int> positions = cyclePositions(cycle, width);
+		laySnake(sim, cycle, static_cast<std::size_t>(length - 1), length);
+
+		auto begin = std::chrono::steady_clock::now();
+		for (std::uint64_t i = 0; i < frames; ++i) {
+			if (dirtyRects) {
+				const Cell& head = sim.getHead();
+				steer(sim, head, cycle[(positions[head.y * width + head.x] + 1) % cycle.size()]);
+				sim.step();
+				if (sim.isGameOver()) {
+					laySnake(sim, cycle, static_cast<std::size_t>(length - 1), length);
+				}
+			}
+			game->render(static_cast<float>(i % 8) / 8.0f);
+		}
+		double seconds = secondsSince(begin);
+		result = { dirtyRects ? "render-dirty" : "render", width, height, length, frames, seconds * 1e9 / frames };
+	}
+
+	game->clean();
+	delete game;
+	SDL_FreeSurface(target);
+	return ready;
+}
+#endif
+
+int main(int argc, char* argv[]) {
+	bool quick = false;
+	const char* filter = nullptr;
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--quick") == 0) {
+			quick = true;
+		}
+		else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+			filter = argv[++i];
+		}
+	}
+	std::uint64_t scale = quick ? 1 : 20;
+
+	std::vector<BenchResult> results;
+	auto wanted = [filter](const char* name) { return !filter || std::strcmp(filter, name) == 0; };
+
+	if (wanted("tick")) {
+		const int boards[][2] = { { 32, 32 }, { 256, 256 }, { 2048, 2048 } };
+		const int lengths[] = { 1, 100, 10000, 1000000 };
+		for (const auto& board : boards) {
+			for (int length : lengths) {
+				if (length <= board[0] * board[1] / 2) {
+					results.push_back(benchTick(board[0], board[1], length, 500000 * scale));
+				}
+			}
+		}
+	}
+
+	if (wanted("food")) {
+		const int boards[][2] = { { 32, 32 }, { 256, 256 } };
+		const double fills[] = { 0.10, 0.50, 0.99 };
+		for (const auto& board : boards) {
+			for (double fill : fills) {
+				std::uint64_t placements = (fill > 0.9 ? 2000 : 200000) * scale;
+				results.push_back(benchFood(board[0], board[1], fill, placements));
+			}
+		}
+	}
+
+	// Games where FixedSimulation did not match Simulation; any at all is a bug
+	std::uint64_t fixedMismatches = 0;
+	if (wanted("fixed")) {
+		std::uint64_t games = 50 * scale;
+		fixedMismatches = verifyFixed<19, 12>(games) + verifyFixed<32, 32>(games) + verifyFixed<7, 6>(games);
+		benchFixed<19, 12>(results, scale);  // The default board
+		benchFixed<32, 32>(results, scale);
+		benchFixed<256, 256>(results, scale);
+	}
+
+	if (wanted("env")) {
+		const int boards[][2] = { { 19, 12 }, { 64, 64 } };
+		for (const auto& board : boards) {
+			results.push_back(benchEnv(board[0], board[1], 1024, 1, 50 * scale));
+			results.push_back(benchEnv(board[0], board[1], 1024, 0, 50 * scale));
+		}
+	}
+
+	if (wanted("arena")) {
+		const int arenas[][3] = { { 256, 256, 100 }, { 1024, 1024, 2000 }, { 4096, 4096, 50000 } };
+		for (const auto& arena : arenas) {
+			results.push_back(benchArena(arena[0], arena[1], arena[2], 100 * scale));
+		}
+	}
+
+	bool renderSkipped = false;
+	if (wanted("render")) {
+#ifdef SNAKE_HAVE_SDL
+		const int boards[][3] = { { GRID_WIDTH, GRID_HEIGHT, 20 }, { 256, 256, 5000 } };
+		for (const auto& board : boards) {
+			for (int dirtyRects = 0; dirtyRects < 2; ++dirtyRects) {
+				BenchResult result;
+				if (benchRender(board[0], board[1], board[2], dirtyRects != 0, 50 * scale, result)) {
+					results.push_back(result);
+				}
+				else {
+					renderSkipped = true;
+				}
+			}
+		}
+#else
+		renderSkipped = true;  // Built without SDL
+#endif
+	}
+
+	std::printf("{\n  \"renderSkipped\": %s,\n  \"fixedMismatches\": %llu,\n  \"benchmarks\": [\n", renderSkipped ? "true" : "false",
+		static_cast<unsigned long long>(fixedMismatches));
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const BenchResult& r = results[i];
+		std::printf("    { \"name\": \"%s\", \"board\": \"%dx%d\", \"length\": %d, \"iterations\": %llu, \"nsPerOp\": %.2f }%s\n",
+			r.name.c_str(), r.gridWidth, r.gridHeight, r.length, static_cast<unsigned long long>(r.iterations),
+			r.nanosecondsPerOp, i + 1 < results.size() ? "," : "");
+	}
+	std::printf("  ]\n}\n");
+	return fixedMismatches == 0 ? 0 : 1;
+}
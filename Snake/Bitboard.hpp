@@ -0,0 +1,120 @@
+#ifndef BITBOARD_HPP
+#define BITBOARD_HPP
+
+#include <array>
+#include <cstdint>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+// Bits set in a word
+inline int popCount64(std::uint64_t word) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<int>(__popcnt64(word));
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<int>((word * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+// Position of the lowest set bit; word must not be zero
+inline int lowestBit64(std::uint64_t word) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long bit;
+    _BitScanForward64(&bit, word);
+    return static_cast<int>(bit);
+#else
+    int bit = 0;
+    while ((word & 1) == 0) {
+        word >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// Position of the n-th set bit, counting from zero; the word must have more than n bits set
+inline int selectBit64(std::uint64_t word, int n) {
+#if defined(__BMI2__)
+    return lowestBit64(_pdep_u64(1ull << n, word));
+#else
+    // Halve the range by popcount down to a byte, then step through what is left
+    int bit = 0;
+    for (int width = 32; width >= 8; width /= 2) {
+        std::uint64_t low = word & ((1ull << width) - 1);
+        int count = popCount64(low);
+        if (n >= count) {
+            n -= count;
+            word >>= width;
+            bit += width;
+        }
+        else {
+            word = low;
+        }
+    }
+    for (; n > 0; --n) {
+        word &= word - 1;
+    }
+    return bit + lowestBit64(word);
+#endif
+}
+
+// One bit per board cell, sized at compile time. The bits past the last cell are kept set,
+// so they never count as clear cells.
+template <int CellCount>
+class Bitboard {
+    static_assert(CellCount > 0, "A bitboard needs at least one cell");
+
+public:
+    static const int WordCount = (CellCount + 63) / 64;
+
+    Bitboard() { clear(); }
+
+    // Clear every cell
+    void clear() {
+        mWords.fill(0);
+        if (CellCount % 64 != 0) {
+            mWords[WordCount - 1] = ~0ull << (CellCount % 64);
+        }
+    }
+
+    bool test(int cell) const { return ((mWords[cell >> 6] >> (cell & 63)) & 1) != 0; }
+    void set(int cell) { mWords[cell >> 6] |= 1ull << (cell & 63); }
+    void reset(int cell) { mWords[cell >> 6] &= ~(1ull << (cell & 63)); }
+
+    int countClear() const {
+        int count = 0;
+        for (int i = 0; i < WordCount; ++i) {
+            count += popCount64(~mWords[i]);
+        }
+        return count;
+    }
+
+    // The n-th clear cell in board order, or -1 if there are not that many
+    int findClear(int n) const {
+        for (int i = 0; i < WordCount; ++i) {
+            std::uint64_t clear = ~mWords[i];
+            int count = popCount64(clear);
+            if (n < count) {
+                return i * 64 + selectBit64(clear, n);
+            }
+            n -= count;
+        }
+        return -1;
+    }
+
+private:
+    std::array<std::uint64_t, WordCount> mWords;
+};
+
+#endif // BITBOARD_HPP
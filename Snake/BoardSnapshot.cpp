@@ -0,0 +1,69 @@
+#include "BoardSnapshot.hpp"
+#include <algorithm>
+
+
+BoardSnapshot::BoardSnapshot()
+	: head()
+	, previousHead()
+	, food()
+	, directionX(0)
+	, directionY(0)
+	, score(0)
+	, isGameOver(false)
+	, hasWon(false)
+	, tick(0)
+	, timePerTick(Simulation::InitialTimePerTick)
+	, tickTime(std::chrono::steady_clock::now())
+	, isMoving(false)
+	, snapToTick(false)
+	, ticksPlayed(0)
+	, updateSeconds(0.0)
+{
+}
+
+void BoardSnapshot::capture(const Simulation& sim, int firstX, int firstY, int lastX, int lastY) {
+	firstX = std::max(firstX, 0);
+	firstY = std::max(firstY, 0);
+	lastX = std::min(lastX, sim.getGridWidth() - 1);
+	lastY = std::min(lastY, sim.getGridHeight() - 1);
+
+	// Walk the snake if it is shorter than the window, otherwise look the window's cells up
+	// in the board's occupancy instead
+	segments.clear();
+	const SnakeBody& snake = sim.getSnake();
+	if (firstX <= lastX && firstY <= lastY) {
+		std::size_t windowCells = static_cast<std::size_t>(lastX - firstX + 1) * (lastY - firstY + 1);
+		if (snake.size() <= windowCells) {
+			for (std::size_t i = 0; i < snake.size(); ++i) {
+				const Cell& cell = snake[i];
+				if (cell.x >= firstX && cell.x <= lastX && cell.y >= firstY && cell.y <= lastY) {
+					BoardSegment segment = { static_cast<int>(i), cell, sim.getPreviousPosition(i) };
+					segments.push_back(segment);
+				}
+			}
+		}
+		else {
+			for (int y = firstY; y <= lastY; ++y) {
+				for (int x = firstX; x <= lastX; ++x) {
+					Cell cell = { x, y };
+					int index = sim.getSegmentIndex(cell);
+					if (index >= 0) {
+						BoardSegment segment = { index, cell, sim.getPreviousPosition(index) };
+						segments.push_back(segment);
+					}
+				}
+			}
+		}
+	}
+
+	head = snake.head();
+	previousHead = sim.getPreviousPosition(0);
+	food = sim.getFood();
+	directionX = sim.getDirectionX();
+	directionY = sim.getDirectionY();
+	score = sim.getScore();
+	isGameOver = sim.isGameOver();
+	hasWon = sim.hasWon();
+	tick = sim.getTick();
+	timePerTick = sim.getTimePerTick();
+}
@@ -0,0 +1,44 @@
+#ifndef BOARD_SNAPSHOT_HPP
+#define BOARD_SNAPSHOT_HPP
+
+#include "Cell.hpp"
+#include "Simulation.hpp"
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// One segment as drawn: where it is and where it was before the last tick
+struct BoardSegment {
+    int index;  // Counted from the head
+    Cell cell;
+    Cell from;
+};
+
+// Everything needed to draw one tick of a Simulation, copied out of it so the game can be
+// stepped on one thread and drawn on another. Only the segments inside a window of the board
+// are kept, so taking a snapshot costs the same however long the snake is.
+struct BoardSnapshot {
+    BoardSnapshot();
+
+    // Copy the game, keeping the segments inside the given cells (inclusive, clamped to the board)
+    void capture(const Simulation& sim, int firstX, int firstY, int lastX, int lastY);
+
+    std::vector<BoardSegment> segments;  // In the window, in drawing order
+    Cell head, previousHead;
+    Cell food;
+    int directionX, directionY;
+    int score;
+    bool isGameOver;
+    bool hasWon;
+    std::uint64_t tick;
+    double timePerTick;
+
+    // Filled in by whoever steps the game
+    std::chrono::steady_clock::time_point tickTime;  // When the tick shown here was due
+    bool isMoving;                                   // The next tick will move the snake
+    bool snapToTick;                                 // Draw at whole ticks, e.g. while fast-forwarding
+    std::uint64_t ticksPlayed;                       // Running totals, for the performance overlay
+    double updateSeconds;
+};
+
+#endif // BOARD_SNAPSHOT_HPP
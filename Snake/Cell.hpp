@@ -0,0 +1,13 @@
+#ifndef CELL_HPP
+#define CELL_HPP
+
+// A position on the board, in cells
+struct Cell {
+    int x;
+    int y;
+
+    bool operator==(const Cell& other) const { return x == other.x && y == other.y; }
+    bool operator!=(const Cell& other) const { return !(*this == other); }
+};
+
+#endif // CELL_HPP
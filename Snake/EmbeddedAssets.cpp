@@ -0,0 +1,3032 @@
+// Generated by Assets/Embed.cmake; do not edit.
+#include "EmbeddedAssets.hpp"
+#include <cstring>
+
+static const unsigned char Snake_png[] = {
+	0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+	0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x00, 0x78, 0x08, 0x06, 0x00, 0x00, 0x00, 0xdf, 0x44, 0x68,
+	0xfa, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+	0x02, 0x7d, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0xdd, 0xc1, 0x49, 0x03, 0x51, 0x14, 0x40,
+	0x51, 0x47, 0xec, 0xc0, 0x65, 0xc0, 0x22, 0xd2, 0x87, 0xe0, 0xc2, 0x1e, 0x52, 0x93, 0x3d, 0xb8,
+	0x08, 0xd8, 0x87, 0x45, 0x08, 0x2e, 0xad, 0x21, 0x16, 0xe0, 0x40, 0x86, 0x7c, 0x87, 0xdc, 0x09,
+	0xe7, 0x2c, 0x43, 0x9c, 0x0c, 0xb3, 0xb8, 0x3c, 0x7c, 0xe4, 0x67, 0x7a, 0xfb, 0x7e, 0x39, 0xdd,
+	0x01, 0x9b, 0x74, 0xd8, 0x1d, 0xa7, 0x6b, 0xdf, 0x03, 0xeb, 0xb9, 0xbf, 0xf6, 0x0d, 0x00, 0x30,
+	0x4f, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0,
+	0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2,
+	0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x04, 0x1a,
+	0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a,
+	0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01,
+	0xa2, 0x1e, 0x46, 0x2f, 0x70, 0xd8, 0x1d, 0x17, 0xbd, 0xef, 0xed, 0xfb, 0x65, 0xf4, 0xa3, 0x6e,
+	0x8a, 0xe7, 0x06, 0x9c, 0x63, 0x82, 0x06, 0x88, 0x12, 0x68, 0x80, 0xa8, 0xe1, 0x7f, 0x71, 0x9c,
+	0x4e, 0xa7, 0x3f, 0xaf, 0x4d, 0xd3, 0x34, 0x7a, 0xd9, 0x9b, 0xe7, 0xb9, 0x01, 0xe7, 0x98, 0xa0,
+	0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x6a, 0x78, 0x49, 0x68,
+	0xb1, 0x75, 0x19, 0xcf, 0x0d, 0x38, 0xc7, 0x04, 0x0d, 0x10, 0x25, 0xd0, 0x00, 0x51, 0x02, 0x0d,
+	0x10, 0x25, 0xd0, 0x00, 0x51, 0x02, 0x0d, 0x10, 0x25, 0xd0, 0x00, 0x51, 0x02, 0x0d, 0x10, 0x25,
+	0xd0, 0x00, 0x51, 0x02, 0x0d, 0x10, 0x25, 0xd0, 0x00, 0x51, 0x02, 0x0d, 0x10, 0x35, 0x7c, 0x16,
+	0x87, 0xdf, 0xcc, 0xbb, 0x8c, 0xe7, 0x06, 0x9c, 0x63, 0x82, 0x06, 0x88, 0x12, 0x68, 0x80, 0x28,
+	0x81, 0x06, 0x88, 0x12, 0x68, 0x80, 0x28, 0x81, 0x06, 0x88, 0x12, 0x68, 0x80, 0x28, 0x81, 0x06,
+	0x88, 0x12, 0x68, 0x80, 0x28, 0x81, 0x06, 0x88, 0x12, 0x68, 0x80, 0x28, 0x81, 0x06, 0x88, 0x12,
+	0x68, 0x80, 0x28, 0x81, 0x06, 0x88, 0x12, 0x68, 0x80, 0x28, 0x81, 0x06, 0x88, 0x1a, 0x3e, 0x0f,
+	0xfa, 0xda, 0x0e, 0xbb, 0xe3, 0x9f, 0xd7, 0x2e, 0x3d, 0x6b, 0xf9, 0x3f, 0xaf, 0x05, 0x30, 0xca,
+	0x04, 0x0d, 0x10, 0x25, 0xd0, 0x00, 0x51, 0x02, 0x0d, 0x10, 0x25, 0xd0, 0x00, 0x51, 0x9b, 0x5f,
+	0x12, 0xfe, 0xe7, 0x12, 0xcf, 0x42, 0x10, 0x28, 0x31, 0x41, 0x03, 0x44, 0x09, 0x34, 0x40, 0x94,
+	0x40, 0x03, 0x44, 0x09, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44, 0x09, 0x34, 0x40, 0x94, 0x40, 0x03,
+	0x44, 0x09, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44, 0x09, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44, 0x09,
+	0x34, 0x40, 0x94, 0x40, 0x03, 0x44, 0x09, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44, 0xa5, 0xce, 0x83,
+	0xde, 0xe2, 0x8f, 0xb6, 0x6e, 0xf1, 0x9e, 0x81, 0x6d, 0x30, 0x41, 0x03, 0x44, 0x09, 0x34, 0x40,
+	0x94, 0x40, 0x03, 0x44, 0x09, 0x34, 0x40, 0x54, 0x6a, 0x49, 0x38, 0xb7, 0x5c, 0x9b, 0x5b, 0xc2,
+	0x2d, 0xf5, 0xbe, 0xdf, 0x2f, 0x7a, 0xdf, 0xeb, 0xe7, 0xe7, 0xc5, 0x9f, 0x61, 0x21, 0x08, 0xac,
+	0xc5, 0x04, 0x0d, 0x10, 0x25, 0xd0, 0x00, 0x51, 0x02, 0x0d, 0x10, 0x25, 0xd0, 0x00, 0x51, 0xa9,
+	0x25, 0xe1, 0x9c, 0xa1, 0x25, 0xdc, 0xf3, 0xd7, 0xfa, 0x9f, 0x01, 0xb0, 0x12, 0x13, 0x34, 0x40,
+	0x94, 0x40, 0x03, 0x44, 0x09, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44, 0x09, 0x34, 0x40, 0x94, 0x40,
+	0x03, 0x44, 0x09, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44, 0x09, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44,
+	0x09, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44, 0x09, 0x34, 0x40, 0x54, 0xfe, 0x34, 0xbb, 0xa5, 0x1e,
+	0x17, 0x9e, 0x5c, 0xb7, 0xf4, 0x6f, 0x7f, 0x3e, 0x9e, 0x46, 0x6e, 0x07, 0x60, 0x98, 0x09, 0x1a,
+	0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x6e, 0x66, 0x49, 0x38,
+	0x67, 0xe9, 0xa2, 0x6f, 0x64, 0xc1, 0x08, 0xb0, 0x16, 0x13, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44,
+	0x09, 0x34, 0x40, 0x94, 0x40, 0x03, 0x44, 0xdd, 0xcc, 0x92, 0x70, 0xe4, 0x9b, 0x7f, 0xbe, 0x35,
+	0x08, 0x14, 0x99, 0xa0, 0x01, 0xa2, 0x04, 0x1a, 0x20, 0x4a, 0xa0, 0x01, 0xa2, 0x7e, 0x01, 0xcb,
+	0x73, 0x3b, 0x9d, 0x26, 0xa9, 0x02, 0x63, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
+	0x42, 0x60, 0x82
+};
+
+static const unsigned char Food_png[] = {
+	0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+	0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x08, 0x06, 0x00, 0x00, 0x00, 0x39, 0x64, 0x36,
+	0xd2, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+	0x03, 0x43, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0xdc, 0xdd, 0x71, 0xa3, 0x30, 0x14, 0x86,
+	0xe1, 0x43, 0x66, 0x2b, 0x48, 0x11, 0xa1, 0x8a, 0xd4, 0x12, 0xae, 0x48, 0x4d, 0xe1, 0xca, 0x5b,
+	0x8b, 0xab, 0xf0, 0x16, 0xe1, 0x16, 0xb4, 0x17, 0x46, 0x8e, 0x90, 0xc5, 0xbf, 0x84, 0xe0, 0xf0,
+	0x3e, 0x33, 0x99, 0x9d, 0xac, 0x37, 0xb6, 0x97, 0x8f, 0x73, 0x10, 0x92, 0x1c, 0x11, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc1, 0x98, 0xf6, 0x6b, 0xd0, 0xdb, 0x06,
+	0x6f, 0x04, 0x19, 0x15, 0xb9, 0xdf, 0x00, 0x16, 0x31, 0xf7, 0x6b, 0x23, 0x22, 0x22, 0xef, 0x9f,
+	0xb5, 0xc8, 0x40, 0x8e, 0x54, 0xb0, 0x72, 0x04, 0xac, 0x1c, 0x01, 0x2b, 0x47, 0xc0, 0xca, 0x11,
+	0xb0, 0x72, 0x04, 0xac, 0x1c, 0x01, 0x2b, 0x47, 0xc0, 0xca, 0x11, 0xb0, 0x72, 0x04, 0xac, 0x1c,
+	0x01, 0x2b, 0x47, 0xc0, 0xca, 0x11, 0xb0, 0x72, 0x04, 0xac, 0x1c, 0x01, 0x2b, 0x47, 0xc0, 0xca,
+	0x11, 0xb0, 0x72, 0x04, 0xac, 0x1c, 0x01, 0x2b, 0xf7, 0x27, 0xf7, 0x1b, 0x88, 0x68, 0x68, 0x87,
+	0xe1, 0x69, 0xf7, 0x9e, 0x69, 0x09, 0xd8, 0xdc, 0x2e, 0x75, 0xef, 0x83, 0x65, 0xd5, 0x18, 0x39,
+	0x69, 0xc8, 0xb4, 0x68, 0xe5, 0x34, 0x04, 0x3c, 0x58, 0xbd, 0x22, 0x22, 0xed, 0xe3, 0xa3, 0x9b,
+	0xc4, 0x35, 0xd2, 0x10, 0x30, 0x06, 0x1c, 0x39, 0x60, 0x23, 0x13, 0xaa, 0xd7, 0x72, 0xaa, 0xf8,
+	0x54, 0x95, 0x7c, 0xd4, 0x41, 0x56, 0x30, 0xd8, 0xb2, 0x6a, 0x3a, 0xdf, 0x4f, 0x0d, 0x5f, 0xb3,
+	0x23, 0x57, 0x30, 0x26, 0x38, 0x6a, 0x05, 0xbf, 0x28, 0xab, 0x46, 0xec, 0xe7, 0x75, 0xac, 0xf6,
+	0x73, 0x3b, 0xcf, 0x4a, 0xb6, 0x7f, 0x9e, 0xe9, 0xb6, 0x49, 0x45, 0x05, 0x87, 0xc2, 0x15, 0x11,
+	0xb9, 0x5f, 0x1f, 0x7f, 0xef, 0xb7, 0xee, 0x33, 0x51, 0x11, 0x30, 0xfa, 0x1d, 0xb1, 0x45, 0x9b,
+	0xdb, 0xa5, 0xee, 0x54, 0x65, 0xa8, 0x7a, 0x5d, 0xf7, 0x6b, 0x23, 0xef, 0x9f, 0xb5, 0x3f, 0xe8,
+	0x4a, 0x3d, 0x9a, 0xde, 0xc5, 0x25, 0x60, 0x0f, 0x01, 0xaf, 0x3a, 0xd0, 0x63, 0xe1, 0x8a, 0x48,
+	0x28, 0xdc, 0x24, 0x23, 0x6c, 0xef, 0x52, 0x60, 0xff, 0x5f, 0x59, 0x83, 0xa6, 0x45, 0x2b, 0x97,
+	0xab, 0x82, 0x9f, 0x55, 0x9b, 0xf2, 0x5e, 0xd5, 0x1f, 0x45, 0xdb, 0x0a, 0x4b, 0xf5, 0x9a, 0x3d,
+	0xf7, 0xe6, 0x59, 0x47, 0xec, 0x5b, 0xbf, 0xb0, 0x11, 0x89, 0x7b, 0x80, 0xed, 0x08, 0xda, 0x86,
+	0xe9, 0x72, 0x5f, 0xa7, 0xac, 0x9a, 0x6c, 0x13, 0x1f, 0x4e, 0xeb, 0x8e, 0x75, 0xbc, 0xf9, 0x15,
+	0x0e, 0x78, 0xd8, 0xa2, 0x45, 0x27, 0x6d, 0xc7, 0xb7, 0x4b, 0x1d, 0x1c, 0x44, 0xed, 0x49, 0xce,
+	0x09, 0x16, 0x2a, 0x58, 0xb9, 0xd4, 0x15, 0xfc, 0xb2, 0x28, 0xe0, 0xde, 0x4a, 0xc4, 0xaa, 0xba,
+	0xb1, 0xe7, 0xc9, 0x79, 0xfd, 0xcd, 0x2d, 0x55, 0x05, 0x07, 0x97, 0xf2, 0xfc, 0x29, 0xc3, 0xd4,
+	0x53, 0x88, 0x65, 0xd5, 0xec, 0x2a, 0xdc, 0x1c, 0x1b, 0x0f, 0x68, 0xd1, 0xca, 0xa5, 0x68, 0xd1,
+	0xa3, 0x95, 0x9b, 0x5a, 0xea, 0xfb, 0xdd, 0x23, 0x89, 0x1d, 0x70, 0x70, 0x21, 0xde, 0x98, 0xdf,
+	0xae, 0x54, 0x14, 0x71, 0x07, 0x91, 0xa1, 0x93, 0x67, 0xcf, 0xc1, 0xb6, 0xf3, 0xe8, 0x9b, 0x4d,
+	0x63, 0xd2, 0xa2, 0x95, 0x8b, 0x55, 0xc1, 0xd1, 0x67, 0xa8, 0xa6, 0xda, 0x73, 0xb5, 0x26, 0x62,
+	0xa6, 0x2c, 0xb0, 0x58, 0x31, 0x02, 0x1e, 0xdd, 0xf8, 0x16, 0xbb, 0x2d, 0x43, 0xdc, 0xa9, 0xd9,
+	0xc1, 0x83, 0x4b, 0x8b, 0x56, 0x6e, 0x6d, 0xc0, 0x93, 0xb7, 0xad, 0xe2, 0xd7, 0xed, 0x52, 0x2f,
+	0xb9, 0x27, 0x36, 0x32, 0xb3, 0x3d, 0x8b, 0x84, 0x5b, 0x74, 0xdf, 0x8b, 0x16, 0xfe, 0xbf, 0x99,
+	0xb9, 0x27, 0x99, 0x6d, 0xad, 0x91, 0x8c, 0xad, 0x20, 0xb9, 0x68, 0xd1, 0xca, 0xf9, 0x15, 0x3c,
+	0xd4, 0x32, 0xec, 0x4a, 0xc8, 0xe2, 0xb6, 0x4c, 0xc5, 0x2e, 0x36, 0xbb, 0x35, 0x5b, 0x54, 0xb0,
+	0x72, 0x73, 0x03, 0x66, 0x50, 0xb5, 0xbd, 0x4e, 0xf5, 0xce, 0xb9, 0xfe, 0x8a, 0xbc, 0xb6, 0xe8,
+	0x42, 0x7a, 0xda, 0x34, 0xc1, 0x6e, 0xea, 0x99, 0x81, 0xb7, 0x35, 0x47, 0x64, 0xe6, 0xf4, 0x26,
+	0x2d, 0x5a, 0xb9, 0xd0, 0x6d, 0x92, 0x7f, 0x86, 0xcc, 0x5e, 0xbf, 0xfc, 0xf8, 0xfa, 0x11, 0x11,
+	0x91, 0x7f, 0x7f, 0xbf, 0x17, 0xbc, 0xa5, 0x53, 0xea, 0x1c, 0xe3, 0x40, 0x4b, 0x16, 0x59, 0xb8,
+	0x30, 0x31, 0xe7, 0x87, 0x46, 0xaf, 0xbf, 0x7e, 0xb0, 0x04, 0x3d, 0xcc, 0xce, 0x0b, 0xf4, 0x7d,
+	0x68, 0xae, 0xb5, 0x6a, 0x9e, 0x97, 0x16, 0xad, 0xdc, 0x9c, 0xc5, 0x86, 0xa2, 0xac, 0x9a, 0x97,
+	0x2a, 0xb6, 0x55, 0x2a, 0x12, 0xae, 0x5c, 0xf7, 0x71, 0x84, 0x05, 0xf6, 0x74, 0x47, 0x5b, 0x9d,
+	0x59, 0xf2, 0x44, 0xc6, 0x5d, 0xc0, 0xf7, 0xdb, 0xef, 0xc7, 0xd7, 0x4f, 0x27, 0x68, 0xda, 0x73,
+	0xbf, 0xb6, 0x45, 0x27, 0x5d, 0x6a, 0xa3, 0x45, 0x2b, 0x37, 0x2b, 0x60, 0xf3, 0x20, 0x45, 0x51,
+	0x3c, 0xbf, 0xb0, 0x5a, 0xd2, 0x5d, 0x96, 0x54, 0xb0, 0x72, 0x31, 0x4a, 0xf0, 0x79, 0x06, 0x1a,
+	0x63, 0x3a, 0xd7, 0x5c, 0xae, 0xc1, 0xe3, 0x52, 0x5f, 0x87, 0x63, 0x6c, 0xd9, 0xe9, 0xac, 0x13,
+	0xbb, 0x6b, 0xbe, 0x86, 0x11, 0x74, 0x76, 0xb4, 0x68, 0xe5, 0xa2, 0xec, 0xaa, 0xb4, 0xf7, 0x4d,
+	0xc5, 0xeb, 0xa8, 0xcb, 0x0c, 0x6d, 0x7a, 0x67, 0x01, 0x23, 0xbd, 0xd5, 0x01, 0x1b, 0x63, 0x8c,
+	0x1f, 0xec, 0x40, 0xe0, 0x1d, 0xce, 0x06, 0xf0, 0x43, 0x3a, 0xc2, 0x09, 0x4a, 0x8b, 0x56, 0x2e,
+	0xc9, 0xe8, 0x6d, 0x6a, 0x05, 0x2b, 0x10, 0xa3, 0x03, 0x25, 0x3d, 0x46, 0x7b, 0xf8, 0x35, 0x4a,
+	0x47, 0xb6, 0xfb, 0x13, 0x98, 0x16, 0xad, 0x1c, 0x01, 0x2b, 0x47, 0xc0, 0xca, 0x11, 0x30, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x25, 0xfe, 0x03, 0x62, 0xf8, 0x33, 0x6a, 0x5c, 0xdc, 0xaf, 0x17, 0x00, 0x00, 0x00,
+	0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+
+static const unsigned char Snake_Head_png[] = {
+	0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+	0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x08, 0x06, 0x00, 0x00, 0x00, 0x39, 0x64, 0x36,
+	0xd2, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+	0x01, 0xcc, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0xdd, 0xc1, 0x49, 0xc3, 0x60, 0x18, 0x80,
+	0x61, 0x23, 0x6e, 0xe0, 0x51, 0x70, 0x88, 0xee, 0x21, 0xf4, 0xe0, 0x0e, 0xce, 0xd4, 0x1d, 0x3c,
+	0x08, 0xee, 0xd1, 0x21, 0x84, 0x1e, 0x9d, 0xa1, 0x0e, 0x60, 0x0e, 0xa1, 0xbf, 0x4d, 0xe3, 0xc3,
+	0xfb, 0x9c, 0x63, 0x1a, 0xf2, 0xf2, 0xc9, 0x0f, 0xfd, 0x93, 0x4e, 0x87, 0xd3, 0xfe, 0x7c, 0x17,
+	0xd6, 0xfd, 0xad, 0x2f, 0x20, 0xd7, 0x55, 0x60, 0x5c, 0x81, 0x71, 0x05, 0xc6, 0x15, 0x18, 0x57,
+	0x60, 0x5c, 0x81, 0x71, 0x05, 0xc6, 0x15, 0x18, 0x57, 0x60, 0x5c, 0x81, 0x71, 0x05, 0xc6, 0x15,
+	0x18, 0x57, 0x60, 0x5c, 0x81, 0x71, 0x05, 0xc6, 0x15, 0x18, 0x57, 0x60, 0x5c, 0x81, 0x71, 0x05,
+	0xc6, 0x15, 0x18, 0x57, 0x60, 0x5c, 0x81, 0x71, 0x05, 0xc6, 0x3d, 0x8c, 0x9e, 0xe0, 0xed, 0xe9,
+	0x63, 0xd1, 0x71, 0x87, 0xd3, 0x7e, 0xf4, 0xa3, 0x28, 0x6b, 0xdd, 0xb7, 0x26, 0x18, 0x57, 0x60,
+	0xdc, 0xf0, 0xbf, 0xe8, 0xf3, 0xf9, 0xf7, 0xa3, 0x4d, 0xd3, 0x34, 0x8d, 0x9e, 0x96, 0xb7, 0xd6,
+	0x7d, 0x6b, 0x82, 0x71, 0x05, 0xc6, 0x15, 0x18, 0x57, 0x60, 0xdc, 0xf0, 0x22, 0xab, 0x05, 0xd5,
+	0x65, 0xd6, 0xba, 0x6f, 0x4d, 0x30, 0xae, 0xc0, 0xb8, 0x02, 0xe3, 0x0a, 0x8c, 0x2b, 0x30, 0xae,
+	0xc0, 0xb8, 0x02, 0xe3, 0x0a, 0x8c, 0x2b, 0x30, 0xae, 0xc0, 0xb8, 0x02, 0xe3, 0xa6, 0x5e, 0x46,
+	0x6a, 0x6b, 0x82, 0x71, 0x05, 0xc6, 0x15, 0x18, 0x57, 0x60, 0x5c, 0x81, 0x71, 0x05, 0xc6, 0x15,
+	0x18, 0x57, 0x60, 0x5c, 0x81, 0x71, 0x05, 0xc6, 0x15, 0x18, 0x57, 0x60, 0x5c, 0x81, 0x71, 0x05,
+	0xc6, 0x15, 0x18, 0x37, 0xfc, 0x6c, 0xd2, 0xad, 0xcd, 0xbd, 0xeb, 0xe2, 0xd2, 0xf7, 0x5a, 0xfc,
+	0xe5, 0xb9, 0xb6, 0xa2, 0x09, 0xc6, 0x15, 0x18, 0x57, 0x60, 0x5c, 0x81, 0x71, 0x6d, 0xba, 0xc3,
+	0x35, 0xc1, 0xb8, 0x02, 0xe3, 0x0a, 0x8c, 0x2b, 0x30, 0xae, 0xc0, 0xb8, 0x02, 0xe3, 0x0a, 0x8c,
+	0x2b, 0x30, 0xae, 0xc0, 0xb8, 0x02, 0xe3, 0x0a, 0x8c, 0x2b, 0x30, 0xae, 0xc0, 0xb8, 0x02, 0xe3,
+	0x0a, 0x8c, 0xdb, 0xd4, 0xa6, 0xbb, 0xff, 0xb8, 0xe9, 0x6d, 0xeb, 0xd7, 0xdc, 0x04, 0xe3, 0x0a,
+	0x8c, 0x2b, 0x30, 0xae, 0xc0, 0xb8, 0x4d, 0x2d, 0xb2, 0xe6, 0x16, 0x27, 0x4b, 0x7f, 0xa5, 0x73,
+	0xce, 0xfb, 0x6e, 0xb7, 0xe8, 0xb8, 0xd7, 0xe3, 0xf1, 0xe2, 0xcf, 0xd8, 0xd2, 0x82, 0x6a, 0x4e,
+	0x13, 0x8c, 0x2b, 0x30, 0xae, 0xc0, 0xb8, 0x02, 0xe3, 0xe8, 0x27, 0x1b, 0x1e, 0x5f, 0xbe, 0x16,
+	0x1d, 0xf7, 0xfd, 0xf9, 0x7c, 0xe5, 0x2b, 0xb9, 0x9d, 0x26, 0x18, 0x57, 0x60, 0x5c, 0x81, 0x71,
+	0x05, 0xc6, 0x15, 0x18, 0x57, 0x60, 0x5c, 0x81, 0x71, 0x05, 0xc6, 0x15, 0x18, 0x57, 0x60, 0x5c,
+	0x81, 0x71, 0x05, 0xc6, 0x15, 0x18, 0xb7, 0xa9, 0x2d, 0x3b, 0x23, 0x96, 0x7e, 0x73, 0xb4, 0xf4,
+	0x6f, 0x95, 0x6f, 0x98, 0x9a, 0x60, 0x5c, 0x81, 0x71, 0x05, 0xc6, 0x15, 0x18, 0xc7, 0x2c, 0xb2,
+	0xe6, 0x2c, 0x5d, 0x28, 0x8d, 0x2c, 0xd0, 0xb6, 0xae, 0x09, 0xc6, 0x15, 0x18, 0x57, 0x60, 0x5c,
+	0x81, 0x71, 0xf4, 0xbe, 0xe8, 0x34, 0xc1, 0xbc, 0x02, 0xe3, 0x0a, 0x8c, 0xfb, 0x01, 0x40, 0xdf,
+	0x39, 0x13, 0x9f, 0x80, 0x07, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+	0x60, 0x82
+};
+
+static const unsigned char BigSpace_ttf[] = {
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x80, 0x00, 0x03, 0x00, 0x60, 0x4f, 0x53, 0x2f, 0x32,
+	0x42, 0xf8, 0x89, 0x54, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+	0x72, 0xd5, 0x4c, 0xc4, 0x00, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x02, 0x4e, 0x63, 0x76, 0x74, 0x20,
+	0x0e, 0x23, 0x24, 0x3f, 0x00, 0x00, 0xa3, 0x74, 0x00, 0x00, 0x00, 0x4a, 0x66, 0x70, 0x67, 0x6d,
+	0x9e, 0x36, 0x12, 0xcc, 0x00, 0x00, 0xa3, 0xc0, 0x00, 0x00, 0x0e, 0x15, 0x67, 0x61, 0x73, 0x70,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xa3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6c, 0x79, 0x66,
+	0x1d, 0x62, 0xed, 0x5f, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x95, 0x3c, 0x68, 0x65, 0x61, 0x64,
+	0x17, 0x49, 0x66, 0x30, 0x00, 0x00, 0x98, 0xd8, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+	0x0e, 0xfa, 0x07, 0x61, 0x00, 0x00, 0x99, 0x10, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+	0x46, 0x0c, 0xcd, 0xc4, 0x00, 0x00, 0x99, 0x34, 0x00, 0x00, 0x03, 0x9a, 0x6c, 0x6f, 0x63, 0x61,
+	0x82, 0xe6, 0xa8, 0x20, 0x00, 0x00, 0x9c, 0xd0, 0x00, 0x00, 0x01, 0xd0, 0x6d, 0x61, 0x78, 0x70,
+	0x02, 0x20, 0x0e, 0xa2, 0x00, 0x00, 0x9e, 0xa0, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+	0x33, 0x95, 0x55, 0x9a, 0x00, 0x00, 0x9e, 0xc0, 0x00, 0x00, 0x02, 0x7e, 0x70, 0x6f, 0x73, 0x74,
+	0x01, 0xbe, 0x64, 0xe6, 0x00, 0x00, 0xa1, 0x40, 0x00, 0x00, 0x02, 0x29, 0x70, 0x72, 0x65, 0x70,
+	0x6a, 0xbd, 0xd6, 0xa8, 0x00, 0x00, 0xb1, 0xd8, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x03, 0x03, 0xa8,
+	0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00, 0x01, 0x1b, 0x05, 0x9a,
+	0x05, 0x33, 0x00, 0x00, 0x03, 0xd1, 0x00, 0x66, 0x02, 0x12, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x4c, 0x20, 0x20, 0x00, 0x40, 0x00, 0x00, 0x22, 0x65,
+	0x05, 0x9a, 0xfe, 0x51, 0x00, 0xcd, 0x07, 0xcb, 0x01, 0xbb, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x05, 0x9a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48,
+	0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x44,
+	0x00, 0x40, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x7e, 0x00, 0xa0, 0x00, 0xac,
+	0x00, 0xad, 0x00, 0xc7, 0x00, 0xe7, 0x00, 0xff, 0x01, 0x07, 0x01, 0x0d, 0x01, 0x31, 0x02, 0xc7,
+	0x02, 0xc9, 0x02, 0xdd, 0x03, 0x7e, 0x20, 0x14, 0x20, 0x1a, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x26,
+	0x20, 0x3a, 0x20, 0x44, 0x20, 0xa4, 0x20, 0xa7, 0x20, 0xac, 0x21, 0x16, 0x21, 0x22, 0x22, 0x12,
+	0x22, 0x15, 0x22, 0x19, 0x22, 0x48, 0x22, 0x65, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+	0x00, 0x20, 0x00, 0xa0, 0x00, 0xa1, 0x00, 0xad, 0x00, 0xae, 0x00, 0xc8, 0x00, 0xe8, 0x01, 0x06,
+	0x01, 0x0c, 0x01, 0x31, 0x02, 0xc6, 0x02, 0xc9, 0x02, 0xd8, 0x03, 0x7e, 0x20, 0x13, 0x20, 0x18,
+	0x20, 0x1c, 0x20, 0x20, 0x20, 0x26, 0x20, 0x39, 0x20, 0x44, 0x20, 0xa3, 0x20, 0xa7, 0x20, 0xac,
+	0x21, 0x16, 0x21, 0x22, 0x22, 0x12, 0x22, 0x15, 0x22, 0x19, 0x22, 0x48, 0x22, 0x64, 0xff, 0xff,
+	0x00, 0x01, 0xff, 0xe4, 0xff, 0xe3, 0x00, 0x00, 0xff, 0xc1, 0x00, 0x00, 0xff, 0xc0, 0xff, 0xc2,
+	0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0xff, 0x93, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xf0, 0xfc, 0xa0,
+	0xe0, 0xbb, 0xe0, 0xb8, 0xe0, 0xb7, 0xe0, 0xb6, 0xe0, 0xb3, 0xe0, 0xa1, 0xe0, 0x98, 0xe0, 0x3a,
+	0xe0, 0x38, 0xe0, 0x34, 0xdf, 0xcb, 0xdf, 0xc0, 0xde, 0xd1, 0xde, 0xc7, 0xde, 0x5e, 0xde, 0x9c,
+	0xde, 0x81, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x88, 0x00, 0xaa,
+	0x00, 0x89, 0x00, 0xab, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+	0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+	0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+	0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+	0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x00, 0x84, 0x85, 0x87, 0x8b, 0x93, 0x98,
+	0x9e, 0xa3, 0xa2, 0xa4, 0xa6, 0xa5, 0xa7, 0xa9, 0xad, 0xac, 0xae, 0xaf, 0xb1, 0xb0, 0xb2, 0xb3,
+	0xb5, 0xb7, 0xb6, 0xb8, 0xba, 0xb9, 0xbe, 0xbd, 0xbf, 0xc0, 0xd6, 0x70, 0x63, 0x64, 0x68, 0xd8,
+	0x76, 0xa1, 0x6e, 0x6a, 0xe2, 0x74, 0x69, 0x00, 0x86, 0x9a, 0x00, 0x71, 0xe5, 0xe6, 0x66, 0x75,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x7a, 0x00, 0xa8, 0xbc, 0x7f, 0x62, 0x6d, 0x00, 0x00, 0xe4,
+	0x00, 0x6c, 0x7b, 0xd9, 0x03, 0x80, 0x83, 0x97, 0x00, 0x00, 0xce, 0xcf, 0xd3, 0xd4, 0xd0, 0xd1,
+	0xbb, 0x00, 0xc3, 0x00, 0xdc, 0x65, 0xda, 0xdb, 0x00, 0x00, 0xd7, 0x77, 0xd2, 0xd5, 0x00, 0x82,
+	0x8c, 0x81, 0x8d, 0x8a, 0x8f, 0x90, 0x91, 0x8e, 0x95, 0x96, 0x00, 0x94, 0x9c, 0x9d, 0x9b, 0xc4,
+	0xc5, 0xcc, 0x6f, 0xc8, 0xc9, 0xca, 0x78, 0xcd, 0xcb, 0xc6, 0x00, 0x00, 0x00, 0x04, 0x00, 0x64,
+	0x00, 0x00, 0x03, 0x9c, 0x05, 0x9a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x24, 0x00, 0x38, 0x00, 0x4b,
+	0x40, 0x48, 0x24, 0x08, 0x02, 0x05, 0x06, 0x37, 0x01, 0x02, 0x05, 0x02, 0x4c, 0x00, 0x05, 0x06,
+	0x02, 0x06, 0x05, 0x02, 0x80, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x03, 0x67, 0x00, 0x04, 0x00,
+	0x06, 0x05, 0x04, 0x06, 0x69, 0x00, 0x02, 0x01, 0x01, 0x02, 0x57, 0x00, 0x02, 0x02, 0x01, 0x5f,
+	0x07, 0x01, 0x01, 0x02, 0x01, 0x4f, 0x00, 0x00, 0x21, 0x1f, 0x18, 0x17, 0x0d, 0x0b, 0x07, 0x06,
+	0x05, 0x04, 0x00, 0x03, 0x00, 0x03, 0x11, 0x08, 0x06, 0x17, 0x2b, 0x33, 0x11, 0x21, 0x11, 0x25,
+	0x21, 0x11, 0x21, 0x17, 0x36, 0x37, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01,
+	0x15, 0x14, 0x17, 0x23, 0x26, 0x35, 0x34, 0x12, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07,
+	0x13, 0x37, 0x36, 0x33, 0x32, 0x1f, 0x01, 0x16, 0x15, 0x14, 0x0f, 0x01, 0x06, 0x23, 0x22, 0x2f,
+	0x01, 0x26, 0x35, 0x34, 0x64, 0x03, 0x38, 0xfc, 0xfa, 0x02, 0xd4, 0xfd, 0x2c, 0xaf, 0x1f, 0x1b,
+	0x35, 0x3b, 0x5c, 0x70, 0x2e, 0x40, 0x3f, 0x48, 0x18, 0x20, 0x23, 0xa3, 0x42, 0x3a, 0x26, 0x1f,
+	0x1a, 0x1e, 0x40, 0x39, 0x0b, 0x09, 0x0a, 0x0c, 0x38, 0x09, 0x0a, 0x38, 0x0e, 0x07, 0x0b, 0x09,
+	0x3d, 0x07, 0x05, 0x9a, 0xfa, 0x66, 0x32, 0x05, 0x36, 0xec, 0x1c, 0x0f, 0x1e, 0x5f, 0x50, 0x31,
+	0x63, 0x50, 0x50, 0x68, 0x2f, 0x26, 0x5f, 0x61, 0x33, 0x4c, 0x01, 0x1c, 0x4b, 0x39, 0x42, 0x11,
+	0x0f, 0x19, 0xfc, 0xff, 0x3a, 0x0a, 0x0b, 0x3c, 0x0b, 0x09, 0x0b, 0x0b, 0x3e, 0x0e, 0x0a, 0x47,
+	0x09, 0x09, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x91, 0x00, 0x00, 0x01, 0xfb, 0x05, 0x9a, 0x00, 0x05,
+	0x00, 0x0b, 0x00, 0x3e, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x15, 0x00, 0x00, 0x00, 0x01, 0x5f,
+	0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x12, 0x02, 0x4e,
+	0x1b, 0x40, 0x15, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x03, 0x03,
+	0x02, 0x5f, 0x00, 0x02, 0x02, 0x12, 0x02, 0x4e, 0x59, 0xb6, 0x11, 0x31, 0x11, 0x30, 0x04, 0x07,
+	0x1a, 0x2b, 0x13, 0x39, 0x01, 0x21, 0x13, 0x21, 0x13, 0x39, 0x01, 0x21, 0x35, 0x21, 0xb7, 0x01,
+	0x1e, 0x26, 0xfe, 0x96, 0x26, 0x01, 0x1e, 0xfe, 0xe2, 0x01, 0x6c, 0x04, 0x2e, 0xfa, 0x66, 0xf9,
+	0x00, 0x02, 0x00, 0x84, 0x04, 0x14, 0x03, 0x04, 0x05, 0x9a, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x36,
+	0xb6, 0x0d, 0x0c, 0x05, 0x04, 0x04, 0x00, 0x49, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x0d, 0x02,
+	0x01, 0x00, 0x00, 0x01, 0x5f, 0x03, 0x01, 0x01, 0x01, 0x11, 0x00, 0x4e, 0x1b, 0x40, 0x0d, 0x02,
+	0x01, 0x00, 0x00, 0x01, 0x5f, 0x03, 0x01, 0x01, 0x01, 0x13, 0x00, 0x4e, 0x59, 0xb6, 0x13, 0x31,
+	0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x13, 0x39, 0x01, 0x33, 0x15, 0x37, 0x35, 0x21, 0x05, 0x39,
+	0x01, 0x33, 0x15, 0x37, 0x35, 0x21, 0x84, 0xa1, 0x7e, 0xfe, 0xe2, 0x01, 0x61, 0xa1, 0x7d, 0xfe,
+	0xe2, 0x04, 0xa1, 0x8d, 0x8d, 0xf9, 0xf9, 0x8d, 0x8d, 0xf9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x77,
+	0x00, 0x00, 0x04, 0xe2, 0x03, 0xf3, 0x00, 0x1c, 0x00, 0x21, 0x00, 0x47, 0x40, 0x44, 0x0d, 0x0b,
+	0x02, 0x09, 0x0e, 0x08, 0x02, 0x00, 0x01, 0x09, 0x00, 0x68, 0x10, 0x0f, 0x07, 0x03, 0x01, 0x06,
+	0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x67, 0x0c, 0x01, 0x0a, 0x0a, 0x14, 0x4d, 0x05, 0x01, 0x03,
+	0x03, 0x12, 0x03, 0x4e, 0x1d, 0x1d, 0x1d, 0x21, 0x1d, 0x21, 0x20, 0x1f, 0x1c, 0x1b, 0x1a, 0x19,
+	0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x11,
+	0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x07, 0x21, 0x07, 0x21, 0x03, 0x23, 0x13, 0x23, 0x03, 0x23,
+	0x13, 0x21, 0x37, 0x21, 0x37, 0x21, 0x37, 0x21, 0x13, 0x33, 0x03, 0x33, 0x13, 0x33, 0x03, 0x21,
+	0x01, 0x31, 0x37, 0x23, 0x07, 0x04, 0xb9, 0xfe, 0xef, 0x23, 0x01, 0x12, 0x29, 0xfe, 0xee, 0x44,
+	0xa5, 0x45, 0x8b, 0x44, 0xa5, 0x45, 0xfe, 0xee, 0x29, 0x01, 0x12, 0x22, 0xfe, 0xee, 0x29, 0x01,
+	0x12, 0x44, 0xa5, 0x44, 0x8a, 0x44, 0xa5, 0x44, 0x01, 0x11, 0xfd, 0xff, 0x22, 0x8a, 0x23, 0x02,
+	0x3e, 0x89, 0xa5, 0xfe, 0xf0, 0x01, 0x10, 0xfe, 0xf0, 0x01, 0x10, 0xa5, 0x89, 0xa5, 0x01, 0x10,
+	0xfe, 0xf0, 0x01, 0x10, 0xfe, 0xf0, 0xfe, 0xd2, 0x89, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0xeb, 0x05, 0x9b, 0x00, 0x22, 0x00, 0x7b, 0x40, 0x0a, 0x22, 0x01, 0x00, 0x07,
+	0x11, 0x01, 0x02, 0x05, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x29, 0x04, 0x01, 0x02,
+	0x05, 0x03, 0x03, 0x02, 0x72, 0x09, 0x01, 0x07, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x01,
+	0x00, 0x06, 0x05, 0x01, 0x06, 0x67, 0x00, 0x08, 0x08, 0x11, 0x4d, 0x00, 0x05, 0x05, 0x03, 0x5f,
+	0x00, 0x03, 0x03, 0x12, 0x03, 0x4e, 0x1b, 0x40, 0x2a, 0x04, 0x01, 0x02, 0x05, 0x03, 0x05, 0x02,
+	0x03, 0x80, 0x09, 0x01, 0x07, 0x00, 0x00, 0x01, 0x07, 0x00, 0x68, 0x00, 0x01, 0x00, 0x06, 0x05,
+	0x01, 0x06, 0x67, 0x00, 0x08, 0x08, 0x11, 0x4d, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x00, 0x03, 0x03,
+	0x12, 0x03, 0x4e, 0x59, 0x40, 0x0e, 0x21, 0x20, 0x11, 0x15, 0x11, 0x32, 0x11, 0x11, 0x15, 0x11,
+	0x40, 0x0a, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x31, 0x23, 0x15, 0x21, 0x15, 0x31, 0x15, 0x31,
+	0x11, 0x21, 0x15, 0x23, 0x35, 0x23, 0x27, 0x35, 0x21, 0x31, 0x33, 0x35, 0x21, 0x35, 0x23, 0x11,
+	0x31, 0x35, 0x21, 0x35, 0x33, 0x15, 0x33, 0x17, 0x02, 0xeb, 0xfe, 0xe0, 0xe4, 0x02, 0x04, 0xfe,
+	0xfe, 0xe6, 0x41, 0xc2, 0x01, 0x71, 0x94, 0xfd, 0xfc, 0x01, 0x01, 0x03, 0xe6, 0x40, 0xc2, 0x03,
+	0xeb, 0xbe, 0x41, 0xcf, 0xfe, 0x84, 0xa1, 0xa1, 0xdb, 0x1a, 0xc3, 0x2c, 0x01, 0xf8, 0x63, 0xbb,
+	0xbb, 0xdb, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd5, 0x05, 0x9b, 0x00, 0x05,
+	0x00, 0x0d, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x4c, 0x40, 0x49, 0x0a, 0x01, 0x05, 0x01,
+	0x0d, 0x01, 0x02, 0x04, 0x1a, 0x01, 0x09, 0x07, 0x1d, 0x01, 0x00, 0x08, 0x04, 0x4c, 0x00, 0x07,
+	0x00, 0x09, 0x08, 0x07, 0x09, 0x68, 0x00, 0x05, 0x05, 0x01, 0x5f, 0x03, 0x01, 0x01, 0x01, 0x11,
+	0x4d, 0x00, 0x02, 0x02, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x14, 0x4d, 0x00, 0x08, 0x08, 0x00, 0x5f,
+	0x06, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x23, 0x22, 0x32, 0x12, 0x33, 0x11, 0x32, 0x12, 0x31,
+	0x11, 0x30, 0x0a, 0x07, 0x1f, 0x2b, 0x33, 0x39, 0x01, 0x33, 0x01, 0x23, 0x01, 0x39, 0x01, 0x21,
+	0x11, 0x27, 0x21, 0x11, 0x25, 0x39, 0x01, 0x23, 0x11, 0x33, 0x15, 0x31, 0x01, 0x39, 0x01, 0x21,
+	0x11, 0x27, 0x21, 0x11, 0x25, 0x39, 0x01, 0x23, 0x11, 0x33, 0x15, 0x31, 0xff, 0xbf, 0x02, 0x0c,
+	0xbf, 0xfd, 0x68, 0x01, 0x8e, 0x73, 0xfe, 0x72, 0x01, 0x56, 0xab, 0xab, 0x01, 0xf1, 0x01, 0x8e,
+	0x74, 0xfe, 0x72, 0x01, 0x56, 0xaa, 0xaa, 0x05, 0x9b, 0xfd, 0xa8, 0x01, 0xbb, 0x9d, 0xfe, 0x44,
+	0x0f, 0x01, 0x02, 0x45, 0xfb, 0x55, 0x01, 0xbb, 0x9d, 0xfe, 0x44, 0x0f, 0x01, 0x02, 0x44, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xab, 0x04, 0xa8, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x96,
+	0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x19, 0x10, 0x0d, 0x02, 0x03, 0x05, 0x11, 0x01, 0x02, 0x03,
+	0x12, 0x01, 0x01, 0x02, 0x14, 0x04, 0x02, 0x00, 0x06, 0x04, 0x4c, 0x13, 0x01, 0x01, 0x01, 0x4b,
+	0x1b, 0x40, 0x19, 0x10, 0x0d, 0x02, 0x03, 0x05, 0x11, 0x01, 0x02, 0x04, 0x12, 0x01, 0x01, 0x02,
+	0x14, 0x04, 0x02, 0x00, 0x06, 0x04, 0x4c, 0x13, 0x01, 0x01, 0x01, 0x4b, 0x59, 0x4b, 0xb0, 0x0b,
+	0x50, 0x58, 0x40, 0x1d, 0x00, 0x05, 0x04, 0x01, 0x03, 0x02, 0x05, 0x03, 0x67, 0x00, 0x02, 0x07,
+	0x01, 0x01, 0x06, 0x02, 0x01, 0x67, 0x00, 0x06, 0x06, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x1b, 0x40, 0x23, 0x00, 0x04, 0x03, 0x02, 0x03, 0x04, 0x72, 0x00, 0x05, 0x00, 0x03, 0x04,
+	0x05, 0x03, 0x67, 0x00, 0x02, 0x07, 0x01, 0x01, 0x06, 0x02, 0x01, 0x67, 0x00, 0x06, 0x06, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x40, 0x0b, 0x11, 0x36, 0x12, 0x11, 0x11, 0x11,
+	0x12, 0x30, 0x08, 0x07, 0x1e, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x37, 0x11, 0x33, 0x35, 0x21, 0x35,
+	0x21, 0x15, 0x33, 0x35, 0x27, 0x21, 0x07, 0x15, 0x17, 0x07, 0x11, 0x25, 0x39, 0x01, 0x21, 0x35,
+	0x21, 0xa1, 0x01, 0xca, 0xa1, 0x9f, 0xfd, 0x44, 0x01, 0x2e, 0xef, 0xa1, 0xfe, 0x36, 0xa1, 0x60,
+	0x60, 0x02, 0x1d, 0xfe, 0xd2, 0x01, 0x2e, 0xda, 0x01, 0x03, 0xee, 0xee, 0x2d, 0x41, 0xdb, 0xdb,
+	0xfe, 0x78, 0x7a, 0xfe, 0xfd, 0x14, 0xef, 0x00, 0x00, 0x01, 0x00, 0xae, 0x04, 0x14, 0x01, 0xcc,
+	0x05, 0x9a, 0x00, 0x07, 0x00, 0x2e, 0xb4, 0x05, 0x04, 0x02, 0x00, 0x49, 0x4b, 0xb0, 0x0f, 0x50,
+	0x58, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x00, 0x4e, 0x1b, 0x40,
+	0x0b, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x00, 0x4e, 0x59, 0xb4, 0x13, 0x30,
+	0x02, 0x07, 0x18, 0x2b, 0x13, 0x39, 0x01, 0x33, 0x15, 0x37, 0x35, 0x21, 0xae, 0xa0, 0x7e, 0xfe,
+	0xe2, 0x04, 0xa1, 0x8d, 0x8d, 0xf9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb,
+	0x05, 0x9b, 0x00, 0x0b, 0x00, 0x26, 0x40, 0x23, 0x0b, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x4c, 0x00,
+	0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x11, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x11, 0x11, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x33, 0x39, 0x01, 0x21,
+	0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x03, 0x11, 0xc2, 0x01, 0x09, 0xe5, 0xe5, 0xfe, 0xf7, 0xc2,
+	0xac, 0x04, 0x42, 0xad, 0xfe, 0xf9, 0xfc, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb,
+	0x05, 0x9b, 0x00, 0x0b, 0x00, 0x26, 0x40, 0x23, 0x0b, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x4c, 0x00,
+	0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x11, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x11, 0x11, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x21, 0x39, 0x01, 0x21,
+	0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x13, 0x11, 0x01, 0x09, 0xfe, 0xf7, 0xe5, 0xe5, 0x01, 0x09,
+	0xc2, 0xac, 0x04, 0x42, 0xad, 0xfe, 0xf9, 0xfc, 0x73, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x03, 0x5f, 0x02, 0x3d, 0x05, 0x9a, 0x00, 0x18, 0x00, 0x5e, 0x40, 0x14, 0x17, 0x16, 0x15, 0x12,
+	0x11, 0x10, 0x06, 0x03, 0x04, 0x0b, 0x0a, 0x09, 0x06, 0x05, 0x04, 0x06, 0x01, 0x00, 0x02, 0x4c,
+	0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x16, 0x06, 0x05, 0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03,
+	0x00, 0x67, 0x00, 0x01, 0x01, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x11, 0x01, 0x4e, 0x1b, 0x40, 0x16,
+	0x06, 0x05, 0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x67, 0x00, 0x01, 0x01, 0x04, 0x5f,
+	0x00, 0x04, 0x04, 0x13, 0x01, 0x4e, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x14,
+	0x11, 0x14, 0x14, 0x12, 0x07, 0x07, 0x1b, 0x2b, 0x01, 0x31, 0x15, 0x23, 0x17, 0x07, 0x27, 0x15,
+	0x23, 0x35, 0x07, 0x27, 0x37, 0x23, 0x35, 0x33, 0x27, 0x37, 0x17, 0x35, 0x33, 0x15, 0x37, 0x17,
+	0x07, 0x02, 0x3d, 0xae, 0x7b, 0x42, 0x7b, 0x5d, 0x7b, 0x42, 0x7b, 0xae, 0xae, 0x7b, 0x42, 0x7b,
+	0x5d, 0x7b, 0x42, 0x7b, 0x04, 0xab, 0x5d, 0x7a, 0x42, 0x7b, 0xae, 0xae, 0x7b, 0x41, 0x7b, 0x5d,
+	0x7b, 0x42, 0x7b, 0xad, 0xad, 0x7b, 0x42, 0x7b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf7,
+	0x03, 0xf4, 0x00, 0x0c, 0x00, 0x27, 0x40, 0x24, 0x06, 0x05, 0x02, 0x03, 0x02, 0x01, 0x00, 0x01,
+	0x03, 0x00, 0x67, 0x00, 0x04, 0x04, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x12, 0x01, 0x4e, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x12, 0x07, 0x07, 0x1b, 0x2b, 0x01, 0x31, 0x15,
+	0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x33, 0x11, 0x03, 0xf7, 0xfe, 0x57, 0xa5, 0xfe,
+	0x57, 0x01, 0xa9, 0xa5, 0x02, 0x4c, 0xa4, 0xfe, 0x58, 0x01, 0xa8, 0xa4, 0x01, 0xa8, 0xfe, 0x58,
+	0x00, 0x01, 0x00, 0x00, 0xff, 0x71, 0x01, 0x1c, 0x00, 0xf8, 0x00, 0x07, 0x00, 0x18, 0x40, 0x15,
+	0x05, 0x04, 0x02, 0x00, 0x49, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x13, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x15, 0x39, 0x01, 0x33, 0x15, 0x37, 0x35, 0x21, 0xa0, 0x7c,
+	0xfe, 0xe4, 0x02, 0x8d, 0x8d, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x64, 0x03, 0xf0,
+	0x03, 0x3a, 0x00, 0x05, 0x00, 0x1e, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
+	0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x13,
+	0x03, 0x07, 0x17, 0x2b, 0x01, 0x39, 0x01, 0x35, 0x21, 0x15, 0x03, 0xf0, 0xfc, 0x10, 0x02, 0x64,
+	0xd6, 0xd6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xfe, 0x01, 0x1c, 0x00, 0xf8, 0x00, 0x05,
+	0x00, 0x13, 0x40, 0x10, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11,
+	0x30, 0x02, 0x07, 0x18, 0x2b, 0x15, 0x39, 0x01, 0x21, 0x35, 0x21, 0x01, 0x1c, 0xfe, 0xe4, 0x02,
+	0xfa, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x05, 0x9d, 0x00, 0x05,
+	0x00, 0x13, 0x40, 0x10, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11,
+	0x30, 0x02, 0x07, 0x18, 0x2b, 0x39, 0x02, 0x33, 0x01, 0x23, 0xbe, 0x02, 0x08, 0xbe, 0x05, 0x9d,
+	0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5f, 0x05, 0x9a, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x4c,
+	0x40, 0x0c, 0x08, 0x05, 0x02, 0x03, 0x01, 0x09, 0x04, 0x02, 0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0,
+	0x0f, 0x50, 0x58, 0x40, 0x15, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00,
+	0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x15, 0x00, 0x03, 0x03,
+	0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x59, 0xb6, 0x11, 0x33, 0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x33, 0x39, 0x01, 0x21,
+	0x13, 0x11, 0x03, 0x21, 0x17, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0xcf, 0x01, 0xc3, 0xcd,
+	0xc2, 0xfc, 0xb9, 0xac, 0x02, 0x3e, 0xfe, 0xe1, 0x01, 0x1f, 0x01, 0x06, 0x03, 0x8d, 0x01, 0x07,
+	0xe6, 0xfc, 0x52, 0x18, 0x03, 0x5d, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x02, 0x94,
+	0x05, 0x9a, 0x00, 0x0f, 0x00, 0x48, 0xb5, 0x06, 0x01, 0x03, 0x02, 0x01, 0x4c, 0x4b, 0xb0, 0x0f,
+	0x50, 0x58, 0x40, 0x16, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x11, 0x4d, 0x04, 0x01,
+	0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x16, 0x00, 0x03, 0x03,
+	0x02, 0x5f, 0x00, 0x02, 0x02, 0x13, 0x4d, 0x04, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x59, 0xb7, 0x11, 0x41, 0x12, 0x11, 0x30, 0x05, 0x07, 0x1b, 0x2b, 0x23, 0x39,
+	0x01, 0x21, 0x11, 0x23, 0x11, 0x03, 0x21, 0x13, 0x23, 0x33, 0x23, 0x33, 0x11, 0x23, 0x53, 0x02,
+	0xe7, 0xe9, 0xc1, 0xfe, 0x6c, 0xd7, 0x01, 0x01, 0x01, 0x60, 0xdf, 0x01, 0x1e, 0x03, 0x75, 0x01,
+	0x07, 0xfe, 0xe1, 0xfc, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x7a,
+	0x05, 0x9a, 0x00, 0x1a, 0x00, 0x83, 0x40, 0x0e, 0x0b, 0x08, 0x02, 0x04, 0x02, 0x19, 0x18, 0x07,
+	0x06, 0x04, 0x01, 0x03, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x03, 0x04,
+	0x01, 0x04, 0x03, 0x72, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x11, 0x4d, 0x00, 0x01,
+	0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40,
+	0x1c, 0x00, 0x03, 0x04, 0x01, 0x04, 0x03, 0x72, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02,
+	0x13, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1d,
+	0x00, 0x03, 0x04, 0x01, 0x04, 0x03, 0x01, 0x80, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02,
+	0x13, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0xb7,
+	0x11, 0x34, 0x14, 0x11, 0x30, 0x05, 0x07, 0x1b, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x21, 0x35,
+	0x01, 0x11, 0x03, 0x21, 0x13, 0x15, 0x23, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x31, 0x15,
+	0x31, 0x15, 0x01, 0x31, 0x1e, 0x03, 0x5b, 0xfd, 0xc3, 0x02, 0x3e, 0xcd, 0xfc, 0xa9, 0xc8, 0x01,
+	0x01, 0x01, 0x1e, 0x01, 0x20, 0xfd, 0xc4, 0x01, 0x1f, 0x8b, 0x01, 0x9c, 0x01, 0x4e, 0x01, 0x06,
+	0xfe, 0xfa, 0x50, 0x4c, 0x09, 0x8c, 0x37, 0x17, 0x62, 0xfe, 0x51, 0x00, 0x00, 0x01, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x80, 0x05, 0x9a, 0x00, 0x29, 0x00, 0xcc, 0x40, 0x16, 0x0b, 0x08, 0x02, 0x03,
+	0x01, 0x1c, 0x1b, 0x1a, 0x18, 0x07, 0x06, 0x05, 0x07, 0x05, 0x02, 0x29, 0x04, 0x02, 0x00, 0x04,
+	0x03, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x22, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x72,
+	0x00, 0x05, 0x04, 0x04, 0x05, 0x70, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d,
+	0x00, 0x04, 0x04, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x11, 0x50,
+	0x58, 0x40, 0x22, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x72, 0x00, 0x05, 0x04, 0x04, 0x05, 0x70,
+	0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x60, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x23, 0x00, 0x02, 0x03,
+	0x05, 0x03, 0x02, 0x72, 0x00, 0x05, 0x04, 0x03, 0x05, 0x04, 0x7e, 0x00, 0x03, 0x03, 0x01, 0x5f,
+	0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x1b, 0x40, 0x24, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x80, 0x00, 0x05, 0x04, 0x03, 0x05,
+	0x04, 0x7e, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x09, 0x11, 0x1e, 0x11, 0x34,
+	0x16, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x11, 0x27, 0x37, 0x11, 0x03,
+	0x21, 0x13, 0x15, 0x23, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x15, 0x31, 0x15, 0x31, 0x15, 0x0f,
+	0x01, 0x15, 0x17, 0x15, 0x31, 0x15, 0x31, 0x15, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15,
+	0xf1, 0x01, 0xc2, 0xcd, 0xa8, 0xa8, 0xcd, 0xfc, 0xa3, 0xce, 0x01, 0x01, 0x01, 0x1f, 0x01, 0x1f,
+	0x85, 0x24, 0xa9, 0xfe, 0xe1, 0xfe, 0xe1, 0x01, 0x01, 0x01, 0x06, 0x01, 0x4e, 0x79, 0x79, 0x01,
+	0x4d, 0x01, 0x07, 0xfe, 0xf9, 0x4f, 0x4c, 0x09, 0x8c, 0x37, 0x17, 0x62, 0x64, 0x1a, 0xff, 0x7f,
+	0x63, 0x16, 0x38, 0x8d, 0x0a, 0x4b, 0x50, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5f,
+	0x05, 0x9a, 0x00, 0x0e, 0x00, 0x4a, 0x40, 0x0b, 0x0b, 0x04, 0x02, 0x02, 0x01, 0x0c, 0x01, 0x04,
+	0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x14, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02,
+	0x04, 0x68, 0x03, 0x01, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40,
+	0x14, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x04, 0x68, 0x03, 0x01, 0x01, 0x01, 0x13, 0x4d, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0xb7, 0x13, 0x11, 0x11, 0x12, 0x30, 0x05, 0x07, 0x1b, 0x2b,
+	0x21, 0x39, 0x01, 0x21, 0x11, 0x03, 0x23, 0x11, 0x21, 0x11, 0x21, 0x17, 0x11, 0x13, 0x21, 0x02,
+	0x40, 0x01, 0x1f, 0xc2, 0x5d, 0xfe, 0xe1, 0xfe, 0x35, 0xac, 0xcd, 0x01, 0x71, 0x04, 0x93, 0x01,
+	0x07, 0xfd, 0x46, 0x02, 0xba, 0xe6, 0xfe, 0x14, 0xfe, 0xfa, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x5f, 0x05, 0x9a, 0x00, 0x19, 0x00, 0x9c, 0x40, 0x0c, 0x10, 0x0d, 0x02, 0x02,
+	0x03, 0x19, 0x04, 0x02, 0x00, 0x05, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x24, 0x00,
+	0x06, 0x04, 0x05, 0x05, 0x06, 0x72, 0x00, 0x01, 0x00, 0x04, 0x06, 0x01, 0x04, 0x67, 0x00, 0x02,
+	0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x11, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x60, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x24, 0x00, 0x06, 0x04, 0x05, 0x05,
+	0x06, 0x72, 0x00, 0x01, 0x00, 0x04, 0x06, 0x01, 0x04, 0x67, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00,
+	0x03, 0x03, 0x13, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b,
+	0x40, 0x25, 0x00, 0x06, 0x04, 0x05, 0x04, 0x06, 0x05, 0x80, 0x00, 0x01, 0x00, 0x04, 0x06, 0x01,
+	0x04, 0x67, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x4d, 0x00, 0x05, 0x05, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x0a, 0x11, 0x11, 0x32, 0x12, 0x31,
+	0x32, 0x30, 0x07, 0x07, 0x1d, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x11, 0x21, 0x15, 0x25, 0x35,
+	0x33, 0x31, 0x25, 0x35, 0x03, 0x21, 0x17, 0x11, 0x21, 0x31, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15,
+	0xcf, 0x01, 0xc3, 0xcd, 0xfe, 0xe1, 0xfe, 0xe1, 0x5a, 0x01, 0xe4, 0xc2, 0xfc, 0xb9, 0xac, 0x01,
+	0x1f, 0x01, 0x1f, 0xfe, 0xe1, 0xfe, 0xe1, 0x01, 0x06, 0x02, 0x90, 0x01, 0x01, 0xe5, 0x01, 0x17,
+	0x01, 0x07, 0xe6, 0xfd, 0xc3, 0xfe, 0xa7, 0x83, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x5f, 0x05, 0x9a, 0x00, 0x12, 0x00, 0x18, 0x00, 0x63, 0x40, 0x10, 0x11, 0x0e,
+	0x02, 0x02, 0x03, 0x05, 0x01, 0x05, 0x01, 0x12, 0x04, 0x02, 0x00, 0x04, 0x03, 0x4c, 0x4b, 0xb0,
+	0x0f, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05, 0x67, 0x00, 0x02, 0x02,
+	0x03, 0x5f, 0x00, 0x03, 0x03, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x40, 0x1d, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05, 0x67, 0x00, 0x02, 0x02,
+	0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x59, 0x40, 0x09, 0x11, 0x33, 0x12, 0x31, 0x33, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33,
+	0x39, 0x01, 0x21, 0x13, 0x11, 0x27, 0x23, 0x31, 0x21, 0x35, 0x33, 0x31, 0x25, 0x35, 0x03, 0x21,
+	0x17, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0xcf, 0x01, 0xc3, 0xcd, 0xd0, 0x4f, 0xfe, 0xe1,
+	0x5a, 0x01, 0xe4, 0xc2, 0xfc, 0xb9, 0xac, 0x02, 0x3e, 0xfe, 0xe1, 0x01, 0x1f, 0x01, 0x06, 0x01,
+	0xa2, 0xf9, 0xda, 0x01, 0x17, 0x01, 0x07, 0xe6, 0xfc, 0x52, 0x18, 0x01, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0xff, 0x56, 0xff, 0xff, 0x03, 0x7a, 0x05, 0x9a, 0x00, 0x15, 0x00, 0x71, 0x40, 0x0c,
+	0x08, 0x05, 0x02, 0x03, 0x01, 0x15, 0x04, 0x02, 0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50,
+	0x58, 0x40, 0x17, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x72, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00,
+	0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58,
+	0x40, 0x17, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x72, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01,
+	0x01, 0x13, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x18, 0x00, 0x02, 0x03, 0x00,
+	0x03, 0x02, 0x00, 0x80, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0xb6, 0x11, 0x34, 0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x17,
+	0x39, 0x01, 0x21, 0x01, 0x35, 0x03, 0x21, 0x13, 0x15, 0x23, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21,
+	0x15, 0x31, 0x15, 0x31, 0x15, 0x1f, 0x01, 0x30, 0x02, 0x2b, 0xcd, 0xfc, 0xa9, 0xc8, 0x01, 0x01,
+	0x01, 0x1e, 0x01, 0x20, 0x01, 0x03, 0xa9, 0xeb, 0x01, 0x07, 0xfe, 0xf9, 0x4f, 0x4c, 0x09, 0x8c,
+	0x37, 0x17, 0x62, 0x00, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x80, 0x05, 0x9a, 0x00, 0x13,
+	0x00, 0x20, 0x00, 0x31, 0x00, 0x7e, 0x40, 0x1d, 0x0b, 0x08, 0x02, 0x04, 0x01, 0x30, 0x25, 0x02,
+	0x03, 0x04, 0x1c, 0x1b, 0x1a, 0x10, 0x0f, 0x0e, 0x07, 0x06, 0x05, 0x09, 0x02, 0x03, 0x13, 0x04,
+	0x02, 0x00, 0x02, 0x04, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1f, 0x06, 0x01, 0x03, 0x04,
+	0x02, 0x04, 0x03, 0x02, 0x80, 0x00, 0x04, 0x04, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x05,
+	0x01, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1f, 0x06, 0x01,
+	0x03, 0x04, 0x02, 0x04, 0x03, 0x02, 0x80, 0x00, 0x04, 0x04, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13,
+	0x4d, 0x05, 0x01, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x40, 0x13,
+	0x24, 0x21, 0x17, 0x14, 0x29, 0x28, 0x21, 0x31, 0x24, 0x31, 0x14, 0x20, 0x17, 0x1f, 0x16, 0x30,
+	0x07, 0x07, 0x18, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x11, 0x27, 0x37, 0x11, 0x03, 0x21, 0x13,
+	0x15, 0x23, 0x15, 0x17, 0x07, 0x11, 0x33, 0x15, 0x25, 0x39, 0x01, 0x21, 0x35, 0x23, 0x35, 0x37,
+	0x17, 0x15, 0x23, 0x15, 0x33, 0x03, 0x39, 0x01, 0x2f, 0x01, 0x35, 0x33, 0x35, 0x21, 0x15, 0x31,
+	0x15, 0x23, 0x15, 0x33, 0x15, 0x07, 0xf1, 0x01, 0xc2, 0xcd, 0xa8, 0xa8, 0xcd, 0xfc, 0xa3, 0xce,
+	0x01, 0xa9, 0xa9, 0x01, 0x02, 0x3e, 0xfe, 0xe1, 0x01, 0x90, 0x90, 0x01, 0x01, 0x90, 0x0b, 0x85,
+	0x01, 0x01, 0x1f, 0x01, 0x01, 0x85, 0x01, 0x06, 0x01, 0x4e, 0x79, 0x79, 0x01, 0x4d, 0x01, 0x07,
+	0xfe, 0xf9, 0x4f, 0xfe, 0x79, 0x79, 0xfe, 0xd0, 0x1e, 0x18, 0x8d, 0x24, 0x6c, 0x6c, 0x24, 0x87,
+	0x02, 0x3b, 0x08, 0x64, 0x24, 0x8c, 0x37, 0x12, 0x43, 0x24, 0x64, 0x00, 0x00, 0x02, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x7d, 0x05, 0x9a, 0x00, 0x12, 0x00, 0x18, 0x00, 0x63, 0x40, 0x10, 0x12, 0x04,
+	0x02, 0x04, 0x00, 0x05, 0x01, 0x01, 0x05, 0x11, 0x0e, 0x02, 0x03, 0x02, 0x03, 0x4c, 0x4b, 0xb0,
+	0x0f, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x05, 0x00, 0x01, 0x02, 0x05, 0x01, 0x67, 0x00, 0x04, 0x04,
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x12,
+	0x03, 0x4e, 0x1b, 0x40, 0x1d, 0x00, 0x05, 0x00, 0x01, 0x02, 0x05, 0x01, 0x67, 0x00, 0x04, 0x04,
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x12,
+	0x03, 0x4e, 0x59, 0x40, 0x09, 0x11, 0x33, 0x12, 0x31, 0x33, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x01,
+	0x39, 0x01, 0x21, 0x13, 0x11, 0x17, 0x33, 0x31, 0x21, 0x15, 0x23, 0x31, 0x21, 0x15, 0x13, 0x21,
+	0x37, 0x11, 0x05, 0x39, 0x01, 0x21, 0x11, 0x21, 0x02, 0xb0, 0xfc, 0xa6, 0xcb, 0xd0, 0x4e, 0x01,
+	0x1f, 0x59, 0xfe, 0x1c, 0xc1, 0x01, 0xce, 0xcd, 0xfd, 0xc2, 0x01, 0x20, 0xfe, 0xe1, 0x05, 0x9a,
+	0xfe, 0xf9, 0xfe, 0x5f, 0xf9, 0xdb, 0x18, 0xfe, 0xfa, 0xe5, 0x03, 0xae, 0x18, 0xfe, 0x9c, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x02, 0xfe, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x1d,
+	0x40, 0x1a, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x31, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x39, 0x02, 0x21,
+	0x35, 0x21, 0x11, 0x39, 0x01, 0x21, 0x35, 0x21, 0x01, 0x1d, 0xfe, 0xe3, 0x01, 0x1d, 0xfe, 0xe3,
+	0xf9, 0x01, 0x0b, 0xfa, 0x00, 0x02, 0x00, 0x00, 0xff, 0x73, 0x01, 0x1d, 0x02, 0xfd, 0x00, 0x07,
+	0x00, 0x0d, 0x00, 0x27, 0x40, 0x24, 0x05, 0x04, 0x02, 0x00, 0x49, 0x00, 0x03, 0x00, 0x02, 0x01,
+	0x03, 0x02, 0x67, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
+	0x01, 0x00, 0x4f, 0x11, 0x31, 0x13, 0x30, 0x04, 0x06, 0x1a, 0x2b, 0x39, 0x02, 0x33, 0x15, 0x37,
+	0x35, 0x21, 0x11, 0x39, 0x01, 0x21, 0x35, 0x21, 0xa0, 0x7d, 0xfe, 0xe3, 0x01, 0x1d, 0xfe, 0xe3,
+	0x8d, 0x8d, 0xf9, 0x01, 0x0b, 0xf9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74, 0x02, 0x7a,
+	0x03, 0x7a, 0x00, 0x07, 0x00, 0x1f, 0x40, 0x1c, 0x07, 0x04, 0x02, 0x00, 0x01, 0x01, 0x4c, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x12,
+	0x30, 0x02, 0x07, 0x18, 0x2b, 0x25, 0x39, 0x01, 0x23, 0x09, 0x01, 0x33, 0x01, 0x02, 0x7a, 0xfd,
+	0xfe, 0x83, 0x01, 0x7d, 0xfd, 0xfe, 0x83, 0x74, 0x01, 0x83, 0x01, 0x83, 0xfe, 0x7d, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x01, 0x22, 0x02, 0xf5, 0x02, 0xf3, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x2f,
+	0x40, 0x2c, 0x00, 0x02, 0x05, 0x01, 0x03, 0x00, 0x02, 0x03, 0x67, 0x00, 0x00, 0x01, 0x01, 0x00,
+	0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x04, 0x01, 0x01, 0x00, 0x01, 0x4f, 0x06, 0x06, 0x00, 0x00,
+	0x06, 0x0b, 0x06, 0x0b, 0x0a, 0x09, 0x00, 0x05, 0x00, 0x05, 0x13, 0x06, 0x07, 0x17, 0x2b, 0x01,
+	0x39, 0x01, 0x35, 0x21, 0x15, 0x01, 0x39, 0x01, 0x35, 0x21, 0x15, 0x02, 0xf5, 0xfd, 0x0b, 0x02,
+	0xf5, 0xfd, 0x0b, 0x01, 0x22, 0xa4, 0xa4, 0x01, 0x2d, 0xa4, 0xa4, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x74, 0x02, 0x7a, 0x03, 0x7a, 0x00, 0x07, 0x00, 0x1f, 0x40, 0x1c, 0x07, 0x04, 0x02, 0x00,
+	0x01, 0x01, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
+	0x01, 0x00, 0x4f, 0x12, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x35, 0x39, 0x01, 0x33, 0x09, 0x01, 0x23,
+	0x01, 0xfe, 0x01, 0x7c, 0xfe, 0x84, 0xfe, 0x01, 0x7d, 0x74, 0x01, 0x83, 0x01, 0x83, 0xfe, 0x7d,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5d, 0x05, 0x9a, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x9a,
+	0x40, 0x0e, 0x0a, 0x07, 0x02, 0x03, 0x01, 0x18, 0x17, 0x05, 0x04, 0x04, 0x00, 0x02, 0x02, 0x4c,
+	0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x23, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x72, 0x00, 0x00,
+	0x05, 0x03, 0x00, 0x05, 0x7e, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00,
+	0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x12, 0x04, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58,
+	0x40, 0x23, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x72, 0x00, 0x00, 0x05, 0x03, 0x00, 0x05, 0x7e,
+	0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00,
+	0x04, 0x04, 0x12, 0x04, 0x4e, 0x1b, 0x40, 0x24, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00, 0x80,
+	0x00, 0x00, 0x05, 0x03, 0x00, 0x05, 0x7e, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13,
+	0x4d, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x12, 0x04, 0x4e, 0x59, 0x59, 0x40, 0x09,
+	0x11, 0x38, 0x11, 0x34, 0x15, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x01, 0x39, 0x01, 0x21, 0x35, 0x01,
+	0x3d, 0x01, 0x03, 0x21, 0x03, 0x15, 0x31, 0x15, 0x31, 0x15, 0x21, 0x35, 0x21, 0x15, 0x31, 0x15,
+	0x31, 0x15, 0x03, 0x31, 0x03, 0x39, 0x01, 0x21, 0x35, 0x21, 0x01, 0x3f, 0x01, 0x1d, 0x01, 0x01,
+	0xcd, 0xfe, 0x3d, 0xcd, 0x01, 0x1f, 0x01, 0x1f, 0xfe, 0x01, 0x01, 0x1d, 0xfe, 0xe3, 0x01, 0x6c,
+	0xe3, 0x01, 0x0e, 0x39, 0xfd, 0x01, 0x07, 0xfe, 0xf9, 0x4f, 0x4c, 0x09, 0x8c, 0x37, 0x17, 0x62,
+	0xfe, 0xdf, 0xfd, 0x56, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80,
+	0x05, 0x9a, 0x00, 0x1d, 0x00, 0x7d, 0xb5, 0x0f, 0x01, 0x03, 0x02, 0x01, 0x4c, 0x4b, 0xb0, 0x0f,
+	0x50, 0x58, 0x40, 0x2d, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05, 0x02, 0x67, 0x00, 0x03, 0x00, 0x04,
+	0x01, 0x03, 0x04, 0x67, 0x00, 0x06, 0x00, 0x01, 0x08, 0x06, 0x01, 0x67, 0x00, 0x07, 0x07, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x11, 0x4d, 0x00, 0x08, 0x08, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x12, 0x09,
+	0x4e, 0x1b, 0x40, 0x2d, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05, 0x02, 0x67, 0x00, 0x03, 0x00, 0x04,
+	0x01, 0x03, 0x04, 0x67, 0x00, 0x06, 0x00, 0x01, 0x08, 0x06, 0x01, 0x67, 0x00, 0x07, 0x07, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x13, 0x4d, 0x00, 0x08, 0x08, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x12, 0x09,
+	0x4e, 0x59, 0x40, 0x0e, 0x1d, 0x1c, 0x31, 0x11, 0x31, 0x12, 0x11, 0x11, 0x13, 0x13, 0x20, 0x0a,
+	0x07, 0x1f, 0x2b, 0x11, 0x31, 0x21, 0x11, 0x1d, 0x01, 0x21, 0x35, 0x23, 0x11, 0x21, 0x11, 0x33,
+	0x07, 0x21, 0x11, 0x37, 0x21, 0x11, 0x33, 0x31, 0x33, 0x11, 0x21, 0x11, 0x21, 0x31, 0x21, 0x15,
+	0x21, 0x05, 0x80, 0xfd, 0xca, 0x01, 0xfe, 0xeb, 0xd5, 0x8c, 0xfe, 0xf9, 0x93, 0x01, 0xfd, 0x49,
+	0x90, 0xfb, 0xc2, 0x03, 0xa5, 0x01, 0x3a, 0xfa, 0x80, 0x05, 0x9a, 0xfc, 0x01, 0x2a, 0x77, 0x0b,
+	0x02, 0x91, 0xfe, 0x72, 0xbe, 0x02, 0x43, 0xc8, 0xfd, 0x46, 0x03, 0x5e, 0xfb, 0xa8, 0xa1, 0x00,
+	0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x58, 0x05, 0x98, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0xa0,
+	0xb6, 0x09, 0x02, 0x02, 0x05, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1a, 0x00,
+	0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03,
+	0x11, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
+	0x1a, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x06, 0x01,
+	0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50,
+	0x58, 0x40, 0x1a, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f,
+	0x06, 0x01, 0x03, 0x03, 0x11, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1a,
+	0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x06, 0x01, 0x03,
+	0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x10, 0x00,
+	0x00, 0x0f, 0x0e, 0x0d, 0x0b, 0x00, 0x0a, 0x00, 0x0a, 0x11, 0x11, 0x13, 0x07, 0x07, 0x19, 0x2b,
+	0x01, 0x31, 0x13, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x27, 0x01, 0x31, 0x21, 0x11, 0x21,
+	0x02, 0x98, 0xc0, 0xfe, 0xe3, 0xfe, 0xe3, 0xfe, 0xe3, 0xab, 0x01, 0xc8, 0x01, 0x1d, 0xfe, 0xe3,
+	0x05, 0x98, 0xfe, 0xfa, 0xfb, 0x6e, 0x02, 0x3d, 0xfd, 0xc3, 0x04, 0xb3, 0xe5, 0xfd, 0xc3, 0x01,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x58, 0x05, 0x98, 0x00, 0x0c,
+	0x00, 0x11, 0x00, 0x16, 0x00, 0xb3, 0x40, 0x14, 0x0a, 0x00, 0x02, 0x02, 0x01, 0x02, 0x01, 0x03,
+	0x02, 0x04, 0x03, 0x02, 0x05, 0x03, 0x05, 0x01, 0x00, 0x04, 0x04, 0x4c, 0x4b, 0xb0, 0x0f, 0x50,
+	0x58, 0x40, 0x1d, 0x00, 0x03, 0x00, 0x05, 0x04, 0x03, 0x05, 0x67, 0x00, 0x02, 0x02, 0x01, 0x5f,
+	0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x03, 0x00, 0x05, 0x04, 0x03, 0x05, 0x67,
+	0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x03, 0x00,
+	0x05, 0x04, 0x03, 0x05, 0x67, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00,
+	0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1d, 0x00, 0x03, 0x00,
+	0x05, 0x04, 0x03, 0x05, 0x67, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00,
+	0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x09, 0x11,
+	0x21, 0x11, 0x21, 0x14, 0x16, 0x06, 0x07, 0x1c, 0x2b, 0x01, 0x31, 0x11, 0x07, 0x17, 0x11, 0x03,
+	0x21, 0x39, 0x01, 0x11, 0x27, 0x21, 0x03, 0x31, 0x21, 0x11, 0x21, 0x01, 0x31, 0x21, 0x11, 0x21,
+	0x03, 0x58, 0x72, 0x72, 0xc0, 0xfd, 0x69, 0xab, 0x03, 0x42, 0x5d, 0xfe, 0xe3, 0x01, 0x1d, 0xfe,
+	0xe3, 0x01, 0x1d, 0xfe, 0xe3, 0x04, 0x92, 0xfe, 0xce, 0x90, 0x92, 0xfe, 0xc8, 0xfe, 0xfa, 0x04,
+	0xb3, 0xe5, 0xfe, 0xe2, 0xfe, 0xe1, 0xfd, 0xc3, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x58, 0x05, 0x98, 0x00, 0x12, 0x00, 0xfe, 0x40, 0x0b, 0x10, 0x0d, 0x02, 0x03,
+	0x05, 0x04, 0x01, 0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x23, 0x00, 0x04,
+	0x03, 0x01, 0x03, 0x04, 0x72, 0x00, 0x01, 0x02, 0x02, 0x01, 0x70, 0x00, 0x03, 0x03, 0x05, 0x5f,
+	0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x06, 0x01, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x23, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x72,
+	0x00, 0x01, 0x02, 0x02, 0x01, 0x70, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x4d,
+	0x00, 0x02, 0x02, 0x00, 0x60, 0x06, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17,
+	0x50, 0x58, 0x40, 0x25, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x80, 0x00, 0x01, 0x02, 0x03,
+	0x01, 0x02, 0x7e, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x4d, 0x00, 0x02, 0x02,
+	0x00, 0x60, 0x06, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40,
+	0x25, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x80, 0x00, 0x01, 0x02, 0x03, 0x01, 0x02, 0x7e,
+	0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x06,
+	0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x25, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01,
+	0x80, 0x00, 0x01, 0x02, 0x03, 0x01, 0x02, 0x7e, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05,
+	0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x06, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59,
+	0x59, 0x59, 0x40, 0x13, 0x03, 0x00, 0x0f, 0x0e, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05,
+	0x00, 0x12, 0x03, 0x11, 0x07, 0x07, 0x16, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x35, 0x21, 0x15,
+	0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x03, 0x21, 0x17, 0x11, 0x31, 0x01, 0x02, 0x8b, 0xcc, 0xfe,
+	0xe3, 0xfe, 0xe3, 0x01, 0x1d, 0x01, 0x1d, 0xc0, 0xfc, 0xbe, 0xab, 0x01, 0x06, 0x9a, 0x82, 0x03,
+	0x5c, 0x82, 0x9a, 0x01, 0x06, 0xe5, 0xfb, 0x4d, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x58,
+	0x05, 0x98, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x94, 0x40, 0x0b, 0x08, 0x05, 0x02, 0x03, 0x01, 0x04,
+	0x01, 0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x16, 0x00, 0x03, 0x03, 0x01,
+	0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x04, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x16, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00,
+	0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x16, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01,
+	0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40,
+	0x16, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f,
+	0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x0f, 0x03, 0x00, 0x10, 0x0f,
+	0x0e, 0x0b, 0x07, 0x06, 0x00, 0x0a, 0x03, 0x09, 0x05, 0x07, 0x16, 0x2b, 0x33, 0x39, 0x01, 0x21,
+	0x13, 0x11, 0x03, 0x21, 0x17, 0x11, 0x31, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x01, 0x02, 0x8b,
+	0xcc, 0xc0, 0xfc, 0xbe, 0xab, 0x02, 0x3a, 0xfe, 0xe3, 0x01, 0x1d, 0x01, 0x06, 0x03, 0x8c, 0x01,
+	0x06, 0xe5, 0xfb, 0x4d, 0x01, 0x1e, 0x03, 0x5c, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x58,
+	0x05, 0x98, 0x00, 0x15, 0x01, 0x1e, 0x40, 0x0b, 0x15, 0x12, 0x02, 0x01, 0x07, 0x0d, 0x01, 0x06,
+	0x04, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x2b, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+	0x72, 0x00, 0x05, 0x03, 0x04, 0x04, 0x05, 0x72, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67,
+	0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00,
+	0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x2b, 0x00, 0x00, 0x01,
+	0x02, 0x01, 0x00, 0x72, 0x00, 0x05, 0x03, 0x04, 0x04, 0x05, 0x72, 0x00, 0x02, 0x00, 0x03, 0x05,
+	0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d, 0x00, 0x04, 0x04,
+	0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2d,
+	0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04, 0x80,
+	0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07,
+	0x13, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0,
+	0x1b, 0x50, 0x58, 0x40, 0x2d, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03,
+	0x04, 0x03, 0x05, 0x04, 0x80, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01,
+	0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12,
+	0x06, 0x4e, 0x1b, 0x40, 0x2d, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03,
+	0x04, 0x03, 0x05, 0x04, 0x80, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01,
+	0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12,
+	0x06, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x40, 0x0b, 0x14, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20,
+	0x08, 0x07, 0x1e, 0x2b, 0x01, 0x31, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35,
+	0x21, 0x15, 0x03, 0x21, 0x39, 0x01, 0x11, 0x27, 0x21, 0x13, 0x03, 0x58, 0xfe, 0xe3, 0xfe, 0xe3,
+	0x01, 0x21, 0xfe, 0xdf, 0x01, 0x1d, 0x01, 0x1d, 0xcc, 0xfd, 0x75, 0xab, 0x03, 0x42, 0xc0, 0x03,
+	0xf8, 0x82, 0xfe, 0xe1, 0xfe, 0xe2, 0xfe, 0xe1, 0x82, 0x9a, 0xfe, 0xfa, 0x04, 0xb3, 0xe5, 0xfe,
+	0xfa, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x58, 0x05, 0x98, 0x00, 0x10,
+	0x00, 0xd8, 0xb6, 0x10, 0x0d, 0x02, 0x01, 0x05, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
+	0x1f, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67,
+	0x00, 0x01, 0x01, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x12, 0x04, 0x4e,
+	0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00,
+	0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13,
+	0x4d, 0x00, 0x04, 0x04, 0x12, 0x04, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x20, 0x00,
+	0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00,
+	0x01, 0x01, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x12, 0x04, 0x4e, 0x1b,
+	0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x20, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00,
+	0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11,
+	0x4d, 0x00, 0x04, 0x04, 0x12, 0x04, 0x4e, 0x1b, 0x40, 0x20, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+	0x02, 0x80, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x05, 0x5f, 0x00,
+	0x05, 0x05, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x12, 0x04, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x40, 0x09,
+	0x14, 0x11, 0x11, 0x11, 0x11, 0x20, 0x06, 0x07, 0x1c, 0x2b, 0x01, 0x31, 0x21, 0x35, 0x21, 0x11,
+	0x21, 0x11, 0x21, 0x11, 0x21, 0x39, 0x01, 0x11, 0x27, 0x21, 0x13, 0x03, 0x58, 0xfe, 0xe3, 0xfe,
+	0xe3, 0x01, 0x21, 0xfe, 0xdf, 0xfe, 0xe3, 0xab, 0x03, 0x42, 0xc0, 0x03, 0xf8, 0x82, 0xfe, 0xe1,
+	0xfe, 0xe2, 0xfd, 0xc3, 0x04, 0xb3, 0xe5, 0xfe, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x58, 0x05, 0x98, 0x00, 0x19, 0x00, 0xf7, 0x40, 0x0b, 0x19, 0x16, 0x02, 0x01,
+	0x06, 0x11, 0x01, 0x05, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x24, 0x00, 0x00,
+	0x01, 0x04, 0x01, 0x00, 0x72, 0x00, 0x04, 0x00, 0x03, 0x02, 0x04, 0x03, 0x67, 0x00, 0x01, 0x01,
+	0x06, 0x5f, 0x00, 0x06, 0x06, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x12,
+	0x05, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x24, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
+	0x72, 0x00, 0x04, 0x00, 0x03, 0x02, 0x04, 0x03, 0x67, 0x00, 0x01, 0x01, 0x06, 0x5f, 0x00, 0x06,
+	0x06, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x12, 0x05, 0x4e, 0x1b, 0x4b,
+	0xb0, 0x17, 0x50, 0x58, 0x40, 0x25, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x04, 0x80, 0x00, 0x04,
+	0x00, 0x03, 0x02, 0x04, 0x03, 0x67, 0x00, 0x01, 0x01, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x4d,
+	0x00, 0x02, 0x02, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x12, 0x05, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50,
+	0x58, 0x40, 0x25, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x04, 0x80, 0x00, 0x04, 0x00, 0x03, 0x02,
+	0x04, 0x03, 0x67, 0x00, 0x01, 0x01, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x11, 0x4d, 0x00, 0x02, 0x02,
+	0x05, 0x5f, 0x00, 0x05, 0x05, 0x12, 0x05, 0x4e, 0x1b, 0x40, 0x25, 0x00, 0x00, 0x01, 0x04, 0x01,
+	0x00, 0x04, 0x80, 0x00, 0x04, 0x00, 0x03, 0x02, 0x04, 0x03, 0x67, 0x00, 0x01, 0x01, 0x06, 0x5f,
+	0x00, 0x06, 0x06, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x12, 0x05, 0x4e,
+	0x59, 0x59, 0x59, 0x59, 0x40, 0x0a, 0x14, 0x16, 0x11, 0x13, 0x11, 0x11, 0x20, 0x07, 0x07, 0x1d,
+	0x2b, 0x01, 0x31, 0x21, 0x35, 0x21, 0x11, 0x21, 0x35, 0x31, 0x35, 0x23, 0x11, 0x21, 0x1d, 0x04,
+	0x03, 0x21, 0x39, 0x01, 0x11, 0x27, 0x21, 0x13, 0x03, 0x58, 0xfe, 0xe3, 0xfe, 0xe3, 0x01, 0x1d,
+	0x97, 0x01, 0xb4, 0xcc, 0xfd, 0x75, 0xab, 0x03, 0x42, 0xc0, 0x03, 0xf8, 0x82, 0xfc, 0xa4, 0x82,
+	0x9d, 0x01, 0x1e, 0x8d, 0x91, 0x9d, 0x1c, 0x7e, 0xfe, 0xfa, 0x04, 0xb3, 0xe5, 0xfe, 0xfa, 0x00,
+	0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x58, 0x05, 0x98, 0x00, 0x12, 0x00, 0x8e, 0xb6, 0x09,
+	0x02, 0x02, 0x04, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x16, 0x00, 0x04, 0x00,
+	0x01, 0x00, 0x04, 0x01, 0x67, 0x06, 0x05, 0x02, 0x03, 0x03, 0x11, 0x4d, 0x02, 0x01, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x16, 0x00, 0x04, 0x00, 0x01, 0x00,
+	0x04, 0x01, 0x67, 0x06, 0x05, 0x02, 0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x16, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01,
+	0x67, 0x06, 0x05, 0x02, 0x03, 0x03, 0x11, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b,
+	0x40, 0x16, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x06, 0x05, 0x02, 0x03, 0x03, 0x13,
+	0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x12, 0x13, 0x12, 0x11, 0x11, 0x13, 0x07, 0x07, 0x1b, 0x2b, 0x01, 0x31, 0x13, 0x11,
+	0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x27, 0x21, 0x11, 0x31, 0x15, 0x21, 0x11, 0x31, 0x11, 0x02,
+	0x98, 0xc0, 0xfe, 0xe3, 0xfe, 0xe3, 0xfe, 0xe3, 0xab, 0x01, 0xc8, 0x01, 0x1d, 0x05, 0x98, 0xfe,
+	0xfa, 0xfb, 0x6e, 0x02, 0x3d, 0xfd, 0xc3, 0x04, 0xb3, 0xe5, 0xfd, 0xfe, 0x3b, 0x01, 0x1f, 0x01,
+	0x1e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x01, 0x1e, 0x05, 0x98, 0x00, 0x08,
+	0x00, 0x57, 0xb5, 0x08, 0x01, 0x00, 0x01, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x0b,
+	0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50,
+	0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b,
+	0xb0, 0x1b, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x1b, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59,
+	0x59, 0x59, 0xb4, 0x13, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x31, 0x11,
+	0x21, 0x17, 0x01, 0x01, 0x1d, 0xfe, 0x38, 0xab, 0x03, 0x96, 0x02, 0x02, 0xe5, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x57, 0x05, 0x98, 0x00, 0x0f, 0x00, 0xda, 0x40, 0x0a,
+	0x05, 0x01, 0x02, 0x01, 0x04, 0x01, 0x00, 0x03, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
+	0x1d, 0x00, 0x04, 0x02, 0x03, 0x03, 0x04, 0x72, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01,
+	0x11, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x60, 0x05, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b,
+	0xb0, 0x13, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x04, 0x02, 0x03, 0x03, 0x04, 0x72, 0x00, 0x02, 0x02,
+	0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x60, 0x05, 0x01, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1e, 0x00, 0x04, 0x02, 0x03, 0x02,
+	0x04, 0x03, 0x80, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x03, 0x03,
+	0x00, 0x60, 0x05, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40,
+	0x1e, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x80, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01,
+	0x01, 0x11, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x60, 0x05, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b,
+	0x40, 0x1e, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x80, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00,
+	0x01, 0x01, 0x13, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x60, 0x05, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x59, 0x59, 0x59, 0x59, 0x40, 0x11, 0x03, 0x00, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06,
+	0x00, 0x0f, 0x03, 0x0e, 0x06, 0x07, 0x16, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x11, 0x03, 0x21, 0x13,
+	0x33, 0x11, 0x21, 0x35, 0x21, 0x11, 0x31, 0x02, 0x8b, 0xcc, 0xc0, 0xfe, 0x14, 0xd5, 0xba, 0xfe,
+	0xe3, 0xfe, 0xe3, 0x01, 0x06, 0x03, 0x8c, 0x01, 0x06, 0xfe, 0xe2, 0xfc, 0xa4, 0x83, 0xfe, 0x5f,
+	0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x57, 0x05, 0x98, 0x00, 0x13, 0x00, 0x8c, 0x40, 0x0d,
+	0x0b, 0x02, 0x00, 0x03, 0x04, 0x03, 0x04, 0x03, 0x02, 0x01, 0x04, 0x02, 0x4c, 0x4b, 0xb0, 0x0f,
+	0x50, 0x58, 0x40, 0x15, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x05, 0x01, 0x03, 0x03,
+	0x11, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
+	0x15, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x05, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x02,
+	0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x15, 0x00, 0x04,
+	0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x05, 0x01, 0x03, 0x03, 0x11, 0x4d, 0x02, 0x01, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x40, 0x15, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x05, 0x01,
+	0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x09,
+	0x11, 0x13, 0x12, 0x11, 0x11, 0x15, 0x06, 0x07, 0x1c, 0x2b, 0x01, 0x31, 0x11, 0x07, 0x17, 0x11,
+	0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x27, 0x21, 0x11, 0x31, 0x15, 0x21, 0x11, 0x33, 0x03, 0x57,
+	0x72, 0x72, 0xfe, 0xe4, 0xfe, 0xe3, 0xfe, 0xe3, 0xab, 0x01, 0xc8, 0x01, 0x1d, 0x5c, 0x04, 0x92,
+	0xfe, 0xce, 0x90, 0x91, 0xfd, 0xc1, 0x02, 0x3e, 0xfd, 0xc4, 0x04, 0xb1, 0xe5, 0xfd, 0xfe, 0x3a,
+	0x02, 0x3c, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x58, 0x05, 0x98, 0x00, 0x0f,
+	0x00, 0xbf, 0x40, 0x0a, 0x0d, 0x01, 0x01, 0x03, 0x04, 0x01, 0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0,
+	0x0f, 0x50, 0x58, 0x40, 0x18, 0x00, 0x01, 0x03, 0x02, 0x02, 0x01, 0x72, 0x00, 0x03, 0x03, 0x11,
+	0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0,
+	0x13, 0x50, 0x58, 0x40, 0x18, 0x00, 0x01, 0x03, 0x02, 0x02, 0x01, 0x72, 0x00, 0x03, 0x03, 0x13,
+	0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0,
+	0x17, 0x50, 0x58, 0x40, 0x19, 0x00, 0x01, 0x03, 0x02, 0x03, 0x01, 0x02, 0x80, 0x00, 0x03, 0x03,
+	0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b,
+	0xb0, 0x1b, 0x50, 0x58, 0x40, 0x19, 0x00, 0x01, 0x03, 0x02, 0x03, 0x01, 0x02, 0x80, 0x00, 0x03,
+	0x03, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b,
+	0x40, 0x19, 0x00, 0x01, 0x03, 0x02, 0x03, 0x01, 0x02, 0x80, 0x00, 0x03, 0x03, 0x13, 0x4d, 0x00,
+	0x02, 0x02, 0x00, 0x60, 0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x40,
+	0x0f, 0x03, 0x00, 0x0c, 0x0b, 0x08, 0x07, 0x06, 0x05, 0x00, 0x0f, 0x03, 0x0e, 0x05, 0x07, 0x16,
+	0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x35, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x17, 0x11,
+	0x31, 0x01, 0x02, 0x8b, 0xcc, 0xfe, 0xe3, 0xfe, 0xe3, 0x01, 0xfe, 0x39, 0xab, 0x01, 0x06, 0x9b,
+	0x83, 0x02, 0x7e, 0x01, 0xfc, 0xe5, 0xfb, 0x4d, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x04, 0xed,
+	0x05, 0x98, 0x00, 0x12, 0x00, 0x62, 0x40, 0x0b, 0x0d, 0x0a, 0x07, 0x06, 0x05, 0x02, 0x06, 0x00,
+	0x02, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x0c, 0x00, 0x02, 0x02, 0x11, 0x4d, 0x01,
+	0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0c, 0x00, 0x02,
+	0x02, 0x13, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58,
+	0x40, 0x0c, 0x00, 0x02, 0x02, 0x11, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40,
+	0x0c, 0x00, 0x02, 0x02, 0x13, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59,
+	0xb5, 0x12, 0x14, 0x13, 0x03, 0x07, 0x19, 0x2b, 0x01, 0x31, 0x17, 0x11, 0x21, 0x11, 0x09, 0x01,
+	0x11, 0x21, 0x11, 0x27, 0x21, 0x01, 0x13, 0x31, 0x13, 0x31, 0x35, 0x04, 0x40, 0xad, 0xfe, 0xe3,
+	0xfe, 0xaf, 0xfe, 0x9f, 0xfe, 0xe3, 0xab, 0x01, 0x64, 0x01, 0xc8, 0xfd, 0xc1, 0x05, 0x7d, 0xeb,
+	0xfb, 0x6e, 0x03, 0x14, 0xfe, 0x4a, 0x01, 0xd5, 0xfc, 0xcd, 0x04, 0xb3, 0xe5, 0xfd, 0x8d, 0x01,
+	0x55, 0x01, 0x04, 0x01, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0xae, 0x05, 0x9a, 0x00, 0x12,
+	0x00, 0x42, 0x40, 0x0a, 0x0f, 0x09, 0x06, 0x05, 0x02, 0x05, 0x00, 0x02, 0x01, 0x4c, 0x4b, 0xb0,
+	0x0f, 0x50, 0x58, 0x40, 0x0e, 0x04, 0x03, 0x02, 0x02, 0x02, 0x11, 0x4d, 0x01, 0x01, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x40, 0x0e, 0x04, 0x03, 0x02, 0x02, 0x02, 0x13, 0x4d, 0x01, 0x01, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x59, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x22, 0x13, 0x13,
+	0x05, 0x07, 0x19, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x21, 0x11, 0x01, 0x11, 0x21, 0x11, 0x27, 0x33,
+	0x21, 0x33, 0x17, 0x01, 0x11, 0x31, 0x11, 0x02, 0xec, 0xc2, 0xfe, 0xe0, 0xfe, 0x94, 0xfe, 0xe1,
+	0xad, 0x02, 0x01, 0x5d, 0x08, 0x2c, 0x01, 0xa5, 0x05, 0x9a, 0xfe, 0xfa, 0xfb, 0x6c, 0x01, 0x9c,
+	0x01, 0xc4, 0xfc, 0xa0, 0x04, 0xb5, 0xe5, 0x40, 0xfd, 0xf4, 0x01, 0x2e, 0x01, 0x1e, 0x00, 0x00,
+	0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x62, 0x05, 0x9b, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x2b,
+	0x40, 0x28, 0x08, 0x05, 0x02, 0x03, 0x01, 0x09, 0x04, 0x02, 0x00, 0x02, 0x02, 0x4c, 0x00, 0x03,
+	0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x11, 0x33, 0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13,
+	0x11, 0x03, 0x21, 0x17, 0x03, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0xd0, 0x01, 0xc4, 0xce, 0xc2,
+	0xfc, 0xb6, 0xad, 0x01, 0x02, 0x40, 0xfe, 0xe0, 0x01, 0x20, 0x01, 0x07, 0x03, 0x8d, 0x01, 0x07,
+	0xe6, 0xfc, 0x52, 0x18, 0x03, 0x5d, 0x00, 0x00, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x62,
+	0x05, 0x9b, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x38, 0x40, 0x35, 0x0c, 0x09, 0x02, 0x04, 0x02, 0x08,
+	0x01, 0x03, 0x04, 0x02, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x01, 0x67, 0x00, 0x04, 0x04,
+	0x02, 0x5f, 0x00, 0x02, 0x02, 0x11, 0x4d, 0x05, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x03, 0x00,
+	0x14, 0x13, 0x12, 0x0f, 0x0b, 0x0a, 0x07, 0x06, 0x00, 0x0e, 0x03, 0x0d, 0x06, 0x07, 0x16, 0x2b,
+	0x33, 0x39, 0x01, 0x21, 0x11, 0x33, 0x35, 0x21, 0x13, 0x11, 0x03, 0x21, 0x17, 0x11, 0x31, 0x01,
+	0x39, 0x01, 0x21, 0x11, 0x21, 0x03, 0x01, 0x1e, 0x01, 0x01, 0x7b, 0xc5, 0xc2, 0xfc, 0xb6, 0xad,
+	0x02, 0x3f, 0xfe, 0xe0, 0x01, 0x20, 0x01, 0xe2, 0x5c, 0x01, 0x23, 0x01, 0x33, 0x01, 0x07, 0xe6,
+	0xfb, 0x4b, 0x03, 0x5d, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x04, 0x78,
+	0x05, 0x9b, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x68, 0x40, 0x14, 0x0a, 0x07, 0x02, 0x05, 0x02, 0x12,
+	0x01, 0x04, 0x05, 0x0b, 0x01, 0x03, 0x04, 0x06, 0x03, 0x02, 0x00, 0x03, 0x04, 0x4c, 0x4b, 0xb0,
+	0x09, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x04, 0x05, 0x03, 0x03, 0x04, 0x72, 0x00, 0x05, 0x05, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x11, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x60, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x40, 0x1e, 0x00, 0x04, 0x05, 0x03, 0x05, 0x04, 0x03, 0x80, 0x00, 0x05, 0x05,
+	0x02, 0x5f, 0x00, 0x02, 0x02, 0x11, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x60, 0x01, 0x01, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x59, 0x40, 0x09, 0x12, 0x21, 0x23, 0x13, 0x12, 0x20, 0x06, 0x07, 0x1c, 0x2b,
+	0x25, 0x31, 0x21, 0x27, 0x07, 0x21, 0x03, 0x13, 0x27, 0x21, 0x13, 0x11, 0x05, 0x31, 0x21, 0x03,
+	0x3b, 0x01, 0x27, 0x11, 0x21, 0x04, 0x78, 0xfe, 0xa3, 0x44, 0x43, 0xfe, 0x3c, 0xce, 0x01, 0xad,
+	0x03, 0x4a, 0xc2, 0xfd, 0xc0, 0x01, 0x13, 0xe6, 0xf3, 0x55, 0x55, 0xfe, 0xe0, 0x01, 0x54, 0x55,
+	0x01, 0x07, 0x03, 0xae, 0xe6, 0xfe, 0xf9, 0xfc, 0xc7, 0x3c, 0x01, 0x1e, 0x35, 0x02, 0x0a, 0x00,
+	0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x62, 0x05, 0x9b, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x40,
+	0x40, 0x3d, 0x14, 0x11, 0x02, 0x05, 0x03, 0x10, 0x01, 0x04, 0x05, 0x0f, 0x0e, 0x02, 0x01, 0x04,
+	0x03, 0x4c, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x00,
+	0x03, 0x03, 0x11, 0x4d, 0x02, 0x06, 0x02, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x03, 0x00, 0x1c, 0x1b,
+	0x1a, 0x17, 0x13, 0x12, 0x0b, 0x08, 0x07, 0x06, 0x00, 0x16, 0x03, 0x15, 0x07, 0x07, 0x16, 0x2b,
+	0x33, 0x39, 0x01, 0x21, 0x11, 0x33, 0x35, 0x21, 0x11, 0x39, 0x01, 0x21, 0x11, 0x33, 0x35, 0x27,
+	0x37, 0x11, 0x03, 0x21, 0x17, 0x11, 0x31, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x03, 0x01, 0x1e,
+	0x01, 0x01, 0x20, 0x01, 0x1f, 0x01, 0x73, 0x73, 0xc2, 0xfc, 0xb6, 0xad, 0x02, 0x3f, 0xfe, 0xe0,
+	0x01, 0x20, 0x01, 0xe2, 0x5c, 0xfd, 0xc2, 0x01, 0xe2, 0x5d, 0x92, 0x90, 0x01, 0x33, 0x01, 0x07,
+	0xe6, 0xfb, 0x4b, 0x03, 0x5d, 0x01, 0x1f, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x62,
+	0x05, 0x9b, 0x00, 0x1c, 0x00, 0x7e, 0x40, 0x0b, 0x1c, 0x19, 0x02, 0x01, 0x07, 0x0c, 0x01, 0x03,
+	0x05, 0x02, 0x4c, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x2b, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+	0x72, 0x00, 0x04, 0x06, 0x05, 0x05, 0x04, 0x72, 0x00, 0x02, 0x00, 0x06, 0x04, 0x02, 0x06, 0x67,
+	0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x05, 0x05, 0x03, 0x60, 0x00,
+	0x03, 0x03, 0x12, 0x03, 0x4e, 0x1b, 0x40, 0x2d, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80,
+	0x00, 0x04, 0x06, 0x05, 0x06, 0x04, 0x05, 0x80, 0x00, 0x02, 0x00, 0x06, 0x04, 0x02, 0x06, 0x67,
+	0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x05, 0x05, 0x03, 0x60, 0x00,
+	0x03, 0x03, 0x12, 0x03, 0x4e, 0x59, 0x40, 0x0b, 0x12, 0x31, 0x11, 0x13, 0x13, 0x33, 0x11, 0x20,
+	0x08, 0x07, 0x1e, 0x2b, 0x01, 0x31, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x29, 0x01, 0x19,
+	0x01, 0x03, 0x21, 0x39, 0x01, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x31, 0x21, 0x11, 0x27, 0x21,
+	0x13, 0x03, 0x62, 0xfe, 0xe0, 0xfe, 0xe0, 0x01, 0x01, 0x01, 0x20, 0x01, 0x20, 0xce, 0xfd, 0x6f,
+	0x01, 0x1f, 0x01, 0x20, 0xfe, 0xdf, 0xfe, 0xe2, 0xad, 0x03, 0x4a, 0xc2, 0x03, 0xf7, 0x85, 0x85,
+	0x9a, 0xfe, 0xe1, 0xfe, 0xc9, 0xfe, 0xf9, 0x01, 0xa2, 0x83, 0x01, 0x1f, 0x02, 0x77, 0xe6, 0xfe,
+	0xf9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0xc3, 0x05, 0x9b, 0x00, 0x11,
+	0x00, 0x24, 0x40, 0x21, 0x03, 0x01, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x11, 0x4d, 0x04,
+	0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x03, 0x00, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x08, 0x00, 0x11,
+	0x03, 0x10, 0x05, 0x07, 0x16, 0x2b, 0x21, 0x39, 0x01, 0x21, 0x11, 0x31, 0x35, 0x31, 0x11, 0x33,
+	0x31, 0x21, 0x03, 0x21, 0x13, 0x33, 0x11, 0x31, 0x01, 0x17, 0x01, 0x1f, 0x43, 0x01, 0x4a, 0xd7,
+	0xfc, 0x6a, 0xd0, 0xf1, 0x01, 0xe6, 0x3e, 0x02, 0x58, 0x01, 0x1f, 0xfe, 0xe1, 0xfb, 0x84, 0x00,
+	0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x62, 0x05, 0x9b, 0x00, 0x0e, 0x00, 0x27, 0x40, 0x24,
+	0x0d, 0x05, 0x02, 0x02, 0x01, 0x0e, 0x04, 0x02, 0x00, 0x02, 0x02, 0x4c, 0x03, 0x01, 0x01, 0x01,
+	0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x12, 0x11, 0x13,
+	0x30, 0x04, 0x07, 0x1a, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x11, 0x03, 0x23, 0x11, 0x21, 0x19,
+	0x01, 0x21, 0x17, 0x03, 0xd0, 0x01, 0xc4, 0xce, 0xc2, 0x5e, 0xfe, 0xe0, 0xfe, 0x34, 0xad, 0x01,
+	0x01, 0x07, 0x03, 0x8d, 0x01, 0x07, 0xfb, 0x84, 0x02, 0x04, 0x02, 0x78, 0xe6, 0xfc, 0x52, 0x00,
+	0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x62, 0x05, 0x9b, 0x00, 0x0d, 0x00, 0x1a, 0x40, 0x17,
+	0x0d, 0x0a, 0x09, 0x08, 0x05, 0x04, 0x03, 0x00, 0x08, 0x00, 0x49, 0x01, 0x01, 0x00, 0x00, 0x11,
+	0x00, 0x4e, 0x14, 0x16, 0x02, 0x07, 0x18, 0x2b, 0x13, 0x39, 0x01, 0x09, 0x01, 0x11, 0x03, 0x23,
+	0x11, 0x07, 0x27, 0x11, 0x21, 0x17, 0x02, 0x01, 0xb5, 0x01, 0xab, 0xc2, 0x5e, 0x8a, 0x96, 0xfe,
+	0x34, 0xad, 0x01, 0x07, 0xfe, 0xf9, 0x01, 0x07, 0x03, 0x8d, 0x01, 0x07, 0xfc, 0x0a, 0x60, 0x60,
+	0x03, 0xf6, 0xe6, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x05, 0xa2, 0x05, 0x9b, 0x00, 0x18,
+	0x00, 0x35, 0x40, 0x32, 0x10, 0x0a, 0x02, 0x03, 0x03, 0x02, 0x09, 0x06, 0x03, 0x03, 0x00, 0x03,
+	0x02, 0x4c, 0x07, 0x06, 0x04, 0x03, 0x02, 0x02, 0x11, 0x4d, 0x05, 0x01, 0x03, 0x03, 0x00, 0x60,
+	0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x12, 0x32, 0x12,
+	0x13, 0x12, 0x14, 0x08, 0x07, 0x1c, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x03, 0x21, 0x27, 0x07, 0x21,
+	0x03, 0x13, 0x27, 0x21, 0x19, 0x01, 0x21, 0x11, 0x27, 0x3b, 0x02, 0x19, 0x01, 0x21, 0x11, 0x04,
+	0xe0, 0xc2, 0xce, 0xfe, 0x3c, 0x3e, 0x3e, 0xfe, 0x3c, 0xce, 0x01, 0xad, 0x01, 0xcc, 0x01, 0x20,
+	0xac, 0xac, 0x5e, 0xc2, 0x01, 0x20, 0x05, 0x9b, 0xfe, 0xf9, 0xfc, 0x73, 0xfe, 0xf9, 0x4f, 0x4f,
+	0x01, 0x07, 0x03, 0xae, 0xe6, 0xfd, 0x88, 0xfd, 0xfc, 0x03, 0x97, 0xe5, 0xfd, 0x88, 0xfd, 0xfc,
+	0x04, 0x7c, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x62, 0x05, 0x99, 0x00, 0x16,
+	0x00, 0x59, 0x40, 0x13, 0x14, 0x13, 0x12, 0x0f, 0x0e, 0x0d, 0x0c, 0x09, 0x08, 0x07, 0x04, 0x03,
+	0x02, 0x00, 0x0e, 0x00, 0x02, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x0d, 0x03, 0x01,
+	0x02, 0x02, 0x13, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50,
+	0x58, 0x40, 0x0d, 0x03, 0x01, 0x02, 0x02, 0x11, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x1b, 0x40, 0x0d, 0x03, 0x01, 0x02, 0x02, 0x13, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x59, 0x59, 0xb6, 0x14, 0x15, 0x14, 0x15, 0x04, 0x07, 0x1a, 0x2b, 0x01, 0x31, 0x11, 0x07, 0x17,
+	0x11, 0x21, 0x11, 0x27, 0x07, 0x11, 0x21, 0x03, 0x37, 0x27, 0x13, 0x27, 0x21, 0x11, 0x17, 0x37,
+	0x11, 0x33, 0x03, 0x62, 0xba, 0xba, 0xfe, 0xe0, 0x8a, 0x96, 0xfe, 0xe1, 0x01, 0xbf, 0xbf, 0x01,
+	0xad, 0x01, 0xcc, 0x96, 0x8a, 0x5e, 0x04, 0x92, 0xfe, 0x92, 0x72, 0x73, 0xfd, 0xc1, 0x01, 0xa1,
+	0x60, 0x60, 0xfe, 0x5f, 0x02, 0x3f, 0x73, 0x72, 0x01, 0x8f, 0xe6, 0xfe, 0x29, 0x60, 0x60, 0x01,
+	0xd7, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x62, 0x05, 0x9b, 0x00, 0x11,
+	0x00, 0x29, 0x40, 0x26, 0x10, 0x0f, 0x0e, 0x0b, 0x0a, 0x09, 0x04, 0x03, 0x02, 0x09, 0x00, 0x01,
+	0x01, 0x4c, 0x03, 0x02, 0x02, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x11, 0x16, 0x15, 0x04, 0x07, 0x18, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x05,
+	0x11, 0x21, 0x39, 0x01, 0x11, 0x25, 0x13, 0x27, 0x21, 0x11, 0x17, 0x37, 0x11, 0x02, 0xa0, 0xc2,
+	0xfe, 0xe5, 0xfe, 0xe1, 0xfe, 0xda, 0x01, 0xad, 0x01, 0xcc, 0x96, 0x8a, 0x05, 0x9b, 0xfe, 0xf9,
+	0xfd, 0xbd, 0xae, 0xfe, 0x5d, 0x01, 0xa0, 0xb1, 0x02, 0x64, 0xe6, 0xfd, 0x54, 0x60, 0x60, 0x02,
+	0xac, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x88, 0x05, 0x9b, 0x00, 0x16,
+	0x00, 0x5c, 0x40, 0x0c, 0x0f, 0x09, 0x02, 0x00, 0x02, 0x01, 0x4c, 0x0e, 0x01, 0x02, 0x01, 0x4b,
+	0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x00, 0x02, 0x04, 0x04, 0x00, 0x72, 0x00, 0x02,
+	0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x60, 0x00, 0x01, 0x01,
+	0x12, 0x01, 0x4e, 0x1b, 0x40, 0x1d, 0x00, 0x00, 0x02, 0x04, 0x02, 0x00, 0x04, 0x80, 0x00, 0x02,
+	0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x60, 0x00, 0x01, 0x01,
+	0x12, 0x01, 0x4e, 0x59, 0xb7, 0x27, 0x11, 0x14, 0x31, 0x20, 0x05, 0x07, 0x1b, 0x2b, 0x01, 0x31,
+	0x21, 0x11, 0x39, 0x01, 0x21, 0x39, 0x01, 0x11, 0x01, 0x21, 0x03, 0x21, 0x13, 0x01, 0x15, 0x31,
+	0x15, 0x23, 0x15, 0x33, 0x21, 0x02, 0x68, 0x01, 0x20, 0xfc, 0x82, 0x01, 0xff, 0xfe, 0x1d, 0xd0,
+	0x03, 0x58, 0xd7, 0xfd, 0xa5, 0x01, 0x01, 0x01, 0x3e, 0x01, 0xa2, 0xfe, 0x5e, 0x02, 0x3d, 0x02,
+	0x3f, 0x01, 0x1f, 0xfe, 0xe1, 0xfd, 0x53, 0x62, 0x29, 0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x93, 0x01, 0x9c, 0x05, 0x98, 0x00, 0x09, 0x00, 0x6e, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
+	0x12, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03,
+	0x11, 0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x12, 0x00, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x63, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x02, 0x4e, 0x1b, 0x4b, 0xb0,
+	0x1b, 0x50, 0x58, 0x40, 0x12, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00, 0x02, 0x02, 0x03,
+	0x5f, 0x00, 0x03, 0x03, 0x11, 0x02, 0x4e, 0x1b, 0x40, 0x12, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x63, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x02, 0x4e, 0x59, 0x59, 0x59, 0xb6,
+	0x11, 0x11, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x35, 0x39, 0x01, 0x21, 0x35, 0x23, 0x11, 0x33,
+	0x35, 0x21, 0x01, 0x9c, 0xcd, 0xcd, 0xfe, 0x64, 0x93, 0x9a, 0x03, 0xd1, 0x9a, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x01, 0xff, 0xfd, 0x02, 0xbe, 0x05, 0x98, 0x00, 0x05, 0x00, 0x50, 0x4b, 0xb0,
+	0x0f, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x11, 0x4d,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0xb4, 0x11, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x05, 0x39,
+	0x01, 0x23, 0x01, 0x33, 0x02, 0xbe, 0xab, 0xfd, 0xee, 0xab, 0x03, 0x05, 0x9b, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x93, 0x01, 0x9d, 0x05, 0x98, 0x00, 0x09, 0x00, 0x6e, 0x4b, 0xb0,
+	0x0f, 0x50, 0x58, 0x40, 0x12, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00, 0x02, 0x02, 0x03,
+	0x5f, 0x00, 0x03, 0x03, 0x11, 0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x12, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x02,
+	0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x12, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x63,
+	0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x11, 0x02, 0x4e, 0x1b, 0x40, 0x12, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x00, 0x63, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x02, 0x4e,
+	0x59, 0x59, 0x59, 0xb6, 0x11, 0x11, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x25, 0x39, 0x01, 0x21,
+	0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x01, 0x9d, 0xfe, 0x64, 0xcd, 0xcd, 0x01, 0x9c, 0x93, 0x9a,
+	0x03, 0xd1, 0x9a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x19, 0x01, 0xe0, 0x05, 0x9a, 0x00, 0x07,
+	0x00, 0x06, 0xb3, 0x04, 0x00, 0x01, 0x32, 0x2b, 0x01, 0x39, 0x01, 0x35, 0x27, 0x07, 0x15, 0x37,
+	0x01, 0xe0, 0xf0, 0xf0, 0xf0, 0x04, 0x19, 0xcd, 0xb4, 0xb4, 0xcd, 0xb4, 0x00, 0x01, 0x00, 0x00,
+	0xff, 0x26, 0x03, 0xf0, 0xff, 0xfc, 0x00, 0x05, 0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b,
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01,
+	0x4f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x13, 0x03, 0x07, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44,
+	0x05, 0x39, 0x01, 0x35, 0x21, 0x15, 0x03, 0xf0, 0xfc, 0x10, 0xda, 0xd6, 0xd6, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0xff, 0xff, 0x04, 0x19, 0x01, 0x6b, 0x05, 0x98, 0x00, 0x05, 0x00, 0x20, 0xb1, 0x06,
+	0x64, 0x44, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
+	0x00, 0x01, 0x00, 0x4f, 0x11, 0x30, 0x02, 0x07, 0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x39,
+	0x01, 0x33, 0x03, 0x23, 0xbf, 0xac, 0x8c, 0xe0, 0x04, 0x19, 0x01, 0x7f, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x2b, 0x40, 0x28, 0x09, 0x01,
+	0x04, 0x02, 0x04, 0x01, 0x00, 0x03, 0x02, 0x4c, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02,
+	0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x32,
+	0x11, 0x12, 0x30, 0x05, 0x07, 0x1b, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x11, 0x21, 0x11, 0x21, 0x03,
+	0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x01, 0x6d, 0xd3, 0x01, 0x1e, 0xfd, 0x64, 0xc2, 0x02, 0x40,
+	0xfe, 0xe0, 0x01, 0x20, 0x01, 0x1f, 0xfe, 0xe1, 0x03, 0xf8, 0xfe, 0xf7, 0xfe, 0x31, 0x01, 0xb6,
+	0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x58, 0x05, 0x9a, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x5d,
+	0x40, 0x0e, 0x0c, 0x01, 0x02, 0x03, 0x07, 0x01, 0x05, 0x02, 0x04, 0x01, 0x00, 0x04, 0x03, 0x4c,
+	0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x03, 0x03, 0x11, 0x4d, 0x00, 0x05, 0x05, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x40, 0x1b, 0x00, 0x03, 0x03, 0x13, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x5f, 0x00,
+	0x02, 0x02, 0x14, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x59, 0x40, 0x09, 0x11, 0x32, 0x11, 0x12, 0x12, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33, 0x39, 0x01,
+	0x21, 0x11, 0x13, 0x21, 0x11, 0x03, 0x21, 0x11, 0x21, 0x17, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21,
+	0x01, 0x01, 0x1e, 0xcf, 0x01, 0x6a, 0xc0, 0xfe, 0x87, 0xfe, 0x37, 0xab, 0x02, 0x3a, 0xfe, 0xe4,
+	0x01, 0x1c, 0x01, 0x1b, 0xfe, 0xe5, 0x02, 0xe8, 0x01, 0x07, 0x01, 0xab, 0xe5, 0xfc, 0x68, 0x01,
+	0xb3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x0a,
+	0x00, 0x25, 0x40, 0x22, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x4c, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00,
+	0x03, 0x03, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11,
+	0x11, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x21, 0x11, 0x21, 0x11, 0x21,
+	0x03, 0x02, 0x8c, 0xd2, 0xfd, 0xc2, 0x02, 0x3e, 0xfd, 0x64, 0xc2, 0x01, 0x20, 0x01, 0xb6, 0x01,
+	0x22, 0xfe, 0xf7, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x56, 0x05, 0x9a, 0x00, 0x0e,
+	0x00, 0x14, 0x00, 0x5d, 0x40, 0x0e, 0x0b, 0x01, 0x03, 0x02, 0x0e, 0x01, 0x05, 0x03, 0x04, 0x01,
+	0x00, 0x04, 0x03, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x02, 0x02, 0x11, 0x4d,
+	0x00, 0x05, 0x05, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x01,
+	0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1b, 0x00, 0x02, 0x02, 0x13, 0x4d, 0x00, 0x05,
+	0x05, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x01, 0x01, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x59, 0x40, 0x09, 0x11, 0x32, 0x12, 0x13, 0x12, 0x30, 0x06, 0x07, 0x1c,
+	0x2b, 0x39, 0x02, 0x21, 0x13, 0x11, 0x21, 0x11, 0x31, 0x11, 0x21, 0x17, 0x15, 0x21, 0x03, 0x01,
+	0x39, 0x01, 0x21, 0x11, 0x21, 0x01, 0x69, 0xd0, 0x01, 0x1d, 0xfe, 0x38, 0xab, 0xfe, 0x87, 0xc0,
+	0x02, 0x39, 0xfe, 0xe4, 0x01, 0x1c, 0x01, 0x1b, 0xfe, 0xe5, 0x03, 0xef, 0x01, 0xab, 0xe5, 0xc6,
+	0xfe, 0xf9, 0xfe, 0x35, 0x01, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x03, 0x5f,
+	0x03, 0xf9, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x2a, 0x40, 0x27, 0x0b, 0x01, 0x03, 0x02, 0x0c, 0x06,
+	0x02, 0x01, 0x03, 0x02, 0x4c, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00,
+	0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x15, 0x14, 0x11, 0x30, 0x04, 0x07,
+	0x1a, 0x2b, 0x35, 0x39, 0x01, 0x21, 0x13, 0x21, 0x01, 0x35, 0x23, 0x35, 0x21, 0x03, 0x01, 0x39,
+	0x01, 0x11, 0x33, 0x02, 0x8c, 0xd2, 0xfe, 0xb1, 0x01, 0x50, 0x01, 0xfd, 0x64, 0xc2, 0x01, 0x20,
+	0xf0, 0x01, 0x01, 0x20, 0x01, 0xa5, 0xd3, 0x60, 0xfe, 0xf7, 0xfe, 0xbb, 0x01, 0x2c, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0xfe, 0x51, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x0c, 0x00, 0x29, 0x40, 0x26,
+	0x0c, 0x01, 0x03, 0x04, 0x01, 0x4c, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x67, 0x00, 0x03,
+	0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x14, 0x4d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x4e, 0x11, 0x11,
+	0x11, 0x11, 0x30, 0x05, 0x07, 0x1b, 0x2b, 0x11, 0x39, 0x01, 0x21, 0x11, 0x21, 0x13, 0x21, 0x11,
+	0x21, 0x11, 0x21, 0x03, 0x01, 0x20, 0x01, 0x6c, 0xd2, 0xfd, 0xc2, 0x02, 0x3e, 0xfd, 0x64, 0xc2,
+	0xfe, 0x51, 0x02, 0x5d, 0x01, 0x20, 0x01, 0x09, 0x01, 0x21, 0xfe, 0xf7, 0x00, 0x02, 0x00, 0x00,
+	0xfe, 0x51, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x0d, 0x00, 0x15, 0x00, 0x35, 0x40, 0x32, 0x08, 0x01,
+	0x05, 0x01, 0x0b, 0x01, 0x02, 0x04, 0x02, 0x4c, 0x00, 0x05, 0x05, 0x01, 0x5f, 0x00, 0x01, 0x01,
+	0x14, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x16, 0x00, 0x4e, 0x11, 0x31, 0x12, 0x12, 0x13, 0x30, 0x06, 0x07, 0x1c,
+	0x2b, 0x01, 0x39, 0x01, 0x21, 0x39, 0x01, 0x11, 0x21, 0x03, 0x11, 0x21, 0x13, 0x11, 0x21, 0x01,
+	0x39, 0x01, 0x21, 0x11, 0x21, 0x11, 0x23, 0x01, 0x40, 0x02, 0x1e, 0xfd, 0x64, 0xc2, 0x01, 0x6d,
+	0xd1, 0xfe, 0x2c, 0x01, 0xd4, 0xfe, 0xe2, 0x01, 0x20, 0x02, 0xfe, 0x51, 0x05, 0xa7, 0xfe, 0xf7,
+	0xfd, 0x11, 0x01, 0x1e, 0xfe, 0x54, 0x01, 0xae, 0x01, 0xb7, 0xfe, 0xfa, 0x00, 0x01, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x58, 0x05, 0x9a, 0x00, 0x0d, 0x00, 0x4d, 0x40, 0x0a, 0x0d, 0x01, 0x03, 0x04,
+	0x08, 0x01, 0x01, 0x03, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x16, 0x00, 0x04, 0x04,
+	0x11, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x02, 0x01, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x40, 0x16, 0x00, 0x04, 0x04, 0x13, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x5f,
+	0x00, 0x03, 0x03, 0x14, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0xb7, 0x11, 0x12,
+	0x11, 0x11, 0x30, 0x05, 0x07, 0x1b, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
+	0x03, 0x21, 0x11, 0x21, 0x17, 0x01, 0x01, 0x1e, 0x01, 0x1c, 0x01, 0x1d, 0xc0, 0xfe, 0x87, 0xfe,
+	0x37, 0xab, 0x02, 0xd0, 0xfd, 0x30, 0x02, 0xe8, 0x01, 0x07, 0x01, 0xab, 0xe5, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x05, 0x9a, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x4d,
+	0xb5, 0x00, 0x01, 0x00, 0x01, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x16, 0x00, 0x00,
+	0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x04, 0x01, 0x03, 0x03, 0x14, 0x4d, 0x00, 0x02,
+	0x02, 0x12, 0x02, 0x4e, 0x1b, 0x40, 0x16, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13,
+	0x4d, 0x04, 0x01, 0x03, 0x03, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x12, 0x02, 0x4e, 0x59, 0x40, 0x0c,
+	0x06, 0x06, 0x06, 0x0a, 0x06, 0x0a, 0x13, 0x11, 0x12, 0x05, 0x07, 0x19, 0x2b, 0x01, 0x31, 0x15,
+	0x21, 0x11, 0x33, 0x13, 0x31, 0x11, 0x21, 0x11, 0x01, 0x1c, 0xfe, 0xe4, 0x5a, 0xc3, 0xfe, 0xe3,
+	0x04, 0x95, 0x26, 0x01, 0x2b, 0xfe, 0x55, 0xfc, 0x11, 0x03, 0xef, 0x00, 0x00, 0x02, 0xfe, 0x2c,
+	0xfe, 0x51, 0x01, 0x1b, 0x05, 0x9a, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x50, 0xb5, 0x0b, 0x01, 0x03,
+	0x04, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00,
+	0x04, 0x04, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x60, 0x00, 0x00,
+	0x00, 0x16, 0x00, 0x4e, 0x1b, 0x40, 0x1a, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x13,
+	0x4d, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x60, 0x00, 0x00, 0x00, 0x16, 0x00,
+	0x4e, 0x59, 0xb7, 0x11, 0x13, 0x11, 0x11, 0x33, 0x05, 0x07, 0x1b, 0x2b, 0x05, 0x31, 0x33, 0x11,
+	0x39, 0x01, 0x21, 0x03, 0x21, 0x13, 0x21, 0x35, 0x31, 0x15, 0x21, 0x11, 0x33, 0x01, 0x1a, 0x01,
+	0xfd, 0xe5, 0xd4, 0x01, 0xd1, 0x01, 0x01, 0x1c, 0xfe, 0xe3, 0x5a, 0x61, 0xfe, 0xb2, 0x01, 0x1f,
+	0x04, 0x7e, 0xa7, 0x26, 0x01, 0x2b, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x03, 0x58,
+	0x05, 0x9a, 0x00, 0x13, 0x00, 0x57, 0x40, 0x0c, 0x13, 0x01, 0x03, 0x05, 0x0a, 0x09, 0x08, 0x03,
+	0x01, 0x04, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x19, 0x00, 0x04, 0x00, 0x01, 0x00,
+	0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x02, 0x01, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x19, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00,
+	0x05, 0x05, 0x13, 0x4d, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x59, 0x40, 0x09, 0x13, 0x11, 0x14, 0x11, 0x11, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33, 0x39, 0x01,
+	0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x27, 0x37, 0x11, 0x21, 0x11, 0x21, 0x11, 0x31, 0x11, 0x21,
+	0x17, 0x01, 0x01, 0x1e, 0x01, 0x1c, 0x01, 0x1d, 0x57, 0x57, 0xfe, 0xe3, 0xfe, 0xe4, 0xfe, 0x37,
+	0xab, 0x01, 0xb1, 0xfe, 0x4f, 0x01, 0xc9, 0x77, 0x77, 0x01, 0x36, 0xfe, 0xe3, 0x01, 0xb1, 0x01,
+	0x19, 0xe5, 0x00, 0x00, 0x00, 0x01, 0xff, 0x56, 0x00, 0x00, 0x01, 0x1e, 0x05, 0x9a, 0x00, 0x08,
+	0x00, 0x2f, 0xb5, 0x08, 0x01, 0x00, 0x01, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x0b,
+	0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x0b, 0x00, 0x01,
+	0x01, 0x13, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0xb4, 0x13, 0x30, 0x02, 0x07, 0x18,
+	0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x31, 0x11, 0x21, 0x17, 0x01, 0x01, 0x1d, 0xfe, 0x38, 0xab,
+	0x04, 0x81, 0x01, 0x19, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9d,
+	0x03, 0xf8, 0x00, 0x0f, 0x00, 0x25, 0x40, 0x22, 0x0d, 0x01, 0x01, 0x05, 0x01, 0x4c, 0x03, 0x01,
+	0x01, 0x01, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x14, 0x4d, 0x04, 0x02, 0x02, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x12, 0x11, 0x11, 0x12, 0x11, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x39, 0x02, 0x21, 0x11, 0x21,
+	0x13, 0x15, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x03, 0x21, 0x01, 0x20, 0x01, 0x1e, 0x01, 0x01,
+	0x1f, 0x01, 0x1f, 0x01, 0x20, 0xc2, 0xfb, 0x25, 0x02, 0xd6, 0xfe, 0x0a, 0xe0, 0x02, 0xd6, 0xfd,
+	0x2a, 0x02, 0xef, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5e,
+	0x03, 0xf8, 0x00, 0x0a, 0x00, 0x21, 0x40, 0x1e, 0x08, 0x01, 0x01, 0x03, 0x01, 0x4c, 0x00, 0x01,
+	0x01, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x12,
+	0x11, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x39, 0x02, 0x21, 0x11, 0x21, 0x13, 0x21, 0x11, 0x03,
+	0x21, 0x01, 0x20, 0x01, 0x1e, 0x01, 0x01, 0x1f, 0xc2, 0xfd, 0x64, 0x02, 0xd6, 0xfd, 0x2a, 0x02,
+	0xef, 0x01, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x07,
+	0x00, 0x0f, 0x00, 0x29, 0x40, 0x26, 0x04, 0x01, 0x03, 0x01, 0x07, 0x01, 0x00, 0x02, 0x02, 0x4c,
+	0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x32, 0x12, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x33, 0x39, 0x01,
+	0x21, 0x11, 0x03, 0x21, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x15, 0x31, 0xc2, 0x02, 0x9c,
+	0xc2, 0xfd, 0x64, 0x02, 0x3e, 0xfe, 0xe2, 0x01, 0x1e, 0x02, 0xef, 0x01, 0x09, 0xfd, 0x11, 0x18,
+	0x01, 0xb5, 0x73, 0x00, 0x00, 0x02, 0x00, 0x00, 0xfe, 0x51, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x0b,
+	0x00, 0x11, 0x00, 0x2f, 0x40, 0x2c, 0x07, 0x01, 0x04, 0x02, 0x04, 0x01, 0x01, 0x03, 0x02, 0x4c,
+	0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00,
+	0x01, 0x01, 0x12, 0x4d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x4e, 0x11, 0x31, 0x32, 0x12, 0x30, 0x05,
+	0x07, 0x1b, 0x2b, 0x11, 0x39, 0x01, 0x21, 0x11, 0x13, 0x21, 0x11, 0x03, 0x21, 0x31, 0x21, 0x01,
+	0x39, 0x01, 0x21, 0x11, 0x21, 0x01, 0x20, 0xd1, 0x01, 0x6d, 0xc2, 0xfe, 0x84, 0xfe, 0xe0, 0x02,
+	0x3e, 0xfe, 0xe2, 0x01, 0x1e, 0xfe, 0x51, 0x02, 0xcc, 0xfe, 0xe3, 0x02, 0xef, 0x01, 0x09, 0xfd,
+	0x28, 0x01, 0xb6, 0x00, 0x00, 0x02, 0x00, 0x00, 0xfe, 0x51, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x0b,
+	0x00, 0x11, 0x00, 0x2f, 0x40, 0x2c, 0x07, 0x01, 0x04, 0x02, 0x04, 0x01, 0x01, 0x03, 0x02, 0x4c,
+	0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00,
+	0x01, 0x01, 0x12, 0x4d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x4e, 0x11, 0x31, 0x32, 0x12, 0x30, 0x05,
+	0x07, 0x1b, 0x2b, 0x01, 0x39, 0x01, 0x21, 0x11, 0x03, 0x21, 0x11, 0x13, 0x21, 0x31, 0x21, 0x01,
+	0x39, 0x01, 0x21, 0x11, 0x21, 0x03, 0x5e, 0xfe, 0xe0, 0xd1, 0xfe, 0x93, 0xc2, 0x01, 0x7c, 0x01,
+	0x20, 0xfd, 0xc2, 0x01, 0x1e, 0xfe, 0xe2, 0xfe, 0x51, 0x02, 0xcc, 0xfe, 0xe3, 0x02, 0xef, 0x01,
+	0x09, 0xfd, 0x28, 0x01, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5e,
+	0x03, 0xf8, 0x00, 0x0a, 0x00, 0x4a, 0xb5, 0x08, 0x01, 0x01, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x26,
+	0x50, 0x58, 0x40, 0x17, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x72, 0x00, 0x01, 0x01, 0x03, 0x5f,
+	0x00, 0x03, 0x03, 0x14, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x18, 0x00, 0x02,
+	0x01, 0x00, 0x01, 0x02, 0x00, 0x80, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0xb6, 0x12, 0x11, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b,
+	0x39, 0x02, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x03, 0x21, 0x01, 0x20, 0x01, 0x1e, 0x01, 0x20,
+	0xc2, 0xfd, 0x64, 0x02, 0xd6, 0x44, 0x5d, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x1d, 0x00, 0x35, 0x40, 0x32, 0x12, 0x0f, 0x02, 0x02,
+	0x03, 0x1d, 0x04, 0x02, 0x00, 0x05, 0x02, 0x4c, 0x00, 0x01, 0x00, 0x04, 0x05, 0x01, 0x04, 0x67,
+	0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x5f, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x31, 0x16, 0x12, 0x31, 0x16, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33,
+	0x39, 0x01, 0x21, 0x13, 0x35, 0x31, 0x35, 0x31, 0x35, 0x21, 0x35, 0x21, 0x31, 0x21, 0x35, 0x03,
+	0x21, 0x03, 0x15, 0x31, 0x15, 0x31, 0x15, 0x21, 0x15, 0x23, 0x31, 0x21, 0x15, 0xc2, 0x01, 0xda,
+	0xc2, 0xfd, 0xc2, 0x01, 0x1e, 0x01, 0x20, 0xc2, 0xfe, 0x26, 0xc2, 0x02, 0x3e, 0xce, 0xfe, 0x90,
+	0x01, 0x07, 0x5c, 0xc2, 0x57, 0x5d, 0x18, 0x01, 0x07, 0xfe, 0xf9, 0x5d, 0xc1, 0x63, 0x51, 0x18,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8f, 0x05, 0x9a, 0x00, 0x14, 0x00, 0x90, 0x40, 0x0a,
+	0x0a, 0x01, 0x03, 0x02, 0x03, 0x01, 0x01, 0x05, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
+	0x21, 0x00, 0x00, 0x04, 0x05, 0x05, 0x00, 0x72, 0x00, 0x02, 0x02, 0x11, 0x4d, 0x00, 0x04, 0x04,
+	0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x60, 0x00, 0x01, 0x01, 0x12,
+	0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x26, 0x50, 0x58, 0x40, 0x21, 0x00, 0x00, 0x04, 0x05, 0x05, 0x00,
+	0x72, 0x00, 0x02, 0x02, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d,
+	0x00, 0x05, 0x05, 0x01, 0x60, 0x00, 0x01, 0x01, 0x12, 0x01, 0x4e, 0x1b, 0x40, 0x22, 0x00, 0x00,
+	0x04, 0x05, 0x04, 0x00, 0x05, 0x80, 0x00, 0x02, 0x02, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x03, 0x5f,
+	0x00, 0x03, 0x03, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x60, 0x00, 0x01, 0x01, 0x12, 0x01, 0x4e,
+	0x59, 0x59, 0x40, 0x09, 0x11, 0x11, 0x13, 0x14, 0x32, 0x20, 0x06, 0x07, 0x1c, 0x2b, 0x01, 0x31,
+	0x21, 0x15, 0x03, 0x21, 0x31, 0x21, 0x39, 0x01, 0x11, 0x27, 0x21, 0x11, 0x31, 0x15, 0x33, 0x11,
+	0x23, 0x11, 0x33, 0x02, 0x72, 0x01, 0x1d, 0xc0, 0xfe, 0xf9, 0xfe, 0xe3, 0xab, 0x01, 0xc8, 0xe3,
+	0xe3, 0xaa, 0x01, 0x63, 0x5d, 0xfe, 0xfa, 0x04, 0xb5, 0xe5, 0xfe, 0xe7, 0x92, 0xfe, 0xe1, 0xfe,
+	0x4f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x0a,
+	0x00, 0x21, 0x40, 0x1e, 0x08, 0x01, 0x03, 0x01, 0x01, 0x4c, 0x02, 0x01, 0x00, 0x00, 0x14, 0x4d,
+	0x00, 0x01, 0x01, 0x03, 0x60, 0x00, 0x03, 0x03, 0x12, 0x03, 0x4e, 0x12, 0x11, 0x11, 0x30, 0x04,
+	0x07, 0x1a, 0x2b, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x03, 0x21, 0x11, 0x13, 0x21, 0x03, 0x5e,
+	0xfe, 0xe0, 0xfe, 0xe2, 0x01, 0xfe, 0xe1, 0xc2, 0x02, 0x9c, 0x03, 0xf8, 0xfd, 0x29, 0x02, 0xd7,
+	0xfd, 0x11, 0xfe, 0xf7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x60, 0x03, 0xf8, 0x00, 0x0b,
+	0x00, 0x17, 0x40, 0x14, 0x0b, 0x08, 0x07, 0x06, 0x03, 0x05, 0x00, 0x49, 0x01, 0x01, 0x00, 0x00,
+	0x14, 0x00, 0x4e, 0x14, 0x14, 0x02, 0x07, 0x18, 0x2b, 0x21, 0x39, 0x01, 0x01, 0x11, 0x21, 0x11,
+	0x07, 0x27, 0x11, 0x21, 0x11, 0x01, 0xb5, 0x01, 0xab, 0xfe, 0xe0, 0x8a, 0x96, 0xfe, 0xe0, 0x01,
+	0x09, 0x02, 0xef, 0xfd, 0xb0, 0x61, 0x61, 0x02, 0x50, 0xfd, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0xa0, 0x03, 0xf8, 0x00, 0x15, 0x00, 0x29, 0x40, 0x26, 0x09, 0x06, 0x03, 0x03,
+	0x01, 0x04, 0x01, 0x4c, 0x05, 0x03, 0x02, 0x00, 0x00, 0x14, 0x4d, 0x06, 0x01, 0x04, 0x04, 0x01,
+	0x60, 0x02, 0x01, 0x01, 0x01, 0x12, 0x01, 0x4e, 0x13, 0x21, 0x12, 0x12, 0x12, 0x12, 0x20, 0x07,
+	0x07, 0x1d, 0x2b, 0x01, 0x31, 0x21, 0x11, 0x03, 0x21, 0x27, 0x07, 0x21, 0x03, 0x11, 0x21, 0x15,
+	0x11, 0x21, 0x11, 0x31, 0x21, 0x31, 0x15, 0x11, 0x21, 0x04, 0x80, 0x01, 0x20, 0xce, 0xfe, 0x3c,
+	0x3e, 0x3e, 0xfe, 0x3c, 0xce, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x03, 0xf8, 0xfd,
+	0x11, 0xfe, 0xf7, 0x50, 0x50, 0x01, 0x09, 0x02, 0xef, 0xce, 0xfd, 0xf7, 0x02, 0xd7, 0xce, 0xfd,
+	0xf7, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x60, 0x03, 0xf8, 0x00, 0x15,
+	0x00, 0x28, 0x40, 0x25, 0x15, 0x14, 0x13, 0x10, 0x0f, 0x0e, 0x0b, 0x0a, 0x09, 0x06, 0x05, 0x04,
+	0x0c, 0x00, 0x02, 0x01, 0x4c, 0x03, 0x01, 0x02, 0x02, 0x14, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x14, 0x14, 0x14, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x39, 0x02, 0x21, 0x11, 0x37, 0x17,
+	0x11, 0x21, 0x11, 0x27, 0x37, 0x11, 0x21, 0x15, 0x07, 0x27, 0x35, 0x21, 0x11, 0x17, 0x07, 0x01,
+	0x20, 0x96, 0x8a, 0x01, 0x20, 0xbb, 0xbb, 0xfe, 0xe0, 0x8a, 0x96, 0xfe, 0xe0, 0xbf, 0xbf, 0x01,
+	0x17, 0x61, 0x61, 0xfe, 0xe9, 0x01, 0xb6, 0x74, 0x73, 0x01, 0x5b, 0xbb, 0x61, 0x61, 0xbb, 0xfe,
+	0xa5, 0x73, 0x74, 0x00, 0x00, 0x01, 0x00, 0x00, 0xfe, 0x51, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x18,
+	0x00, 0x2d, 0x40, 0x2a, 0x14, 0x01, 0x04, 0x02, 0x01, 0x4c, 0x03, 0x01, 0x01, 0x01, 0x14, 0x4d,
+	0x00, 0x02, 0x02, 0x04, 0x60, 0x00, 0x04, 0x04, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x60, 0x00,
+	0x00, 0x00, 0x16, 0x00, 0x4e, 0x11, 0x12, 0x11, 0x13, 0x37, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x01,
+	0x39, 0x01, 0x21, 0x39, 0x01, 0x11, 0x23, 0x35, 0x33, 0x11, 0x23, 0x31, 0x21, 0x31, 0x23, 0x11,
+	0x21, 0x03, 0x21, 0x11, 0x13, 0x21, 0x15, 0x21, 0x01, 0x40, 0x02, 0x1e, 0x01, 0x01, 0x01, 0xfe,
+	0xe3, 0x02, 0xfe, 0xe2, 0x01, 0xfe, 0xe1, 0xc2, 0x01, 0x7c, 0xfe, 0x2c, 0xfe, 0x51, 0x01, 0x51,
+	0x5e, 0x03, 0xf8, 0xfd, 0x29, 0x02, 0xd7, 0xfd, 0x11, 0xfe, 0xf7, 0x8e, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x5e, 0x03, 0xf8, 0x00, 0x0d, 0x00, 0x27, 0x40, 0x24, 0x06, 0x01, 0x03, 0x0d,
+	0x01, 0x01, 0x02, 0x4b, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x01,
+	0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x32, 0x11, 0x30, 0x04, 0x07, 0x1a,
+	0x2b, 0x39, 0x02, 0x21, 0x11, 0x21, 0x01, 0x11, 0x39, 0x01, 0x21, 0x11, 0x21, 0x01, 0x03, 0x5e,
+	0xfe, 0x43, 0x01, 0xbd, 0xfc, 0xa2, 0x01, 0xbd, 0xfe, 0x43, 0x01, 0x21, 0x01, 0xb5, 0x01, 0x22,
+	0xfe, 0xde, 0xfe, 0x4b, 0x00, 0x01, 0x00, 0x00, 0xff, 0x4a, 0x02, 0x9a, 0x06, 0x4d, 0x00, 0x16,
+	0x00, 0x2f, 0x40, 0x2c, 0x16, 0x11, 0x0f, 0x0e, 0x0c, 0x0b, 0x06, 0x03, 0x08, 0x00, 0x03, 0x01,
+	0x4c, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x03, 0x67, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00,
+	0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x11, 0x18, 0x11, 0x17, 0x04, 0x07, 0x1a,
+	0x2b, 0x01, 0x39, 0x01, 0x07, 0x17, 0x31, 0x17, 0x11, 0x33, 0x15, 0x21, 0x03, 0x11, 0x2f, 0x01,
+	0x3f, 0x01, 0x11, 0x13, 0x21, 0x15, 0x23, 0x11, 0x01, 0x97, 0x8e, 0x8e, 0x1f, 0xe4, 0xfe, 0xf8,
+	0xc2, 0x05, 0xcb, 0xcb, 0x05, 0xc2, 0x01, 0x08, 0xe4, 0x03, 0x1d, 0x52, 0x52, 0x12, 0xfd, 0x8f,
+	0xac, 0x01, 0x07, 0x02, 0x02, 0x03, 0x75, 0x76, 0x03, 0x02, 0x02, 0x01, 0x07, 0xac, 0xfd, 0x8e,
+	0x00, 0x01, 0x00, 0x00, 0xff, 0x48, 0x00, 0xa4, 0x06, 0x4a, 0x00, 0x05, 0x00, 0x18, 0x40, 0x15,
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
+	0x11, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x13, 0x39, 0x01, 0x23, 0x11, 0x33, 0xa4, 0xa4, 0xa4, 0x06,
+	0x4a, 0xf8, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x01, 0xff, 0x4a, 0x02, 0x9b, 0x06, 0x4d, 0x00, 0x16,
+	0x00, 0x2e, 0x40, 0x2b, 0x15, 0x14, 0x0f, 0x0c, 0x09, 0x04, 0x02, 0x07, 0x01, 0x02, 0x01, 0x4c,
+	0x00, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02, 0x67, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01,
+	0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x11, 0x18, 0x11, 0x15, 0x04, 0x07, 0x1a, 0x2b,
+	0x01, 0x31, 0x0f, 0x01, 0x11, 0x03, 0x21, 0x35, 0x33, 0x11, 0x37, 0x31, 0x37, 0x27, 0x31, 0x27,
+	0x11, 0x23, 0x35, 0x21, 0x13, 0x11, 0x17, 0x02, 0x9b, 0xcb, 0x05, 0xc2, 0xfe, 0xf8, 0xe4, 0x1f,
+	0x8e, 0x8e, 0x1f, 0xe4, 0x01, 0x08, 0xc2, 0x05, 0x02, 0xcb, 0x75, 0x03, 0xfd, 0xfe, 0xfe, 0xf9,
+	0xac, 0x02, 0x71, 0x12, 0x52, 0x52, 0x12, 0x02, 0x72, 0xac, 0xfe, 0xf9, 0xfd, 0xfe, 0x03, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x02, 0x04, 0x03, 0x3d, 0x03, 0x6e, 0x00, 0x13, 0x00, 0x39, 0xb1, 0x06,
+	0x64, 0x44, 0x40, 0x2e, 0x0b, 0x01, 0x02, 0x01, 0x03, 0x01, 0x4c, 0x00, 0x01, 0x02, 0x4a, 0x0a,
+	0x01, 0x00, 0x49, 0x00, 0x03, 0x01, 0x00, 0x03, 0x59, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
+	0x69, 0x00, 0x03, 0x03, 0x00, 0x61, 0x00, 0x00, 0x03, 0x00, 0x51, 0x21, 0x25, 0x21, 0x23, 0x04,
+	0x07, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x15, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x23, 0x22,
+	0x06, 0x07, 0x35, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x33, 0x32, 0x36, 0x03, 0x3d, 0x3f, 0x76, 0x39,
+	0x3c, 0xeb, 0x3b, 0x33, 0x71, 0x49, 0x40, 0x76, 0x37, 0x40, 0xeb, 0x37, 0x34, 0x71, 0x03, 0x6e,
+	0xc4, 0x48, 0x33, 0x61, 0x38, 0x54, 0xc4, 0x49, 0x34, 0x63, 0x38, 0x00, 0x00, 0x02, 0x00, 0x01,
+	0xfe, 0x52, 0x01, 0x69, 0x03, 0xed, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x03,
+	0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01,
+	0x16, 0x01, 0x4e, 0x11, 0x31, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x13, 0x39, 0x01, 0x21, 0x13,
+	0x21, 0x13, 0x39, 0x01, 0x21, 0x15, 0x21, 0x26, 0x01, 0x1d, 0x26, 0xfe, 0x98, 0x25, 0x01, 0x1d,
+	0xfe, 0xe3, 0x02, 0x81, 0xfb, 0xd1, 0x05, 0x9b, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0xff, 0x22, 0x03, 0x5c, 0x04, 0xcd, 0x00, 0x11, 0x00, 0x64, 0xb5, 0x0b, 0x01, 0x00, 0x05, 0x01,
+	0x4c, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x23, 0x00, 0x06, 0x05, 0x05, 0x06, 0x70, 0x00, 0x03,
+	0x02, 0x02, 0x03, 0x71, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x07, 0x01, 0x05, 0x05, 0x14, 0x4d, 0x00,
+	0x01, 0x01, 0x02, 0x5f, 0x04, 0x01, 0x02, 0x02, 0x12, 0x02, 0x4e, 0x1b, 0x40, 0x21, 0x00, 0x06,
+	0x05, 0x06, 0x85, 0x00, 0x03, 0x02, 0x03, 0x86, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x07, 0x01, 0x05,
+	0x05, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x04, 0x01, 0x02, 0x02, 0x12, 0x02, 0x4e, 0x59,
+	0x40, 0x0b, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x20, 0x08, 0x07, 0x1e, 0x2b, 0x01, 0x31,
+	0x21, 0x11, 0x21, 0x03, 0x23, 0x15, 0x23, 0x35, 0x21, 0x11, 0x13, 0x33, 0x35, 0x33, 0x15, 0x21,
+	0x03, 0x5c, 0xfd, 0xc3, 0x02, 0x3d, 0xd1, 0x70, 0xe5, 0xfe, 0xca, 0xc2, 0x74, 0xe5, 0x01, 0x41,
+	0x02, 0xd0, 0xfe, 0x4e, 0xfe, 0xe2, 0xde, 0xde, 0x02, 0xe9, 0x01, 0x06, 0xde, 0xde, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x31, 0x05, 0x9b, 0x00, 0x18, 0x00, 0x88, 0x40, 0x0a,
+	0x18, 0x01, 0x01, 0x0a, 0x0d, 0x01, 0x06, 0x04, 0x02, 0x4c, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40,
+	0x2e, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x05, 0x03, 0x04, 0x04, 0x05, 0x72, 0x09,
+	0x01, 0x02, 0x08, 0x01, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x0a, 0x5f, 0x00, 0x0a,
+	0x0a, 0x11, 0x4d, 0x07, 0x01, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b,
+	0x40, 0x30, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05,
+	0x04, 0x80, 0x09, 0x01, 0x02, 0x08, 0x01, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x0a,
+	0x5f, 0x00, 0x0a, 0x0a, 0x11, 0x4d, 0x07, 0x01, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12,
+	0x06, 0x4e, 0x59, 0x40, 0x10, 0x17, 0x16, 0x15, 0x14, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x20, 0x0b, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x35, 0x21, 0x11, 0x33, 0x15, 0x23, 0x11,
+	0x21, 0x35, 0x21, 0x15, 0x03, 0x21, 0x11, 0x33, 0x11, 0x23, 0x35, 0x33, 0x11, 0x21, 0x13, 0x04,
+	0x31, 0xfe, 0xe2, 0xfe, 0xe1, 0xbe, 0xbe, 0x01, 0x1f, 0x01, 0x1e, 0xcd, 0xfc, 0x9c, 0xd6, 0xd6,
+	0xd6, 0x02, 0x9a, 0xc1, 0x03, 0xfa, 0x82, 0xfe, 0xac, 0x96, 0xfe, 0x8d, 0x82, 0x9a, 0xfe, 0xf9,
+	0x01, 0x1f, 0x01, 0x73, 0x96, 0x02, 0x73, 0xfe, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0xff, 0x03, 0xf2, 0x00, 0x10, 0x00, 0x15, 0x00, 0x42, 0x40, 0x3f, 0x10, 0x0b,
+	0x0a, 0x00, 0x04, 0x03, 0x01, 0x09, 0x08, 0x03, 0x02, 0x04, 0x00, 0x02, 0x02, 0x4c, 0x0f, 0x0c,
+	0x02, 0x01, 0x4a, 0x07, 0x04, 0x02, 0x00, 0x49, 0x00, 0x01, 0x04, 0x01, 0x03, 0x02, 0x01, 0x03,
+	0x67, 0x00, 0x02, 0x00, 0x00, 0x02, 0x57, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x00,
+	0x4f, 0x11, 0x11, 0x11, 0x15, 0x11, 0x15, 0x15, 0x17, 0x15, 0x05, 0x07, 0x19, 0x2b, 0x01, 0x31,
+	0x11, 0x17, 0x07, 0x27, 0x21, 0x07, 0x27, 0x37, 0x11, 0x27, 0x37, 0x17, 0x21, 0x37, 0x17, 0x05,
+	0x31, 0x15, 0x33, 0x35, 0x03, 0x6a, 0x95, 0xa4, 0x9b, 0xfe, 0x7f, 0x9b, 0xa4, 0x95, 0x95, 0xa4,
+	0x9b, 0x01, 0x81, 0x9b, 0xa4, 0xfd, 0x89, 0xf0, 0x02, 0xb7, 0xfe, 0x84, 0x88, 0xb3, 0x8e, 0x8e,
+	0xb3, 0x88, 0x01, 0x7c, 0x88, 0xb3, 0x8e, 0x8e, 0xb3, 0xce, 0xf0, 0xf0, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x5d, 0x05, 0x9c, 0x00, 0x1d, 0x00, 0x42, 0x40, 0x3f, 0x1c, 0x1b, 0x1a, 0x17,
+	0x02, 0x05, 0x00, 0x09, 0x01, 0x4c, 0x08, 0x01, 0x00, 0x07, 0x01, 0x01, 0x02, 0x00, 0x01, 0x68,
+	0x06, 0x01, 0x02, 0x05, 0x01, 0x03, 0x04, 0x02, 0x03, 0x67, 0x0b, 0x0a, 0x02, 0x09, 0x09, 0x11,
+	0x4d, 0x00, 0x04, 0x04, 0x12, 0x04, 0x4e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x1d, 0x19, 0x18, 0x11,
+	0x11, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x13, 0x0c, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x11, 0x07,
+	0x33, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x07, 0x21, 0x39, 0x01, 0x35, 0x21, 0x35, 0x21, 0x35,
+	0x21, 0x35, 0x21, 0x25, 0x11, 0x21, 0x11, 0x17, 0x37, 0x11, 0x03, 0x5d, 0xfe, 0xfd, 0xfe, 0xe7,
+	0x01, 0x19, 0xfe, 0xe7, 0x01, 0xfe, 0xe2, 0xfe, 0xdd, 0x01, 0x23, 0xfe, 0xdd, 0x01, 0x03, 0xfe,
+	0xfc, 0x01, 0x1f, 0x95, 0x8a, 0x05, 0x9c, 0xfd, 0x6a, 0x9d, 0x95, 0x40, 0x96, 0xfe, 0xfe, 0x96,
+	0x40, 0x95, 0x9d, 0x02, 0x96, 0xfe, 0x08, 0x60, 0x60, 0x01, 0xf8, 0x00, 0x00, 0x02, 0x00, 0x01,
+	0xff, 0x48, 0x00, 0xa5, 0x06, 0x4a, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x03,
+	0x00, 0x02, 0x01, 0x03, 0x02, 0x67, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00,
+	0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x11, 0x31, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x17, 0x39,
+	0x01, 0x33, 0x11, 0x23, 0x11, 0x39, 0x01, 0x33, 0x11, 0x23, 0x01, 0xa4, 0xa4, 0xa4, 0xa4, 0xb8,
+	0x02, 0xfc, 0x01, 0x0a, 0x02, 0xfc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x43, 0x03, 0x12,
+	0x05, 0x74, 0x00, 0x1e, 0x00, 0x25, 0x02, 0x59, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x0f, 0x16,
+	0x01, 0x07, 0x06, 0x11, 0x02, 0x02, 0x00, 0x04, 0x07, 0x01, 0x02, 0x03, 0x03, 0x4c, 0x1b, 0x4b,
+	0xb0, 0x0d, 0x50, 0x58, 0x40, 0x0f, 0x16, 0x01, 0x07, 0x06, 0x11, 0x02, 0x02, 0x09, 0x04, 0x07,
+	0x01, 0x02, 0x03, 0x03, 0x4c, 0x1b, 0x40, 0x0f, 0x16, 0x01, 0x07, 0x06, 0x11, 0x02, 0x02, 0x09,
+	0x08, 0x07, 0x01, 0x02, 0x03, 0x03, 0x4c, 0x59, 0x59, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x26,
+	0x09, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x67, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x63,
+	0x00, 0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x08, 0x01, 0x04, 0x04, 0x07, 0x5f,
+	0x00, 0x07, 0x07, 0x14, 0x04, 0x4e, 0x1b, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x2d, 0x00, 0x00,
+	0x09, 0x03, 0x09, 0x00, 0x03, 0x80, 0x00, 0x09, 0x00, 0x03, 0x02, 0x09, 0x03, 0x67, 0x00, 0x02,
+	0x00, 0x01, 0x02, 0x01, 0x63, 0x00, 0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x4d, 0x08,
+	0x01, 0x04, 0x04, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x14, 0x04, 0x4e, 0x1b, 0x4b, 0xb0, 0x0f, 0x50,
+	0x58, 0x40, 0x34, 0x00, 0x04, 0x07, 0x08, 0x07, 0x04, 0x08, 0x80, 0x00, 0x00, 0x09, 0x03, 0x09,
+	0x00, 0x03, 0x80, 0x00, 0x09, 0x00, 0x03, 0x02, 0x09, 0x03, 0x67, 0x00, 0x02, 0x00, 0x01, 0x02,
+	0x01, 0x63, 0x00, 0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x08, 0x08, 0x07,
+	0x5f, 0x00, 0x07, 0x07, 0x14, 0x08, 0x4e, 0x1b, 0x4b, 0xb0, 0x11, 0x50, 0x58, 0x40, 0x34, 0x00,
+	0x04, 0x07, 0x08, 0x07, 0x04, 0x08, 0x80, 0x00, 0x00, 0x09, 0x03, 0x09, 0x00, 0x03, 0x80, 0x00,
+	0x09, 0x00, 0x03, 0x02, 0x09, 0x03, 0x67, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x63, 0x00, 0x06,
+	0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x4d, 0x00, 0x08, 0x08, 0x07, 0x5f, 0x00, 0x07, 0x07,
+	0x14, 0x08, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x34, 0x00, 0x04, 0x07, 0x08, 0x07,
+	0x04, 0x08, 0x80, 0x00, 0x00, 0x09, 0x03, 0x09, 0x00, 0x03, 0x80, 0x00, 0x09, 0x00, 0x03, 0x02,
+	0x09, 0x03, 0x67, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x63, 0x00, 0x06, 0x06, 0x05, 0x5f, 0x00,
+	0x05, 0x05, 0x11, 0x4d, 0x00, 0x08, 0x08, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x14, 0x08, 0x4e, 0x1b,
+	0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x34, 0x00, 0x04, 0x07, 0x08, 0x07, 0x04, 0x08, 0x80, 0x00,
+	0x00, 0x09, 0x03, 0x09, 0x00, 0x03, 0x80, 0x00, 0x09, 0x00, 0x03, 0x02, 0x09, 0x03, 0x67, 0x00,
+	0x02, 0x00, 0x01, 0x02, 0x01, 0x63, 0x00, 0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x4d,
+	0x00, 0x08, 0x08, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x14, 0x08, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50,
+	0x58, 0x40, 0x34, 0x00, 0x04, 0x07, 0x08, 0x07, 0x04, 0x08, 0x80, 0x00, 0x00, 0x09, 0x03, 0x09,
+	0x00, 0x03, 0x80, 0x00, 0x09, 0x00, 0x03, 0x02, 0x09, 0x03, 0x67, 0x00, 0x02, 0x00, 0x01, 0x02,
+	0x01, 0x63, 0x00, 0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x08, 0x08, 0x07,
+	0x5f, 0x00, 0x07, 0x07, 0x14, 0x08, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x34, 0x00,
+	0x04, 0x07, 0x08, 0x07, 0x04, 0x08, 0x80, 0x00, 0x00, 0x09, 0x03, 0x09, 0x00, 0x03, 0x80, 0x00,
+	0x09, 0x00, 0x03, 0x02, 0x09, 0x03, 0x67, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x63, 0x00, 0x06,
+	0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x4d, 0x00, 0x08, 0x08, 0x07, 0x5f, 0x00, 0x07, 0x07,
+	0x14, 0x08, 0x4e, 0x1b, 0x40, 0x32, 0x00, 0x04, 0x07, 0x08, 0x07, 0x04, 0x08, 0x80, 0x00, 0x00,
+	0x09, 0x03, 0x09, 0x00, 0x03, 0x80, 0x00, 0x05, 0x00, 0x06, 0x07, 0x05, 0x06, 0x67, 0x00, 0x09,
+	0x00, 0x03, 0x02, 0x09, 0x03, 0x67, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x63, 0x00, 0x08, 0x08,
+	0x07, 0x5f, 0x00, 0x07, 0x07, 0x14, 0x08, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+	0x40, 0x0e, 0x25, 0x23, 0x32, 0x11, 0x21, 0x14, 0x14, 0x11, 0x21, 0x14, 0x13, 0x0a, 0x07, 0x1f,
+	0x2b, 0x01, 0x31, 0x15, 0x07, 0x33, 0x1d, 0x02, 0x07, 0x21, 0x27, 0x21, 0x33, 0x35, 0x21, 0x3d,
+	0x02, 0x37, 0x23, 0x3d, 0x02, 0x37, 0x21, 0x17, 0x23, 0x21, 0x15, 0x21, 0x15, 0x07, 0x31, 0x23,
+	0x21, 0x15, 0x3b, 0x01, 0x03, 0x12, 0x36, 0x36, 0xaf, 0xfe, 0x4c, 0x9d, 0x01, 0x38, 0xf2, 0xfd,
+	0xc4, 0x2e, 0x2e, 0xaf, 0x01, 0xb4, 0x9d, 0xe8, 0xfe, 0xbe, 0x02, 0x3c, 0xd6, 0x24, 0xfe, 0xbe,
+	0x74, 0xf2, 0x03, 0x0a, 0x50, 0x49, 0x33, 0xbf, 0x50, 0xec, 0xd3, 0x9a, 0x3e, 0xbf, 0x50, 0x3e,
+	0x3e, 0xbf, 0x50, 0xec, 0xd3, 0xa6, 0x32, 0xb3, 0x75, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+	0x04, 0x7b, 0x02, 0x87, 0x05, 0x98, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x32, 0xb1, 0x06, 0x64, 0x44,
+	0x40, 0x27, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x05,
+	0x03, 0x04, 0x03, 0x01, 0x00, 0x01, 0x4f, 0x06, 0x06, 0x00, 0x00, 0x06, 0x0b, 0x06, 0x0b, 0x0a,
+	0x09, 0x00, 0x05, 0x00, 0x05, 0x13, 0x06, 0x07, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x39,
+	0x01, 0x11, 0x23, 0x11, 0x07, 0x39, 0x01, 0x11, 0x23, 0x11, 0x02, 0x87, 0xf7, 0x98, 0xf7, 0x04,
+	0x7b, 0x01, 0x1d, 0xfe, 0xe4, 0x01, 0x01, 0x1d, 0xfe, 0xe4, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x7f, 0x05, 0x9a, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x1e, 0x00, 0xa8, 0xb1, 0x06,
+	0x64, 0x44, 0x40, 0x0b, 0x1c, 0x19, 0x02, 0x07, 0x09, 0x10, 0x01, 0x04, 0x06, 0x02, 0x4c, 0x4b,
+	0xb0, 0x1d, 0x50, 0x58, 0x40, 0x36, 0x00, 0x08, 0x07, 0x05, 0x07, 0x08, 0x72, 0x00, 0x05, 0x06,
+	0x06, 0x05, 0x70, 0x00, 0x01, 0x00, 0x03, 0x09, 0x01, 0x03, 0x67, 0x00, 0x09, 0x00, 0x07, 0x08,
+	0x09, 0x07, 0x67, 0x00, 0x06, 0x0a, 0x01, 0x04, 0x02, 0x06, 0x04, 0x68, 0x00, 0x02, 0x00, 0x00,
+	0x02, 0x57, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x1b, 0x40, 0x38, 0x00,
+	0x08, 0x07, 0x05, 0x07, 0x08, 0x05, 0x80, 0x00, 0x05, 0x06, 0x07, 0x05, 0x06, 0x7e, 0x00, 0x01,
+	0x00, 0x03, 0x09, 0x01, 0x03, 0x67, 0x00, 0x09, 0x00, 0x07, 0x08, 0x09, 0x07, 0x67, 0x00, 0x06,
+	0x0a, 0x01, 0x04, 0x02, 0x06, 0x04, 0x68, 0x00, 0x02, 0x00, 0x00, 0x02, 0x57, 0x00, 0x02, 0x02,
+	0x00, 0x5f, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x59, 0x40, 0x17, 0x0f, 0x0c, 0x1b, 0x1a, 0x18, 0x17,
+	0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x0c, 0x1e, 0x0f, 0x1d, 0x11, 0x31, 0x11, 0x30, 0x0b, 0x07,
+	0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x39, 0x02, 0x21, 0x11, 0x21, 0x01, 0x39, 0x01, 0x21, 0x11,
+	0x21, 0x01, 0x39, 0x01, 0x21, 0x37, 0x35, 0x23, 0x15, 0x23, 0x11, 0x33, 0x15, 0x33, 0x35, 0x27,
+	0x21, 0x17, 0x11, 0x31, 0x05, 0x7f, 0xfa, 0x81, 0x04, 0xde, 0xfb, 0xc3, 0x04, 0x3d, 0xfc, 0xfa,
+	0x01, 0xb9, 0x8a, 0xc1, 0xc1, 0xc1, 0xc1, 0x82, 0xfd, 0xcb, 0x74, 0x05, 0x9a, 0xfb, 0x07, 0x04,
+	0x57, 0xfb, 0xee, 0xb2, 0x69, 0x59, 0x02, 0x49, 0x58, 0x69, 0xb2, 0x9c, 0xfc, 0xce, 0x00, 0x00,
+	0x00, 0x02, 0xff, 0xff, 0x03, 0x76, 0x01, 0xcf, 0x05, 0x98, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x2b,
+	0x40, 0x28, 0x09, 0x01, 0x04, 0x02, 0x04, 0x01, 0x00, 0x03, 0x02, 0x4c, 0x00, 0x04, 0x04, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x21, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x22,
+	0x00, 0x4e, 0x11, 0x32, 0x11, 0x12, 0x30, 0x05, 0x08, 0x1b, 0x2b, 0x03, 0x39, 0x01, 0x33, 0x37,
+	0x15, 0x33, 0x11, 0x21, 0x07, 0x05, 0x39, 0x01, 0x23, 0x35, 0x33, 0x01, 0xc4, 0x72, 0x9a, 0xfe,
+	0x98, 0x68, 0x01, 0x36, 0x9b, 0x9b, 0x03, 0x76, 0x9a, 0x9a, 0x02, 0x22, 0x8f, 0xf8, 0xeb, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x03, 0x55, 0x02, 0xd4, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x28,
+	0x40, 0x25, 0x0f, 0x0c, 0x07, 0x04, 0x04, 0x02, 0x03, 0x01, 0x4c, 0x00, 0x01, 0x03, 0x01, 0x85,
+	0x00, 0x00, 0x02, 0x00, 0x86, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x12, 0x02, 0x4e,
+	0x12, 0x32, 0x12, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x25, 0x39, 0x01, 0x33, 0x09, 0x01, 0x23, 0x09,
+	0x01, 0x39, 0x01, 0x23, 0x09, 0x01, 0x33, 0x01, 0x01, 0x03, 0xf3, 0xfe, 0xfd, 0x01, 0x03, 0xf3,
+	0xfe, 0xfd, 0x03, 0x55, 0xf4, 0xfe, 0xfe, 0x01, 0x02, 0xf4, 0xfe, 0xfd, 0x01, 0x01, 0x69, 0x01,
+	0x6a, 0xfe, 0x96, 0xfe, 0x97, 0x01, 0x69, 0x01, 0x6a, 0xfe, 0x96, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xc4, 0x04, 0x6f, 0x02, 0xd4, 0x00, 0x07, 0x00, 0x1e, 0x40, 0x1b, 0x00, 0x00, 0x02, 0x00,
+	0x86, 0x00, 0x01, 0x02, 0x02, 0x01, 0x57, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x01, 0x02,
+	0x4f, 0x11, 0x11, 0x30, 0x03, 0x07, 0x19, 0x2b, 0x25, 0x39, 0x01, 0x33, 0x11, 0x21, 0x15, 0x21,
+	0x03, 0xcc, 0xa3, 0xfb, 0x91, 0x03, 0xcc, 0xc4, 0x02, 0x10, 0xa4, 0x00, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x7f, 0x05, 0x9a, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x28, 0x00, 0x6c,
+	0xb1, 0x06, 0x64, 0x44, 0x40, 0x61, 0x14, 0x11, 0x02, 0x05, 0x03, 0x10, 0x01, 0x04, 0x05, 0x0f,
+	0x01, 0x01, 0x04, 0x03, 0x4c, 0x0e, 0x01, 0x01, 0x01, 0x4b, 0x02, 0x0a, 0x02, 0x00, 0x01, 0x08,
+	0x01, 0x00, 0x08, 0x80, 0x00, 0x07, 0x00, 0x09, 0x03, 0x07, 0x09, 0x67, 0x00, 0x03, 0x00, 0x05,
+	0x04, 0x03, 0x05, 0x67, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x08, 0x06, 0x06,
+	0x08, 0x57, 0x00, 0x08, 0x08, 0x06, 0x5f, 0x00, 0x06, 0x08, 0x06, 0x4f, 0x03, 0x00, 0x28, 0x27,
+	0x26, 0x23, 0x22, 0x21, 0x20, 0x1d, 0x1c, 0x1b, 0x1a, 0x17, 0x13, 0x12, 0x0b, 0x08, 0x07, 0x06,
+	0x00, 0x16, 0x03, 0x15, 0x0b, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x25, 0x39, 0x01, 0x33,
+	0x11, 0x33, 0x35, 0x33, 0x11, 0x39, 0x01, 0x33, 0x11, 0x31, 0x35, 0x27, 0x37, 0x35, 0x27, 0x21,
+	0x17, 0x11, 0x31, 0x01, 0x39, 0x01, 0x23, 0x35, 0x33, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x01,
+	0x39, 0x01, 0x21, 0x11, 0x21, 0x01, 0xd7, 0xc1, 0x01, 0xc2, 0xc1, 0x4d, 0x4d, 0x82, 0xfd, 0xc9,
+	0x74, 0x01, 0x84, 0xc2, 0xc2, 0xfc, 0xa5, 0x05, 0x7f, 0xfa, 0x81, 0x04, 0xde, 0xfb, 0xc3, 0x04,
+	0x3d, 0xe6, 0x01, 0x48, 0x3e, 0xfe, 0x7a, 0x01, 0x48, 0x3e, 0x63, 0x62, 0xd0, 0xb2, 0x9b, 0xfc,
+	0xce, 0x02, 0x48, 0xc3, 0xfc, 0x0f, 0x05, 0x9a, 0xfb, 0x07, 0x04, 0x57, 0x00, 0x01, 0x00, 0x00,
+	0x04, 0xf4, 0x03, 0xed, 0x05, 0x98, 0x00, 0x05, 0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b,
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01,
+	0x4f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x13, 0x03, 0x07, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44,
+	0x01, 0x39, 0x01, 0x35, 0x21, 0x15, 0x03, 0xed, 0xfc, 0x13, 0x04, 0xf4, 0xa4, 0xa4, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x03, 0x77, 0x02, 0x1b, 0x05, 0x9a, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x2a,
+	0xb1, 0x06, 0x64, 0x44, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x67, 0x00, 0x02,
+	0x00, 0x00, 0x02, 0x57, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x11, 0x31,
+	0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x11, 0x39, 0x01, 0x21, 0x11, 0x21,
+	0x01, 0x39, 0x01, 0x23, 0x35, 0x33, 0x02, 0x1b, 0xfd, 0xe5, 0x01, 0x7a, 0xd9, 0xd9, 0x03, 0x77,
+	0x02, 0x23, 0xfe, 0x7e, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x03, 0x21,
+	0x03, 0xee, 0x00, 0x0d, 0x00, 0x13, 0x00, 0x33, 0x40, 0x30, 0x04, 0x01, 0x02, 0x05, 0x01, 0x01,
+	0x00, 0x02, 0x01, 0x67, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x00, 0x06,
+	0x06, 0x07, 0x5f, 0x08, 0x01, 0x07, 0x07, 0x12, 0x07, 0x4e, 0x0e, 0x0e, 0x0e, 0x13, 0x0e, 0x13,
+	0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x09, 0x07, 0x1d, 0x2b, 0x25, 0x39, 0x01, 0x33, 0x11,
+	0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x01, 0x39, 0x01, 0x35, 0x21, 0x15, 0x01,
+	0x38, 0xb1, 0x01, 0x1d, 0xfe, 0xe3, 0xb1, 0xfe, 0xe3, 0x01, 0x1d, 0x01, 0xe9, 0xfc, 0xdf, 0xff,
+	0x01, 0x1e, 0xb2, 0x01, 0x1f, 0xfe, 0xe1, 0xb2, 0xfd, 0xe4, 0xa4, 0xa4, 0x00, 0x01, 0x00, 0x00,
+	0x03, 0x76, 0x01, 0x92, 0x05, 0x98, 0x00, 0x1a, 0x00, 0x5e, 0x40, 0x0e, 0x0b, 0x08, 0x02, 0x04,
+	0x02, 0x19, 0x18, 0x07, 0x06, 0x04, 0x01, 0x03, 0x02, 0x4c, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
+	0x1c, 0x00, 0x03, 0x04, 0x01, 0x04, 0x03, 0x72, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02,
+	0x21, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4e, 0x1b, 0x40, 0x1d,
+	0x00, 0x03, 0x04, 0x01, 0x04, 0x03, 0x01, 0x80, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02,
+	0x21, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4e, 0x59, 0xb7, 0x11,
+	0x34, 0x14, 0x11, 0x30, 0x05, 0x08, 0x1b, 0x2b, 0x13, 0x39, 0x01, 0x21, 0x35, 0x23, 0x35, 0x37,
+	0x35, 0x27, 0x21, 0x17, 0x15, 0x31, 0x15, 0x31, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x15, 0x31,
+	0x15, 0x07, 0x33, 0x4c, 0x01, 0x45, 0xd9, 0xda, 0x4e, 0xfe, 0xbc, 0x4c, 0x6c, 0x6d, 0xd9, 0x01,
+	0x03, 0x76, 0x6d, 0x35, 0x9d, 0x7f, 0x64, 0x64, 0x1e, 0x1d, 0x04, 0x36, 0x15, 0x09, 0x25, 0xa5,
+	0x00, 0x01, 0x00, 0x00, 0x03, 0x76, 0x01, 0x94, 0x05, 0x98, 0x00, 0x29, 0x00, 0x75, 0x40, 0x16,
+	0x0b, 0x08, 0x02, 0x03, 0x01, 0x1c, 0x1b, 0x1a, 0x18, 0x07, 0x06, 0x05, 0x07, 0x05, 0x02, 0x29,
+	0x04, 0x02, 0x00, 0x04, 0x03, 0x4c, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x22, 0x00, 0x02, 0x03,
+	0x05, 0x03, 0x02, 0x72, 0x00, 0x05, 0x04, 0x04, 0x05, 0x70, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00,
+	0x01, 0x01, 0x21, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x60, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4e, 0x1b,
+	0x40, 0x24, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x80, 0x00, 0x05, 0x04, 0x03, 0x05, 0x04,
+	0x7e, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x21, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x60,
+	0x00, 0x00, 0x00, 0x22, 0x00, 0x4e, 0x59, 0x40, 0x09, 0x11, 0x1e, 0x11, 0x34, 0x16, 0x30, 0x06,
+	0x08, 0x1c, 0x2b, 0x13, 0x39, 0x01, 0x33, 0x37, 0x35, 0x27, 0x37, 0x35, 0x27, 0x21, 0x17, 0x15,
+	0x31, 0x15, 0x31, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x15, 0x31, 0x15, 0x0f, 0x01, 0x15, 0x17,
+	0x15, 0x31, 0x15, 0x31, 0x15, 0x23, 0x35, 0x23, 0x15, 0x31, 0x15, 0x31, 0x15, 0x9c, 0xaa, 0x4e,
+	0x40, 0x40, 0x4e, 0xfe, 0xba, 0x4e, 0x6d, 0x6c, 0x32, 0x0e, 0x40, 0x6c, 0x6d, 0x03, 0x76, 0x64,
+	0x7f, 0x2e, 0x2e, 0x7f, 0x64, 0x64, 0x1e, 0x1d, 0x04, 0x36, 0x15, 0x09, 0x25, 0x26, 0x0a, 0x61,
+	0x31, 0x25, 0x09, 0x15, 0x35, 0x03, 0x1d, 0x1e, 0x00, 0x01, 0x00, 0x00, 0x03, 0xee, 0x01, 0x91,
+	0x05, 0x98, 0x00, 0x05, 0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x11, 0x30, 0x02, 0x07,
+	0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x39, 0x01, 0x23, 0x13, 0x33, 0xbe, 0xbe, 0x9b, 0xf6,
+	0x03, 0xee, 0x01, 0xaa, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x03, 0x55, 0x05, 0x98, 0x00, 0x0c,
+	0x00, 0x9d, 0xb5, 0x0b, 0x01, 0x05, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1a,
+	0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x01, 0x68, 0x04, 0x01, 0x02, 0x02, 0x11, 0x4d, 0x06, 0x01,
+	0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58,
+	0x40, 0x1a, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x01, 0x68, 0x04, 0x01, 0x02, 0x02, 0x13, 0x4d,
+	0x06, 0x01, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b,
+	0x50, 0x58, 0x40, 0x1a, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x01, 0x68, 0x04, 0x01, 0x02, 0x02,
+	0x11, 0x4d, 0x06, 0x01, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40,
+	0x1a, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x01, 0x68, 0x04, 0x01, 0x02, 0x02, 0x13, 0x4d, 0x06,
+	0x01, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x0e,
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07, 0x07, 0x1b, 0x2b, 0x19,
+	0x01, 0x21, 0x03, 0x21, 0x11, 0x21, 0x11, 0x21, 0x03, 0x21, 0x11, 0x17, 0x01, 0x1d, 0x01, 0x02,
+	0x39, 0xfe, 0xe4, 0xfe, 0xe4, 0x01, 0xfe, 0xe4, 0xb3, 0x01, 0xbd, 0xfe, 0x44, 0x01, 0xaa, 0x03,
+	0xed, 0xfd, 0x31, 0x02, 0xcf, 0xfd, 0x19, 0xf4, 0x00, 0x01, 0x00, 0x00, 0xff, 0xfd, 0x02, 0xe5,
+	0x05, 0x98, 0x00, 0x10, 0x00, 0xa5, 0x40, 0x0a, 0x0c, 0x01, 0x02, 0x00, 0x0b, 0x01, 0x04, 0x02,
+	0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x01,
+	0x80, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x05, 0x01, 0x00, 0x00, 0x11, 0x4d, 0x03, 0x01, 0x01, 0x01,
+	0x12, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x04, 0x02, 0x01, 0x02,
+	0x04, 0x01, 0x80, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x05, 0x01, 0x00, 0x00, 0x13, 0x4d, 0x03, 0x01,
+	0x01, 0x01, 0x12, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x04, 0x02,
+	0x01, 0x02, 0x04, 0x01, 0x80, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x05, 0x01, 0x00, 0x00, 0x11, 0x4d,
+	0x03, 0x01, 0x01, 0x01, 0x12, 0x01, 0x4e, 0x1b, 0x40, 0x1a, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04,
+	0x01, 0x80, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x05, 0x01, 0x00, 0x00, 0x13, 0x4d, 0x03, 0x01, 0x01,
+	0x01, 0x12, 0x01, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x11, 0x02, 0x00, 0x0a, 0x09, 0x08, 0x07, 0x06,
+	0x05, 0x04, 0x03, 0x00, 0x10, 0x02, 0x0d, 0x06, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x11, 0x23,
+	0x11, 0x07, 0x11, 0x23, 0x11, 0x23, 0x27, 0x11, 0x37, 0x3b, 0x02, 0x02, 0x8a, 0x5b, 0xa3, 0x75,
+	0xa3, 0xc0, 0x6a, 0x64, 0xc6, 0xa3, 0x75, 0x05, 0x98, 0xfa, 0x65, 0x05, 0x09, 0x02, 0xfa, 0xf9,
+	0x02, 0xb0, 0x88, 0x01, 0xda, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0xdb, 0x01, 0x1c,
+	0x02, 0xd4, 0x00, 0x05, 0x00, 0x18, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01,
+	0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x11, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x13, 0x39,
+	0x01, 0x21, 0x35, 0x21, 0x01, 0x01, 0x1b, 0xfe, 0xe5, 0x01, 0xdb, 0xf9, 0x00, 0x01, 0xff, 0xff,
+	0xfe, 0x91, 0x01, 0x51, 0x00, 0x3e, 0x00, 0x14, 0x00, 0xe7, 0xb1, 0x06, 0x64, 0x44, 0xb5, 0x04,
+	0x01, 0x00, 0x04, 0x01, 0x4c, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x25, 0x00, 0x02, 0x01, 0x01,
+	0x02, 0x70, 0x00, 0x03, 0x01, 0x04, 0x00, 0x03, 0x72, 0x05, 0x01, 0x04, 0x00, 0x01, 0x04, 0x70,
+	0x00, 0x01, 0x03, 0x00, 0x01, 0x58, 0x00, 0x01, 0x01, 0x00, 0x60, 0x06, 0x01, 0x00, 0x01, 0x00,
+	0x50, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x27, 0x00, 0x02, 0x01, 0x01, 0x02, 0x70, 0x00,
+	0x03, 0x01, 0x04, 0x01, 0x03, 0x04, 0x80, 0x05, 0x01, 0x04, 0x00, 0x01, 0x04, 0x00, 0x7e, 0x00,
+	0x01, 0x03, 0x00, 0x01, 0x58, 0x00, 0x01, 0x01, 0x00, 0x60, 0x06, 0x01, 0x00, 0x01, 0x00, 0x50,
+	0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x2d, 0x00, 0x02, 0x01, 0x01, 0x02, 0x70, 0x00, 0x03,
+	0x01, 0x05, 0x01, 0x03, 0x05, 0x80, 0x00, 0x05, 0x04, 0x01, 0x05, 0x04, 0x7e, 0x00, 0x04, 0x00,
+	0x01, 0x04, 0x00, 0x7e, 0x00, 0x01, 0x03, 0x00, 0x01, 0x58, 0x00, 0x01, 0x01, 0x00, 0x60, 0x06,
+	0x01, 0x00, 0x01, 0x00, 0x50, 0x1b, 0x40, 0x2c, 0x00, 0x02, 0x01, 0x02, 0x85, 0x00, 0x03, 0x01,
+	0x05, 0x01, 0x03, 0x05, 0x80, 0x00, 0x05, 0x04, 0x01, 0x05, 0x04, 0x7e, 0x00, 0x04, 0x00, 0x01,
+	0x04, 0x00, 0x7e, 0x00, 0x01, 0x03, 0x00, 0x01, 0x58, 0x00, 0x01, 0x01, 0x00, 0x60, 0x06, 0x01,
+	0x00, 0x01, 0x00, 0x50, 0x59, 0x59, 0x59, 0x40, 0x13, 0x03, 0x00, 0x12, 0x11, 0x10, 0x0f, 0x0e,
+	0x0b, 0x0a, 0x09, 0x06, 0x05, 0x00, 0x14, 0x03, 0x13, 0x07, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00,
+	0x44, 0x03, 0x39, 0x01, 0x21, 0x37, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x15, 0x33, 0x31, 0x33,
+	0x15, 0x23, 0x35, 0x23, 0x15, 0x31, 0x01, 0x01, 0x02, 0x50, 0xe2, 0x01, 0x71, 0x70, 0x72, 0x71,
+	0x71, 0xfe, 0x91, 0x68, 0xeb, 0x3d, 0x1d, 0xcb, 0x71, 0x1a, 0x8b, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x03, 0x76, 0x01, 0x3a, 0x05, 0x98, 0x00, 0x0f, 0x00, 0x27, 0x40, 0x24, 0x06, 0x01, 0x03, 0x02,
+	0x01, 0x4c, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x21, 0x4d, 0x04, 0x01, 0x01, 0x01,
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4e, 0x11, 0x41, 0x12, 0x11, 0x30, 0x05, 0x08, 0x1b,
+	0x2b, 0x13, 0x39, 0x01, 0x21, 0x35, 0x23, 0x11, 0x27, 0x23, 0x17, 0x39, 0x02, 0x33, 0x11, 0x23,
+	0x21, 0x01, 0x19, 0x58, 0x49, 0x99, 0x51, 0x25, 0x55, 0x03, 0x76, 0x6d, 0x01, 0x51, 0x64, 0x6d,
+	0xfe, 0xb8, 0x00, 0x00, 0x00, 0x02, 0xff, 0xc6, 0x03, 0x76, 0x01, 0x4d, 0x05, 0x98, 0x00, 0x09,
+	0x00, 0x0f, 0x00, 0x2b, 0x40, 0x28, 0x08, 0x05, 0x02, 0x03, 0x01, 0x09, 0x04, 0x02, 0x00, 0x02,
+	0x02, 0x4c, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x21, 0x4d, 0x00, 0x02, 0x02, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4e, 0x11, 0x33, 0x13, 0x30, 0x04, 0x08, 0x1a, 0x2b, 0x13,
+	0x39, 0x01, 0x33, 0x37, 0x11, 0x27, 0x21, 0x17, 0x11, 0x37, 0x39, 0x01, 0x23, 0x11, 0x33, 0x54,
+	0xab, 0x4e, 0x49, 0xfe, 0xc2, 0x41, 0xd9, 0x6d, 0x6d, 0x03, 0x76, 0x64, 0x01, 0x5a, 0x64, 0x58,
+	0xfe, 0x9a, 0x09, 0x01, 0x48, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x03, 0x54,
+	0x02, 0xd4, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x28, 0x40, 0x25, 0x0f, 0x0c, 0x07, 0x04, 0x04, 0x00,
+	0x01, 0x01, 0x4c, 0x00, 0x03, 0x01, 0x03, 0x85, 0x00, 0x02, 0x00, 0x02, 0x86, 0x00, 0x01, 0x01,
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x12, 0x32, 0x12, 0x30, 0x04, 0x07, 0x1a, 0x2b,
+	0x25, 0x39, 0x01, 0x23, 0x09, 0x01, 0x33, 0x09, 0x01, 0x39, 0x01, 0x33, 0x09, 0x01, 0x23, 0x01,
+	0x02, 0x51, 0xf3, 0x01, 0x03, 0xfe, 0xfd, 0xf3, 0x01, 0x03, 0xfc, 0xac, 0xf3, 0x01, 0x02, 0xfe,
+	0xfe, 0xf3, 0x01, 0x02, 0x01, 0x01, 0x69, 0x01, 0x6a, 0xfe, 0x96, 0xfe, 0x97, 0x01, 0x69, 0x01,
+	0x6a, 0xfe, 0x96, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x04, 0x9e, 0x05, 0x98, 0x00, 0x05,
+	0x00, 0x15, 0x00, 0x24, 0x00, 0x59, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x4e, 0x0c, 0x01, 0x05, 0x01,
+	0x21, 0x1a, 0x02, 0x09, 0x08, 0x22, 0x01, 0x0b, 0x09, 0x03, 0x4c, 0x04, 0x01, 0x01, 0x00, 0x05,
+	0x03, 0x01, 0x05, 0x67, 0x06, 0x01, 0x03, 0x00, 0x02, 0x08, 0x03, 0x02, 0x67, 0x0a, 0x01, 0x08,
+	0x09, 0x00, 0x08, 0x57, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x09, 0x0b, 0x68, 0x0a, 0x01, 0x08, 0x08,
+	0x00, 0x5f, 0x07, 0x01, 0x00, 0x08, 0x00, 0x4f, 0x24, 0x23, 0x20, 0x1f, 0x1e, 0x1d, 0x12, 0x31,
+	0x11, 0x41, 0x12, 0x11, 0x31, 0x11, 0x30, 0x0c, 0x07, 0x1f, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x37,
+	0x39, 0x01, 0x33, 0x01, 0x23, 0x01, 0x39, 0x01, 0x21, 0x35, 0x23, 0x11, 0x27, 0x23, 0x17, 0x35,
+	0x15, 0x35, 0x33, 0x11, 0x23, 0x01, 0x39, 0x01, 0x33, 0x11, 0x27, 0x23, 0x11, 0x23, 0x11, 0x23,
+	0x17, 0x15, 0x17, 0x33, 0xd9, 0x90, 0x02, 0x07, 0x90, 0xfd, 0x4a, 0x01, 0x6c, 0x71, 0x5f, 0xc6,
+	0x69, 0x2f, 0x6e, 0x03, 0xe7, 0x8d, 0x5f, 0x2e, 0x8d, 0xe1, 0x55, 0x64, 0xb5, 0x01, 0x05, 0x97,
+	0xfd, 0x3e, 0x8d, 0x01, 0xb3, 0x82, 0x8e, 0x01, 0x01, 0x01, 0xfe, 0x58, 0xfc, 0x9e, 0x02, 0x41,
+	0x81, 0xfe, 0xa9, 0x01, 0x57, 0x71, 0xf2, 0x82, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x04, 0xc7,
+	0x05, 0x98, 0x00, 0x05, 0x00, 0x15, 0x00, 0x30, 0x00, 0xa1, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x12,
+	0x0c, 0x01, 0x05, 0x01, 0x21, 0x1e, 0x02, 0x0b, 0x09, 0x2f, 0x2e, 0x1d, 0x1c, 0x04, 0x08, 0x0a,
+	0x03, 0x4c, 0x4b, 0xb0, 0x26, 0x50, 0x58, 0x40, 0x32, 0x00, 0x0b, 0x09, 0x0a, 0x0a, 0x0b, 0x72,
+	0x04, 0x01, 0x01, 0x00, 0x05, 0x03, 0x01, 0x05, 0x67, 0x06, 0x01, 0x03, 0x00, 0x02, 0x09, 0x03,
+	0x02, 0x67, 0x00, 0x09, 0x00, 0x0a, 0x08, 0x09, 0x0a, 0x68, 0x00, 0x08, 0x00, 0x00, 0x08, 0x57,
+	0x00, 0x08, 0x08, 0x00, 0x5f, 0x07, 0x01, 0x00, 0x08, 0x00, 0x4f, 0x1b, 0x40, 0x33, 0x00, 0x0b,
+	0x09, 0x0a, 0x09, 0x0b, 0x0a, 0x80, 0x04, 0x01, 0x01, 0x00, 0x05, 0x03, 0x01, 0x05, 0x67, 0x06,
+	0x01, 0x03, 0x00, 0x02, 0x09, 0x03, 0x02, 0x67, 0x00, 0x09, 0x00, 0x0a, 0x08, 0x09, 0x0a, 0x68,
+	0x00, 0x08, 0x00, 0x00, 0x08, 0x57, 0x00, 0x08, 0x08, 0x00, 0x5f, 0x07, 0x01, 0x00, 0x08, 0x00,
+	0x4f, 0x59, 0x40, 0x12, 0x29, 0x28, 0x27, 0x24, 0x20, 0x1f, 0x11, 0x31, 0x11, 0x41, 0x12, 0x11,
+	0x31, 0x11, 0x30, 0x0c, 0x07, 0x1f, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x37, 0x39, 0x01, 0x33, 0x01,
+	0x23, 0x01, 0x39, 0x01, 0x21, 0x35, 0x23, 0x11, 0x27, 0x23, 0x17, 0x35, 0x15, 0x35, 0x33, 0x11,
+	0x23, 0x01, 0x39, 0x01, 0x21, 0x35, 0x21, 0x35, 0x25, 0x35, 0x27, 0x21, 0x17, 0x15, 0x31, 0x15,
+	0x31, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x15, 0x31, 0x15, 0x05, 0x31, 0xda, 0x90, 0x02, 0x07,
+	0x90, 0xfd, 0x4a, 0x01, 0x6d, 0x72, 0x5f, 0xc6, 0x69, 0x2f, 0x6e, 0x02, 0xf6, 0x01, 0xa5, 0xfe,
+	0xe8, 0x01, 0x19, 0x65, 0xfe, 0x5d, 0x62, 0x8d, 0x8c, 0xfe, 0xe8, 0x01, 0x05, 0x97, 0xfd, 0x3e,
+	0x8d, 0x01, 0xb3, 0x82, 0x8e, 0x01, 0x01, 0x01, 0xfe, 0x58, 0xfc, 0x9e, 0x8d, 0x45, 0xcb, 0xa4,
+	0x81, 0x81, 0x27, 0x26, 0x04, 0x45, 0x1b, 0x0b, 0x31, 0xd4, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x01, 0x04, 0xdf, 0x05, 0x98, 0x00, 0x05, 0x00, 0x14, 0x00, 0x3e, 0x00, 0xc1, 0xb1, 0x06,
+	0x64, 0x44, 0x40, 0x1f, 0x20, 0x1d, 0x02, 0x0a, 0x01, 0x31, 0x30, 0x2f, 0x2d, 0x1c, 0x1b, 0x1a,
+	0x07, 0x0c, 0x09, 0x3e, 0x19, 0x02, 0x07, 0x0b, 0x11, 0x0a, 0x02, 0x04, 0x03, 0x12, 0x01, 0x06,
+	0x04, 0x05, 0x4c, 0x4b, 0xb0, 0x26, 0x50, 0x58, 0x40, 0x3a, 0x00, 0x0a, 0x01, 0x09, 0x09, 0x0a,
+	0x72, 0x00, 0x0c, 0x09, 0x0b, 0x0b, 0x0c, 0x72, 0x08, 0x01, 0x01, 0x00, 0x09, 0x0c, 0x01, 0x09,
+	0x67, 0x00, 0x0b, 0x00, 0x07, 0x03, 0x0b, 0x07, 0x68, 0x05, 0x01, 0x03, 0x04, 0x00, 0x03, 0x57,
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x68, 0x05, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x02, 0x01,
+	0x00, 0x03, 0x00, 0x4f, 0x1b, 0x40, 0x3c, 0x00, 0x0a, 0x01, 0x09, 0x01, 0x0a, 0x09, 0x80, 0x00,
+	0x0c, 0x09, 0x0b, 0x09, 0x0c, 0x0b, 0x80, 0x08, 0x01, 0x01, 0x00, 0x09, 0x0c, 0x01, 0x09, 0x67,
+	0x00, 0x0b, 0x00, 0x07, 0x03, 0x0b, 0x07, 0x68, 0x05, 0x01, 0x03, 0x04, 0x00, 0x03, 0x57, 0x00,
+	0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x68, 0x05, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x02, 0x01, 0x00,
+	0x03, 0x00, 0x4f, 0x59, 0x40, 0x14, 0x39, 0x38, 0x37, 0x36, 0x28, 0x27, 0x26, 0x23, 0x16, 0x31,
+	0x13, 0x11, 0x11, 0x12, 0x31, 0x11, 0x30, 0x0d, 0x07, 0x1f, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x25,
+	0x39, 0x01, 0x33, 0x01, 0x23, 0x01, 0x39, 0x01, 0x33, 0x11, 0x27, 0x23, 0x11, 0x23, 0x11, 0x23,
+	0x17, 0x15, 0x17, 0x33, 0x01, 0x39, 0x01, 0x33, 0x37, 0x35, 0x27, 0x37, 0x35, 0x27, 0x21, 0x17,
+	0x15, 0x31, 0x15, 0x31, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x15, 0x31, 0x15, 0x0f, 0x01, 0x15,
+	0x17, 0x15, 0x31, 0x15, 0x31, 0x15, 0x23, 0x35, 0x23, 0x15, 0x31, 0x15, 0x31, 0x15, 0x01, 0x1a,
+	0x90, 0x02, 0x07, 0x90, 0x01, 0x31, 0x8d, 0x5f, 0x2e, 0x8d, 0xe1, 0x55, 0x64, 0xb5, 0xfc, 0x78,
+	0xde, 0x64, 0x52, 0x52, 0x64, 0xfe, 0x58, 0x65, 0x8d, 0x8d, 0x40, 0x13, 0x53, 0x8d, 0x8d, 0x01,
+	0x05, 0x97, 0xfa, 0x69, 0x02, 0x41, 0x81, 0xfe, 0xa9, 0x01, 0x57, 0x71, 0xf2, 0x82, 0x01, 0xf6,
+	0x81, 0xa5, 0x3c, 0x3c, 0xa4, 0x82, 0x82, 0x27, 0x25, 0x05, 0x45, 0x1b, 0x0b, 0x31, 0x31, 0x0d,
+	0x7e, 0x3f, 0x30, 0x0b, 0x1c, 0x46, 0x05, 0x25, 0x28, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0xfe, 0x57, 0x03, 0x57, 0x03, 0xee, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x6e, 0x40, 0x0e, 0x18, 0x17,
+	0x05, 0x04, 0x04, 0x02, 0x00, 0x0a, 0x07, 0x02, 0x01, 0x03, 0x02, 0x4c, 0x4b, 0xb0, 0x13, 0x50,
+	0x58, 0x40, 0x23, 0x00, 0x00, 0x05, 0x02, 0x05, 0x00, 0x02, 0x80, 0x00, 0x02, 0x03, 0x03, 0x02,
+	0x70, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x60,
+	0x00, 0x01, 0x01, 0x16, 0x01, 0x4e, 0x1b, 0x40, 0x24, 0x00, 0x00, 0x05, 0x02, 0x05, 0x00, 0x02,
+	0x80, 0x00, 0x02, 0x03, 0x05, 0x02, 0x03, 0x7e, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04,
+	0x14, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x60, 0x00, 0x01, 0x01, 0x16, 0x01, 0x4e, 0x59, 0x40, 0x09,
+	0x11, 0x38, 0x11, 0x34, 0x15, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x01, 0x39, 0x01, 0x21, 0x15, 0x03,
+	0x1d, 0x01, 0x13, 0x21, 0x13, 0x35, 0x31, 0x35, 0x31, 0x35, 0x21, 0x15, 0x21, 0x35, 0x31, 0x35,
+	0x31, 0x35, 0x13, 0x23, 0x13, 0x39, 0x01, 0x21, 0x15, 0x21, 0x02, 0x1a, 0xfe, 0xe5, 0xff, 0xcc,
+	0x01, 0xbf, 0xcc, 0xfe, 0xe3, 0xfe, 0xe3, 0xfd, 0x01, 0x01, 0xfe, 0xe5, 0x01, 0x1b, 0x02, 0x82,
+	0xe2, 0xfe, 0xf3, 0x39, 0xfd, 0xfe, 0xfa, 0x01, 0x06, 0x4f, 0x4c, 0x09, 0x8c, 0x37, 0x17, 0x62,
+	0x01, 0x21, 0x02, 0xa8, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c,
+	0x07, 0xc9, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0xce, 0xb6, 0x09, 0x02, 0x02, 0x05, 0x03,
+	0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x25, 0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06,
+	0x03, 0x03, 0x06, 0x70, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03,
+	0x5f, 0x08, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b,
+	0xb0, 0x13, 0x50, 0x58, 0x40, 0x25, 0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x03, 0x03, 0x06,
+	0x70, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x08, 0x01,
+	0x03, 0x03, 0x11, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50,
+	0x58, 0x40, 0x24, 0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x03, 0x06, 0x85, 0x00, 0x04, 0x00,
+	0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x08, 0x01, 0x03, 0x03, 0x11, 0x4d,
+	0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x24, 0x00, 0x07, 0x06, 0x07, 0x85, 0x00,
+	0x06, 0x03, 0x06, 0x85, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03,
+	0x5f, 0x08, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59,
+	0x59, 0x40, 0x14, 0x00, 0x00, 0x15, 0x14, 0x13, 0x10, 0x0f, 0x0e, 0x0d, 0x0b, 0x00, 0x0a, 0x00,
+	0x0a, 0x11, 0x11, 0x13, 0x09, 0x07, 0x19, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x21, 0x11, 0x21, 0x11,
+	0x21, 0x11, 0x27, 0x01, 0x31, 0x21, 0x11, 0x21, 0x13, 0x39, 0x01, 0x33, 0x03, 0x23, 0x02, 0x9b,
+	0xc1, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xac, 0x01, 0xca, 0x01, 0x1e, 0xfe, 0xe2, 0x23, 0xbe,
+	0x9b, 0xf7, 0x05, 0x99, 0xfe, 0xfa, 0xfb, 0x6d, 0x02, 0x3d, 0xfd, 0xc3, 0x04, 0xb4, 0xe5, 0xfd,
+	0xc3, 0x01, 0x1f, 0x01, 0xa3, 0x01, 0xab, 0x00, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c,
+	0x07, 0xc9, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x99, 0xb6, 0x09, 0x02, 0x02, 0x05, 0x03,
+	0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x22, 0x00, 0x07, 0x00, 0x06, 0x03, 0x07, 0x06,
+	0x67, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x08, 0x01,
+	0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50,
+	0x58, 0x40, 0x22, 0x00, 0x07, 0x00, 0x06, 0x03, 0x07, 0x06, 0x67, 0x00, 0x04, 0x00, 0x01, 0x00,
+	0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x08, 0x01, 0x03, 0x03, 0x11, 0x4d, 0x02, 0x01,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x22, 0x00, 0x07, 0x00, 0x06, 0x03, 0x07, 0x06, 0x67,
+	0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x08, 0x01, 0x03,
+	0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x14, 0x00, 0x00,
+	0x15, 0x14, 0x13, 0x10, 0x0f, 0x0e, 0x0d, 0x0b, 0x00, 0x0a, 0x00, 0x0a, 0x11, 0x11, 0x13, 0x09,
+	0x07, 0x19, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x27, 0x01, 0x31,
+	0x21, 0x11, 0x21, 0x13, 0x39, 0x01, 0x23, 0x13, 0x33, 0x02, 0x9b, 0xc1, 0xfe, 0xe2, 0xfe, 0xe2,
+	0xfe, 0xe2, 0xac, 0x01, 0xca, 0x01, 0x1e, 0xfe, 0xe2, 0xf3, 0xbe, 0x9b, 0xf7, 0x05, 0x99, 0xfe,
+	0xfa, 0xfb, 0x6d, 0x02, 0x3d, 0xfd, 0xc3, 0x04, 0xb4, 0xe5, 0xfd, 0xc3, 0x01, 0x1f, 0x01, 0xa3,
+	0x01, 0xab, 0x00, 0x00, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c, 0x07, 0xcb, 0x00, 0x0a,
+	0x00, 0x0f, 0x00, 0x17, 0x00, 0x87, 0x40, 0x10, 0x09, 0x02, 0x02, 0x05, 0x03, 0x01, 0x4c, 0x17,
+	0x16, 0x15, 0x14, 0x13, 0x10, 0x06, 0x03, 0x4a, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1a, 0x00,
+	0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03,
+	0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
+	0x1a, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x06, 0x01,
+	0x03, 0x03, 0x11, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1a, 0x00, 0x04,
+	0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x13,
+	0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x10, 0x00, 0x00, 0x0f, 0x0e,
+	0x0d, 0x0b, 0x00, 0x0a, 0x00, 0x0a, 0x11, 0x11, 0x13, 0x07, 0x07, 0x19, 0x2b, 0x01, 0x31, 0x13,
+	0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x27, 0x01, 0x31, 0x21, 0x11, 0x21, 0x01, 0x39, 0x01,
+	0x35, 0x25, 0x05, 0x15, 0x25, 0x02, 0x9b, 0xc1, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xac, 0x01,
+	0xca, 0x01, 0x1e, 0xfe, 0xe2, 0x01, 0x85, 0xfe, 0xf7, 0xfe, 0xf6, 0x01, 0x0a, 0x05, 0x99, 0xfe,
+	0xfa, 0xfb, 0x6d, 0x02, 0x3d, 0xfd, 0xc3, 0x04, 0xb4, 0xe5, 0xfd, 0xc3, 0x01, 0x1f, 0x01, 0xa2,
+	0xe5, 0xc9, 0xc9, 0xe5, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c,
+	0x07, 0x9b, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x2b, 0x00, 0xd0, 0x40, 0x14, 0x2b, 0x1e, 0x02, 0x08,
+	0x06, 0x1f, 0x01, 0x03, 0x09, 0x09, 0x02, 0x02, 0x05, 0x03, 0x03, 0x4c, 0x10, 0x01, 0x07, 0x4a,
+	0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x2f, 0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x08, 0x06,
+	0x85, 0x00, 0x08, 0x09, 0x08, 0x85, 0x00, 0x09, 0x03, 0x03, 0x09, 0x70, 0x00, 0x04, 0x00, 0x01,
+	0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x0a, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x02,
+	0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x07,
+	0x06, 0x07, 0x85, 0x00, 0x06, 0x08, 0x06, 0x85, 0x00, 0x08, 0x09, 0x08, 0x85, 0x00, 0x09, 0x03,
+	0x09, 0x85, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x0a,
+	0x01, 0x03, 0x03, 0x11, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x2e, 0x00,
+	0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x08, 0x06, 0x85, 0x00, 0x08, 0x09, 0x08, 0x85, 0x00, 0x09,
+	0x03, 0x09, 0x85, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f,
+	0x0a, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40,
+	0x18, 0x00, 0x00, 0x28, 0x26, 0x24, 0x22, 0x1b, 0x19, 0x17, 0x15, 0x0f, 0x0e, 0x0d, 0x0b, 0x00,
+	0x0a, 0x00, 0x0a, 0x11, 0x11, 0x13, 0x0b, 0x07, 0x19, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x21, 0x11,
+	0x21, 0x11, 0x21, 0x11, 0x27, 0x01, 0x31, 0x21, 0x11, 0x21, 0x01, 0x39, 0x01, 0x06, 0x07, 0x06,
+	0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x17, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
+	0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x02, 0x9b, 0xc1, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xac,
+	0x01, 0xca, 0x01, 0x1e, 0xfe, 0xe2, 0x01, 0xec, 0x45, 0x37, 0x36, 0x32, 0x35, 0x72, 0x72, 0x3e,
+	0x35, 0x39, 0x39, 0x3c, 0x03, 0x46, 0x36, 0x36, 0x31, 0x39, 0x72, 0x73, 0x3a, 0x37, 0x38, 0x39,
+	0x3c, 0x05, 0x99, 0xfe, 0xfa, 0xfb, 0x6d, 0x02, 0x3d, 0xfd, 0xc3, 0x04, 0xb4, 0xe5, 0xfd, 0xc3,
+	0x01, 0x1f, 0x03, 0x20, 0x51, 0x1b, 0x1b, 0x30, 0x30, 0x1a, 0x19, 0x46, 0xdc, 0x51, 0x1b, 0x1b,
+	0x2f, 0x2f, 0x19, 0x19, 0x45, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c,
+	0x07, 0x3a, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0xea, 0xb6, 0x09, 0x02, 0x02,
+	0x05, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x29, 0x08, 0x01, 0x06, 0x07, 0x06,
+	0x85, 0x0c, 0x09, 0x0b, 0x03, 0x07, 0x03, 0x03, 0x07, 0x70, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04,
+	0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x0a, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x29, 0x08, 0x01, 0x06, 0x07,
+	0x06, 0x85, 0x0c, 0x09, 0x0b, 0x03, 0x07, 0x03, 0x03, 0x07, 0x70, 0x00, 0x04, 0x00, 0x01, 0x00,
+	0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x0a, 0x01, 0x03, 0x03, 0x11, 0x4d, 0x02, 0x01,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x28, 0x08, 0x01, 0x06,
+	0x07, 0x06, 0x85, 0x0c, 0x09, 0x0b, 0x03, 0x07, 0x03, 0x07, 0x85, 0x00, 0x04, 0x00, 0x01, 0x00,
+	0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x0a, 0x01, 0x03, 0x03, 0x11, 0x4d, 0x02, 0x01,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x28, 0x08, 0x01, 0x06, 0x07, 0x06, 0x85, 0x0c, 0x09,
+	0x0b, 0x03, 0x07, 0x03, 0x07, 0x85, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05,
+	0x05, 0x03, 0x5f, 0x0a, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x59, 0x59, 0x59, 0x40, 0x20, 0x16, 0x16, 0x10, 0x10, 0x00, 0x00, 0x16, 0x1b, 0x16, 0x1b, 0x1a,
+	0x19, 0x10, 0x15, 0x10, 0x15, 0x14, 0x13, 0x0f, 0x0e, 0x0d, 0x0b, 0x00, 0x0a, 0x00, 0x0a, 0x11,
+	0x11, 0x13, 0x0d, 0x07, 0x19, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11,
+	0x27, 0x01, 0x31, 0x21, 0x11, 0x21, 0x01, 0x39, 0x01, 0x11, 0x23, 0x11, 0x07, 0x39, 0x01, 0x11,
+	0x23, 0x11, 0x02, 0x9b, 0xc1, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xac, 0x01, 0xca, 0x01, 0x1e,
+	0xfe, 0xe2, 0x01, 0xd9, 0xf9, 0x98, 0xf8, 0x05, 0x99, 0xfe, 0xfa, 0xfb, 0x6d, 0x02, 0x3d, 0xfd,
+	0xc3, 0x04, 0xb4, 0xe5, 0xfd, 0xc3, 0x01, 0x1f, 0x01, 0xa2, 0x01, 0x1d, 0xfe, 0xe4, 0x01, 0x01,
+	0x1d, 0xfe, 0xe4, 0x00, 0x00, 0x04, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c, 0x07, 0xcb, 0x00, 0x0a,
+	0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0xc2, 0xb6, 0x09, 0x02, 0x02, 0x05, 0x03, 0x01, 0x4c,
+	0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x07, 0x09, 0x07, 0x85, 0x00, 0x06, 0x08, 0x03,
+	0x03, 0x06, 0x72, 0x00, 0x09, 0x00, 0x08, 0x06, 0x09, 0x08, 0x67, 0x00, 0x04, 0x00, 0x01, 0x00,
+	0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x0a, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x02, 0x01,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x07, 0x09,
+	0x07, 0x85, 0x00, 0x06, 0x08, 0x03, 0x03, 0x06, 0x72, 0x00, 0x09, 0x00, 0x08, 0x06, 0x09, 0x08,
+	0x67, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f, 0x0a, 0x01,
+	0x03, 0x03, 0x11, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x2f, 0x00, 0x07,
+	0x09, 0x07, 0x85, 0x00, 0x06, 0x08, 0x03, 0x08, 0x06, 0x03, 0x80, 0x00, 0x09, 0x00, 0x08, 0x06,
+	0x09, 0x08, 0x67, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x05, 0x05, 0x03, 0x5f,
+	0x0a, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40,
+	0x18, 0x00, 0x00, 0x1b, 0x1a, 0x19, 0x16, 0x15, 0x14, 0x13, 0x10, 0x0f, 0x0e, 0x0d, 0x0b, 0x00,
+	0x0a, 0x00, 0x0a, 0x11, 0x11, 0x13, 0x0b, 0x07, 0x19, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x21, 0x11,
+	0x21, 0x11, 0x21, 0x11, 0x27, 0x01, 0x31, 0x21, 0x11, 0x21, 0x03, 0x39, 0x01, 0x21, 0x11, 0x21,
+	0x01, 0x39, 0x01, 0x23, 0x35, 0x33, 0x02, 0x9b, 0xc1, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xac,
+	0x01, 0xca, 0x01, 0x1e, 0xfe, 0xe2, 0x5e, 0x01, 0xbe, 0xfe, 0x42, 0x01, 0x39, 0xb4, 0xb4, 0x05,
+	0x99, 0xfe, 0xfa, 0xfb, 0x6d, 0x02, 0x3d, 0xfd, 0xc3, 0x04, 0xb4, 0xe5, 0xfd, 0xc3, 0x01, 0x1f,
+	0x01, 0x8b, 0x01, 0xc5, 0xfe, 0xc1, 0xb9, 0x00, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x05, 0x98,
+	0x05, 0x99, 0x00, 0x19, 0x00, 0x1e, 0x01, 0x07, 0x40, 0x0b, 0x19, 0x16, 0x02, 0x01, 0x09, 0x0d,
+	0x01, 0x06, 0x04, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x30, 0x00, 0x00, 0x01, 0x02,
+	0x01, 0x00, 0x72, 0x00, 0x05, 0x03, 0x04, 0x04, 0x05, 0x72, 0x0c, 0x0b, 0x02, 0x02, 0x07, 0x01,
+	0x03, 0x05, 0x02, 0x03, 0x67, 0x0a, 0x01, 0x01, 0x01, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x13, 0x4d,
+	0x00, 0x04, 0x04, 0x06, 0x60, 0x08, 0x01, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x13,
+	0x50, 0x58, 0x40, 0x30, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x05, 0x03, 0x04, 0x04,
+	0x05, 0x72, 0x0c, 0x0b, 0x02, 0x02, 0x07, 0x01, 0x03, 0x05, 0x02, 0x03, 0x67, 0x0a, 0x01, 0x01,
+	0x01, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x08, 0x01, 0x06,
+	0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x32, 0x00, 0x00, 0x01, 0x02,
+	0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04, 0x80, 0x0c, 0x0b, 0x02, 0x02,
+	0x07, 0x01, 0x03, 0x05, 0x02, 0x03, 0x67, 0x0a, 0x01, 0x01, 0x01, 0x09, 0x5f, 0x00, 0x09, 0x09,
+	0x11, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x08, 0x01, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x40,
+	0x32, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04,
+	0x80, 0x0c, 0x0b, 0x02, 0x02, 0x07, 0x01, 0x03, 0x05, 0x02, 0x03, 0x67, 0x0a, 0x01, 0x01, 0x01,
+	0x09, 0x5f, 0x00, 0x09, 0x09, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x08, 0x01, 0x06, 0x06,
+	0x12, 0x06, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x16, 0x1a, 0x1a, 0x1a, 0x1e, 0x1a, 0x1e, 0x1d, 0x1c,
+	0x18, 0x17, 0x11, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x0d, 0x07, 0x1f, 0x2b, 0x01,
+	0x31, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x21, 0x39,
+	0x01, 0x11, 0x21, 0x11, 0x21, 0x11, 0x27, 0x21, 0x13, 0x01, 0x31, 0x11, 0x21, 0x11, 0x05, 0x98,
+	0xfe, 0xe2, 0xfe, 0xe2, 0x01, 0x22, 0xfe, 0xde, 0x01, 0x1e, 0x01, 0x1e, 0xcc, 0xfd, 0x72, 0xfe,
+	0xe2, 0xfe, 0xe2, 0xac, 0x05, 0x82, 0xc0, 0xfc, 0xa6, 0xfe, 0xe2, 0x03, 0xf9, 0x82, 0xfe, 0xe1,
+	0xfe, 0xe1, 0xfe, 0xe2, 0x82, 0x9b, 0xfe, 0xfa, 0x02, 0x3d, 0xfd, 0xc3, 0x04, 0xb4, 0xe5, 0xfe,
+	0xfa, 0xfe, 0xc9, 0x01, 0x1f, 0xfe, 0xe1, 0x00, 0x00, 0x01, 0xff, 0x56, 0xfe, 0x7c, 0x03, 0x5c,
+	0x05, 0x99, 0x00, 0x20, 0x01, 0xe5, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x0f, 0x20, 0x1d, 0x02,
+	0x01, 0x0b, 0x09, 0x01, 0x04, 0x02, 0x0e, 0x01, 0x06, 0x07, 0x03, 0x4c, 0x1b, 0x40, 0x0f, 0x20,
+	0x1d, 0x02, 0x01, 0x0b, 0x09, 0x01, 0x04, 0x02, 0x0e, 0x01, 0x06, 0x08, 0x03, 0x4c, 0x59, 0x4b,
+	0xb0, 0x0b, 0x50, 0x58, 0x40, 0x3b, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x72, 0x00, 0x03, 0x02,
+	0x02, 0x03, 0x70, 0x00, 0x09, 0x05, 0x07, 0x06, 0x09, 0x72, 0x08, 0x01, 0x07, 0x06, 0x05, 0x07,
+	0x70, 0x00, 0x01, 0x01, 0x0b, 0x5f, 0x00, 0x0b, 0x0b, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60,
+	0x0a, 0x01, 0x04, 0x04, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x16, 0x06,
+	0x4e, 0x1b, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x3c, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x72,
+	0x00, 0x03, 0x02, 0x02, 0x03, 0x70, 0x00, 0x09, 0x05, 0x07, 0x05, 0x09, 0x07, 0x80, 0x08, 0x01,
+	0x07, 0x06, 0x05, 0x07, 0x70, 0x00, 0x01, 0x01, 0x0b, 0x5f, 0x00, 0x0b, 0x0b, 0x13, 0x4d, 0x00,
+	0x02, 0x02, 0x04, 0x60, 0x0a, 0x01, 0x04, 0x04, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00,
+	0x06, 0x06, 0x16, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x3d, 0x00, 0x00, 0x01,
+	0x03, 0x01, 0x00, 0x72, 0x00, 0x03, 0x02, 0x02, 0x03, 0x70, 0x00, 0x09, 0x05, 0x07, 0x05, 0x09,
+	0x07, 0x80, 0x08, 0x01, 0x07, 0x06, 0x05, 0x07, 0x06, 0x7e, 0x00, 0x01, 0x01, 0x0b, 0x5f, 0x00,
+	0x0b, 0x0b, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x0a, 0x01, 0x04, 0x04, 0x12, 0x4d, 0x00,
+	0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x16, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58,
+	0x40, 0x3d, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x72, 0x00, 0x03, 0x02, 0x02, 0x03, 0x70, 0x00,
+	0x09, 0x05, 0x07, 0x05, 0x09, 0x07, 0x80, 0x08, 0x01, 0x07, 0x06, 0x05, 0x07, 0x06, 0x7e, 0x00,
+	0x01, 0x01, 0x0b, 0x5f, 0x00, 0x0b, 0x0b, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x0a, 0x01,
+	0x04, 0x04, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x16, 0x06, 0x4e, 0x1b,
+	0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x45, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x03, 0x80, 0x00,
+	0x03, 0x02, 0x01, 0x03, 0x02, 0x7e, 0x00, 0x09, 0x05, 0x07, 0x05, 0x09, 0x07, 0x80, 0x00, 0x07,
+	0x08, 0x05, 0x07, 0x08, 0x7e, 0x00, 0x08, 0x06, 0x05, 0x08, 0x06, 0x7e, 0x00, 0x01, 0x01, 0x0b,
+	0x5f, 0x00, 0x0b, 0x0b, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x0a, 0x01, 0x04, 0x04, 0x12,
+	0x4d, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x16, 0x06, 0x4e, 0x1b, 0x40, 0x42, 0x00,
+	0x00, 0x01, 0x03, 0x01, 0x00, 0x03, 0x80, 0x00, 0x03, 0x02, 0x01, 0x03, 0x02, 0x7e, 0x00, 0x09,
+	0x05, 0x07, 0x05, 0x09, 0x07, 0x80, 0x00, 0x07, 0x08, 0x05, 0x07, 0x08, 0x7e, 0x00, 0x08, 0x06,
+	0x05, 0x08, 0x06, 0x7e, 0x00, 0x05, 0x00, 0x06, 0x05, 0x06, 0x63, 0x00, 0x01, 0x01, 0x0b, 0x5f,
+	0x00, 0x0b, 0x0b, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x0a, 0x01, 0x04, 0x04, 0x12, 0x04,
+	0x4e, 0x59, 0x59, 0x59, 0x59, 0x59, 0x40, 0x12, 0x1f, 0x1e, 0x1a, 0x19, 0x18, 0x16, 0x11, 0x12,
+	0x12, 0x11, 0x12, 0x11, 0x11, 0x11, 0x20, 0x0c, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x35, 0x21,
+	0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x23, 0x15, 0x33, 0x15, 0x07, 0x21, 0x31, 0x35, 0x33, 0x15,
+	0x33, 0x35, 0x2b, 0x01, 0x35, 0x21, 0x39, 0x01, 0x11, 0x27, 0x21, 0x13, 0x03, 0x5c, 0xfe, 0xe2,
+	0xfe, 0xe2, 0x01, 0x1e, 0x01, 0x1e, 0xcd, 0xed, 0xe3, 0x51, 0xfe, 0xfe, 0x71, 0x71, 0x72, 0x70,
+	0xfe, 0xd0, 0xac, 0x03, 0x45, 0xc1, 0x03, 0xf9, 0x82, 0xfc, 0xa4, 0x82, 0x9b, 0xfe, 0xfa, 0x30,
+	0xec, 0x68, 0x8b, 0x1a, 0x72, 0xa1, 0x04, 0xb4, 0xe5, 0xfe, 0xfa, 0x00, 0x00, 0x02, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x5c, 0x07, 0xc9, 0x00, 0x12, 0x00, 0x18, 0x00, 0xfe, 0x40, 0x0b, 0x10, 0x0d,
+	0x02, 0x03, 0x05, 0x04, 0x01, 0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x2e,
+	0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x05, 0x05, 0x06, 0x70, 0x00, 0x04, 0x03, 0x01, 0x03,
+	0x04, 0x72, 0x00, 0x01, 0x02, 0x02, 0x01, 0x70, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05,
+	0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x08, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b,
+	0xb0, 0x13, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x05, 0x05, 0x06,
+	0x70, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x72, 0x00, 0x01, 0x02, 0x02, 0x01, 0x70, 0x00, 0x03,
+	0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x08, 0x01, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2f, 0x00, 0x07, 0x06, 0x07,
+	0x85, 0x00, 0x06, 0x05, 0x06, 0x85, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x80, 0x00, 0x01,
+	0x02, 0x03, 0x01, 0x02, 0x7e, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00,
+	0x02, 0x02, 0x00, 0x60, 0x08, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x2f, 0x00, 0x07,
+	0x06, 0x07, 0x85, 0x00, 0x06, 0x05, 0x06, 0x85, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x80,
+	0x00, 0x01, 0x02, 0x03, 0x01, 0x02, 0x7e, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13,
+	0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x08, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59,
+	0x40, 0x17, 0x03, 0x00, 0x18, 0x17, 0x16, 0x13, 0x0f, 0x0e, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07,
+	0x06, 0x05, 0x00, 0x12, 0x03, 0x11, 0x09, 0x07, 0x16, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x35,
+	0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x03, 0x21, 0x17, 0x11, 0x31, 0x01, 0x39, 0x01,
+	0x23, 0x13, 0x33, 0x02, 0x02, 0x8d, 0xcd, 0xfe, 0xe2, 0xfe, 0xe2, 0x01, 0x1e, 0x01, 0x1e, 0xc1,
+	0xfc, 0xbb, 0xac, 0x01, 0xe1, 0xbe, 0x9b, 0xf7, 0x01, 0x06, 0x9b, 0x82, 0x03, 0x5c, 0x82, 0x9a,
+	0x01, 0x06, 0xe5, 0xfb, 0x4c, 0x06, 0x1e, 0x01, 0xab, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x5c, 0x07, 0xcb, 0x00, 0x12, 0x00, 0x1a, 0x00, 0xd9, 0x40, 0x14, 0x10, 0x0d,
+	0x02, 0x03, 0x05, 0x04, 0x01, 0x00, 0x02, 0x02, 0x4c, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x06,
+	0x05, 0x4a, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x23, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x72,
+	0x00, 0x01, 0x02, 0x02, 0x01, 0x70, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x4d,
+	0x00, 0x02, 0x02, 0x00, 0x60, 0x06, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x13,
+	0x50, 0x58, 0x40, 0x23, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x72, 0x00, 0x01, 0x02, 0x02, 0x01,
+	0x70, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60,
+	0x06, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x25, 0x00,
+	0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x80, 0x00, 0x01, 0x02, 0x03, 0x01, 0x02, 0x7e, 0x00, 0x03,
+	0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x06, 0x01, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x25, 0x00, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x80, 0x00,
+	0x01, 0x02, 0x03, 0x01, 0x02, 0x7e, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x4d,
+	0x00, 0x02, 0x02, 0x00, 0x60, 0x06, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x40,
+	0x13, 0x03, 0x00, 0x0f, 0x0e, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x00, 0x12, 0x03,
+	0x11, 0x07, 0x07, 0x16, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x35, 0x21, 0x15, 0x21, 0x11, 0x21,
+	0x15, 0x21, 0x35, 0x03, 0x21, 0x17, 0x11, 0x31, 0x01, 0x05, 0x25, 0x15, 0x05, 0x25, 0x35, 0x31,
+	0x02, 0x02, 0x8d, 0xcd, 0xfe, 0xe2, 0xfe, 0xe2, 0x01, 0x1e, 0x01, 0x1e, 0xc1, 0xfc, 0xbb, 0xac,
+	0x02, 0x45, 0xfe, 0xf7, 0xfe, 0xf6, 0x01, 0x0a, 0x01, 0x09, 0x01, 0x06, 0x9b, 0x82, 0x03, 0x5c,
+	0x82, 0x9a, 0x01, 0x06, 0xe5, 0xfb, 0x4c, 0x07, 0xcb, 0xc9, 0xc9, 0xe5, 0xc9, 0xc9, 0xe5, 0x00,
+	0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c, 0x07, 0xc9, 0x00, 0x15, 0x00, 0x1b, 0x01, 0x15,
+	0x40, 0x0b, 0x15, 0x12, 0x02, 0x01, 0x07, 0x0d, 0x01, 0x06, 0x04, 0x02, 0x4c, 0x4b, 0xb0, 0x0f,
+	0x50, 0x58, 0x40, 0x36, 0x00, 0x09, 0x08, 0x09, 0x85, 0x00, 0x08, 0x07, 0x07, 0x08, 0x70, 0x00,
+	0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x05, 0x03, 0x04, 0x04, 0x05, 0x72, 0x00, 0x02, 0x00,
+	0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d, 0x00,
+	0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58,
+	0x40, 0x36, 0x00, 0x09, 0x08, 0x09, 0x85, 0x00, 0x08, 0x07, 0x07, 0x08, 0x70, 0x00, 0x00, 0x01,
+	0x02, 0x01, 0x00, 0x72, 0x00, 0x05, 0x03, 0x04, 0x04, 0x05, 0x72, 0x00, 0x02, 0x00, 0x03, 0x05,
+	0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04,
+	0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x37,
+	0x00, 0x09, 0x08, 0x09, 0x85, 0x00, 0x08, 0x07, 0x08, 0x85, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+	0x02, 0x80, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04, 0x80, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02,
+	0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x06,
+	0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x40, 0x37, 0x00, 0x09, 0x08, 0x09, 0x85, 0x00,
+	0x08, 0x07, 0x08, 0x85, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03, 0x04,
+	0x03, 0x05, 0x04, 0x80, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07,
+	0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06,
+	0x4e, 0x59, 0x59, 0x59, 0x40, 0x0e, 0x1b, 0x1a, 0x32, 0x14, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x20, 0x0a, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21,
+	0x35, 0x21, 0x15, 0x03, 0x21, 0x39, 0x01, 0x11, 0x27, 0x21, 0x13, 0x01, 0x39, 0x01, 0x33, 0x03,
+	0x23, 0x03, 0x5c, 0xfe, 0xe2, 0xfe, 0xe2, 0x01, 0x22, 0xfe, 0xde, 0x01, 0x1e, 0x01, 0x1e, 0xcd,
+	0xfd, 0x73, 0xac, 0x03, 0x45, 0xc1, 0xfd, 0xdb, 0xbe, 0x9b, 0xf7, 0x03, 0xf9, 0x82, 0xfe, 0xe1,
+	0xfe, 0xe1, 0xfe, 0xe2, 0x82, 0x9b, 0xfe, 0xfa, 0x04, 0xb4, 0xe5, 0xfe, 0xfa, 0x01, 0x8b, 0x01,
+	0xab, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c, 0x07, 0xc9, 0x00, 0x15,
+	0x00, 0x1b, 0x01, 0x0b, 0x40, 0x0b, 0x15, 0x12, 0x02, 0x01, 0x07, 0x0d, 0x01, 0x06, 0x04, 0x02,
+	0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x33, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00,
+	0x05, 0x03, 0x04, 0x04, 0x05, 0x72, 0x00, 0x09, 0x00, 0x08, 0x07, 0x09, 0x08, 0x67, 0x00, 0x02,
+	0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d,
+	0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50,
+	0x58, 0x40, 0x33, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x05, 0x03, 0x04, 0x04, 0x05,
+	0x72, 0x00, 0x09, 0x00, 0x08, 0x07, 0x09, 0x08, 0x67, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03,
+	0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60,
+	0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x35, 0x00, 0x00,
+	0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04, 0x80, 0x00, 0x09,
+	0x00, 0x08, 0x07, 0x09, 0x08, 0x67, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01,
+	0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06,
+	0x12, 0x06, 0x4e, 0x1b, 0x40, 0x35, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05,
+	0x03, 0x04, 0x03, 0x05, 0x04, 0x80, 0x00, 0x09, 0x00, 0x08, 0x07, 0x09, 0x08, 0x67, 0x00, 0x02,
+	0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d,
+	0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x0e,
+	0x1b, 0x1a, 0x32, 0x14, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x0a, 0x07, 0x1f, 0x2b, 0x01,
+	0x31, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x21, 0x39,
+	0x01, 0x11, 0x27, 0x21, 0x13, 0x01, 0x39, 0x01, 0x23, 0x13, 0x33, 0x03, 0x5c, 0xfe, 0xe2, 0xfe,
+	0xe2, 0x01, 0x22, 0xfe, 0xde, 0x01, 0x1e, 0x01, 0x1e, 0xcd, 0xfd, 0x73, 0xac, 0x03, 0x45, 0xc1,
+	0xfe, 0xab, 0xbe, 0x9b, 0xf7, 0x03, 0xf9, 0x82, 0xfe, 0xe1, 0xfe, 0xe1, 0xfe, 0xe2, 0x82, 0x9b,
+	0xfe, 0xfa, 0x04, 0xb4, 0xe5, 0xfe, 0xfa, 0x01, 0x8b, 0x01, 0xab, 0x00, 0x00, 0x02, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x5c, 0x07, 0xcb, 0x00, 0x15, 0x00, 0x1d, 0x00, 0xf1, 0x40, 0x14, 0x15, 0x12,
+	0x02, 0x01, 0x07, 0x0d, 0x01, 0x06, 0x04, 0x02, 0x4c, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x16, 0x06,
+	0x07, 0x4a, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x2b, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72,
+	0x00, 0x05, 0x03, 0x04, 0x04, 0x05, 0x72, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00,
+	0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06,
+	0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x2b, 0x00, 0x00, 0x01, 0x02,
+	0x01, 0x00, 0x72, 0x00, 0x05, 0x03, 0x04, 0x04, 0x05, 0x72, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02,
+	0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x06,
+	0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2d, 0x00,
+	0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04, 0x80, 0x00,
+	0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11,
+	0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x40, 0x2d, 0x00,
+	0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04, 0x80, 0x00,
+	0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13,
+	0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x59, 0x59, 0x59, 0x40,
+	0x0b, 0x14, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x08, 0x07, 0x1e, 0x2b, 0x01, 0x31, 0x21,
+	0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x21, 0x39, 0x01, 0x11,
+	0x27, 0x21, 0x13, 0x03, 0x39, 0x01, 0x35, 0x25, 0x05, 0x15, 0x25, 0x03, 0x5c, 0xfe, 0xe2, 0xfe,
+	0xe2, 0x01, 0x22, 0xfe, 0xde, 0x01, 0x1e, 0x01, 0x1e, 0xcd, 0xfd, 0x73, 0xac, 0x03, 0x45, 0xc1,
+	0xe2, 0xfe, 0xf7, 0xfe, 0xf6, 0x01, 0x0a, 0x03, 0xf9, 0x82, 0xfe, 0xe1, 0xfe, 0xe1, 0xfe, 0xe2,
+	0x82, 0x9b, 0xfe, 0xfa, 0x04, 0xb4, 0xe5, 0xfe, 0xfa, 0x01, 0x8a, 0xe5, 0xc9, 0xc9, 0xe5, 0xc9,
+	0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c, 0x07, 0x3a, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x21,
+	0x01, 0x31, 0x40, 0x0b, 0x15, 0x12, 0x02, 0x01, 0x07, 0x0d, 0x01, 0x06, 0x04, 0x02, 0x4c, 0x4b,
+	0xb0, 0x0f, 0x50, 0x58, 0x40, 0x3a, 0x0a, 0x01, 0x08, 0x09, 0x08, 0x85, 0x0d, 0x0b, 0x0c, 0x03,
+	0x09, 0x07, 0x07, 0x09, 0x70, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x05, 0x03, 0x04,
+	0x04, 0x05, 0x72, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f,
+	0x00, 0x07, 0x07, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e,
+	0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x3a, 0x0a, 0x01, 0x08, 0x09, 0x08, 0x85, 0x0d, 0x0b,
+	0x0c, 0x03, 0x09, 0x07, 0x07, 0x09, 0x70, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x05,
+	0x03, 0x04, 0x04, 0x05, 0x72, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01,
+	0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06, 0x12,
+	0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x3b, 0x0a, 0x01, 0x08, 0x09, 0x08, 0x85,
+	0x0d, 0x0b, 0x0c, 0x03, 0x09, 0x07, 0x09, 0x85, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80,
+	0x00, 0x05, 0x03, 0x04, 0x03, 0x05, 0x04, 0x80, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67,
+	0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00,
+	0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x40, 0x3b, 0x0a, 0x01, 0x08, 0x09, 0x08, 0x85, 0x0d, 0x0b,
+	0x0c, 0x03, 0x09, 0x07, 0x09, 0x85, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x05,
+	0x03, 0x04, 0x03, 0x05, 0x04, 0x80, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02, 0x03, 0x67, 0x00, 0x01,
+	0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x06, 0x60, 0x00, 0x06, 0x06,
+	0x12, 0x06, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x1a, 0x1c, 0x1c, 0x16, 0x16, 0x1c, 0x21, 0x1c, 0x21,
+	0x20, 0x1f, 0x16, 0x1b, 0x16, 0x1b, 0x15, 0x14, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x0e,
+	0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x35, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x35, 0x21,
+	0x15, 0x03, 0x21, 0x39, 0x01, 0x11, 0x27, 0x21, 0x13, 0x03, 0x39, 0x01, 0x11, 0x23, 0x11, 0x07,
+	0x39, 0x01, 0x11, 0x23, 0x11, 0x03, 0x5c, 0xfe, 0xe2, 0xfe, 0xe2, 0x01, 0x22, 0xfe, 0xde, 0x01,
+	0x1e, 0x01, 0x1e, 0xcd, 0xfd, 0x73, 0xac, 0x03, 0x45, 0xc1, 0x76, 0xf9, 0x98, 0xf9, 0x03, 0xf9,
+	0x82, 0xfe, 0xe1, 0xfe, 0xe1, 0xfe, 0xe2, 0x82, 0x9b, 0xfe, 0xfa, 0x04, 0xb4, 0xe5, 0xfe, 0xfa,
+	0x01, 0x8a, 0x01, 0x1d, 0xfe, 0xe4, 0x01, 0x01, 0x1d, 0xfe, 0xe4, 0x00, 0x00, 0x02, 0xff, 0x56,
+	0x00, 0x00, 0x01, 0x1f, 0x07, 0xc8, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x5d, 0xb5, 0x08, 0x01, 0x00,
+	0x01, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x13, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03,
+	0x02, 0x67, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0,
+	0x17, 0x50, 0x58, 0x40, 0x13, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02, 0x67, 0x00, 0x01, 0x01,
+	0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x13, 0x00, 0x03, 0x00, 0x02, 0x01,
+	0x03, 0x02, 0x67, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59,
+	0xb6, 0x11, 0x32, 0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x31, 0x11,
+	0x21, 0x17, 0x13, 0x39, 0x01, 0x33, 0x03, 0x23, 0x01, 0x01, 0x1e, 0xfe, 0x37, 0xab, 0x59, 0xbe,
+	0x9b, 0xf7, 0x03, 0x96, 0x02, 0x03, 0xe5, 0x01, 0x69, 0x01, 0xab, 0x00, 0x00, 0x02, 0xff, 0x56,
+	0x00, 0x00, 0x01, 0xdc, 0x07, 0xc8, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x83, 0xb5, 0x08, 0x01, 0x00,
+	0x01, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x16, 0x00, 0x03, 0x02, 0x03, 0x85, 0x00,
+	0x02, 0x01, 0x01, 0x02, 0x70, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x16, 0x00, 0x03, 0x02, 0x03, 0x85, 0x00, 0x02, 0x01,
+	0x01, 0x02, 0x70, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b,
+	0xb0, 0x17, 0x50, 0x58, 0x40, 0x15, 0x00, 0x03, 0x02, 0x03, 0x85, 0x00, 0x02, 0x01, 0x02, 0x85,
+	0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x15, 0x00, 0x03,
+	0x02, 0x03, 0x85, 0x00, 0x02, 0x01, 0x02, 0x85, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0xb6, 0x11, 0x32, 0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x33,
+	0x39, 0x01, 0x21, 0x11, 0x31, 0x11, 0x21, 0x17, 0x01, 0x39, 0x01, 0x23, 0x13, 0x33, 0x01, 0x01,
+	0x1e, 0xfe, 0x37, 0xab, 0x01, 0x07, 0xbe, 0x9b, 0xf7, 0x03, 0x96, 0x02, 0x03, 0xe5, 0x01, 0x69,
+	0x01, 0xab, 0x00, 0x00, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x01, 0x6f, 0x07, 0xca, 0x00, 0x08,
+	0x00, 0x10, 0x00, 0x4d, 0x40, 0x0f, 0x08, 0x01, 0x00, 0x01, 0x01, 0x4c, 0x10, 0x0f, 0x0e, 0x0d,
+	0x0c, 0x09, 0x06, 0x01, 0x4a, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x13,
+	0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0b, 0x00,
+	0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x0b, 0x00, 0x01, 0x01,
+	0x13, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0xb4, 0x13, 0x30, 0x02, 0x07, 0x18,
+	0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x31, 0x11, 0x21, 0x17, 0x01, 0x39, 0x01, 0x35, 0x25, 0x05,
+	0x15, 0x25, 0x01, 0x01, 0x1e, 0xfe, 0x37, 0xab, 0x01, 0x6e, 0xfe, 0xf6, 0xfe, 0xf7, 0x01, 0x09,
+	0x03, 0x96, 0x02, 0x03, 0xe5, 0x01, 0x69, 0xe5, 0xc8, 0xc8, 0xe5, 0xc8, 0x00, 0x03, 0xff, 0x1a,
+	0x00, 0x00, 0x01, 0xa3, 0x07, 0x3a, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x77, 0xb5, 0x08,
+	0x01, 0x00, 0x01, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x17, 0x04, 0x01, 0x02, 0x07,
+	0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x17, 0x04, 0x01, 0x02, 0x07, 0x05,
+	0x06, 0x03, 0x03, 0x01, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x40, 0x17, 0x04, 0x01, 0x02, 0x07, 0x05, 0x06, 0x03, 0x03, 0x01, 0x02, 0x03,
+	0x67, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x14,
+	0x0f, 0x0f, 0x09, 0x09, 0x0f, 0x14, 0x0f, 0x14, 0x13, 0x12, 0x09, 0x0e, 0x09, 0x0e, 0x15, 0x13,
+	0x30, 0x08, 0x07, 0x19, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x31, 0x11, 0x21, 0x17, 0x01, 0x39,
+	0x01, 0x11, 0x23, 0x11, 0x23, 0x39, 0x01, 0x11, 0x23, 0x11, 0x04, 0x01, 0x1e, 0xfe, 0x37, 0xab,
+	0x01, 0x9f, 0xf9, 0x97, 0xf9, 0x03, 0x96, 0x02, 0x03, 0xe5, 0x01, 0x69, 0x01, 0x1d, 0xfe, 0xe3,
+	0x01, 0x1d, 0xfe, 0xe3, 0x00, 0x02, 0xff, 0xf9, 0x00, 0x00, 0x04, 0x02, 0x05, 0x99, 0x00, 0x0d,
+	0x00, 0x16, 0x00, 0x9f, 0x40, 0x0b, 0x0c, 0x02, 0x02, 0x04, 0x03, 0x03, 0x01, 0x00, 0x07, 0x02,
+	0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x21, 0x05, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x02,
+	0x01, 0x67, 0x00, 0x04, 0x04, 0x03, 0x5f, 0x08, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x09, 0x01, 0x07,
+	0x07, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
+	0x21, 0x05, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x02, 0x01, 0x67, 0x00, 0x04, 0x04, 0x03, 0x5f,
+	0x08, 0x01, 0x03, 0x03, 0x11, 0x4d, 0x09, 0x01, 0x07, 0x07, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x40, 0x21, 0x05, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x02, 0x01, 0x67, 0x00,
+	0x04, 0x04, 0x03, 0x5f, 0x08, 0x01, 0x03, 0x03, 0x13, 0x4d, 0x09, 0x01, 0x07, 0x07, 0x00, 0x5f,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x18, 0x0e, 0x0e, 0x00, 0x00, 0x0e, 0x16,
+	0x0e, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10, 0x00, 0x0d, 0x00, 0x0d, 0x11, 0x13, 0x14, 0x0a,
+	0x07, 0x19, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x03, 0x21, 0x23, 0x31, 0x11, 0x23, 0x35, 0x33, 0x11,
+	0x27, 0x01, 0x31, 0x11, 0x21, 0x11, 0x33, 0x15, 0x23, 0x11, 0x03, 0x41, 0xc1, 0xcc, 0xfd, 0x73,
+	0x01, 0xaf, 0xaf, 0xab, 0x02, 0xe7, 0xfe, 0xe2, 0xac, 0xac, 0x05, 0x99, 0xfe, 0xfa, 0xfc, 0x73,
+	0xfe, 0xfa, 0x02, 0x7a, 0xa5, 0x01, 0x95, 0xe5, 0xfb, 0x86, 0x03, 0x5b, 0xfe, 0xa5, 0xa5, 0xfe,
+	0xa5, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0xa7, 0x07, 0x9b, 0x00, 0x12,
+	0x00, 0x2d, 0x00, 0x9e, 0x40, 0x17, 0x24, 0x17, 0x02, 0x07, 0x05, 0x16, 0x01, 0x02, 0x06, 0x0f,
+	0x09, 0x06, 0x05, 0x02, 0x05, 0x00, 0x02, 0x03, 0x4c, 0x23, 0x01, 0x04, 0x4a, 0x4b, 0xb0, 0x0f,
+	0x50, 0x58, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x07, 0x06, 0x04, 0x07, 0x69, 0x00, 0x05, 0x00, 0x06,
+	0x02, 0x05, 0x06, 0x69, 0x08, 0x03, 0x02, 0x02, 0x02, 0x13, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x07, 0x06, 0x04,
+	0x07, 0x69, 0x00, 0x05, 0x00, 0x06, 0x02, 0x05, 0x06, 0x69, 0x08, 0x03, 0x02, 0x02, 0x02, 0x11,
+	0x4d, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x07, 0x06,
+	0x04, 0x07, 0x69, 0x00, 0x05, 0x00, 0x06, 0x02, 0x05, 0x06, 0x69, 0x08, 0x03, 0x02, 0x02, 0x02,
+	0x13, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x14, 0x00, 0x00, 0x2d,
+	0x2b, 0x29, 0x27, 0x20, 0x1e, 0x1c, 0x1a, 0x00, 0x12, 0x00, 0x12, 0x22, 0x13, 0x13, 0x09, 0x07,
+	0x19, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x21, 0x11, 0x01, 0x11, 0x21, 0x11, 0x27, 0x33, 0x21, 0x33,
+	0x17, 0x01, 0x11, 0x31, 0x11, 0x25, 0x31, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
+	0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22,
+	0x02, 0xe6, 0xc1, 0xfe, 0xe2, 0xfe, 0x96, 0xfe, 0xe2, 0xab, 0x02, 0x01, 0x5b, 0x08, 0x2b, 0x01,
+	0xa3, 0xfe, 0x1d, 0x36, 0x45, 0x04, 0x3d, 0x38, 0x39, 0x35, 0x3e, 0x72, 0x72, 0x35, 0x32, 0x37,
+	0x36, 0x45, 0x04, 0x3c, 0x39, 0x38, 0x37, 0x3a, 0x72, 0x72, 0x39, 0x31, 0x05, 0x99, 0xfe, 0xfa,
+	0xfb, 0x6d, 0x01, 0x9b, 0x01, 0xc4, 0xfc, 0xa1, 0x04, 0xb4, 0xe5, 0x41, 0xfd, 0xf5, 0x01, 0x2d,
+	0x01, 0x1f, 0xf2, 0x1b, 0x52, 0xdc, 0x47, 0x19, 0x19, 0x30, 0x30, 0x1b, 0x1b, 0x52, 0xdc, 0x46,
+	0x18, 0x19, 0x2f, 0x2f, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5b, 0x07, 0xc8, 0x00, 0x09,
+	0x00, 0x0f, 0x00, 0x15, 0x00, 0x85, 0x40, 0x0c, 0x08, 0x05, 0x02, 0x03, 0x01, 0x09, 0x04, 0x02,
+	0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x05, 0x00, 0x04, 0x01,
+	0x05, 0x04, 0x67, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02,
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1d,
+	0x00, 0x05, 0x00, 0x04, 0x01, 0x05, 0x04, 0x67, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01,
+	0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1d,
+	0x00, 0x05, 0x00, 0x04, 0x01, 0x05, 0x04, 0x67, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01,
+	0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40,
+	0x09, 0x11, 0x31, 0x11, 0x33, 0x13, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13,
+	0x11, 0x03, 0x21, 0x17, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x01, 0x39, 0x01, 0x33, 0x03,
+	0x23, 0xce, 0x01, 0xc1, 0xcc, 0xc1, 0xfc, 0xbc, 0xab, 0x02, 0x3c, 0xfe, 0xe2, 0x01, 0x1e, 0xfe,
+	0xf8, 0xbe, 0x9b, 0xf7, 0x01, 0x06, 0x03, 0x8d, 0x01, 0x06, 0xe5, 0xfc, 0x52, 0x19, 0x03, 0x5b,
+	0x01, 0xa3, 0x01, 0xab, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5b, 0x07, 0xc8, 0x00, 0x09,
+	0x00, 0x0f, 0x00, 0x15, 0x00, 0xb5, 0x40, 0x0c, 0x08, 0x05, 0x02, 0x03, 0x01, 0x09, 0x04, 0x02,
+	0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x20, 0x00, 0x05, 0x04, 0x05, 0x85,
+	0x00, 0x04, 0x01, 0x01, 0x04, 0x70, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d,
+	0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50,
+	0x58, 0x40, 0x20, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04, 0x01, 0x01, 0x04, 0x70, 0x00, 0x03,
+	0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x05, 0x04, 0x05, 0x85,
+	0x00, 0x04, 0x01, 0x04, 0x85, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00,
+	0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1f, 0x00, 0x05, 0x04,
+	0x05, 0x85, 0x00, 0x04, 0x01, 0x04, 0x85, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13,
+	0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x40,
+	0x09, 0x11, 0x31, 0x11, 0x33, 0x13, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13,
+	0x11, 0x03, 0x21, 0x17, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x03, 0x39, 0x01, 0x23, 0x13,
+	0x33, 0xce, 0x01, 0xc1, 0xcc, 0xc1, 0xfc, 0xbc, 0xab, 0x02, 0x3c, 0xfe, 0xe2, 0x01, 0x1e, 0x4f,
+	0xbd, 0x9b, 0xf7, 0x01, 0x06, 0x03, 0x8d, 0x01, 0x06, 0xe5, 0xfc, 0x52, 0x19, 0x03, 0x5b, 0x01,
+	0xa3, 0x01, 0xab, 0x00, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5b, 0x07, 0xca, 0x00, 0x09,
+	0x00, 0x0f, 0x00, 0x17, 0x00, 0x73, 0x40, 0x15, 0x08, 0x05, 0x02, 0x03, 0x01, 0x09, 0x04, 0x02,
+	0x00, 0x02, 0x02, 0x4c, 0x17, 0x16, 0x15, 0x14, 0x13, 0x10, 0x06, 0x01, 0x4a, 0x4b, 0xb0, 0x0f,
+	0x50, 0x58, 0x40, 0x15, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02,
+	0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
+	0x15, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x15, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01,
+	0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59,
+	0xb6, 0x11, 0x33, 0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x11, 0x03,
+	0x21, 0x17, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x13, 0x39, 0x01, 0x35, 0x25, 0x05, 0x15,
+	0x25, 0xce, 0x01, 0xc1, 0xcc, 0xc1, 0xfc, 0xbc, 0xab, 0x02, 0x3c, 0xfe, 0xe2, 0x01, 0x1e, 0x4d,
+	0xfe, 0xf7, 0xfe, 0xf7, 0x01, 0x09, 0x01, 0x06, 0x03, 0x8d, 0x01, 0x06, 0xe5, 0xfc, 0x52, 0x19,
+	0x03, 0x5b, 0x01, 0xa3, 0xe5, 0xc8, 0xc8, 0xe5, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x5b, 0x07, 0x9b, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x2b, 0x00, 0xac, 0x40, 0x19,
+	0x2b, 0x1e, 0x02, 0x06, 0x04, 0x1f, 0x01, 0x01, 0x07, 0x08, 0x05, 0x02, 0x03, 0x01, 0x09, 0x04,
+	0x02, 0x00, 0x02, 0x04, 0x4c, 0x10, 0x01, 0x05, 0x4a, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x25,
+	0x00, 0x05, 0x00, 0x06, 0x07, 0x05, 0x06, 0x69, 0x00, 0x04, 0x00, 0x07, 0x01, 0x04, 0x07, 0x69,
+	0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x25, 0x00, 0x05, 0x00,
+	0x06, 0x07, 0x05, 0x06, 0x69, 0x00, 0x04, 0x00, 0x07, 0x01, 0x04, 0x07, 0x69, 0x00, 0x03, 0x03,
+	0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x40, 0x25, 0x00, 0x05, 0x00, 0x06, 0x07, 0x05, 0x06, 0x69, 0x00, 0x04, 0x00,
+	0x07, 0x01, 0x04, 0x07, 0x69, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00,
+	0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x0b, 0x22, 0x27,
+	0x22, 0x26, 0x11, 0x33, 0x13, 0x30, 0x08, 0x07, 0x1e, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x11,
+	0x03, 0x21, 0x17, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x13, 0x39, 0x01, 0x06, 0x07, 0x06,
+	0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x17, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
+	0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0xce, 0x01, 0xc1, 0xcc, 0xc1, 0xfc, 0xbc, 0xab, 0x02, 0x3c,
+	0xfe, 0xe2, 0x01, 0x1e, 0xc0, 0x45, 0x36, 0x36, 0x33, 0x35, 0x72, 0x72, 0x3e, 0x35, 0x38, 0x39,
+	0x3d, 0x04, 0x45, 0x37, 0x36, 0x31, 0x39, 0x72, 0x72, 0x3a, 0x37, 0x39, 0x38, 0x3c, 0x01, 0x06,
+	0x03, 0x8d, 0x01, 0x06, 0xe5, 0xfc, 0x52, 0x19, 0x03, 0x5b, 0x03, 0x21, 0x52, 0x1b, 0x1b, 0x30,
+	0x30, 0x19, 0x19, 0x47, 0xdc, 0x52, 0x1b, 0x1b, 0x2f, 0x2f, 0x19, 0x18, 0x46, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5b, 0x07, 0x3a, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x15,
+	0x00, 0x1b, 0x00, 0x9e, 0x40, 0x0c, 0x08, 0x05, 0x02, 0x03, 0x01, 0x09, 0x04, 0x02, 0x00, 0x02,
+	0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x21, 0x06, 0x01, 0x04, 0x09, 0x07, 0x08, 0x03,
+	0x05, 0x01, 0x04, 0x05, 0x67, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00,
+	0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58,
+	0x40, 0x21, 0x06, 0x01, 0x04, 0x09, 0x07, 0x08, 0x03, 0x05, 0x01, 0x04, 0x05, 0x67, 0x00, 0x03,
+	0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x40, 0x21, 0x06, 0x01, 0x04, 0x09, 0x07, 0x08, 0x03, 0x05, 0x01, 0x04,
+	0x05, 0x67, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x16, 0x16, 0x16, 0x10, 0x10, 0x16,
+	0x1b, 0x16, 0x1b, 0x1a, 0x19, 0x10, 0x15, 0x10, 0x15, 0x14, 0x11, 0x33, 0x13, 0x30, 0x0a, 0x07,
+	0x1b, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x11, 0x03, 0x21, 0x17, 0x11, 0x25, 0x39, 0x01, 0x21,
+	0x11, 0x21, 0x13, 0x39, 0x01, 0x11, 0x23, 0x11, 0x23, 0x39, 0x01, 0x11, 0x23, 0x11, 0xce, 0x01,
+	0xc1, 0xcc, 0xc1, 0xfc, 0xbc, 0xab, 0x02, 0x3c, 0xfe, 0xe2, 0x01, 0x1e, 0xae, 0xf8, 0x98, 0xf9,
+	0x01, 0x06, 0x03, 0x8d, 0x01, 0x06, 0xe5, 0xfc, 0x52, 0x19, 0x03, 0x5b, 0x01, 0xa3, 0x01, 0x1d,
+	0xfe, 0xe3, 0x01, 0x1d, 0xfe, 0xe3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xa2, 0x03, 0x3d,
+	0x04, 0xe1, 0x00, 0x0b, 0x00, 0x06, 0xb3, 0x04, 0x00, 0x01, 0x32, 0x2b, 0x13, 0x07, 0x09, 0x01,
+	0x17, 0x09, 0x01, 0x37, 0x09, 0x01, 0x27, 0x01, 0x74, 0x74, 0x01, 0x2b, 0xfe, 0xd5, 0x74, 0x01,
+	0x2b, 0x01, 0x2a, 0x74, 0xfe, 0xd5, 0x01, 0x2b, 0x74, 0xfe, 0xd6, 0x04, 0xe1, 0x74, 0xfe, 0xd5,
+	0xfe, 0xd4, 0x74, 0x01, 0x2b, 0xfe, 0xd5, 0x74, 0x01, 0x2c, 0x01, 0x2b, 0x74, 0xfe, 0xd5, 0x00,
+	0x00, 0x03, 0xff, 0x59, 0xff, 0x90, 0x03, 0xf6, 0x06, 0x1f, 0x00, 0x10, 0x00, 0x15, 0x00, 0x19,
+	0x00, 0x53, 0x40, 0x50, 0x0f, 0x0c, 0x03, 0x02, 0x04, 0x04, 0x02, 0x18, 0x14, 0x13, 0x03, 0x05,
+	0x04, 0x0b, 0x0a, 0x07, 0x04, 0x04, 0x00, 0x05, 0x03, 0x4c, 0x06, 0x01, 0x03, 0x02, 0x03, 0x85,
+	0x00, 0x01, 0x00, 0x01, 0x86, 0x07, 0x01, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x11, 0x4d,
+	0x08, 0x01, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x16, 0x16, 0x11, 0x11,
+	0x00, 0x00, 0x16, 0x19, 0x16, 0x19, 0x11, 0x15, 0x11, 0x15, 0x00, 0x10, 0x00, 0x10, 0x14, 0x12,
+	0x15, 0x09, 0x07, 0x19, 0x2b, 0x01, 0x31, 0x03, 0x17, 0x11, 0x03, 0x21, 0x27, 0x07, 0x23, 0x13,
+	0x27, 0x11, 0x27, 0x21, 0x17, 0x37, 0x01, 0x31, 0x11, 0x01, 0x35, 0x11, 0x31, 0x11, 0x01, 0x03,
+	0xf6, 0xbe, 0x26, 0xcc, 0xfe, 0x3f, 0x26, 0x5b, 0xbb, 0xa8, 0x39, 0xab, 0x03, 0x44, 0x30, 0x6e,
+	0xfd, 0xe7, 0x01, 0x1e, 0xfe, 0xef, 0x06, 0x1f, 0xfe, 0xaa, 0x35, 0xfc, 0x74, 0xfe, 0xfa, 0x31,
+	0xa3, 0x01, 0x2f, 0x49, 0x03, 0xae, 0xe5, 0x41, 0xc5, 0xfe, 0x5d, 0xfd, 0xde, 0x02, 0x03, 0x1f,
+	0xfc, 0xa4, 0x01, 0xec, 0xfe, 0x14, 0x00, 0x00, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c,
+	0x07, 0xc9, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x79, 0x40, 0x0c, 0x0d, 0x05, 0x02, 0x02, 0x01, 0x0e,
+	0x04, 0x02, 0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x19, 0x00, 0x05, 0x00,
+	0x04, 0x01, 0x05, 0x04, 0x67, 0x03, 0x01, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x19, 0x00, 0x05,
+	0x00, 0x04, 0x01, 0x05, 0x04, 0x67, 0x03, 0x01, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x19, 0x00, 0x05, 0x00, 0x04, 0x01, 0x05,
+	0x04, 0x67, 0x03, 0x01, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x09, 0x11, 0x33, 0x12, 0x11, 0x13, 0x30, 0x06, 0x07, 0x1c,
+	0x2b, 0x33, 0x39, 0x01, 0x21, 0x13, 0x11, 0x03, 0x23, 0x11, 0x21, 0x19, 0x01, 0x21, 0x17, 0x11,
+	0x01, 0x39, 0x01, 0x33, 0x03, 0x23, 0xce, 0x01, 0xc2, 0xcc, 0xc1, 0x5d, 0xfe, 0xe2, 0xfe, 0x36,
+	0xac, 0x01, 0x4b, 0xbe, 0x9b, 0xf8, 0x01, 0x06, 0x03, 0x8d, 0x01, 0x06, 0xfb, 0x85, 0x02, 0x05,
+	0x02, 0x76, 0xe5, 0xfc, 0x52, 0x05, 0x18, 0x01, 0xab, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x56,
+	0x00, 0x00, 0x03, 0x5c, 0x07, 0xc9, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x7f, 0x40, 0x0c, 0x0d, 0x05,
+	0x02, 0x02, 0x01, 0x0e, 0x04, 0x02, 0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
+	0x1b, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04, 0x01, 0x04, 0x85, 0x03, 0x01, 0x01, 0x01, 0x13,
+	0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17,
+	0x50, 0x58, 0x40, 0x1b, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04, 0x01, 0x04, 0x85, 0x03, 0x01,
+	0x01, 0x01, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b,
+	0x40, 0x1b, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04, 0x01, 0x04, 0x85, 0x03, 0x01, 0x01, 0x01,
+	0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40,
+	0x09, 0x11, 0x33, 0x12, 0x11, 0x13, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13,
+	0x11, 0x03, 0x23, 0x11, 0x21, 0x19, 0x01, 0x21, 0x17, 0x11, 0x01, 0x39, 0x01, 0x23, 0x13, 0x33,
+	0xce, 0x01, 0xc2, 0xcc, 0xc1, 0x5d, 0xfe, 0xe2, 0xfe, 0x36, 0xac, 0x02, 0x05, 0xbe, 0x9b, 0xf8,
+	0x01, 0x06, 0x03, 0x8d, 0x01, 0x06, 0xfb, 0x85, 0x02, 0x05, 0x02, 0x76, 0xe5, 0xfc, 0x52, 0x05,
+	0x18, 0x01, 0xab, 0x00, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5d, 0x07, 0xca, 0x00, 0x0e,
+	0x00, 0x16, 0x00, 0x67, 0x40, 0x15, 0x0d, 0x05, 0x02, 0x02, 0x01, 0x0e, 0x04, 0x02, 0x00, 0x02,
+	0x02, 0x4c, 0x16, 0x15, 0x14, 0x13, 0x12, 0x0f, 0x06, 0x01, 0x4a, 0x4b, 0xb0, 0x0f, 0x50, 0x58,
+	0x40, 0x11, 0x03, 0x01, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x11, 0x03, 0x01, 0x01, 0x01, 0x11,
+	0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x11, 0x03,
+	0x01, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x59, 0x59, 0xb6, 0x12, 0x11, 0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x13,
+	0x11, 0x03, 0x23, 0x11, 0x21, 0x19, 0x01, 0x21, 0x17, 0x11, 0x01, 0x39, 0x01, 0x35, 0x25, 0x05,
+	0x15, 0x25, 0xcf, 0x01, 0xc1, 0xcd, 0xc1, 0x5d, 0xfe, 0xe1, 0xfe, 0x36, 0xac, 0x02, 0x91, 0xfe,
+	0xf6, 0xfe, 0xf6, 0x01, 0x0a, 0x01, 0x06, 0x03, 0x8d, 0x01, 0x06, 0xfb, 0x85, 0x02, 0x05, 0x02,
+	0x76, 0xe5, 0xfc, 0x52, 0x05, 0x17, 0xe5, 0xc8, 0xc8, 0xe5, 0xc8, 0x00, 0x00, 0x03, 0xff, 0x57,
+	0x00, 0x00, 0x03, 0x5d, 0x07, 0x3a, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x92, 0x40, 0x0c,
+	0x0d, 0x05, 0x02, 0x02, 0x01, 0x0e, 0x04, 0x02, 0x00, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50,
+	0x58, 0x40, 0x1d, 0x06, 0x01, 0x04, 0x09, 0x07, 0x08, 0x03, 0x05, 0x01, 0x04, 0x05, 0x67, 0x03,
+	0x01, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1d, 0x06, 0x01, 0x04, 0x09, 0x07, 0x08, 0x03, 0x05,
+	0x01, 0x04, 0x05, 0x67, 0x03, 0x01, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1d, 0x06, 0x01, 0x04, 0x09, 0x07, 0x08, 0x03, 0x05,
+	0x01, 0x04, 0x05, 0x67, 0x03, 0x01, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x60, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x16, 0x15, 0x15, 0x0f, 0x0f, 0x15, 0x1a, 0x15,
+	0x1a, 0x19, 0x18, 0x0f, 0x14, 0x0f, 0x14, 0x16, 0x12, 0x11, 0x13, 0x30, 0x0a, 0x07, 0x1b, 0x2b,
+	0x33, 0x39, 0x01, 0x21, 0x13, 0x11, 0x03, 0x23, 0x11, 0x21, 0x19, 0x01, 0x21, 0x17, 0x11, 0x01,
+	0x39, 0x01, 0x11, 0x23, 0x11, 0x23, 0x39, 0x01, 0x11, 0x23, 0x11, 0xcf, 0x01, 0xc1, 0xcd, 0xc1,
+	0x5d, 0xfe, 0xe1, 0xfe, 0x37, 0xab, 0x02, 0xfe, 0xf9, 0x98, 0xf9, 0x01, 0x06, 0x03, 0x8d, 0x01,
+	0x06, 0xfb, 0x85, 0x02, 0x05, 0x02, 0x76, 0xe5, 0xfc, 0x52, 0x05, 0x17, 0x01, 0x1d, 0xfe, 0xe3,
+	0x01, 0x1d, 0xfe, 0xe3, 0x00, 0x02, 0xff, 0x56, 0x00, 0x00, 0x03, 0x5c, 0x07, 0xc9, 0x00, 0x12,
+	0x00, 0x18, 0x00, 0x7d, 0x40, 0x0e, 0x10, 0x0f, 0x0e, 0x0b, 0x0a, 0x09, 0x06, 0x05, 0x04, 0x09,
+	0x00, 0x01, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x17, 0x00, 0x04, 0x03, 0x04, 0x85,
+	0x02, 0x01, 0x01, 0x01, 0x13, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x05, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x17, 0x00, 0x04, 0x03, 0x04, 0x85, 0x02,
+	0x01, 0x01, 0x01, 0x11, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x05, 0x01, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x1b, 0x40, 0x17, 0x00, 0x04, 0x03, 0x04, 0x85, 0x02, 0x01, 0x01, 0x01, 0x13, 0x4d, 0x00,
+	0x03, 0x03, 0x00, 0x5f, 0x05, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x11, 0x03,
+	0x00, 0x18, 0x17, 0x16, 0x13, 0x0d, 0x0c, 0x08, 0x07, 0x00, 0x12, 0x03, 0x11, 0x06, 0x07, 0x16,
+	0x2b, 0x21, 0x39, 0x01, 0x21, 0x11, 0x25, 0x11, 0x03, 0x23, 0x11, 0x07, 0x27, 0x11, 0x21, 0x17,
+	0x03, 0x05, 0x11, 0x31, 0x13, 0x39, 0x01, 0x23, 0x13, 0x33, 0x01, 0x25, 0x01, 0x1e, 0x01, 0x19,
+	0xc1, 0x5d, 0x89, 0x95, 0xfe, 0x36, 0xac, 0x01, 0x01, 0x24, 0xf9, 0xbe, 0x9b, 0xf8, 0x01, 0xa2,
+	0xae, 0x02, 0x43, 0x01, 0x06, 0xfd, 0x55, 0x60, 0x60, 0x02, 0xab, 0xe5, 0xfd, 0x9c, 0xb0, 0xfe,
+	0x60, 0x06, 0x1e, 0x01, 0xab, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x57, 0x00, 0x00, 0x03, 0x95,
+	0x05, 0x99, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x7d, 0x40, 0x0a, 0x0b, 0x01, 0x02, 0x03, 0x06, 0x01,
+	0x05, 0x02, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x02, 0x00, 0x05, 0x04,
+	0x02, 0x05, 0x67, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x03, 0x03, 0x13, 0x4d,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x02,
+	0x00, 0x05, 0x04, 0x02, 0x05, 0x67, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x03,
+	0x03, 0x11, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1b, 0x00, 0x02, 0x00, 0x05,
+	0x04, 0x02, 0x05, 0x67, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x03, 0x03, 0x13,
+	0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x09, 0x11, 0x32, 0x11, 0x12, 0x11,
+	0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x35, 0x21, 0x11, 0x03, 0x21, 0x35, 0x21,
+	0x17, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x02, 0x01, 0x1f, 0x02, 0x74, 0xc1, 0xfe, 0x4d, 0xfe,
+	0x36, 0xab, 0x02, 0x75, 0xfe, 0xaa, 0x01, 0x56, 0xac, 0x02, 0xe8, 0x01, 0x06, 0xff, 0xe5, 0xfd,
+	0x15, 0x01, 0xb3, 0x00, 0x00, 0x01, 0xff, 0x56, 0xfe, 0x7a, 0x04, 0x42, 0x05, 0x99, 0x00, 0x18,
+	0x00, 0xd4, 0x40, 0x0b, 0x16, 0x13, 0x02, 0x01, 0x07, 0x10, 0x01, 0x05, 0x04, 0x02, 0x4c, 0x4b,
+	0xb0, 0x0f, 0x50, 0x58, 0x40, 0x24, 0x06, 0x01, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00,
+	0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x60, 0x00, 0x05,
+	0x05, 0x12, 0x4d, 0x08, 0x01, 0x00, 0x00, 0x16, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58,
+	0x40, 0x24, 0x06, 0x01, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f,
+	0x00, 0x07, 0x07, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x60, 0x00, 0x05, 0x05, 0x12, 0x4d, 0x08,
+	0x01, 0x00, 0x00, 0x16, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x24, 0x06, 0x01,
+	0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13,
+	0x4d, 0x00, 0x04, 0x04, 0x05, 0x60, 0x00, 0x05, 0x05, 0x12, 0x4d, 0x08, 0x01, 0x00, 0x00, 0x16,
+	0x00, 0x4e, 0x1b, 0x40, 0x24, 0x08, 0x01, 0x00, 0x05, 0x00, 0x86, 0x06, 0x01, 0x02, 0x00, 0x03,
+	0x04, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x4d, 0x00, 0x04,
+	0x04, 0x05, 0x60, 0x00, 0x05, 0x05, 0x12, 0x05, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x17, 0x03, 0x00,
+	0x15, 0x14, 0x12, 0x11, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x00, 0x18,
+	0x03, 0x17, 0x09, 0x07, 0x16, 0x2b, 0x13, 0x39, 0x01, 0x21, 0x11, 0x33, 0x35, 0x21, 0x11, 0x23,
+	0x11, 0x05, 0x03, 0x21, 0x11, 0x21, 0x13, 0x11, 0x23, 0x13, 0x03, 0x21, 0x17, 0x11, 0x31, 0x02,
+	0x01, 0x1c, 0x02, 0x01, 0x1e, 0x9d, 0x01, 0x83, 0x01, 0xfe, 0x7e, 0x01, 0xe0, 0xc1, 0xe8, 0x02,
+	0xc1, 0xfc, 0xbb, 0xac, 0xfe, 0x7a, 0x05, 0x18, 0xe9, 0xfe, 0xe1, 0xfe, 0xe1, 0x02, 0xfe, 0xe3,
+	0xfe, 0xe2, 0x01, 0x06, 0x02, 0x52, 0x01, 0x3b, 0x01, 0x06, 0xe5, 0xf9, 0xc6, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63, 0x06, 0x28, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x15,
+	0x00, 0x35, 0x40, 0x32, 0x09, 0x01, 0x04, 0x02, 0x04, 0x01, 0x00, 0x03, 0x02, 0x4c, 0x00, 0x06,
+	0x00, 0x05, 0x02, 0x06, 0x05, 0x67, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d,
+	0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x31, 0x11, 0x32,
+	0x11, 0x12, 0x30, 0x07, 0x07, 0x1d, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x11, 0x21, 0x11, 0x21, 0x03,
+	0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x03, 0x39, 0x01, 0x33, 0x03, 0x23, 0x01, 0x6f, 0xd4, 0x01,
+	0x20, 0xfd, 0x60, 0xc3, 0x02, 0x43, 0xfe, 0xde, 0x01, 0x22, 0xcf, 0xc1, 0x9d, 0xfa, 0x01, 0x20,
+	0xfe, 0xe0, 0x03, 0xfa, 0xfe, 0xf7, 0xfe, 0x30, 0x01, 0xb7, 0x01, 0xa0, 0x01, 0xb0, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63, 0x06, 0x25, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x15,
+	0x00, 0x65, 0x40, 0x0a, 0x09, 0x01, 0x04, 0x02, 0x04, 0x01, 0x00, 0x03, 0x02, 0x4c, 0x4b, 0xb0,
+	0x15, 0x50, 0x58, 0x40, 0x21, 0x00, 0x06, 0x05, 0x06, 0x85, 0x00, 0x05, 0x02, 0x02, 0x05, 0x70,
+	0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01,
+	0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x20, 0x00, 0x06, 0x05, 0x06, 0x85, 0x00, 0x05,
+	0x02, 0x05, 0x85, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03,
+	0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x40, 0x0a, 0x11, 0x31, 0x11, 0x32,
+	0x11, 0x12, 0x30, 0x07, 0x07, 0x1d, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x11, 0x21, 0x11, 0x21, 0x03,
+	0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x03, 0x39, 0x01, 0x23, 0x13, 0x33, 0x01, 0x6f, 0xd4, 0x01,
+	0x20, 0xfd, 0x60, 0xc3, 0x02, 0x43, 0xfe, 0xde, 0x01, 0x22, 0x1b, 0xc0, 0x9d, 0xfa, 0x01, 0x20,
+	0xfe, 0xe0, 0x03, 0xfa, 0xfe, 0xf7, 0xfe, 0x30, 0x01, 0xb7, 0x01, 0x9d, 0x01, 0xb0, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63, 0x06, 0x27, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x17,
+	0x00, 0x34, 0x40, 0x31, 0x09, 0x01, 0x04, 0x02, 0x04, 0x01, 0x00, 0x03, 0x02, 0x4c, 0x17, 0x16,
+	0x15, 0x14, 0x13, 0x10, 0x06, 0x02, 0x4a, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14,
+	0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x32, 0x11,
+	0x12, 0x30, 0x05, 0x07, 0x1b, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x11, 0x21, 0x11, 0x21, 0x03, 0x01,
+	0x39, 0x01, 0x21, 0x11, 0x21, 0x13, 0x39, 0x01, 0x35, 0x25, 0x05, 0x15, 0x25, 0x01, 0x6f, 0xd4,
+	0x01, 0x20, 0xfd, 0x60, 0xc3, 0x02, 0x43, 0xfe, 0xde, 0x01, 0x22, 0xd6, 0xfe, 0xf4, 0xfe, 0xf3,
+	0x01, 0x0d, 0x01, 0x20, 0xfe, 0xe0, 0x03, 0xfa, 0xfe, 0xf7, 0xfe, 0x30, 0x01, 0xb7, 0x01, 0x9d,
+	0xe7, 0xcb, 0xcb, 0xe7, 0xca, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63,
+	0x05, 0xaa, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x2b, 0x01, 0xd8, 0x40, 0x17, 0x2b, 0x1e, 0x02, 0x07,
+	0x05, 0x1f, 0x01, 0x02, 0x08, 0x09, 0x01, 0x04, 0x02, 0x04, 0x01, 0x00, 0x03, 0x04, 0x4c, 0x10,
+	0x01, 0x06, 0x4a, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x28, 0x00, 0x05, 0x00, 0x08, 0x02, 0x05,
+	0x08, 0x69, 0x00, 0x07, 0x07, 0x06, 0x61, 0x00, 0x06, 0x06, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x11, 0x50, 0x58, 0x40, 0x28, 0x00, 0x05, 0x00, 0x08, 0x02, 0x05,
+	0x08, 0x69, 0x00, 0x07, 0x07, 0x06, 0x61, 0x00, 0x06, 0x06, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x28, 0x00, 0x05, 0x00, 0x08, 0x02, 0x05,
+	0x08, 0x69, 0x00, 0x07, 0x07, 0x06, 0x61, 0x00, 0x06, 0x06, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x28, 0x00, 0x05, 0x00, 0x08, 0x02, 0x05,
+	0x08, 0x69, 0x00, 0x07, 0x07, 0x06, 0x61, 0x00, 0x06, 0x06, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x28, 0x00, 0x05, 0x00, 0x08, 0x02, 0x05,
+	0x08, 0x69, 0x00, 0x07, 0x07, 0x06, 0x61, 0x00, 0x06, 0x06, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x28, 0x00, 0x05, 0x00, 0x08, 0x02, 0x05,
+	0x08, 0x69, 0x00, 0x07, 0x07, 0x06, 0x61, 0x00, 0x06, 0x06, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x28, 0x00, 0x05, 0x00, 0x08, 0x02, 0x05,
+	0x08, 0x69, 0x00, 0x07, 0x07, 0x06, 0x61, 0x00, 0x06, 0x06, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40, 0x28, 0x00, 0x05, 0x00, 0x08, 0x02, 0x05,
+	0x08, 0x69, 0x00, 0x07, 0x07, 0x06, 0x61, 0x00, 0x06, 0x06, 0x13, 0x4d, 0x00, 0x04, 0x04, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12,
+	0x00, 0x4e, 0x1b, 0x40, 0x26, 0x00, 0x06, 0x00, 0x07, 0x08, 0x06, 0x07, 0x69, 0x00, 0x05, 0x00,
+	0x08, 0x02, 0x05, 0x08, 0x69, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00,
+	0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x59,
+	0x59, 0x59, 0x59, 0x40, 0x0c, 0x22, 0x27, 0x22, 0x26, 0x11, 0x32, 0x11, 0x12, 0x30, 0x09, 0x07,
+	0x1f, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x11, 0x21, 0x11, 0x21, 0x03, 0x01, 0x39, 0x01, 0x21, 0x11,
+	0x21, 0x01, 0x39, 0x01, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07,
+	0x17, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x01, 0x6f, 0xd4,
+	0x01, 0x20, 0xfd, 0x60, 0xc3, 0x02, 0x43, 0xfe, 0xde, 0x01, 0x22, 0x01, 0x00, 0x46, 0x37, 0x37,
+	0x32, 0x36, 0x74, 0x73, 0x3f, 0x35, 0x3a, 0x39, 0x3d, 0x03, 0x47, 0x36, 0x37, 0x32, 0x3a, 0x73,
+	0x74, 0x3a, 0x38, 0x39, 0x3a, 0x3c, 0x01, 0x20, 0xfe, 0xe0, 0x03, 0xfa, 0xfe, 0xf7, 0xfe, 0x30,
+	0x01, 0xb7, 0x02, 0xd2, 0x52, 0x1b, 0x1c, 0x31, 0x30, 0x19, 0x1a, 0x47, 0xde, 0x52, 0x1b, 0x1c,
+	0x30, 0x2f, 0x19, 0x19, 0x46, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63,
+	0x05, 0xaa, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x48, 0x40, 0x45, 0x09, 0x01,
+	0x04, 0x02, 0x04, 0x01, 0x00, 0x03, 0x02, 0x4c, 0x0a, 0x08, 0x09, 0x03, 0x06, 0x06, 0x05, 0x5f,
+	0x07, 0x01, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d,
+	0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x16, 0x16, 0x10, 0x10,
+	0x16, 0x1b, 0x16, 0x1b, 0x1a, 0x19, 0x10, 0x15, 0x10, 0x15, 0x14, 0x11, 0x32, 0x11, 0x12, 0x30,
+	0x0b, 0x07, 0x1c, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x11, 0x21, 0x11, 0x21, 0x03, 0x01, 0x39, 0x01,
+	0x21, 0x11, 0x21, 0x13, 0x39, 0x01, 0x11, 0x23, 0x11, 0x23, 0x39, 0x01, 0x11, 0x23, 0x11, 0x01,
+	0x6f, 0xd4, 0x01, 0x20, 0xfd, 0x60, 0xc3, 0x02, 0x43, 0xfe, 0xde, 0x01, 0x22, 0xd0, 0xfc, 0x99,
+	0xfc, 0x01, 0x20, 0xfe, 0xe0, 0x03, 0xfa, 0xfe, 0xf7, 0xfe, 0x30, 0x01, 0xb7, 0x01, 0xb2, 0x01,
+	0x20, 0xfe, 0xe0, 0x01, 0x20, 0xfe, 0xe0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63,
+	0x06, 0x3e, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x3f, 0x40, 0x3c, 0x09, 0x01,
+	0x04, 0x02, 0x04, 0x01, 0x00, 0x03, 0x02, 0x4c, 0x00, 0x06, 0x00, 0x08, 0x07, 0x06, 0x08, 0x67,
+	0x00, 0x07, 0x00, 0x05, 0x02, 0x07, 0x05, 0x67, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02,
+	0x14, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x31,
+	0x11, 0x31, 0x11, 0x32, 0x11, 0x12, 0x30, 0x09, 0x07, 0x1f, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x11,
+	0x21, 0x11, 0x21, 0x03, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21,
+	0x01, 0x39, 0x01, 0x23, 0x35, 0x33, 0x01, 0x6f, 0xd4, 0x01, 0x20, 0xfd, 0x60, 0xc3, 0x02, 0x43,
+	0xfe, 0xde, 0x01, 0x22, 0xfe, 0x8f, 0x01, 0xc3, 0xfe, 0x3d, 0x01, 0x3c, 0xb6, 0xb6, 0x01, 0x20,
+	0xfe, 0xe0, 0x03, 0xfa, 0xfe, 0xf7, 0xfe, 0x30, 0x01, 0xb7, 0x01, 0x9d, 0x01, 0xc9, 0xfe, 0xbe,
+	0xbb, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0xa2, 0x03, 0xfa, 0x00, 0x12,
+	0x00, 0x17, 0x00, 0x1b, 0x00, 0x34, 0x40, 0x31, 0x0c, 0x01, 0x05, 0x03, 0x18, 0x02, 0x02, 0x00,
+	0x05, 0x09, 0x01, 0x01, 0x00, 0x03, 0x4c, 0x06, 0x01, 0x05, 0x05, 0x03, 0x5f, 0x00, 0x03, 0x03,
+	0x14, 0x4d, 0x04, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01, 0x12, 0x01, 0x4e, 0x13,
+	0x11, 0x22, 0x42, 0x13, 0x21, 0x13, 0x07, 0x07, 0x1d, 0x2b, 0x01, 0x31, 0x15, 0x01, 0x21, 0x03,
+	0x29, 0x01, 0x23, 0x11, 0x03, 0x21, 0x11, 0x13, 0x21, 0x3b, 0x01, 0x21, 0x15, 0x01, 0x31, 0x21,
+	0x11, 0x21, 0x01, 0x31, 0x13, 0x23, 0x05, 0xa2, 0xfe, 0xae, 0x01, 0x51, 0xd3, 0xfe, 0x95, 0xfe,
+	0xe0, 0x05, 0xcf, 0xfe, 0x91, 0xc3, 0x01, 0x8a, 0xb4, 0x62, 0x02, 0x3e, 0xfb, 0x80, 0x01, 0x1d,
+	0xfe, 0xe3, 0x02, 0x42, 0xee, 0xee, 0x03, 0x9a, 0xd3, 0xfe, 0x5a, 0xfe, 0xdf, 0x01, 0x1a, 0xfe,
+	0xe6, 0x02, 0xf1, 0x01, 0x09, 0x60, 0xfd, 0x87, 0x01, 0xb7, 0xfe, 0xd7, 0x01, 0x29, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0xfe, 0x6f, 0x03, 0x63, 0x03, 0xf7, 0x00, 0x18, 0x01, 0x4c, 0x4b, 0xb0,
+	0x13, 0x50, 0x58, 0x40, 0x0a, 0x16, 0x01, 0x00, 0x09, 0x09, 0x01, 0x04, 0x05, 0x02, 0x4c, 0x1b,
+	0x40, 0x0a, 0x16, 0x01, 0x00, 0x09, 0x09, 0x01, 0x04, 0x06, 0x02, 0x4c, 0x59, 0x4b, 0xb0, 0x0b,
+	0x50, 0x58, 0x40, 0x2e, 0x00, 0x07, 0x03, 0x05, 0x04, 0x07, 0x72, 0x06, 0x01, 0x05, 0x04, 0x03,
+	0x05, 0x70, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x02,
+	0x5f, 0x08, 0x01, 0x02, 0x02, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x16,
+	0x04, 0x4e, 0x1b, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x2f, 0x00, 0x07, 0x03, 0x05, 0x03, 0x07,
+	0x05, 0x80, 0x06, 0x01, 0x05, 0x04, 0x03, 0x05, 0x70, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x00, 0x09,
+	0x09, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x08, 0x01, 0x02, 0x02, 0x12, 0x4d, 0x00, 0x03,
+	0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x16, 0x04, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40,
+	0x30, 0x00, 0x07, 0x03, 0x05, 0x03, 0x07, 0x05, 0x80, 0x06, 0x01, 0x05, 0x04, 0x03, 0x05, 0x04,
+	0x7e, 0x00, 0x00, 0x00, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f,
+	0x08, 0x01, 0x02, 0x02, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x16, 0x04,
+	0x4e, 0x1b, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x36, 0x00, 0x07, 0x03, 0x05, 0x03, 0x07, 0x05,
+	0x80, 0x00, 0x05, 0x06, 0x03, 0x05, 0x06, 0x7e, 0x00, 0x06, 0x04, 0x03, 0x06, 0x04, 0x7e, 0x00,
+	0x00, 0x00, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x08, 0x01,
+	0x02, 0x02, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x16, 0x04, 0x4e, 0x1b,
+	0x40, 0x33, 0x00, 0x07, 0x03, 0x05, 0x03, 0x07, 0x05, 0x80, 0x00, 0x05, 0x06, 0x03, 0x05, 0x06,
+	0x7e, 0x00, 0x06, 0x04, 0x03, 0x06, 0x04, 0x7e, 0x00, 0x03, 0x00, 0x04, 0x03, 0x04, 0x63, 0x00,
+	0x00, 0x00, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x08, 0x01,
+	0x02, 0x02, 0x12, 0x02, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x40, 0x0e, 0x18, 0x17, 0x11, 0x21, 0x11,
+	0x12, 0x12, 0x11, 0x11, 0x11, 0x20, 0x0a, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x11, 0x21, 0x03,
+	0x23, 0x15, 0x33, 0x15, 0x07, 0x21, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x2b, 0x01, 0x35, 0x21,
+	0x11, 0x13, 0x21, 0x03, 0x63, 0xfd, 0xbe, 0x02, 0x42, 0xd3, 0xed, 0xe5, 0x52, 0xfe, 0xfb, 0x72,
+	0x73, 0x73, 0x72, 0xfe, 0xcf, 0xc3, 0x02, 0xa0, 0x02, 0xd5, 0xfe, 0x48, 0xfe, 0xe0, 0x36, 0xef,
+	0x69, 0x8d, 0x1a, 0x72, 0xa9, 0x02, 0xf0, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x63, 0x06, 0x25, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x5d, 0xb5, 0x0a, 0x01, 0x02,
+	0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x20, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00,
+	0x04, 0x03, 0x03, 0x04, 0x70, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x00,
+	0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1f, 0x00, 0x05, 0x04,
+	0x05, 0x85, 0x00, 0x04, 0x03, 0x04, 0x85, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14,
+	0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x40, 0x09, 0x11,
+	0x32, 0x11, 0x11, 0x11, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x21, 0x11, 0x21,
+	0x11, 0x21, 0x03, 0x01, 0x39, 0x01, 0x23, 0x13, 0x33, 0x02, 0x90, 0xd3, 0xfd, 0xbe, 0x02, 0x42,
+	0xfd, 0x60, 0xc3, 0x02, 0x5a, 0xc0, 0x9d, 0xfa, 0x01, 0x21, 0x01, 0xb7, 0x01, 0x22, 0xfe, 0xf7,
+	0x01, 0x84, 0x01, 0xb0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63, 0x06, 0x27, 0x00, 0x0a,
+	0x00, 0x12, 0x00, 0x2e, 0x40, 0x2b, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x4c, 0x11, 0x10, 0x0f, 0x0e,
+	0x0d, 0x0c, 0x06, 0x03, 0x4a, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x00,
+	0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x11, 0x11, 0x30, 0x04, 0x07,
+	0x1a, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x21, 0x11, 0x21, 0x11, 0x21, 0x03, 0x01, 0x05, 0x25, 0x15,
+	0x05, 0x25, 0x35, 0x31, 0x02, 0x90, 0xd3, 0xfd, 0xbe, 0x02, 0x42, 0xfd, 0x60, 0xc3, 0x02, 0xab,
+	0xfe, 0xf4, 0xfe, 0xf3, 0x01, 0x0d, 0x01, 0x0c, 0x01, 0x21, 0x01, 0xb7, 0x01, 0x22, 0xfe, 0xf7,
+	0x03, 0x36, 0xcb, 0xcb, 0xe8, 0xca, 0xca, 0xe8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63,
+	0x06, 0x28, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x16, 0x00, 0x34, 0x40, 0x31, 0x0b, 0x01, 0x03, 0x02,
+	0x0c, 0x06, 0x02, 0x01, 0x03, 0x02, 0x4c, 0x00, 0x05, 0x00, 0x04, 0x02, 0x05, 0x04, 0x67, 0x00,
+	0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x11, 0x31, 0x15, 0x14, 0x11, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x39, 0x02,
+	0x21, 0x13, 0x21, 0x01, 0x35, 0x31, 0x35, 0x21, 0x03, 0x01, 0x39, 0x01, 0x11, 0x33, 0x03, 0x39,
+	0x01, 0x33, 0x03, 0x23, 0x02, 0x90, 0xd3, 0xfe, 0xaf, 0x01, 0x51, 0xfd, 0x60, 0xc3, 0x01, 0x21,
+	0xf1, 0xa5, 0xc1, 0x9d, 0xfa, 0x01, 0x21, 0x01, 0xa6, 0xd3, 0x60, 0xfe, 0xf7, 0xfe, 0xba, 0x01,
+	0x2d, 0x01, 0xa0, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63,
+	0x06, 0x28, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x16, 0x00, 0x63, 0x40, 0x0b, 0x0b, 0x01, 0x03, 0x02,
+	0x0c, 0x06, 0x02, 0x01, 0x03, 0x02, 0x4c, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40, 0x20, 0x00, 0x05,
+	0x04, 0x05, 0x85, 0x00, 0x04, 0x02, 0x02, 0x04, 0x70, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02,
+	0x02, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40,
+	0x1f, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04, 0x02, 0x04, 0x85, 0x00, 0x03, 0x03, 0x02, 0x5f,
+	0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x59, 0x40, 0x09, 0x11, 0x31, 0x15, 0x14, 0x11, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x39, 0x02, 0x21,
+	0x13, 0x21, 0x01, 0x35, 0x31, 0x35, 0x21, 0x03, 0x01, 0x39, 0x01, 0x11, 0x33, 0x13, 0x39, 0x01,
+	0x23, 0x13, 0x33, 0x02, 0x90, 0xd3, 0xfe, 0xaf, 0x01, 0x51, 0xfd, 0x60, 0xc3, 0x01, 0x21, 0xf1,
+	0x04, 0xc0, 0x9d, 0xfa, 0x01, 0x21, 0x01, 0xa6, 0xd3, 0x60, 0xfe, 0xf7, 0xfe, 0xba, 0x01, 0x2d,
+	0x01, 0xa0, 0x01, 0xb0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63, 0x06, 0x27, 0x00, 0x0b,
+	0x00, 0x10, 0x00, 0x18, 0x00, 0x33, 0x40, 0x30, 0x0b, 0x01, 0x03, 0x02, 0x0c, 0x06, 0x02, 0x01,
+	0x03, 0x02, 0x4c, 0x18, 0x17, 0x16, 0x15, 0x14, 0x11, 0x06, 0x02, 0x4a, 0x00, 0x03, 0x03, 0x02,
+	0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x15, 0x14, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x21, 0x01, 0x35,
+	0x31, 0x35, 0x21, 0x03, 0x01, 0x39, 0x01, 0x11, 0x33, 0x13, 0x39, 0x01, 0x35, 0x25, 0x05, 0x15,
+	0x25, 0x02, 0x90, 0xd3, 0xfe, 0xaf, 0x01, 0x51, 0xfd, 0x60, 0xc3, 0x01, 0x21, 0xf1, 0xc3, 0xfe,
+	0xf4, 0xfe, 0xf3, 0x01, 0x0d, 0x01, 0x21, 0x01, 0xa6, 0xd3, 0x60, 0xfe, 0xf7, 0xfe, 0xba, 0x01,
+	0x2d, 0x01, 0x9d, 0xe7, 0xcb, 0xcb, 0xe7, 0xca, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x63,
+	0x05, 0xaa, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x21, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x52,
+	0x40, 0x4f, 0x1c, 0x0b, 0x02, 0x03, 0x02, 0x1d, 0x17, 0x0c, 0x06, 0x04, 0x01, 0x03, 0x02, 0x4c,
+	0x0d, 0x0b, 0x0c, 0x03, 0x09, 0x09, 0x08, 0x5f, 0x0a, 0x01, 0x08, 0x08, 0x11, 0x4d, 0x07, 0x01,
+	0x03, 0x03, 0x02, 0x5f, 0x06, 0x01, 0x02, 0x02, 0x14, 0x4d, 0x05, 0x01, 0x01, 0x01, 0x00, 0x5f,
+	0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x28, 0x28, 0x22, 0x22, 0x28, 0x2d, 0x28, 0x2d, 0x2c,
+	0x2b, 0x22, 0x27, 0x22, 0x27, 0x14, 0x15, 0x14, 0x11, 0x31, 0x15, 0x14, 0x11, 0x30, 0x0e, 0x07,
+	0x1f, 0x2b, 0x39, 0x02, 0x21, 0x13, 0x21, 0x01, 0x35, 0x31, 0x35, 0x21, 0x03, 0x01, 0x39, 0x01,
+	0x11, 0x33, 0x01, 0x39, 0x01, 0x21, 0x13, 0x21, 0x01, 0x35, 0x31, 0x35, 0x21, 0x03, 0x01, 0x39,
+	0x01, 0x11, 0x33, 0x13, 0x39, 0x01, 0x11, 0x23, 0x11, 0x23, 0x39, 0x01, 0x11, 0x23, 0x11, 0x02,
+	0x90, 0xd3, 0xfe, 0xaf, 0x01, 0x51, 0xfd, 0x60, 0xc3, 0x01, 0x21, 0xf1, 0xfd, 0xee, 0x02, 0x90,
+	0xd3, 0xfe, 0xaf, 0x01, 0x51, 0xfd, 0x60, 0xc3, 0x01, 0x21, 0xf1, 0xd8, 0xfb, 0x9a, 0xfb, 0x01,
+	0x21, 0x01, 0xa6, 0xd3, 0x60, 0xfe, 0xf7, 0xfe, 0xba, 0x01, 0x2d, 0xfd, 0x28, 0x01, 0x21, 0x01,
+	0xa6, 0xd3, 0x60, 0xfe, 0xf7, 0xfe, 0xba, 0x01, 0x2d, 0x01, 0xb2, 0x01, 0x20, 0xfe, 0xe0, 0x01,
+	0x20, 0xfe, 0xe0, 0x00, 0x00, 0x02, 0xff, 0x66, 0x00, 0x00, 0x01, 0x21, 0x06, 0x23, 0x00, 0x05,
+	0x00, 0x0b, 0x00, 0x1d, 0x40, 0x1a, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02, 0x67, 0x00, 0x01,
+	0x01, 0x14, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x31, 0x11, 0x30, 0x04, 0x07, 0x1a,
+	0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x21, 0x37, 0x39, 0x01, 0x33, 0x03, 0x23, 0x02, 0x01, 0x1f,
+	0xfe, 0xe1, 0x39, 0xbf, 0x9c, 0xf8, 0x03, 0xf7, 0x7d, 0x01, 0xaf, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0xce, 0x06, 0x23, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x3f, 0x4b, 0xb0, 0x15, 0x50,
+	0x58, 0x40, 0x16, 0x00, 0x03, 0x02, 0x03, 0x85, 0x00, 0x02, 0x01, 0x01, 0x02, 0x70, 0x00, 0x01,
+	0x01, 0x14, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x15, 0x00, 0x03, 0x02, 0x03,
+	0x85, 0x00, 0x02, 0x01, 0x02, 0x85, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x59, 0xb6, 0x11, 0x31, 0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x39, 0x02, 0x21, 0x11, 0x21,
+	0x37, 0x39, 0x01, 0x23, 0x13, 0x33, 0x01, 0x1f, 0xfe, 0xe1, 0xf9, 0xbf, 0x9c, 0xf8, 0x03, 0xf7,
+	0x7d, 0x01, 0xaf, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x17, 0x06, 0x22, 0x00, 0x05,
+	0x00, 0x0d, 0x00, 0x1c, 0x40, 0x19, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x06, 0x06, 0x01, 0x4a, 0x00,
+	0x01, 0x01, 0x14, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x30, 0x02, 0x07, 0x18, 0x2b,
+	0x33, 0x39, 0x01, 0x21, 0x11, 0x21, 0x25, 0x39, 0x01, 0x35, 0x25, 0x05, 0x15, 0x25, 0x76, 0x01,
+	0x20, 0xfe, 0xe0, 0x01, 0xa1, 0xfe, 0xf5, 0xfe, 0xf6, 0x01, 0x0a, 0x03, 0xf7, 0x7a, 0xe7, 0xca,
+	0xca, 0xe7, 0xca, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8c, 0x05, 0xa6, 0x00, 0x05,
+	0x00, 0x0b, 0x00, 0x11, 0x00, 0x30, 0x40, 0x2d, 0x07, 0x05, 0x06, 0x03, 0x03, 0x03, 0x02, 0x5f,
+	0x04, 0x01, 0x02, 0x02, 0x11, 0x4d, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x0c, 0x0c, 0x06, 0x06, 0x0c, 0x11, 0x0c, 0x11, 0x10, 0x0f, 0x06, 0x0b, 0x06, 0x0b, 0x14,
+	0x11, 0x30, 0x08, 0x07, 0x19, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x21, 0x25, 0x39, 0x01, 0x11,
+	0x23, 0x11, 0x07, 0x39, 0x01, 0x11, 0x23, 0x11, 0xb6, 0x01, 0x1f, 0xfe, 0xe1, 0x01, 0xd6, 0xfa,
+	0x99, 0xf9, 0x03, 0xf7, 0x8f, 0x01, 0x20, 0xfe, 0xe1, 0x01, 0x01, 0x20, 0xfe, 0xe1, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x05, 0xa6, 0x00, 0x14, 0x00, 0x19, 0x00, 0x45,
+	0x40, 0x42, 0x0a, 0x01, 0x08, 0x03, 0x07, 0x01, 0x01, 0x09, 0x02, 0x4c, 0x07, 0x01, 0x05, 0x04,
+	0x01, 0x00, 0x03, 0x05, 0x00, 0x68, 0x00, 0x06, 0x06, 0x11, 0x4d, 0x00, 0x08, 0x08, 0x03, 0x5f,
+	0x00, 0x03, 0x03, 0x14, 0x4d, 0x0a, 0x01, 0x09, 0x09, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01, 0x12,
+	0x01, 0x4e, 0x15, 0x15, 0x15, 0x19, 0x15, 0x19, 0x13, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x13,
+	0x20, 0x0b, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x23, 0x15, 0x31, 0x11, 0x21, 0x11, 0x03, 0x21, 0x11,
+	0x13, 0x21, 0x35, 0x23, 0x35, 0x33, 0x27, 0x21, 0x15, 0x33, 0x01, 0x31, 0x11, 0x21, 0x11, 0x03,
+	0xfe, 0xa2, 0xfe, 0xe1, 0xd1, 0xfe, 0x94, 0xc2, 0x01, 0x7b, 0xbb, 0xaa, 0x9b, 0x01, 0xcb, 0xa2,
+	0xfe, 0x3f, 0xfe, 0xe2, 0x04, 0x31, 0x3a, 0xfc, 0x09, 0x01, 0x1e, 0xfe, 0xe2, 0x02, 0xef, 0x01,
+	0x08, 0x3a, 0xa5, 0xd0, 0xd0, 0xfc, 0x4a, 0x01, 0xb6, 0xfe, 0x4a, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x5d, 0x05, 0xa6, 0x00, 0x0a, 0x00, 0x26, 0x00, 0xf6, 0x40, 0x13, 0x26, 0x19,
+	0x02, 0x06, 0x04, 0x1a, 0x01, 0x03, 0x07, 0x08, 0x01, 0x01, 0x03, 0x03, 0x4c, 0x0b, 0x01, 0x05,
+	0x4a, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x23, 0x00, 0x04, 0x00, 0x07, 0x03, 0x04, 0x07, 0x69,
+	0x00, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05, 0x11, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x00,
+	0x03, 0x03, 0x14, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x11, 0x50,
+	0x58, 0x40, 0x23, 0x00, 0x04, 0x00, 0x07, 0x03, 0x04, 0x07, 0x69, 0x00, 0x06, 0x06, 0x05, 0x61,
+	0x00, 0x05, 0x05, 0x13, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x02,
+	0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x23, 0x00, 0x04,
+	0x00, 0x07, 0x03, 0x04, 0x07, 0x69, 0x00, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05, 0x11, 0x4d,
+	0x00, 0x01, 0x01, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00,
+	0x4e, 0x1b, 0x4b, 0xb0, 0x24, 0x50, 0x58, 0x40, 0x23, 0x00, 0x04, 0x00, 0x07, 0x03, 0x04, 0x07,
+	0x69, 0x00, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05, 0x13, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x5f,
+	0x00, 0x03, 0x03, 0x14, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x21, 0x00,
+	0x05, 0x00, 0x06, 0x07, 0x05, 0x06, 0x69, 0x00, 0x04, 0x00, 0x07, 0x03, 0x04, 0x07, 0x69, 0x00,
+	0x01, 0x01, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e,
+	0x59, 0x59, 0x59, 0x59, 0x40, 0x0b, 0x22, 0x27, 0x22, 0x26, 0x12, 0x11, 0x11, 0x30, 0x08, 0x07,
+	0x1e, 0x2b, 0x39, 0x02, 0x21, 0x11, 0x21, 0x13, 0x21, 0x11, 0x03, 0x21, 0x01, 0x39, 0x01, 0x06,
+	0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x17, 0x36, 0x37, 0x36, 0x33,
+	0x32, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x01, 0x1f, 0x01, 0x1e, 0x01, 0x01, 0x1f, 0xc2,
+	0xfd, 0x65, 0x03, 0x3d, 0x45, 0x37, 0x36, 0x33, 0x35, 0x73, 0x72, 0x3e, 0x36, 0x39, 0x38, 0x3e,
+	0x04, 0x46, 0x36, 0x37, 0x31, 0x39, 0x73, 0x73, 0x3a, 0x37, 0x39, 0x39, 0x3c, 0x02, 0xd6, 0xfd,
+	0x2a, 0x02, 0xef, 0x01, 0x08, 0x01, 0xaf, 0x52, 0x1c, 0x1b, 0x30, 0x31, 0x1a, 0x19, 0x47, 0xde,
+	0x52, 0x1b, 0x1c, 0x30, 0x2f, 0x19, 0x19, 0x46, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5d,
+	0x06, 0x23, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x33, 0x40, 0x30, 0x04, 0x01, 0x03, 0x01,
+	0x07, 0x01, 0x00, 0x02, 0x02, 0x4c, 0x00, 0x05, 0x00, 0x04, 0x01, 0x05, 0x04, 0x67, 0x00, 0x03,
+	0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x11, 0x33, 0x11, 0x32, 0x12, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33, 0x39, 0x01,
+	0x21, 0x11, 0x03, 0x21, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x15, 0x31, 0x01, 0x39, 0x01,
+	0x33, 0x03, 0x23, 0xc2, 0x02, 0x9b, 0xc2, 0xfd, 0x65, 0x02, 0x3d, 0xfe, 0xe2, 0x01, 0x1e, 0xff,
+	0x00, 0xbe, 0x9b, 0xf9, 0x02, 0xef, 0x01, 0x08, 0xfd, 0x12, 0x18, 0x01, 0xb5, 0x74, 0x02, 0x12,
+	0x01, 0xaf, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5d, 0x06, 0x23, 0x00, 0x07,
+	0x00, 0x0f, 0x00, 0x15, 0x00, 0x62, 0x40, 0x0a, 0x04, 0x01, 0x03, 0x01, 0x07, 0x01, 0x00, 0x02,
+	0x02, 0x4c, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x20, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04,
+	0x01, 0x01, 0x04, 0x70, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02,
+	0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x1f, 0x00, 0x05, 0x04, 0x05,
+	0x85, 0x00, 0x04, 0x01, 0x04, 0x85, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d,
+	0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x40, 0x09, 0x11, 0x33,
+	0x11, 0x32, 0x12, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x03, 0x21, 0x11,
+	0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x15, 0x31, 0x03, 0x39, 0x01, 0x23, 0x13, 0x33, 0xc2, 0x02,
+	0x9b, 0xc2, 0xfd, 0x65, 0x02, 0x3d, 0xfe, 0xe2, 0x01, 0x1e, 0x24, 0xbe, 0x9b, 0xf9, 0x02, 0xef,
+	0x01, 0x08, 0xfd, 0x12, 0x18, 0x01, 0xb5, 0x74, 0x02, 0x12, 0x01, 0xaf, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x5d, 0x06, 0x22, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x32, 0x40, 0x2f,
+	0x0c, 0x01, 0x03, 0x01, 0x0f, 0x01, 0x00, 0x02, 0x02, 0x4c, 0x07, 0x06, 0x05, 0x04, 0x03, 0x00,
+	0x06, 0x01, 0x4a, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02, 0x02,
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x32, 0x12, 0x38, 0x04, 0x07, 0x1a, 0x2b,
+	0x01, 0x39, 0x01, 0x35, 0x25, 0x05, 0x15, 0x25, 0x03, 0x39, 0x01, 0x21, 0x11, 0x03, 0x21, 0x11,
+	0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x15, 0x31, 0x02, 0x8d, 0xfe, 0xf5, 0xfe, 0xf6, 0x01, 0x0a,
+	0xc0, 0x02, 0x9b, 0xc2, 0xfd, 0x65, 0x02, 0x3d, 0xfe, 0xe2, 0x01, 0x1e, 0x04, 0x71, 0xe7, 0xca,
+	0xca, 0xe7, 0xca, 0xfa, 0xc5, 0x02, 0xef, 0x01, 0x08, 0xfd, 0x12, 0x18, 0x01, 0xb5, 0x74, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5d, 0x05, 0xa6, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x2b,
+	0x01, 0x0e, 0x40, 0x17, 0x2b, 0x1e, 0x02, 0x06, 0x04, 0x1f, 0x01, 0x01, 0x07, 0x04, 0x01, 0x03,
+	0x01, 0x07, 0x01, 0x00, 0x02, 0x04, 0x4c, 0x10, 0x01, 0x05, 0x4a, 0x4b, 0xb0, 0x0d, 0x50, 0x58,
+	0x40, 0x27, 0x00, 0x04, 0x00, 0x07, 0x01, 0x04, 0x07, 0x69, 0x00, 0x06, 0x06, 0x05, 0x61, 0x00,
+	0x05, 0x05, 0x11, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02,
+	0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x11, 0x50, 0x58, 0x40,
+	0x27, 0x00, 0x04, 0x00, 0x07, 0x01, 0x04, 0x07, 0x69, 0x00, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05,
+	0x05, 0x13, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02, 0x02,
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x27,
+	0x00, 0x04, 0x00, 0x07, 0x01, 0x04, 0x07, 0x69, 0x00, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05,
+	0x11, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x24, 0x50, 0x58, 0x40, 0x27, 0x00,
+	0x04, 0x00, 0x07, 0x01, 0x04, 0x07, 0x69, 0x00, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05, 0x13,
+	0x4d, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x25, 0x00, 0x05, 0x00, 0x06, 0x07, 0x05, 0x06,
+	0x69, 0x00, 0x04, 0x00, 0x07, 0x01, 0x04, 0x07, 0x69, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01,
+	0x01, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x59, 0x59,
+	0x59, 0x59, 0x40, 0x0b, 0x22, 0x27, 0x22, 0x28, 0x11, 0x32, 0x12, 0x30, 0x08, 0x07, 0x1e, 0x2b,
+	0x33, 0x39, 0x01, 0x21, 0x11, 0x03, 0x21, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x15, 0x31,
+	0x01, 0x39, 0x01, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x17,
+	0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0xc2, 0x02, 0x9b, 0xc2,
+	0xfd, 0x65, 0x02, 0x3d, 0xfe, 0xe2, 0x01, 0x1e, 0x01, 0x00, 0x45, 0x37, 0x36, 0x33, 0x35, 0x73,
+	0x72, 0x3e, 0x36, 0x39, 0x38, 0x3d, 0x03, 0x46, 0x36, 0x37, 0x31, 0x3a, 0x72, 0x73, 0x3a, 0x37,
+	0x39, 0x39, 0x3c, 0x02, 0xef, 0x01, 0x08, 0xfd, 0x12, 0x18, 0x01, 0xb5, 0x74, 0x03, 0x44, 0x52,
+	0x1c, 0x1b, 0x30, 0x31, 0x1a, 0x19, 0x47, 0xde, 0x52, 0x1b, 0x1c, 0x30, 0x2f, 0x19, 0x19, 0x46,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5d, 0x05, 0xa6, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x15,
+	0x00, 0x1b, 0x00, 0x46, 0x40, 0x43, 0x04, 0x01, 0x03, 0x01, 0x07, 0x01, 0x00, 0x02, 0x02, 0x4c,
+	0x09, 0x07, 0x08, 0x03, 0x05, 0x05, 0x04, 0x5f, 0x06, 0x01, 0x04, 0x04, 0x11, 0x4d, 0x00, 0x03,
+	0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x4e, 0x16, 0x16, 0x10, 0x10, 0x16, 0x1b, 0x16, 0x1b, 0x1a, 0x19, 0x10, 0x15, 0x10,
+	0x15, 0x16, 0x11, 0x32, 0x12, 0x30, 0x0a, 0x07, 0x1b, 0x2b, 0x33, 0x39, 0x01, 0x21, 0x11, 0x03,
+	0x21, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x15, 0x31, 0x13, 0x39, 0x01, 0x11, 0x23, 0x11,
+	0x07, 0x39, 0x01, 0x11, 0x23, 0x11, 0xc2, 0x02, 0x9b, 0xc2, 0xfd, 0x65, 0x02, 0x3d, 0xfe, 0xe2,
+	0x01, 0x1e, 0xb7, 0xf9, 0x99, 0xfa, 0x02, 0xef, 0x01, 0x08, 0xfd, 0x12, 0x18, 0x01, 0xb5, 0x74,
+	0x02, 0x24, 0x01, 0x20, 0xfe, 0xe1, 0x01, 0x01, 0x20, 0xfe, 0xe1, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0xc5, 0x03, 0xf6, 0x04, 0x78, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x36, 0x40, 0x33,
+	0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x02, 0x67, 0x00, 0x00, 0x06, 0x01, 0x01, 0x05, 0x00, 0x01,
+	0x67, 0x00, 0x05, 0x04, 0x04, 0x05, 0x57, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x05, 0x04,
+	0x4f, 0x00, 0x00, 0x11, 0x10, 0x0f, 0x0c, 0x0b, 0x0a, 0x09, 0x06, 0x00, 0x05, 0x00, 0x05, 0x13,
+	0x07, 0x07, 0x17, 0x2b, 0x01, 0x39, 0x01, 0x35, 0x21, 0x15, 0x01, 0x39, 0x01, 0x21, 0x35, 0x21,
+	0x03, 0x39, 0x01, 0x21, 0x35, 0x21, 0x03, 0xf6, 0xfc, 0x0a, 0x01, 0x6c, 0x01, 0x1e, 0xfe, 0xe3,
+	0x01, 0x01, 0x1e, 0xfe, 0xe3, 0x02, 0x40, 0xa6, 0xa6, 0x01, 0x3d, 0xfb, 0xfc, 0x4d, 0xfb, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0xff, 0x88, 0x03, 0x82, 0x04, 0x89, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14,
+	0x00, 0x4e, 0x40, 0x4b, 0x03, 0x02, 0x02, 0x04, 0x02, 0x13, 0x0f, 0x02, 0x05, 0x04, 0x09, 0x08,
+	0x02, 0x00, 0x05, 0x03, 0x4c, 0x06, 0x01, 0x03, 0x02, 0x03, 0x85, 0x00, 0x01, 0x00, 0x01, 0x86,
+	0x07, 0x01, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x14, 0x4d, 0x08, 0x01, 0x05, 0x05, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x11, 0x0d, 0x0d, 0x00, 0x00, 0x11, 0x14, 0x11,
+	0x14, 0x0d, 0x10, 0x0d, 0x10, 0x00, 0x0c, 0x00, 0x0c, 0x13, 0x11, 0x14, 0x09, 0x07, 0x19, 0x2b,
+	0x01, 0x31, 0x07, 0x17, 0x11, 0x21, 0x07, 0x23, 0x37, 0x27, 0x11, 0x21, 0x37, 0x01, 0x31, 0x11,
+	0x1b, 0x01, 0x31, 0x11, 0x03, 0x03, 0x82, 0x8d, 0x72, 0xfd, 0x98, 0x43, 0xbc, 0x7e, 0x74, 0x02,
+	0x6b, 0x51, 0xfe, 0x64, 0xab, 0x72, 0xa8, 0x04, 0x89, 0xff, 0x9b, 0xfd, 0x11, 0x78, 0xe3, 0x9e,
+	0x02, 0xee, 0x92, 0xfe, 0x4d, 0xfe, 0xcb, 0x01, 0x35, 0xfe, 0x4b, 0x01, 0x30, 0xfe, 0xd0, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x06, 0x27, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x2b,
+	0x40, 0x28, 0x08, 0x01, 0x03, 0x01, 0x01, 0x4c, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x04, 0x67,
+	0x02, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x60, 0x00, 0x03, 0x03, 0x12, 0x03,
+	0x4e, 0x11, 0x31, 0x12, 0x11, 0x11, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x01, 0x39, 0x01, 0x21, 0x11,
+	0x21, 0x03, 0x21, 0x11, 0x13, 0x21, 0x01, 0x39, 0x01, 0x33, 0x03, 0x23, 0x03, 0x64, 0xfe, 0xde,
+	0xfe, 0xe0, 0x01, 0xfe, 0xdf, 0xc3, 0x02, 0xa1, 0xfd, 0xee, 0xc0, 0x9d, 0xfb, 0x03, 0xf9, 0xfd,
+	0x29, 0x02, 0xd7, 0xfd, 0x10, 0xfe, 0xf7, 0x04, 0x77, 0x01, 0xb0, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x64, 0x06, 0x27, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x2d, 0x40, 0x2a, 0x08, 0x01,
+	0x03, 0x01, 0x01, 0x4c, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04, 0x00, 0x04, 0x85, 0x02, 0x01,
+	0x00, 0x00, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x60, 0x00, 0x03, 0x03, 0x12, 0x03, 0x4e, 0x11,
+	0x31, 0x12, 0x11, 0x11, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x03,
+	0x21, 0x11, 0x13, 0x21, 0x01, 0x39, 0x01, 0x23, 0x13, 0x33, 0x03, 0x64, 0xfe, 0xde, 0xfe, 0xe0,
+	0x01, 0xfe, 0xdf, 0xc3, 0x02, 0xa1, 0xfe, 0xb4, 0xc0, 0x9d, 0xfa, 0x03, 0xf9, 0xfd, 0x29, 0x02,
+	0xd7, 0xfd, 0x10, 0xfe, 0xf7, 0x04, 0x77, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x64, 0x06, 0x26, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x2a, 0x40, 0x27, 0x08, 0x01,
+	0x03, 0x01, 0x01, 0x4c, 0x12, 0x11, 0x10, 0x0f, 0x0e, 0x0b, 0x06, 0x00, 0x4a, 0x02, 0x01, 0x00,
+	0x00, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x60, 0x00, 0x03, 0x03, 0x12, 0x03, 0x4e, 0x12, 0x11,
+	0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x03, 0x21, 0x11, 0x13,
+	0x21, 0x03, 0x39, 0x01, 0x35, 0x25, 0x05, 0x15, 0x25, 0x03, 0x64, 0xfe, 0xde, 0xfe, 0xe0, 0x01,
+	0xfe, 0xdf, 0xc3, 0x02, 0xa1, 0xa5, 0xfe, 0xf3, 0xfe, 0xf3, 0x01, 0x0d, 0x03, 0xf9, 0xfd, 0x29,
+	0x02, 0xd7, 0xfd, 0x10, 0xfe, 0xf7, 0x04, 0x74, 0xe7, 0xcb, 0xcb, 0xe7, 0xca, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x05, 0xa9, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x16,
+	0x00, 0x3e, 0x40, 0x3b, 0x08, 0x01, 0x03, 0x01, 0x01, 0x4c, 0x09, 0x07, 0x08, 0x03, 0x05, 0x05,
+	0x04, 0x5f, 0x06, 0x01, 0x04, 0x04, 0x11, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x01,
+	0x01, 0x03, 0x60, 0x00, 0x03, 0x03, 0x12, 0x03, 0x4e, 0x11, 0x11, 0x0b, 0x0b, 0x11, 0x16, 0x11,
+	0x16, 0x15, 0x14, 0x0b, 0x10, 0x0b, 0x10, 0x14, 0x12, 0x11, 0x11, 0x30, 0x0a, 0x07, 0x1b, 0x2b,
+	0x01, 0x39, 0x01, 0x21, 0x11, 0x21, 0x03, 0x21, 0x11, 0x13, 0x21, 0x03, 0x39, 0x01, 0x11, 0x23,
+	0x11, 0x23, 0x39, 0x01, 0x11, 0x23, 0x11, 0x03, 0x64, 0xfe, 0xde, 0xfe, 0xe0, 0x01, 0xfe, 0xdf,
+	0xc3, 0x02, 0xa1, 0x69, 0xfc, 0x9a, 0xfc, 0x03, 0xf9, 0xfd, 0x29, 0x02, 0xd7, 0xfd, 0x10, 0xfe,
+	0xf7, 0x04, 0x89, 0x01, 0x20, 0xfe, 0xe0, 0x01, 0x20, 0xfe, 0xe0, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0xfe, 0x50, 0x03, 0x64, 0x06, 0x27, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x39, 0x40, 0x36, 0x14, 0x01,
+	0x04, 0x02, 0x01, 0x4c, 0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x01, 0x06, 0x85, 0x03, 0x01,
+	0x01, 0x01, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x00, 0x04, 0x04, 0x12, 0x4d, 0x00, 0x05,
+	0x05, 0x00, 0x60, 0x00, 0x00, 0x00, 0x16, 0x00, 0x4e, 0x11, 0x31, 0x11, 0x12, 0x11, 0x13, 0x37,
+	0x30, 0x08, 0x07, 0x1e, 0x2b, 0x01, 0x39, 0x01, 0x21, 0x39, 0x01, 0x11, 0x23, 0x35, 0x33, 0x11,
+	0x23, 0x31, 0x21, 0x31, 0x23, 0x11, 0x21, 0x03, 0x21, 0x11, 0x13, 0x21, 0x15, 0x21, 0x01, 0x39,
+	0x01, 0x23, 0x13, 0x33, 0x01, 0x42, 0x02, 0x22, 0x01, 0x01, 0x01, 0xfe, 0xe1, 0x02, 0xfe, 0xe0,
+	0x01, 0xfe, 0xdf, 0xc3, 0x01, 0x7f, 0xfe, 0x29, 0x01, 0xa1, 0xc1, 0x9e, 0xfa, 0xfe, 0x50, 0x01,
+	0x51, 0x5f, 0x03, 0xf9, 0xfd, 0x29, 0x02, 0xd7, 0xfd, 0x10, 0xfe, 0xf7, 0x8e, 0x05, 0x05, 0x01,
+	0xb0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x06, 0x26, 0x00, 0x0a,
+	0x00, 0x10, 0x00, 0x2d, 0x40, 0x2a, 0x06, 0x01, 0x05, 0x02, 0x01, 0x4c, 0x00, 0x02, 0x00, 0x05,
+	0x04, 0x02, 0x05, 0x67, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x03, 0x03, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x31, 0x11, 0x12, 0x11, 0x30, 0x06, 0x07, 0x1c,
+	0x2b, 0x39, 0x02, 0x21, 0x11, 0x21, 0x11, 0x03, 0x21, 0x11, 0x21, 0x01, 0x39, 0x01, 0x21, 0x11,
+	0x21, 0x01, 0x22, 0x02, 0x42, 0xc4, 0xfe, 0x82, 0xfe, 0xde, 0x02, 0x42, 0xfe, 0xe0, 0x01, 0x20,
+	0x01, 0x5e, 0x02, 0x45, 0x01, 0x0b, 0x01, 0x78, 0xfc, 0x5a, 0x01, 0x0b, 0x00, 0x03, 0x00, 0x00,
+	0xfe, 0x50, 0x03, 0x64, 0x05, 0xa9, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x4a, 0x40, 0x47,
+	0x14, 0x01, 0x04, 0x02, 0x01, 0x4c, 0x0b, 0x09, 0x0a, 0x03, 0x07, 0x07, 0x06, 0x5f, 0x08, 0x01,
+	0x06, 0x06, 0x11, 0x4d, 0x03, 0x01, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x00,
+	0x04, 0x04, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x60, 0x00, 0x00, 0x00, 0x16, 0x00, 0x4e, 0x1f,
+	0x1f, 0x19, 0x19, 0x1f, 0x24, 0x1f, 0x24, 0x23, 0x22, 0x19, 0x1e, 0x19, 0x1e, 0x14, 0x11, 0x12,
+	0x11, 0x13, 0x37, 0x30, 0x0c, 0x07, 0x1d, 0x2b, 0x01, 0x39, 0x01, 0x21, 0x39, 0x01, 0x11, 0x23,
+	0x35, 0x33, 0x11, 0x23, 0x31, 0x21, 0x31, 0x23, 0x11, 0x21, 0x03, 0x21, 0x11, 0x13, 0x21, 0x15,
+	0x21, 0x01, 0x39, 0x01, 0x11, 0x23, 0x11, 0x23, 0x39, 0x01, 0x11, 0x23, 0x11, 0x01, 0x42, 0x02,
+	0x22, 0x01, 0x01, 0x01, 0xfe, 0xe1, 0x02, 0xfe, 0xe0, 0x01, 0xfe, 0xdf, 0xc3, 0x01, 0x7f, 0xfe,
+	0x29, 0x02, 0x90, 0xfc, 0x9a, 0xfc, 0xfe, 0x50, 0x01, 0x51, 0x5f, 0x03, 0xf9, 0xfd, 0x29, 0x02,
+	0xd7, 0xfd, 0x10, 0xfe, 0xf7, 0x8e, 0x05, 0x17, 0x01, 0x20, 0xfe, 0xe0, 0x01, 0x20, 0xfe, 0xe0,
+	0x00, 0x01, 0x00, 0x00, 0xff, 0xfd, 0x01, 0x22, 0x03, 0xf6, 0x00, 0x05, 0x00, 0x13, 0x40, 0x10,
+	0x00, 0x01, 0x01, 0x14, 0x4d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11, 0x30, 0x02, 0x07, 0x18,
+	0x2b, 0x15, 0x39, 0x01, 0x21, 0x11, 0x21, 0x01, 0x22, 0xfe, 0xde, 0x03, 0x03, 0xf9, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x04, 0x70, 0x02, 0x1a, 0x06, 0x22, 0x00, 0x07, 0x00, 0x06, 0xb3, 0x04,
+	0x00, 0x01, 0x32, 0x2b, 0x01, 0x39, 0x01, 0x35, 0x25, 0x05, 0x15, 0x25, 0x02, 0x1a, 0xfe, 0xf3,
+	0xfe, 0xf3, 0x01, 0x0d, 0x04, 0x70, 0xe8, 0xca, 0xca, 0xe8, 0xcb, 0x00, 0x00, 0x01, 0x00, 0x01,
+	0x04, 0x70, 0x02, 0x1a, 0x06, 0x22, 0x00, 0x07, 0x00, 0x06, 0xb3, 0x04, 0x00, 0x01, 0x32, 0x2b,
+	0x01, 0x39, 0x01, 0x15, 0x05, 0x25, 0x35, 0x05, 0x02, 0x1a, 0xfe, 0xf3, 0xfe, 0xf4, 0x01, 0x0c,
+	0x06, 0x22, 0xe7, 0xcb, 0xcb, 0xe7, 0xca, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x7c, 0x03, 0xfe,
+	0x06, 0x22, 0x00, 0x05, 0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01,
+	0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x05, 0x13, 0x03, 0x07, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x39, 0x01, 0x35,
+	0x21, 0x15, 0x03, 0xfe, 0xfc, 0x02, 0x05, 0x7c, 0xa6, 0xa6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x04, 0xce, 0x02, 0x9e, 0x06, 0x22, 0x00, 0x11, 0x00, 0x15, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0a,
+	0x01, 0x01, 0x00, 0x00, 0x76, 0x17, 0x17, 0x02, 0x07, 0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13,
+	0x39, 0x01, 0x16, 0x04, 0x37, 0x36, 0x37, 0x23, 0x06, 0x07, 0x06, 0x26, 0x27, 0x26, 0x27, 0x23,
+	0x16, 0x4a, 0x5c, 0x01, 0x0a, 0x71, 0x79, 0x04, 0x9b, 0x04, 0x3f, 0x3d, 0x8f, 0x31, 0x26, 0x02,
+	0x9b, 0x02, 0x05, 0x57, 0x6d, 0x1c, 0x56, 0x68, 0x96, 0x4f, 0x36, 0x2f, 0x10, 0x3a, 0x31, 0x39,
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x26, 0x01, 0x20, 0x06, 0x22, 0x00, 0x05,
+	0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01,
+	0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x11, 0x30, 0x02, 0x07, 0x18, 0x2b, 0xb1, 0x06,
+	0x00, 0x44, 0x11, 0x39, 0x01, 0x21, 0x35, 0x21, 0x01, 0x20, 0xfe, 0xe1, 0x05, 0x26, 0xfc, 0x00,
+	0x00, 0x02, 0x00, 0x01, 0x04, 0x70, 0x01, 0xc5, 0x06, 0x3a, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x2a,
+	0xb1, 0x06, 0x64, 0x44, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x67, 0x00, 0x02,
+	0x00, 0x00, 0x02, 0x57, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x11, 0x31,
+	0x11, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x39, 0x01, 0x21, 0x11, 0x21,
+	0x01, 0x39, 0x01, 0x23, 0x35, 0x33, 0x01, 0x01, 0xc4, 0xfe, 0x3c, 0x01, 0x3d, 0xb6, 0xb6, 0x04,
+	0x70, 0x01, 0xca, 0xfe, 0xbd, 0xbc, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xfe, 0x45, 0x02, 0x40,
+	0x00, 0xaf, 0x00, 0x11, 0x00, 0x06, 0xb3, 0x10, 0x06, 0x01, 0x32, 0x2b, 0x17, 0x39, 0x01, 0x06,
+	0x16, 0x17, 0x16, 0x37, 0x27, 0x06, 0x27, 0x2e, 0x01, 0x37, 0x36, 0x37, 0x27, 0x06, 0x0b, 0x0b,
+	0xa8, 0x8d, 0x9e, 0x6d, 0x6d, 0x3a, 0x54, 0x4c, 0x5a, 0x06, 0x08, 0x27, 0x6d, 0x4d, 0x23, 0x98,
+	0xdf, 0x14, 0x0d, 0x6f, 0x75, 0x39, 0x07, 0x0b, 0x78, 0x52, 0x41, 0x2d, 0x75, 0x55, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x04, 0x25, 0x03, 0x2d, 0x05, 0xa6, 0x00, 0x1b, 0x00, 0x39, 0xb1, 0x06,
+	0x64, 0x44, 0x40, 0x2e, 0x1b, 0x0e, 0x02, 0x02, 0x00, 0x01, 0x4c, 0x00, 0x01, 0x01, 0x4a, 0x0f,
+	0x01, 0x03, 0x49, 0x00, 0x00, 0x02, 0x03, 0x00, 0x59, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02,
+	0x69, 0x00, 0x00, 0x00, 0x03, 0x61, 0x00, 0x03, 0x00, 0x03, 0x51, 0x22, 0x27, 0x22, 0x25, 0x04,
+	0x07, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x39, 0x01, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27,
+	0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x17, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x33, 0x32,
+	0x37, 0x36, 0x37, 0x03, 0x29, 0x46, 0x37, 0x37, 0x33, 0x36, 0x73, 0x74, 0x3f, 0x35, 0x3a, 0x39,
+	0x3e, 0x04, 0x47, 0x36, 0x37, 0x32, 0x3a, 0x73, 0x74, 0x3b, 0x37, 0x3a, 0x39, 0x3d, 0x05, 0xa6,
+	0x52, 0x1c, 0x1b, 0x30, 0x31, 0x1a, 0x19, 0x48, 0xde, 0x52, 0x1c, 0x1b, 0x2f, 0x30, 0x19, 0x19,
+	0x47, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x74, 0x02, 0xf4, 0x06, 0x24, 0x00, 0x05,
+	0x00, 0x0b, 0x00, 0x25, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1a, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x57, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x01, 0x00, 0x4f, 0x11, 0x31, 0x11,
+	0x30, 0x04, 0x07, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x39, 0x01, 0x23, 0x13, 0x33, 0x13,
+	0x39, 0x01, 0x23, 0x13, 0x33, 0xc0, 0xc0, 0x9d, 0xfa, 0x86, 0xc1, 0x9e, 0xfa, 0x04, 0x74, 0x01,
+	0xb0, 0xfe, 0x50, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x74, 0x03, 0xfe,
+	0x03, 0x1a, 0x00, 0x05, 0x00, 0x1e, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
+	0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x13,
+	0x03, 0x07, 0x17, 0x2b, 0x01, 0x39, 0x01, 0x35, 0x21, 0x15, 0x03, 0xfe, 0xfc, 0x02, 0x02, 0x74,
+	0xa6, 0xa6, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x02, 0x6a, 0x06, 0x1d, 0x03, 0x10, 0x00, 0x05,
+	0x00, 0x1e, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02,
+	0x01, 0x01, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x13, 0x03, 0x07, 0x17, 0x2b,
+	0x01, 0x39, 0x01, 0x35, 0x21, 0x15, 0x06, 0x1d, 0xf9, 0xe2, 0x02, 0x6a, 0xa6, 0xa6, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x04, 0x98, 0x01, 0x21, 0x06, 0x22, 0x00, 0x07, 0x00, 0xa6, 0xb4, 0x05,
+	0x04, 0x02, 0x00, 0x4a, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x5f,
+	0x00, 0x00, 0x00, 0x11, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01,
+	0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
+	0x0b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x11, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x13,
+	0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x13, 0x01, 0x4e, 0x1b,
+	0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x11,
+	0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
+	0x00, 0x00, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01,
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x11, 0x01, 0x4e, 0x1b, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x00, 0x5f,
+	0x00, 0x00, 0x00, 0x13, 0x01, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xb4, 0x13, 0x30,
+	0x02, 0x07, 0x18, 0x2b, 0x01, 0x39, 0x01, 0x23, 0x35, 0x07, 0x15, 0x21, 0x01, 0x21, 0xa2, 0x7f,
+	0x01, 0x20, 0x05, 0x94, 0x8e, 0x8e, 0xfc, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x98, 0x01, 0x21,
+	0x06, 0x22, 0x00, 0x07, 0x00, 0x1d, 0x40, 0x1a, 0x05, 0x04, 0x02, 0x00, 0x49, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x13, 0x30, 0x02,
+	0x07, 0x18, 0x2b, 0x11, 0x39, 0x01, 0x33, 0x15, 0x37, 0x35, 0x21, 0xa2, 0x7f, 0xfe, 0xe0, 0x05,
+	0x26, 0x8e, 0x8e, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xff, 0x6e, 0x01, 0x1f, 0x00, 0xf9, 0x00, 0x07,
+	0x00, 0x18, 0x40, 0x15, 0x05, 0x04, 0x02, 0x00, 0x49, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
+	0x00, 0x12, 0x00, 0x4e, 0x13, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x07, 0x39, 0x01, 0x33, 0x15, 0x37,
+	0x35, 0x21, 0x01, 0xa2, 0x7e, 0xfe, 0xe1, 0x03, 0x8f, 0x8f, 0xfc, 0x00, 0x00, 0x02, 0xff, 0xff,
+	0x04, 0x98, 0x02, 0xb1, 0x06, 0x22, 0x00, 0x07, 0x00, 0x0f, 0x00, 0xba, 0xb6, 0x0d, 0x0c, 0x05,
+	0x04, 0x04, 0x00, 0x4a, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x00,
+	0x5f, 0x02, 0x01, 0x00, 0x00, 0x11, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x0d,
+	0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x00, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0,
+	0x0f, 0x50, 0x58, 0x40, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x00, 0x11,
+	0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5f,
+	0x02, 0x01, 0x00, 0x00, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x0d, 0x03,
+	0x01, 0x01, 0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x00, 0x11, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x17,
+	0x50, 0x58, 0x40, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x00, 0x13, 0x01,
+	0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x02,
+	0x01, 0x00, 0x00, 0x11, 0x01, 0x4e, 0x1b, 0x40, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x02,
+	0x01, 0x00, 0x00, 0x13, 0x01, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xb6, 0x13, 0x31,
+	0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x01, 0x39, 0x01, 0x23, 0x35, 0x07, 0x15, 0x21, 0x25, 0x39,
+	0x01, 0x23, 0x35, 0x07, 0x15, 0x21, 0x01, 0x20, 0xa2, 0x7f, 0x01, 0x20, 0x01, 0x92, 0xa2, 0x7e,
+	0x01, 0x20, 0x05, 0x94, 0x8e, 0x8e, 0xfc, 0xfc, 0x8e, 0x8e, 0xfc, 0x00, 0x00, 0x02, 0xff, 0xff,
+	0x04, 0x98, 0x02, 0xb1, 0x06, 0x22, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x24, 0x40, 0x21, 0x0d, 0x0c,
+	0x05, 0x04, 0x04, 0x00, 0x49, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x03, 0x01, 0x01, 0x01,
+	0x00, 0x5f, 0x02, 0x01, 0x00, 0x01, 0x00, 0x4f, 0x13, 0x31, 0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b,
+	0x01, 0x39, 0x01, 0x33, 0x15, 0x37, 0x35, 0x21, 0x05, 0x39, 0x01, 0x33, 0x15, 0x37, 0x35, 0x21,
+	0x01, 0x91, 0xa2, 0x7e, 0xfe, 0xe0, 0xfe, 0x6e, 0xa2, 0x7e, 0xfe, 0xe1, 0x05, 0x26, 0x8e, 0x8e,
+	0xfc, 0xfc, 0x8e, 0x8e, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0xff, 0x6e, 0x02, 0xb2,
+	0x00, 0xf9, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x1e, 0x40, 0x1b, 0x0d, 0x0c, 0x05, 0x04, 0x04, 0x00,
+	0x49, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x13, 0x31,
+	0x13, 0x30, 0x04, 0x07, 0x1a, 0x2b, 0x05, 0x39, 0x01, 0x33, 0x15, 0x37, 0x35, 0x21, 0x05, 0x39,
+	0x01, 0x33, 0x15, 0x37, 0x35, 0x21, 0x01, 0x92, 0xa2, 0x7e, 0xfe, 0xe1, 0xfe, 0x6e, 0xa2, 0x7e,
+	0xfe, 0xe0, 0x03, 0x8f, 0x8f, 0xfc, 0xfc, 0x8f, 0x8f, 0xfc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0xff, 0xc3, 0x03, 0xfc, 0x05, 0xa6, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x08, 0xb5, 0x12, 0x0f, 0x0a,
+	0x00, 0x02, 0x32, 0x2b, 0x01, 0x31, 0x27, 0x39, 0x01, 0x07, 0x27, 0x37, 0x17, 0x27, 0x37, 0x17,
+	0x07, 0x37, 0x17, 0x01, 0x31, 0x03, 0x37, 0x17, 0x02, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9,
+	0xa9, 0xa9, 0xa8, 0xfe, 0xff, 0xfe, 0x02, 0x8a, 0x8a, 0x8f, 0x03, 0x1d, 0x8b, 0x8b, 0x8b, 0x8c,
+	0x8c, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x8c, 0xfc, 0x1b, 0x02, 0xfc, 0xe9, 0xe9, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x03, 0x66, 0x05, 0xa6, 0x00, 0x0e, 0x00, 0x21, 0x00, 0x08,
+	0xb5, 0x20, 0x17, 0x0a, 0x00, 0x02, 0x32, 0x2b, 0x01, 0x31, 0x27, 0x15, 0x35, 0x07, 0x27, 0x37,
+	0x17, 0x27, 0x37, 0x17, 0x07, 0x37, 0x17, 0x01, 0x31, 0x37, 0x17, 0x07, 0x27, 0x15, 0x17, 0x07,
+	0x27, 0x37, 0x27, 0x07, 0x27, 0x37, 0x17, 0x27, 0x37, 0x17, 0x02, 0x8c, 0xd9, 0xda, 0xd9, 0xd9,
+	0xd9, 0x90, 0x91, 0x90, 0x90, 0xd9, 0xda, 0xfe, 0x50, 0xd6, 0xda, 0xda, 0xd8, 0x8f, 0x90, 0x91,
+	0x90, 0x01, 0xd8, 0xd9, 0xd9, 0xd7, 0x8e, 0x91, 0x90, 0x03, 0x41, 0x84, 0x01, 0x01, 0x84, 0x84,
+	0x84, 0x84, 0xf0, 0xf1, 0xf1, 0xf0, 0x84, 0x84, 0xfe, 0x23, 0x82, 0x84, 0x84, 0x83, 0x01, 0xef,
+	0xf1, 0xf1, 0xef, 0x01, 0x83, 0x84, 0x84, 0x82, 0xec, 0xf0, 0xf0, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0xa5, 0x02, 0x50, 0x03, 0xf5, 0x00, 0x0b, 0x00, 0x13, 0x40, 0x10, 0x00, 0x01, 0x01, 0x00,
+	0x61, 0x00, 0x00, 0x00, 0x14, 0x01, 0x4e, 0x24, 0x22, 0x02, 0x07, 0x18, 0x2b, 0x11, 0x34, 0x36,
+	0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0xae, 0x7b, 0x7a, 0xad, 0xaf, 0x7a, 0x7b,
+	0xac, 0x02, 0xce, 0x7b, 0xac, 0xad, 0x7a, 0x7a, 0xaf, 0xae, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01,
+	0xff, 0xfd, 0x05, 0x47, 0x00, 0xf9, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x1b, 0x40, 0x18,
+	0x05, 0x03, 0x02, 0x01, 0x01, 0x00, 0x5f, 0x04, 0x02, 0x02, 0x00, 0x00, 0x12, 0x00, 0x4e, 0x11,
+	0x31, 0x11, 0x31, 0x11, 0x30, 0x06, 0x07, 0x1c, 0x2b, 0x17, 0x39, 0x01, 0x21, 0x35, 0x21, 0x05,
+	0x39, 0x01, 0x21, 0x35, 0x21, 0x05, 0x39, 0x01, 0x21, 0x35, 0x21, 0x01, 0x01, 0x20, 0xfe, 0xe1,
+	0x02, 0x14, 0x01, 0x20, 0xfe, 0xe0, 0x02, 0x11, 0x01, 0x20, 0xfe, 0xe1, 0x03, 0xfc, 0xfc, 0xfc,
+	0xfc, 0xfc, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc5, 0x02, 0x80, 0x03, 0xd3, 0x00, 0x07,
+	0x00, 0x35, 0xb6, 0x07, 0x04, 0x02, 0x00, 0x01, 0x01, 0x4c, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40,
+	0x0b, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x00, 0x4e, 0x1b, 0x40, 0x10, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x59,
+	0xb4, 0x12, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x25, 0x39, 0x01, 0x21, 0x09, 0x01, 0x21, 0x01, 0x02,
+	0x80, 0xff, 0x00, 0xfe, 0x80, 0x01, 0x80, 0x01, 0x00, 0xfe, 0x80, 0xc5, 0x01, 0x87, 0x01, 0x87,
+	0xfe, 0x79, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc5, 0x02, 0x80, 0x03, 0xd3, 0x00, 0x07,
+	0x00, 0x35, 0xb6, 0x07, 0x04, 0x02, 0x00, 0x01, 0x01, 0x4c, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40,
+	0x0b, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x00, 0x4e, 0x1b, 0x40, 0x10, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x59,
+	0xb4, 0x12, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x35, 0x39, 0x01, 0x21, 0x09, 0x01, 0x21, 0x01, 0x01,
+	0x00, 0x01, 0x80, 0xfe, 0x80, 0xff, 0x00, 0x01, 0x80, 0xc5, 0x01, 0x87, 0x01, 0x87, 0xfe, 0x79,
+	0x00, 0x01, 0xff, 0x32, 0xfe, 0x50, 0x02, 0xdf, 0x06, 0x22, 0x00, 0x05, 0x00, 0x13, 0x40, 0x10,
+	0x00, 0x00, 0x01, 0x00, 0x85, 0x00, 0x01, 0x01, 0x16, 0x01, 0x4e, 0x11, 0x30, 0x02, 0x07, 0x18,
+	0x2b, 0x01, 0x39, 0x01, 0x23, 0x01, 0x33, 0x02, 0xdf, 0xa6, 0xfc, 0xf9, 0xa6, 0x06, 0x22, 0xf8,
+	0x2e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6c, 0x05, 0x9a, 0x00, 0x18,
+	0x00, 0xa9, 0xb6, 0x18, 0x15, 0x02, 0x01, 0x09, 0x01, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
+	0x29, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67,
+	0x08, 0x01, 0x04, 0x07, 0x01, 0x05, 0x06, 0x04, 0x05, 0x67, 0x00, 0x01, 0x01, 0x09, 0x5f, 0x00,
+	0x09, 0x09, 0x11, 0x4d, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58,
+	0x40, 0x29, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03,
+	0x67, 0x08, 0x01, 0x04, 0x07, 0x01, 0x05, 0x06, 0x04, 0x05, 0x67, 0x00, 0x01, 0x01, 0x09, 0x5f,
+	0x00, 0x09, 0x09, 0x13, 0x4d, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x1b, 0x40, 0x2a, 0x00, 0x00,
+	0x01, 0x02, 0x01, 0x00, 0x02, 0x80, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x08, 0x01,
+	0x04, 0x07, 0x01, 0x05, 0x06, 0x04, 0x05, 0x67, 0x00, 0x01, 0x01, 0x09, 0x5f, 0x00, 0x09, 0x09,
+	0x13, 0x4d, 0x00, 0x06, 0x06, 0x12, 0x06, 0x4e, 0x59, 0x59, 0x40, 0x0e, 0x17, 0x16, 0x11, 0x13,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x0a, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x35, 0x21,
+	0x11, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x31, 0x23, 0x11, 0x21, 0x35, 0x21,
+	0x11, 0x27, 0x21, 0x13, 0x04, 0x6c, 0xfe, 0xe3, 0xfe, 0xe3, 0x01, 0x21, 0xfe, 0xdf, 0x01, 0x29,
+	0xfe, 0xd7, 0xfe, 0xe4, 0x01, 0xfe, 0xeb, 0x01, 0x15, 0xaa, 0x03, 0x41, 0xc0, 0x03, 0xf9, 0x82,
+	0xfe, 0xe1, 0xfe, 0xe2, 0x92, 0xa4, 0xfe, 0xf8, 0x01, 0x08, 0xa4, 0x03, 0x09, 0xe5, 0xfe, 0xf9,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2a, 0x05, 0x9a, 0x00, 0x20, 0x00, 0xe5, 0x40, 0x0a,
+	0x20, 0x01, 0x01, 0x0e, 0x11, 0x01, 0x08, 0x06, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
+	0x38, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x07, 0x05, 0x06, 0x06, 0x07, 0x72, 0x0d,
+	0x01, 0x02, 0x0c, 0x01, 0x03, 0x04, 0x02, 0x03, 0x67, 0x0b, 0x01, 0x04, 0x0a, 0x01, 0x05, 0x07,
+	0x04, 0x05, 0x67, 0x00, 0x01, 0x01, 0x0e, 0x5f, 0x00, 0x0e, 0x0e, 0x11, 0x4d, 0x09, 0x01, 0x06,
+	0x06, 0x08, 0x60, 0x00, 0x08, 0x08, 0x12, 0x08, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40,
+	0x38, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x72, 0x00, 0x07, 0x05, 0x06, 0x06, 0x07, 0x72, 0x0d,
+	0x01, 0x02, 0x0c, 0x01, 0x03, 0x04, 0x02, 0x03, 0x67, 0x0b, 0x01, 0x04, 0x0a, 0x01, 0x05, 0x07,
+	0x04, 0x05, 0x67, 0x00, 0x01, 0x01, 0x0e, 0x5f, 0x00, 0x0e, 0x0e, 0x13, 0x4d, 0x09, 0x01, 0x06,
+	0x06, 0x08, 0x60, 0x00, 0x08, 0x08, 0x12, 0x08, 0x4e, 0x1b, 0x40, 0x3a, 0x00, 0x00, 0x01, 0x02,
+	0x01, 0x00, 0x02, 0x80, 0x00, 0x07, 0x05, 0x06, 0x05, 0x07, 0x06, 0x80, 0x0d, 0x01, 0x02, 0x0c,
+	0x01, 0x03, 0x04, 0x02, 0x03, 0x67, 0x0b, 0x01, 0x04, 0x0a, 0x01, 0x05, 0x07, 0x04, 0x05, 0x67,
+	0x00, 0x01, 0x01, 0x0e, 0x5f, 0x00, 0x0e, 0x0e, 0x13, 0x4d, 0x09, 0x01, 0x06, 0x06, 0x08, 0x60,
+	0x00, 0x08, 0x08, 0x12, 0x08, 0x4e, 0x59, 0x59, 0x40, 0x18, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a,
+	0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x0f,
+	0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x35, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23,
+	0x11, 0x21, 0x35, 0x21, 0x15, 0x03, 0x21, 0x11, 0x33, 0x11, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35,
+	0x33, 0x11, 0x21, 0x13, 0x04, 0x2a, 0xfe, 0xe3, 0xfe, 0xe3, 0xbd, 0xbd, 0xbd, 0xbd, 0x01, 0x1d,
+	0x01, 0x1d, 0xcc, 0xfc, 0xa2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0x02, 0x96, 0xc0, 0x03, 0xf9, 0x82,
+	0xba, 0x95, 0x72, 0x95, 0xfe, 0xfa, 0x82, 0x9a, 0xfe, 0xf9, 0x01, 0x1f, 0x01, 0x06, 0x95, 0x72,
+	0x95, 0x01, 0xd9, 0xfe, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x56, 0x00, 0x00, 0x09, 0x00,
+	0x05, 0x9a, 0x00, 0x0d, 0x00, 0x12, 0x00, 0x3f, 0x00, 0xac, 0x40, 0x15, 0x27, 0x0d, 0x03, 0x03,
+	0x03, 0x00, 0x04, 0x01, 0x04, 0x09, 0x3f, 0x3c, 0x02, 0x05, 0x04, 0x1e, 0x01, 0x02, 0x0b, 0x04,
+	0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x34, 0x0e, 0x01, 0x04, 0x00, 0x01, 0x0c, 0x04, 0x01,
+	0x67, 0x00, 0x06, 0x00, 0x0c, 0x0b, 0x06, 0x0c, 0x67, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x08, 0x01,
+	0x00, 0x00, 0x11, 0x4d, 0x0a, 0x01, 0x05, 0x05, 0x09, 0x5f, 0x0d, 0x01, 0x09, 0x09, 0x14, 0x4d,
+	0x00, 0x0b, 0x0b, 0x02, 0x60, 0x07, 0x01, 0x02, 0x02, 0x12, 0x02, 0x4e, 0x1b, 0x40, 0x34, 0x0e,
+	0x01, 0x04, 0x00, 0x01, 0x0c, 0x04, 0x01, 0x67, 0x00, 0x06, 0x00, 0x0c, 0x0b, 0x06, 0x0c, 0x67,
+	0x00, 0x03, 0x03, 0x00, 0x5f, 0x08, 0x01, 0x00, 0x00, 0x13, 0x4d, 0x0a, 0x01, 0x05, 0x05, 0x09,
+	0x5f, 0x0d, 0x01, 0x09, 0x09, 0x14, 0x4d, 0x00, 0x0b, 0x0b, 0x02, 0x60, 0x07, 0x01, 0x02, 0x02,
+	0x12, 0x02, 0x4e, 0x59, 0x40, 0x1f, 0x0e, 0x0e, 0x3e, 0x3d, 0x37, 0x36, 0x35, 0x30, 0x2f, 0x2e,
+	0x2d, 0x2c, 0x29, 0x28, 0x24, 0x1f, 0x19, 0x18, 0x17, 0x13, 0x0e, 0x12, 0x0e, 0x12, 0x16, 0x13,
+	0x13, 0x20, 0x0f, 0x07, 0x1a, 0x2b, 0x03, 0x31, 0x21, 0x13, 0x11, 0x03, 0x21, 0x15, 0x23, 0x11,
+	0x21, 0x39, 0x01, 0x11, 0x01, 0x31, 0x11, 0x21, 0x11, 0x05, 0x31, 0x21, 0x31, 0x23, 0x15, 0x21,
+	0x15, 0x31, 0x15, 0x31, 0x15, 0x03, 0x21, 0x23, 0x21, 0x31, 0x21, 0x39, 0x01, 0x11, 0x27, 0x21,
+	0x11, 0x31, 0x15, 0x33, 0x11, 0x23, 0x11, 0x21, 0x17, 0x33, 0x31, 0x33, 0x35, 0x21, 0x35, 0x31,
+	0x35, 0x31, 0x35, 0x13, 0x21, 0x13, 0xaa, 0x03, 0x42, 0xc0, 0xc3, 0xfe, 0x89, 0x01, 0xfe, 0xe4,
+	0x02, 0x3a, 0xfe, 0xe3, 0x07, 0xe2, 0xfe, 0xe3, 0xc8, 0x01, 0xe5, 0xc0, 0xfe, 0x7e, 0x01, 0xfe,
+	0x0d, 0xfe, 0xe3, 0xab, 0x01, 0xc8, 0xe3, 0xe3, 0x01, 0xc6, 0x01, 0xd9, 0x79, 0xfe, 0x1b, 0xc0,
+	0x01, 0x82, 0xc0, 0x05, 0x9a, 0xfe, 0xf9, 0xfe, 0xce, 0xfe, 0xdd, 0x5c, 0xfe, 0x1e, 0x04, 0xb5,
+	0xfe, 0xa7, 0x01, 0x1f, 0xfe, 0xe1, 0x8a, 0x5b, 0x57, 0xc0, 0x5b, 0xfe, 0xfb, 0x04, 0xb5, 0xe5,
+	0xfe, 0xe7, 0x92, 0xfe, 0xe1, 0xfe, 0x4f, 0x02, 0x50, 0x62, 0xc0, 0x5b, 0x01, 0x05, 0xfe, 0xfb,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9a, 0x05, 0x9a, 0x00, 0x1a, 0x00, 0x7e, 0x40, 0x0a,
+	0x0e, 0x01, 0x07, 0x06, 0x05, 0x01, 0x01, 0x00, 0x02, 0x4c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
+	0x29, 0x08, 0x01, 0x05, 0x09, 0x01, 0x04, 0x03, 0x05, 0x04, 0x67, 0x0a, 0x01, 0x03, 0x0b, 0x01,
+	0x02, 0x00, 0x03, 0x02, 0x67, 0x00, 0x07, 0x07, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x11, 0x4d, 0x00,
+	0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x12, 0x01, 0x4e, 0x1b, 0x40, 0x29, 0x08, 0x01, 0x05,
+	0x09, 0x01, 0x04, 0x03, 0x05, 0x04, 0x67, 0x0a, 0x01, 0x03, 0x0b, 0x01, 0x02, 0x00, 0x03, 0x02,
+	0x67, 0x00, 0x07, 0x07, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f,
+	0x00, 0x01, 0x01, 0x12, 0x01, 0x4e, 0x59, 0x40, 0x12, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x11,
+	0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x20, 0x0c, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x21, 0x11,
+	0x21, 0x25, 0x11, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x11, 0x25, 0x21, 0x11, 0x21, 0x15,
+	0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x01, 0xdc, 0x01, 0xbe, 0xfe, 0x2a, 0xfe, 0xfb, 0xbf,
+	0xbf, 0xbf, 0xbf, 0x01, 0x05, 0x01, 0xd6, 0xfe, 0x42, 0xd1, 0xd1, 0xd1, 0xd1, 0x01, 0x1f, 0xfe,
+	0xe1, 0xcd, 0x01, 0x58, 0x95, 0x72, 0x95, 0x01, 0x0c, 0xcd, 0xfe, 0xe1, 0xba, 0x95, 0x72, 0x95,
+	0x00, 0x04, 0xff, 0x56, 0x00, 0x00, 0x07, 0x72, 0x05, 0x9a, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x22,
+	0x00, 0x28, 0x00, 0x66, 0x40, 0x63, 0x17, 0x09, 0x02, 0x03, 0x07, 0x02, 0x0f, 0x06, 0x02, 0x06,
+	0x07, 0x1a, 0x01, 0x04, 0x06, 0x05, 0x01, 0x08, 0x04, 0x04, 0x4c, 0x00, 0x05, 0x02, 0x05, 0x85,
+	0x0a, 0x03, 0x02, 0x02, 0x07, 0x02, 0x85, 0x0b, 0x01, 0x09, 0x08, 0x00, 0x08, 0x09, 0x00, 0x80,
+	0x01, 0x01, 0x00, 0x00, 0x84, 0x00, 0x07, 0x00, 0x06, 0x04, 0x07, 0x06, 0x67, 0x00, 0x04, 0x08,
+	0x08, 0x04, 0x57, 0x00, 0x04, 0x04, 0x08, 0x5f, 0x00, 0x08, 0x04, 0x08, 0x4f, 0x23, 0x23, 0x00,
+	0x00, 0x23, 0x28, 0x23, 0x28, 0x27, 0x26, 0x20, 0x1f, 0x1e, 0x1b, 0x19, 0x18, 0x16, 0x13, 0x00,
+	0x12, 0x00, 0x12, 0x22, 0x13, 0x13, 0x0c, 0x06, 0x19, 0x2b, 0x01, 0x31, 0x13, 0x11, 0x21, 0x11,
+	0x01, 0x11, 0x21, 0x11, 0x27, 0x33, 0x21, 0x33, 0x17, 0x01, 0x11, 0x31, 0x11, 0x01, 0x39, 0x01,
+	0x21, 0x11, 0x03, 0x21, 0x11, 0x25, 0x39, 0x01, 0x21, 0x11, 0x21, 0x15, 0x31, 0x01, 0x39, 0x01,
+	0x35, 0x21, 0x15, 0x02, 0xe3, 0xc1, 0xfe, 0xe3, 0xfe, 0x97, 0xfe, 0xe3, 0xab, 0x02, 0x01, 0x5a,
+	0x08, 0x2b, 0x01, 0xa2, 0x02, 0x55, 0x02, 0x96, 0xc0, 0xfd, 0x6a, 0x02, 0x39, 0xfe, 0xe4, 0x01,
+	0x1c, 0x01, 0x1b, 0xfc, 0xc3, 0x05, 0x9a, 0xfe, 0xf9, 0xfb, 0x6d, 0x01, 0x9c, 0x01, 0xc4, 0xfc,
+	0xa0, 0x04, 0xb4, 0xe6, 0x41, 0xfd, 0xf4, 0x01, 0x2e, 0x01, 0x1f, 0xfc, 0x11, 0x02, 0xe8, 0x01,
+	0x07, 0xfd, 0x18, 0x18, 0x01, 0xb1, 0x73, 0xfc, 0x82, 0xa4, 0xa4, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x02, 0xe1, 0x04, 0xb8, 0x05, 0x9a, 0x00, 0x13, 0x00, 0x25, 0x00, 0x3f, 0x40, 0x3c, 0x13, 0x0a,
+	0x09, 0x03, 0x04, 0x02, 0x10, 0x06, 0x05, 0x04, 0x04, 0x00, 0x04, 0x02, 0x4c, 0x07, 0x03, 0x01,
+	0x03, 0x00, 0x04, 0x00, 0x86, 0x05, 0x01, 0x02, 0x04, 0x04, 0x02, 0x57, 0x05, 0x01, 0x02, 0x02,
+	0x04, 0x5f, 0x06, 0x01, 0x04, 0x02, 0x04, 0x4f, 0x17, 0x14, 0x23, 0x22, 0x21, 0x20, 0x1f, 0x1c,
+	0x14, 0x25, 0x17, 0x24, 0x19, 0x14, 0x30, 0x08, 0x06, 0x19, 0x2b, 0x01, 0x39, 0x01, 0x33, 0x11,
+	0x17, 0x37, 0x11, 0x33, 0x11, 0x27, 0x35, 0x39, 0x01, 0x07, 0x31, 0x07, 0x03, 0x23, 0x17, 0x01,
+	0x39, 0x01, 0x33, 0x35, 0x31, 0x35, 0x31, 0x11, 0x33, 0x31, 0x33, 0x27, 0x21, 0x17, 0x33, 0x11,
+	0x31, 0x02, 0x54, 0x8a, 0xac, 0xa3, 0x8b, 0x54, 0x5e, 0x7a, 0xde, 0xad, 0x53, 0xfe, 0x84, 0x8a,
+	0x20, 0x9f, 0x67, 0xfe, 0x46, 0x64, 0x74, 0x02, 0xe1, 0x01, 0x8f, 0xe5, 0xd5, 0xfe, 0x81, 0x02,
+	0x39, 0x72, 0x01, 0x7e, 0xa6, 0x01, 0x31, 0x70, 0xfd, 0xb7, 0xed, 0x1d, 0x01, 0x24, 0x8b, 0x8b,
+	0xfd, 0xd2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x33, 0x03, 0xee, 0x02, 0xd8, 0x00, 0x05,
+	0x00, 0x1e, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02,
+	0x01, 0x01, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x13, 0x03, 0x06, 0x17, 0x2b,
+	0x01, 0x39, 0x01, 0x35, 0x21, 0x15, 0x03, 0xee, 0xfc, 0x13, 0x02, 0x33, 0xa5, 0xa5, 0x00, 0x00,
+	0x00, 0x02, 0xff, 0xff, 0x01, 0x05, 0x03, 0x1f, 0x03, 0xef, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x4f,
+	0x40, 0x4c, 0x1b, 0x0e, 0x02, 0x02, 0x00, 0x1c, 0x0f, 0x02, 0x05, 0x03, 0x37, 0x2a, 0x02, 0x06,
+	0x04, 0x03, 0x4c, 0x00, 0x01, 0x01, 0x4a, 0x2b, 0x01, 0x07, 0x49, 0x00, 0x01, 0x00, 0x02, 0x03,
+	0x01, 0x02, 0x69, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x03, 0x69, 0x00, 0x04, 0x06, 0x07, 0x04,
+	0x59, 0x00, 0x05, 0x00, 0x06, 0x07, 0x05, 0x06, 0x69, 0x00, 0x04, 0x04, 0x07, 0x61, 0x00, 0x07,
+	0x04, 0x07, 0x51, 0x22, 0x27, 0x22, 0x29, 0x22, 0x27, 0x22, 0x25, 0x08, 0x06, 0x1e, 0x2b, 0x01,
+	0x39, 0x01, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x17, 0x36,
+	0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x07, 0x39, 0x01, 0x06, 0x07,
+	0x06, 0x23, 0x22, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x17, 0x36, 0x37, 0x36, 0x33, 0x32,
+	0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x03, 0x1b, 0x45, 0x36, 0x36, 0x32, 0x35, 0x72, 0x72,
+	0x3d, 0x35, 0x39, 0x38, 0x3d, 0x04, 0x45, 0x36, 0x36, 0x31, 0x39, 0x72, 0x72, 0x39, 0x37, 0x39,
+	0x38, 0x3c, 0x04, 0x45, 0x36, 0x36, 0x32, 0x35, 0x72, 0x72, 0x3d, 0x35, 0x39, 0x38, 0x3d, 0x04,
+	0x45, 0x36, 0x36, 0x31, 0x39, 0x72, 0x72, 0x39, 0x37, 0x39, 0x38, 0x3c, 0x03, 0xef, 0x52, 0x1b,
+	0x1b, 0x30, 0x30, 0x19, 0x19, 0x47, 0xdc, 0x52, 0x1b, 0x1b, 0x2f, 0x2f, 0x18, 0x19, 0x46, 0x91,
+	0x51, 0x1b, 0x1c, 0x30, 0x30, 0x19, 0x19, 0x47, 0xdc, 0x52, 0x1b, 0x1b, 0x2f, 0x2f, 0x19, 0x18,
+	0x46, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x03, 0xef, 0x00, 0x07,
+	0x00, 0x0d, 0x00, 0x2a, 0x40, 0x27, 0x07, 0x04, 0x02, 0x00, 0x01, 0x01, 0x4c, 0x00, 0x01, 0x00,
+	0x01, 0x85, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00, 0x02, 0x03, 0x02, 0x85, 0x04, 0x01, 0x03, 0x03,
+	0x76, 0x08, 0x08, 0x08, 0x0d, 0x08, 0x0d, 0x15, 0x12, 0x30, 0x05, 0x06, 0x19, 0x2b, 0x25, 0x39,
+	0x01, 0x23, 0x09, 0x01, 0x33, 0x09, 0x01, 0x39, 0x01, 0x35, 0x21, 0x15, 0x02, 0xc3, 0xfb, 0xfe,
+	0x86, 0x01, 0x7a, 0xfb, 0xfe, 0x86, 0x01, 0xc8, 0xfc, 0xef, 0xe9, 0x01, 0x83, 0x01, 0x83, 0xfe,
+	0x7d, 0xfd, 0x94, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12,
+	0x03, 0xef, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x2a, 0x40, 0x27, 0x07, 0x04, 0x02, 0x00, 0x01, 0x01,
+	0x4c, 0x00, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00, 0x02, 0x03, 0x02, 0x85,
+	0x04, 0x01, 0x03, 0x03, 0x76, 0x08, 0x08, 0x08, 0x0d, 0x08, 0x0d, 0x15, 0x12, 0x30, 0x05, 0x06,
+	0x19, 0x2b, 0x37, 0x39, 0x01, 0x33, 0x09, 0x01, 0x23, 0x09, 0x01, 0x39, 0x01, 0x35, 0x21, 0x15,
+	0x4e, 0xfc, 0x01, 0x7a, 0xfe, 0x86, 0xfc, 0x01, 0x7a, 0xfe, 0x38, 0x03, 0x12, 0xe9, 0x01, 0x83,
+	0x01, 0x83, 0xfe, 0x7d, 0xfd, 0x94, 0xa4, 0xa4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0xe1, 0xed, 0x62, 0x76, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xd8, 0x7e, 0x5e, 0x10, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x7e, 0xbd, 0x15, 0xfe, 0x2c, 0xfe, 0x45,
+	0x09, 0x00, 0x07, 0xcb, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x07, 0xcb, 0xfe, 0x45, 0x00, 0x00, 0x09, 0x84, 0xfe, 0x2c, 0xfe, 0xb1,
+	0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xe6, 0x04, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00,
+	0x01, 0xfc, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x91, 0x03, 0x81, 0x00, 0x84, 0x05, 0x38, 0x00, 0x77,
+	0x03, 0x6f, 0x00, 0x00, 0x05, 0x59, 0x00, 0x00, 0x04, 0x2e, 0x00, 0x00, 0x02, 0x53, 0x00, 0xae,
+	0x02, 0x4f, 0x00, 0x00, 0x02, 0x4f, 0x00, 0x00, 0x02, 0xc1, 0x00, 0x00, 0x04, 0x7b, 0x00, 0x00,
+	0x01, 0xa1, 0x00, 0x00, 0x04, 0x75, 0x00, 0x00, 0x01, 0xa1, 0x00, 0x00, 0x03, 0x4b, 0x00, 0x00,
+	0x03, 0xe3, 0xff, 0x56, 0x03, 0x18, 0xff, 0x56, 0x03, 0xfe, 0xff, 0x56, 0x04, 0x04, 0xff, 0x56,
+	0x03, 0xe3, 0xff, 0x56, 0x03, 0xe3, 0xff, 0x56, 0x03, 0xe3, 0xff, 0x56, 0x03, 0xfe, 0xff, 0x56,
+	0x04, 0x04, 0xff, 0x56, 0x04, 0x01, 0xff, 0x56, 0x01, 0xa1, 0x00, 0x00, 0x01, 0xa1, 0x00, 0x00,
+	0x02, 0xfe, 0x00, 0x00, 0x03, 0x79, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x00,
+	0x06, 0x04, 0x00, 0x00, 0x03, 0xdc, 0xff, 0x56, 0x03, 0xdc, 0xff, 0x56, 0x03, 0xdc, 0xff, 0x56,
+	0x03, 0xdc, 0xff, 0x56, 0x03, 0xdc, 0xff, 0x56, 0x03, 0xdc, 0xff, 0x56, 0x03, 0xdc, 0xff, 0x56,
+	0x03, 0xdc, 0xff, 0x56, 0x01, 0xf3, 0xff, 0x56, 0x03, 0xdb, 0x00, 0x00, 0x03, 0xdb, 0xff, 0x56,
+	0x03, 0xdc, 0xff, 0x56, 0x05, 0x71, 0xff, 0x56, 0x04, 0x32, 0xff, 0x56, 0x03, 0xe6, 0xff, 0x56,
+	0x03, 0xe6, 0xff, 0x56, 0x03, 0xe6, 0xff, 0x56, 0x03, 0xe6, 0xff, 0x56, 0x03, 0xe6, 0xff, 0x56,
+	0x04, 0x47, 0xff, 0x56, 0x03, 0xe6, 0xff, 0x56, 0x03, 0xe6, 0xff, 0x56, 0x06, 0x26, 0xff, 0x56,
+	0x03, 0xe6, 0xff, 0x56, 0x03, 0xe6, 0xff, 0x56, 0x04, 0x0c, 0xff, 0x56, 0x02, 0x20, 0x00, 0x00,
+	0x03, 0x42, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x02, 0x63, 0x00, 0x00, 0x04, 0x75, 0x00, 0x00,
+	0x01, 0xef, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xdc, 0xff, 0x56, 0x03, 0xe2, 0x00, 0x00,
+	0x03, 0xda, 0x00, 0x00, 0x03, 0xe3, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00,
+	0x03, 0xdc, 0xff, 0x56, 0x01, 0xa1, 0x00, 0x00, 0x01, 0x9f, 0xfe, 0x2c, 0x03, 0xdc, 0xff, 0x56,
+	0x01, 0xa2, 0xff, 0x56, 0x06, 0x21, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00,
+	0x03, 0xe2, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00,
+	0x03, 0x69, 0xff, 0x56, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xe4, 0x00, 0x00, 0x06, 0x24, 0x00, 0x00,
+	0x03, 0xe4, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x03, 0x1f, 0x00, 0x00,
+	0x01, 0x28, 0x00, 0x00, 0x03, 0x1f, 0x00, 0x00, 0x03, 0xc1, 0x00, 0x00, 0x01, 0xed, 0x00, 0x00,
+	0x03, 0xe0, 0x00, 0x00, 0x04, 0xb5, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x00,
+	0x01, 0x29, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00,
+	0x02, 0x53, 0x00, 0x00, 0x03, 0xd9, 0x00, 0x00, 0x04, 0xf3, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00,
+	0x04, 0x71, 0x00, 0x00, 0x02, 0x9f, 0x00, 0x00, 0x03, 0xa5, 0x00, 0x00, 0x02, 0x16, 0x00, 0x00,
+	0x02, 0x18, 0x00, 0x00, 0x02, 0x15, 0x00, 0x00, 0x03, 0xd9, 0x00, 0x00, 0x03, 0x69, 0x00, 0x00,
+	0x01, 0xa0, 0x00, 0x00, 0x01, 0xd5, 0x00, 0x00, 0x01, 0xbe, 0x00, 0x00, 0x01, 0xd1, 0xff, 0xc5,
+	0x03, 0xd9, 0x00, 0x00, 0x05, 0x22, 0x00, 0x00, 0x05, 0x4a, 0x00, 0x00, 0x05, 0x62, 0x00, 0x00,
+	0x03, 0xdb, 0x00, 0x00, 0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56,
+	0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56, 0x06, 0x1c, 0xff, 0x56,
+	0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56,
+	0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56, 0x01, 0xa3, 0xff, 0x56,
+	0x02, 0x60, 0xff, 0x56, 0x01, 0xf3, 0xff, 0x56, 0x02, 0x27, 0xff, 0x1a, 0x04, 0x86, 0xff, 0xf9,
+	0x04, 0x2b, 0xff, 0x56, 0x03, 0xdf, 0xff, 0x56, 0x03, 0xdf, 0xff, 0x56, 0x03, 0xdf, 0xff, 0x56,
+	0x03, 0xdf, 0xff, 0x56, 0x03, 0xdf, 0xff, 0x56, 0x03, 0xc1, 0x00, 0x00, 0x04, 0x7a, 0xff, 0x59,
+	0x03, 0xe0, 0xff, 0x56, 0x03, 0xe0, 0xff, 0x56, 0x03, 0xe1, 0xff, 0x56, 0x03, 0xe1, 0xff, 0x56,
+	0x03, 0xe0, 0xff, 0x56, 0x04, 0x19, 0xff, 0x56, 0x04, 0xc6, 0xff, 0x56, 0x03, 0xe7, 0x00, 0x00,
+	0x03, 0xe7, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00,
+	0x03, 0xe7, 0x00, 0x00, 0x06, 0x26, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00,
+	0x03, 0xe7, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x00,
+	0x03, 0xe7, 0x00, 0x00, 0x01, 0xa5, 0xff, 0x65, 0x01, 0x87, 0x00, 0x00, 0x02, 0x9b, 0x00, 0x02,
+	0x03, 0x10, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x00,
+	0x03, 0xe1, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x00, 0x03, 0xe1, 0x00, 0x00,
+	0x04, 0x79, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+	0x03, 0xe8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00,
+	0x03, 0xe8, 0x00, 0x00, 0x01, 0xa6, 0x00, 0x00, 0x02, 0x9e, 0x00, 0x00, 0x02, 0x9e, 0x00, 0x00,
+	0x04, 0x82, 0x00, 0x00, 0x03, 0x21, 0x00, 0x00, 0x01, 0xa4, 0x00, 0x00, 0x02, 0x48, 0x00, 0x00,
+	0x02, 0xc4, 0x00, 0x00, 0x03, 0xb1, 0x00, 0x00, 0x03, 0x78, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00,
+	0x06, 0xa1, 0x00, 0x00, 0x01, 0xa4, 0x00, 0x00, 0x01, 0xa4, 0x00, 0x00, 0x01, 0xa4, 0x00, 0x00,
+	0x03, 0x35, 0x00, 0x00, 0x03, 0x35, 0x00, 0x00, 0x03, 0x36, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00,
+	0x03, 0xea, 0x00, 0x00, 0x02, 0xd4, 0x00, 0x00, 0x05, 0xcb, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00,
+	0x03, 0x04, 0x00, 0x00, 0x01, 0x90, 0xff, 0x32, 0x04, 0xf0, 0x00, 0x00, 0x04, 0xae, 0x00, 0x00,
+	0x09, 0x84, 0xff, 0x56, 0x04, 0x1e, 0x00, 0x00, 0x07, 0xf6, 0xff, 0x56, 0x05, 0x3c, 0x00, 0x00,
+	0x04, 0x72, 0x00, 0x00, 0x03, 0xa3, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0xb2, 0x00, 0xe8, 0x01, 0x48,
+	0x01, 0xb4, 0x02, 0x12, 0x02, 0x86, 0x02, 0xae, 0x02, 0xd6, 0x03, 0x00, 0x03, 0x56, 0x03, 0x82,
+	0x03, 0x9e, 0x03, 0xbc, 0x03, 0xd4, 0x03, 0xea, 0x04, 0x2e, 0x04, 0x6e, 0x04, 0xd8, 0x05, 0x76,
+	0x05, 0xb8, 0x06, 0x30, 0x06, 0x8a, 0x06, 0xe4, 0x07, 0x68, 0x07, 0xc2, 0x07, 0xe4, 0x08, 0x0e,
+	0x08, 0x32, 0x08, 0x60, 0x08, 0x82, 0x08, 0xfe, 0x09, 0x6a, 0x09, 0xdc, 0x0a, 0x60, 0x0a, 0xfe,
+	0x0b, 0x66, 0x0c, 0x1c, 0x0c, 0xa8, 0x0d, 0x4a, 0x0d, 0xb4, 0x0d, 0xf2, 0x0e, 0x7a, 0x0e, 0xe4,
+	0x0f, 0x5e, 0x0f, 0xb4, 0x0f, 0xfa, 0x10, 0x2e, 0x10, 0x6e, 0x10, 0xca, 0x11, 0x16, 0x11, 0x84,
+	0x11, 0xb2, 0x11, 0xe2, 0x12, 0x0c, 0x12, 0x54, 0x12, 0xac, 0x12, 0xe4, 0x13, 0x38, 0x13, 0x82,
+	0x13, 0xba, 0x14, 0x04, 0x14, 0x18, 0x14, 0x3a, 0x14, 0x58, 0x14, 0x8a, 0x14, 0xdc, 0x15, 0x04,
+	0x15, 0x56, 0x15, 0x8a, 0x15, 0xb8, 0x15, 0xf8, 0x16, 0x3a, 0x16, 0x78, 0x16, 0xbe, 0x17, 0x0c,
+	0x17, 0x36, 0x17, 0x66, 0x17, 0x8c, 0x17, 0xbc, 0x17, 0xf4, 0x18, 0x2e, 0x18, 0x68, 0x18, 0xaa,
+	0x19, 0x14, 0x19, 0x3c, 0x19, 0x60, 0x19, 0x9c, 0x19, 0xd4, 0x1a, 0x10, 0x1a, 0x3c, 0x1a, 0x7a,
+	0x1a, 0x94, 0x1a, 0xd2, 0x1b, 0x10, 0x1b, 0x38, 0x1b, 0x8a, 0x1b, 0xf8, 0x1c, 0x40, 0x1c, 0x90,
+	0x1c, 0xb6, 0x1e, 0x18, 0x1e, 0x48, 0x1e, 0xca, 0x1e, 0xfa, 0x1f, 0x30, 0x1f, 0x50, 0x1f, 0xc0,
+	0x1f, 0xe2, 0x20, 0x0e, 0x20, 0x48, 0x20, 0x9a, 0x21, 0x06, 0x21, 0x24, 0x21, 0x8e, 0x21, 0xfe,
+	0x22, 0x18, 0x22, 0xa8, 0x22, 0xd4, 0x23, 0x06, 0x23, 0x3c, 0x23, 0x9e, 0x24, 0x30, 0x24, 0xe0,
+	0x25, 0x46, 0x25, 0xd6, 0x26, 0x4c, 0x26, 0xbe, 0x27, 0x6e, 0x28, 0x14, 0x28, 0xa6, 0x29, 0x5e,
+	0x2a, 0x80, 0x2b, 0x28, 0x2b, 0xc2, 0x2c, 0x7c, 0x2d, 0x30, 0x2d, 0xda, 0x2e, 0xa8, 0x2e, 0xf0,
+	0x2f, 0x4c, 0x2f, 0x90, 0x2f, 0xec, 0x30, 0x64, 0x30, 0xfc, 0x31, 0x64, 0x31, 0xe4, 0x32, 0x48,
+	0x32, 0xe2, 0x33, 0x5e, 0x33, 0x82, 0x33, 0xde, 0x34, 0x40, 0x34, 0xa4, 0x35, 0x00, 0x35, 0x74,
+	0x35, 0xde, 0x36, 0x3c, 0x36, 0xd2, 0x37, 0x12, 0x37, 0x6a, 0x37, 0xae, 0x38, 0xde, 0x39, 0x2e,
+	0x39, 0x7c, 0x39, 0xca, 0x3a, 0x98, 0x3a, 0xe4, 0x3b, 0x1e, 0x3b, 0x5e, 0x3b, 0xb4, 0x3b, 0xf6,
+	0x3c, 0x64, 0x3c, 0x88, 0x3c, 0xbc, 0x3c, 0xe4, 0x3d, 0x1a, 0x3d, 0x68, 0x3e, 0x1e, 0x3e, 0x5c,
+	0x3e, 0xb0, 0x3e, 0xf2, 0x3f, 0xba, 0x40, 0x08, 0x40, 0x42, 0x40, 0x92, 0x40, 0xc8, 0x41, 0x00,
+	0x41, 0x3a, 0x41, 0x80, 0x41, 0xcc, 0x42, 0x00, 0x42, 0x5a, 0x42, 0x72, 0x42, 0x88, 0x42, 0x9e,
+	0x42, 0xc0, 0x42, 0xec, 0x43, 0x0a, 0x43, 0x36, 0x43, 0x5a, 0x43, 0xa4, 0x43, 0xce, 0x43, 0xec,
+	0x44, 0x0a, 0x44, 0x6e, 0x44, 0x8c, 0x44, 0xa8, 0x45, 0x20, 0x45, 0x4e, 0x45, 0x78, 0x45, 0xa2,
+	0x45, 0xe0, 0x46, 0x00, 0x46, 0x2c, 0x46, 0x5c, 0x46, 0x8a, 0x46, 0xa4, 0x47, 0x22, 0x47, 0xc6,
+	0x48, 0x72, 0x48, 0xda, 0x49, 0x50, 0x49, 0xa4, 0x49, 0xc2, 0x4a, 0x3c, 0x4a, 0x6e, 0x4a, 0x9e,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x22, 0x00, 0x4b, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x83, 0x0e, 0x15, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x7e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x6a,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x12, 0x00, 0x6a, 0x00, 0x03,
+	0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x7c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+	0x00, 0x03, 0x00, 0x2c, 0x00, 0x8a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x12,
+	0x00, 0xb6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x78, 0x00, 0xc8, 0x00, 0x03,
+	0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x10, 0x01, 0x40, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+	0x00, 0x07, 0x00, 0x18, 0x01, 0x50, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x18,
+	0x01, 0x68, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0a, 0x00, 0x80, 0x01, 0x80, 0x00, 0x42,
+	0x00, 0x69, 0x00, 0x67, 0x00, 0x20, 0x00, 0x53, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65,
+	0x00, 0x20, 0x00, 0xa9, 0x00, 0x20, 0x00, 0x28, 0x00, 0x4e, 0x00, 0x75, 0x00, 0x72, 0x00, 0x66,
+	0x00, 0x20, 0x00, 0x44, 0x00, 0x65, 0x00, 0x73, 0x00, 0x69, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x73,
+	0x00, 0x29, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39, 0x00, 0x2e,
+	0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x52, 0x00, 0x69, 0x00, 0x67,
+	0x00, 0x68, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65,
+	0x00, 0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64, 0x00, 0x42, 0x00, 0x69, 0x00, 0x67, 0x00, 0x20,
+	0x00, 0x53, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67,
+	0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x42, 0x00, 0x69, 0x00, 0x67, 0x00, 0x20,
+	0x00, 0x53, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x3a, 0x00, 0x56, 0x00, 0x65,
+	0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e,
+	0x00, 0x30, 0x00, 0x30, 0x00, 0x42, 0x00, 0x69, 0x00, 0x67, 0x00, 0x20, 0x00, 0x53, 0x00, 0x70,
+	0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69,
+	0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3b,
+	0x00, 0x46, 0x00, 0x65, 0x00, 0x62, 0x00, 0x72, 0x00, 0x75, 0x00, 0x61, 0x00, 0x72, 0x00, 0x79,
+	0x00, 0x20, 0x00, 0x35, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39,
+	0x00, 0x3b, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x43, 0x00, 0x72, 0x00, 0x65,
+	0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x31, 0x00, 0x31, 0x00, 0x2e,
+	0x00, 0x35, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x32, 0x00, 0x34, 0x00, 0x32, 0x00, 0x37,
+	0x00, 0x20, 0x00, 0x36, 0x00, 0x34, 0x00, 0x2d, 0x00, 0x62, 0x00, 0x69, 0x00, 0x74, 0x00, 0x42,
+	0x00, 0x69, 0x00, 0x67, 0x00, 0x53, 0x00, 0x70, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x4e,
+	0x00, 0x75, 0x00, 0x72, 0x00, 0x66, 0x00, 0x20, 0x00, 0x44, 0x00, 0x65, 0x00, 0x73, 0x00, 0x69,
+	0x00, 0x67, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x4e, 0x00, 0x75, 0x00, 0x72, 0x00, 0x66, 0x00, 0x20,
+	0x00, 0x44, 0x00, 0x65, 0x00, 0x73, 0x00, 0x69, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x54,
+	0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74,
+	0x00, 0x20, 0x00, 0x77, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x63, 0x00, 0x72, 0x00, 0x65,
+	0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x73, 0x00, 0x69,
+	0x00, 0x6e, 0x00, 0x67, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x43,
+	0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x31,
+	0x00, 0x31, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x20, 0x00, 0x66, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6d,
+	0x00, 0x20, 0x00, 0x48, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x2d, 0x00, 0x4c, 0x00, 0x6f,
+	0x00, 0x67, 0x00, 0x69, 0x00, 0x63, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x27, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xe7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+	0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e,
+	0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
+	0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e,
+	0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26,
+	0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e,
+	0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
+	0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e,
+	0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46,
+	0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e,
+	0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
+	0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e,
+	0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0xa3, 0x00, 0x84, 0x00, 0x85, 0x00, 0xbd, 0x00, 0x96,
+	0x00, 0xe8, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x8b, 0x00, 0x9d, 0x00, 0xa9, 0x00, 0xa4, 0x00, 0x8a,
+	0x00, 0xda, 0x00, 0x83, 0x00, 0x93, 0x01, 0x02, 0x01, 0x03, 0x00, 0x8d, 0x00, 0x97, 0x00, 0x88,
+	0x00, 0xc3, 0x00, 0xde, 0x01, 0x04, 0x00, 0x9e, 0x00, 0xaa, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf6,
+	0x00, 0xa2, 0x00, 0xad, 0x00, 0xc9, 0x00, 0xc7, 0x00, 0xae, 0x00, 0x62, 0x00, 0x63, 0x00, 0x90,
+	0x00, 0x64, 0x00, 0xfd, 0x00, 0xff, 0x00, 0xcb, 0x00, 0x65, 0x00, 0xc8, 0x00, 0xca, 0x00, 0xcf,
+	0x00, 0xcc, 0x00, 0xcd, 0x00, 0xce, 0x00, 0xe9, 0x00, 0x66, 0x00, 0xd3, 0x00, 0xd0, 0x00, 0xd1,
+	0x00, 0xaf, 0x00, 0x67, 0x00, 0xf0, 0x00, 0x91, 0x00, 0xd6, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0x68,
+	0x00, 0xeb, 0x00, 0xed, 0x00, 0x89, 0x00, 0x6a, 0x00, 0x69, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0x6c,
+	0x00, 0x6e, 0x00, 0xa0, 0x00, 0x6f, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x71, 0x00, 0x70, 0x00, 0x72,
+	0x00, 0x73, 0x00, 0x75, 0x00, 0x74, 0x00, 0x76, 0x00, 0x77, 0x00, 0xea, 0x00, 0x78, 0x00, 0x7a,
+	0x00, 0x79, 0x00, 0x7b, 0x00, 0x7d, 0x00, 0x7c, 0x00, 0xb8, 0x00, 0xa1, 0x00, 0x7f, 0x00, 0x7e,
+	0x00, 0x80, 0x00, 0x81, 0x00, 0xec, 0x00, 0xee, 0x00, 0xba, 0x00, 0xd7, 0x00, 0xd8, 0x00, 0xe1,
+	0x01, 0x05, 0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0xe0, 0x00, 0xd9, 0x00, 0xdf, 0x00, 0xb2,
+	0x00, 0xb3, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xc5, 0x00, 0x82,
+	0x00, 0xc2, 0x00, 0x87, 0x00, 0xab, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xbc, 0x00, 0xf7, 0x01, 0x06,
+	0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x00, 0x8c, 0x00, 0xef, 0x00, 0xa7, 0x00, 0x94, 0x00, 0x95,
+	0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x33,
+	0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x39,
+	0x04, 0x6c, 0x69, 0x72, 0x61, 0x06, 0x70, 0x65, 0x73, 0x65, 0x74, 0x61, 0x04, 0x45, 0x75, 0x72,
+	0x6f, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+	0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20,
+	0x01, 0x20, 0x01, 0x21, 0x01, 0x21, 0x05, 0x9b, 0x00, 0x00, 0x05, 0x9a, 0x03, 0xf8, 0x00, 0x00,
+	0xfe, 0x51, 0x05, 0x9b, 0x00, 0x00, 0x05, 0x9a, 0x03, 0xf8, 0x00, 0x00, 0xfe, 0x51, 0x00, 0x32,
+	0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x05, 0x98, 0x03, 0x76, 0x05, 0x98, 0x03, 0x76, 0x00, 0x00,
+	0xb0, 0x00, 0x2c, 0x20, 0xb0, 0x00, 0x55, 0x58, 0x45, 0x59, 0x20, 0x20, 0x4b, 0xb8, 0x00, 0x0e,
+	0x51, 0x4b, 0xb0, 0x06, 0x53, 0x5a, 0x58, 0xb0, 0x34, 0x1b, 0xb0, 0x28, 0x59, 0x60, 0x66, 0x20,
+	0x8a, 0x55, 0x58, 0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x62,
+	0x1b, 0x21, 0x21, 0xb0, 0x00, 0x59, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00, 0x43,
+	0x60, 0x42, 0x2d, 0xb0, 0x01, 0x2c, 0xb0, 0x20, 0x60, 0x66, 0x2d, 0xb0, 0x02, 0x2c, 0x23, 0x21,
+	0x23, 0x21, 0x2d, 0xb0, 0x03, 0x2c, 0x20, 0x64, 0xb3, 0x03, 0x14, 0x15, 0x00, 0x42, 0x43, 0xb0,
+	0x13, 0x43, 0x20, 0x60, 0x60, 0x42, 0xb1, 0x02, 0x14, 0x43, 0x42, 0xb1, 0x25, 0x03, 0x43, 0xb0,
+	0x02, 0x43, 0x54, 0x78, 0x20, 0xb0, 0x0c, 0x23, 0xb0, 0x02, 0x43, 0x43, 0x61, 0x64, 0xb0, 0x04,
+	0x50, 0x78, 0xb2, 0x02, 0x02, 0x02, 0x43, 0x60, 0x42, 0xb0, 0x21, 0x65, 0x1c, 0x21, 0xb0, 0x02,
+	0x43, 0x43, 0xb2, 0x0e, 0x15, 0x01, 0x42, 0x1c, 0x20, 0xb0, 0x02, 0x43, 0x23, 0x42, 0xb2, 0x13,
+	0x01, 0x13, 0x43, 0x60, 0x42, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb2, 0x16, 0x01, 0x02,
+	0x43, 0x60, 0x42, 0x2d, 0xb0, 0x04, 0x2c, 0xb0, 0x03, 0x2b, 0xb0, 0x15, 0x43, 0x58, 0x23, 0x21,
+	0x23, 0x21, 0xb0, 0x16, 0x43, 0x43, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x1b, 0x20, 0x64,
+	0x20, 0xb0, 0xc0, 0x50, 0xb0, 0x04, 0x26, 0x5a, 0xb2, 0x28, 0x01, 0x0d, 0x43, 0x45, 0x63, 0x45,
+	0xb0, 0x06, 0x45, 0x58, 0x21, 0xb0, 0x03, 0x25, 0x59, 0x52, 0x5b, 0x58, 0x21, 0x23, 0x21, 0x1b,
+	0x8a, 0x58, 0x20, 0xb0, 0x50, 0x50, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b, 0x20, 0xb0, 0x38, 0x50,
+	0x58, 0x21, 0xb0, 0x38, 0x59, 0x59, 0x20, 0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63, 0x45, 0x61, 0x64,
+	0xb0, 0x28, 0x50, 0x58, 0x21, 0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63, 0x45, 0x20, 0xb0, 0x30, 0x50,
+	0x58, 0x21, 0xb0, 0x30, 0x59, 0x1b, 0x20, 0xb0, 0xc0, 0x50, 0x58, 0x20, 0x66, 0x20, 0x8a, 0x8a,
+	0x61, 0x20, 0xb0, 0x0a, 0x50, 0x58, 0x60, 0x1b, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x0a,
+	0x60, 0x1b, 0x20, 0xb0, 0x36, 0x50, 0x58, 0x21, 0xb0, 0x36, 0x60, 0x1b, 0x60, 0x59, 0x59, 0x59,
+	0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x0c, 0x43, 0x63, 0xb0, 0x00, 0x52, 0x58, 0xb0, 0x00, 0x4b, 0xb0,
+	0x0a, 0x50, 0x58, 0x21, 0xb0, 0x0c, 0x43, 0x1b, 0x4b, 0xb0, 0x1e, 0x50, 0x58, 0x21, 0xb0, 0x1e,
+	0x4b, 0x61, 0xb8, 0x10, 0x00, 0x63, 0xb0, 0x0c, 0x43, 0x63, 0xb8, 0x05, 0x00, 0x62, 0x59, 0x59,
+	0x64, 0x61, 0x59, 0xb0, 0x01, 0x2b, 0x59, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x59,
+	0x20, 0x64, 0xb0, 0x16, 0x43, 0x23, 0x42, 0x59, 0x2d, 0xb0, 0x05, 0x2c, 0x20, 0x45, 0x20, 0xb0,
+	0x04, 0x25, 0x61, 0x64, 0x20, 0xb0, 0x07, 0x43, 0x50, 0x58, 0xb0, 0x07, 0x23, 0x42, 0xb0, 0x08,
+	0x23, 0x42, 0x1b, 0x21, 0x21, 0x59, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x06, 0x2c, 0x23, 0x21, 0x23,
+	0x21, 0xb0, 0x03, 0x2b, 0x20, 0x64, 0xb1, 0x07, 0x62, 0x42, 0x20, 0xb0, 0x08, 0x23, 0x42, 0xb0,
+	0x06, 0x45, 0x58, 0x1b, 0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63, 0xb1, 0x01, 0x0d, 0x43, 0xb0, 0x02,
+	0x60, 0x45, 0x63, 0xb0, 0x05, 0x2a, 0x21, 0x20, 0xb0, 0x08, 0x43, 0x20, 0x8a, 0x20, 0x8a, 0xb0,
+	0x01, 0x2b, 0xb1, 0x30, 0x05, 0x25, 0xb0, 0x04, 0x26, 0x51, 0x58, 0x60, 0x50, 0x1b, 0x61, 0x52,
+	0x59, 0x58, 0x23, 0x59, 0x21, 0x59, 0x20, 0xb0, 0x40, 0x53, 0x58, 0xb0, 0x01, 0x2b, 0x1b, 0x21,
+	0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x2d, 0xb0, 0x07, 0x2c, 0xb0, 0x09,
+	0x43, 0x2b, 0xb2, 0x00, 0x02, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x08, 0x2c, 0xb0, 0x09, 0x23,
+	0x42, 0x23, 0x20, 0xb0, 0x00, 0x23, 0x42, 0x61, 0xb0, 0x02, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0,
+	0x01, 0x60, 0xb0, 0x07, 0x2a, 0x2d, 0xb0, 0x09, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x0e, 0x43,
+	0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
+	0x01, 0x63, 0x60, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0a, 0x2c, 0xb2, 0x09, 0x0e, 0x00, 0x43,
+	0x45, 0x42, 0x2a, 0x21, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x0b, 0x2c, 0xb0,
+	0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x0c, 0x2c, 0x20,
+	0x20, 0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25, 0x60, 0x20, 0x45,
+	0x8a, 0x23, 0x61, 0x20, 0x64, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x00, 0x1b, 0xb0, 0x30,
+	0x50, 0x58, 0xb0, 0x20, 0x1b, 0xb0, 0x40, 0x59, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59,
+	0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0d, 0x2c, 0x20, 0x20,
+	0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25, 0x60, 0x20, 0x45, 0x8a,
+	0x23, 0x61, 0x20, 0x64, 0xb0, 0x24, 0x50, 0x58, 0xb0, 0x00, 0x1b, 0xb0, 0x40, 0x59, 0x23, 0xb0,
+	0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d,
+	0xb0, 0x0e, 0x2c, 0x20, 0xb0, 0x00, 0x23, 0x42, 0xb3, 0x0d, 0x0c, 0x00, 0x03, 0x45, 0x50, 0x58,
+	0x21, 0x1b, 0x23, 0x21, 0x59, 0x2a, 0x21, 0x2d, 0xb0, 0x0f, 0x2c, 0xb1, 0x02, 0x02, 0x45, 0xb0,
+	0x64, 0x61, 0x44, 0x2d, 0xb0, 0x10, 0x2c, 0xb0, 0x01, 0x60, 0x20, 0x20, 0xb0, 0x0f, 0x43, 0x4a,
+	0xb0, 0x00, 0x50, 0x58, 0x20, 0xb0, 0x0f, 0x23, 0x42, 0x59, 0xb0, 0x10, 0x43, 0x4a, 0xb0, 0x00,
+	0x52, 0x58, 0x20, 0xb0, 0x10, 0x23, 0x42, 0x59, 0x2d, 0xb0, 0x11, 0x2c, 0x20, 0xb0, 0x10, 0x62,
+	0x66, 0xb0, 0x01, 0x63, 0x20, 0xb8, 0x04, 0x00, 0x63, 0x8a, 0x23, 0x61, 0xb0, 0x11, 0x43, 0x60,
+	0x20, 0x8a, 0x60, 0x20, 0xb0, 0x11, 0x23, 0x42, 0x23, 0x2d, 0xb0, 0x12, 0x2c, 0x4b, 0x54, 0x58,
+	0xb1, 0x04, 0x64, 0x44, 0x59, 0x24, 0xb0, 0x0d, 0x65, 0x23, 0x78, 0x2d, 0xb0, 0x13, 0x2c, 0x4b,
+	0x51, 0x58, 0x4b, 0x53, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x1b, 0x21, 0x59, 0x24, 0xb0, 0x13,
+	0x65, 0x23, 0x78, 0x2d, 0xb0, 0x14, 0x2c, 0xb1, 0x00, 0x12, 0x43, 0x55, 0x58, 0xb1, 0x12, 0x12,
+	0x43, 0xb0, 0x01, 0x61, 0x42, 0xb0, 0x11, 0x2b, 0x59, 0xb0, 0x00, 0x43, 0xb0, 0x02, 0x25, 0x42,
+	0xb1, 0x0f, 0x02, 0x25, 0x42, 0xb1, 0x10, 0x02, 0x25, 0x42, 0xb0, 0x01, 0x16, 0x23, 0x20, 0xb0,
+	0x03, 0x25, 0x50, 0x58, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x04, 0x25, 0x42, 0x8a, 0x8a, 0x20,
+	0x8a, 0x23, 0x61, 0xb0, 0x10, 0x2a, 0x21, 0x23, 0xb0, 0x01, 0x61, 0x20, 0x8a, 0x23, 0x61, 0xb0,
+	0x10, 0x2a, 0x21, 0x1b, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x02, 0x25, 0x42, 0xb0, 0x02, 0x25,
+	0x61, 0xb0, 0x10, 0x2a, 0x21, 0x59, 0xb0, 0x0f, 0x43, 0x47, 0xb0, 0x10, 0x43, 0x47, 0x60, 0xb0,
+	0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x20,
+	0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
+	0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb1, 0x00, 0x00, 0x13, 0x23, 0x44, 0xb0, 0x01, 0x43, 0xb0,
+	0x00, 0x3e, 0xb2, 0x01, 0x01, 0x01, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x15, 0x2c, 0x00, 0xb1, 0x00,
+	0x02, 0x45, 0x54, 0x58, 0xb0, 0x12, 0x23, 0x42, 0x20, 0x45, 0xb0, 0x0e, 0x23, 0x42, 0xb0, 0x0d,
+	0x23, 0xb0, 0x02, 0x60, 0x42, 0x20, 0xb0, 0x14, 0x23, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb7,
+	0x18, 0x18, 0x01, 0x00, 0x11, 0x00, 0x13, 0x00, 0x42, 0x42, 0x42, 0x8a, 0x60, 0x20, 0xb0, 0x14,
+	0x43, 0x60, 0xb0, 0x14, 0x23, 0x42, 0xb1, 0x14, 0x08, 0x2b, 0xb0, 0x8b, 0x2b, 0x1b, 0x22, 0x59,
+	0x2d, 0xb0, 0x16, 0x2c, 0xb1, 0x00, 0x15, 0x2b, 0x2d, 0xb0, 0x17, 0x2c, 0xb1, 0x01, 0x15, 0x2b,
+	0x2d, 0xb0, 0x18, 0x2c, 0xb1, 0x02, 0x15, 0x2b, 0x2d, 0xb0, 0x19, 0x2c, 0xb1, 0x03, 0x15, 0x2b,
+	0x2d, 0xb0, 0x1a, 0x2c, 0xb1, 0x04, 0x15, 0x2b, 0x2d, 0xb0, 0x1b, 0x2c, 0xb1, 0x05, 0x15, 0x2b,
+	0x2d, 0xb0, 0x1c, 0x2c, 0xb1, 0x06, 0x15, 0x2b, 0x2d, 0xb0, 0x1d, 0x2c, 0xb1, 0x07, 0x15, 0x2b,
+	0x2d, 0xb0, 0x1e, 0x2c, 0xb1, 0x08, 0x15, 0x2b, 0x2d, 0xb0, 0x1f, 0x2c, 0xb1, 0x09, 0x15, 0x2b,
+	0x2d, 0xb0, 0x2b, 0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x06, 0x60,
+	0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e, 0xb0, 0x01, 0x5d, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x2c,
+	0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x16, 0x60, 0x4b, 0x54, 0x58,
+	0x23, 0x20, 0x2e, 0xb0, 0x01, 0x71, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x2d, 0x2c, 0x23, 0x20,
+	0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x26, 0x60, 0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e,
+	0xb0, 0x01, 0x72, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x20, 0x2c, 0x00, 0xb0, 0x0f, 0x2b, 0xb1,
+	0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x12, 0x23, 0x42, 0x20, 0x45, 0xb0, 0x0e, 0x23, 0x42, 0xb0,
+	0x0d, 0x23, 0xb0, 0x02, 0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5, 0x18, 0x18, 0x01, 0x00,
+	0x11, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x14, 0x08, 0x2b, 0xb0, 0x8b, 0x2b, 0x1b, 0x22, 0x59,
+	0x2d, 0xb0, 0x21, 0x2c, 0xb1, 0x00, 0x20, 0x2b, 0x2d, 0xb0, 0x22, 0x2c, 0xb1, 0x01, 0x20, 0x2b,
+	0x2d, 0xb0, 0x23, 0x2c, 0xb1, 0x02, 0x20, 0x2b, 0x2d, 0xb0, 0x24, 0x2c, 0xb1, 0x03, 0x20, 0x2b,
+	0x2d, 0xb0, 0x25, 0x2c, 0xb1, 0x04, 0x20, 0x2b, 0x2d, 0xb0, 0x26, 0x2c, 0xb1, 0x05, 0x20, 0x2b,
+	0x2d, 0xb0, 0x27, 0x2c, 0xb1, 0x06, 0x20, 0x2b, 0x2d, 0xb0, 0x28, 0x2c, 0xb1, 0x07, 0x20, 0x2b,
+	0x2d, 0xb0, 0x29, 0x2c, 0xb1, 0x08, 0x20, 0x2b, 0x2d, 0xb0, 0x2a, 0x2c, 0xb1, 0x09, 0x20, 0x2b,
+	0x2d, 0xb0, 0x2e, 0x2c, 0x20, 0x3c, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x2f, 0x2c, 0x20, 0x60, 0xb0,
+	0x18, 0x60, 0x20, 0x43, 0x23, 0xb0, 0x01, 0x60, 0x43, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x01, 0x60,
+	0xb0, 0x2e, 0x2a, 0x21, 0x2d, 0xb0, 0x30, 0x2c, 0xb0, 0x2f, 0x2b, 0xb0, 0x2f, 0x2a, 0x2d, 0xb0,
+	0x31, 0x2c, 0x20, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20,
+	0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x61, 0x38,
+	0x23, 0x20, 0x8a, 0x55, 0x58, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00,
+	0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23,
+	0x61, 0x38, 0x1b, 0x21, 0x59, 0x2d, 0xb0, 0x32, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58,
+	0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x16, 0xb0, 0x31, 0x2a, 0xb1, 0x05, 0x01, 0x15, 0x45,
+	0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x33, 0x2c, 0x00, 0xb0, 0x0f, 0x2b, 0xb1, 0x00,
+	0x02, 0x45, 0x54, 0x58, 0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x16, 0xb0, 0x31, 0x2a, 0xb1,
+	0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x34, 0x2c, 0x20, 0x35,
+	0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x35, 0x2c, 0x00, 0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x45,
+	0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
+	0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00,
+	0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x00, 0x16,
+	0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x3e, 0x23, 0x38, 0xb1, 0x34, 0x01, 0x15, 0x2a, 0x21,
+	0x2d, 0xb0, 0x36, 0x2c, 0x20, 0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00,
+	0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0,
+	0x00, 0x43, 0x61, 0x38, 0x2d, 0xb0, 0x37, 0x2c, 0x2e, 0x17, 0x3c, 0x2d, 0xb0, 0x38, 0x2c, 0x20,
+	0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50,
+	0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0xb0, 0x01,
+	0x43, 0x63, 0x38, 0x2d, 0xb0, 0x39, 0x2c, 0xb1, 0x02, 0x00, 0x16, 0x25, 0x20, 0x2e, 0x20, 0x47,
+	0xb0, 0x00, 0x23, 0x42, 0xb0, 0x02, 0x25, 0x49, 0x8a, 0x8a, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20,
+	0x58, 0x62, 0x1b, 0x21, 0x59, 0xb0, 0x01, 0x23, 0x42, 0xb2, 0x38, 0x01, 0x01, 0x15, 0x14, 0x2a,
+	0x2d, 0xb0, 0x3a, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0xb0, 0x04, 0x25, 0xb0, 0x04,
+	0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b, 0x43, 0x2b, 0x65, 0x8a,
+	0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d, 0xb0, 0x3b, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17,
+	0x23, 0x42, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20,
+	0xb0, 0x06, 0x23, 0x42, 0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b, 0x43, 0x2b, 0x20, 0xb0, 0x60, 0x50,
+	0x58, 0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x04, 0x20, 0x05, 0x20, 0x1b, 0xb3, 0x04, 0x26, 0x05,
+	0x1a, 0x59, 0x42, 0x42, 0x23, 0x20, 0xb0, 0x0a, 0x43, 0x20, 0x8a, 0x23, 0x47, 0x23, 0x47, 0x23,
+	0x61, 0x23, 0x46, 0x60, 0xb0, 0x06, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0,
+	0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b, 0x20, 0x8a, 0x8a, 0x61,
+	0x20, 0xb0, 0x04, 0x43, 0x60, 0x64, 0x23, 0xb0, 0x05, 0x43, 0x61, 0x64, 0x50, 0x58, 0xb0, 0x04,
+	0x43, 0x61, 0x1b, 0xb0, 0x05, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0,
+	0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x61, 0x23, 0x20, 0x20, 0xb0,
+	0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x1b, 0x23, 0xb0, 0x0a, 0x43, 0x46, 0xb0, 0x02, 0x25, 0xb0,
+	0x0a, 0x43, 0x47, 0x23, 0x47, 0x23, 0x61, 0x60, 0x20, 0xb0, 0x06, 0x43, 0xb0, 0x02, 0x62, 0x20,
+	0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x20, 0xb0,
+	0x01, 0x2b, 0x23, 0xb0, 0x06, 0x43, 0x60, 0xb0, 0x01, 0x2b, 0xb0, 0x05, 0x25, 0x61, 0xb0, 0x05,
+	0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
+	0x63, 0xb0, 0x04, 0x26, 0x61, 0x20, 0xb0, 0x04, 0x25, 0x60, 0x64, 0x23, 0xb0, 0x03, 0x25, 0x60,
+	0x64, 0x50, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46,
+	0x61, 0x38, 0x59, 0x2d, 0xb0, 0x3c, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0x20, 0x20,
+	0x20, 0xb0, 0x05, 0x26, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x23, 0x3c, 0x38, 0x2d, 0xb0,
+	0x3d, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0x20, 0xb0, 0x0a, 0x23, 0x42, 0x20, 0x20,
+	0x20, 0x46, 0x23, 0x47, 0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x2d, 0xb0, 0x3e, 0x2c, 0xb0, 0x00,
+	0x16, 0xb0, 0x17, 0x23, 0x42, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61,
+	0xb0, 0x00, 0x54, 0x58, 0x2e, 0x20, 0x3c, 0x23, 0x21, 0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25,
+	0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25, 0x47, 0x23, 0x47, 0x23,
+	0x61, 0xb0, 0x06, 0x25, 0xb0, 0x05, 0x25, 0x49, 0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08,
+	0x00, 0x63, 0x63, 0x23, 0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20,
+	0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x2e, 0x23,
+	0x20, 0x20, 0x3c, 0x8a, 0x38, 0x23, 0x21, 0x59, 0x2d, 0xb0, 0x3f, 0x2c, 0xb0, 0x00, 0x16, 0xb0,
+	0x17, 0x23, 0x42, 0x20, 0xb0, 0x0a, 0x43, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0x60,
+	0xb0, 0x20, 0x60, 0x66, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
+	0x66, 0xb0, 0x01, 0x63, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d, 0xb0, 0x40, 0x2c, 0x23, 0x20,
+	0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20,
+	0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x41, 0x2c, 0x23, 0x20, 0x2e, 0x46,
+	0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x52, 0x1b, 0x50, 0x59, 0x58, 0x20, 0x3c, 0x59,
+	0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x42, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
+	0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x23, 0x20,
+	0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x52, 0x1b, 0x50, 0x59, 0x58, 0x20,
+	0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x43, 0x2c, 0xb0, 0x3a, 0x2b, 0x23,
+	0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58,
+	0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x44, 0x2c, 0xb0, 0x3b, 0x2b,
+	0x8a, 0x20, 0x20, 0x3c, 0xb0, 0x06, 0x23, 0x42, 0x8a, 0x38, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
+	0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1,
+	0x30, 0x01, 0x14, 0x2b, 0xb0, 0x06, 0x43, 0x2e, 0xb0, 0x30, 0x2b, 0x2d, 0xb0, 0x45, 0x2c, 0xb0,
+	0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x20, 0x20, 0x20, 0x46, 0x23, 0x47, 0x61, 0xb0,
+	0x0c, 0x23, 0x42, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x0b, 0x43, 0x2b, 0x23, 0x20, 0x3c,
+	0x20, 0x2e, 0x23, 0x38, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x46, 0x2c, 0xb1, 0x0a, 0x04,
+	0x25, 0x42, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47,
+	0x23, 0x61, 0x20, 0xb0, 0x06, 0x23, 0x42, 0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b, 0x43, 0x2b, 0x20,
+	0xb0, 0x60, 0x50, 0x58, 0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x04, 0x20, 0x05, 0x20, 0x1b, 0xb3,
+	0x04, 0x26, 0x05, 0x1a, 0x59, 0x42, 0x42, 0x23, 0x20, 0x47, 0xb0, 0x06, 0x43, 0xb0, 0x02, 0x62,
+	0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0,
+	0x01, 0x2b, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x04, 0x43, 0x60, 0x64, 0x23, 0xb0, 0x05, 0x43,
+	0x61, 0x64, 0x50, 0x58, 0xb0, 0x04, 0x43, 0x61, 0x1b, 0xb0, 0x05, 0x43, 0x60, 0x59, 0xb0, 0x03,
+	0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
+	0x63, 0x61, 0xb0, 0x02, 0x25, 0x46, 0x61, 0x38, 0x23, 0x20, 0x3c, 0x23, 0x38, 0x1b, 0x21, 0x20,
+	0x20, 0x46, 0x23, 0x47, 0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x21, 0x59, 0xb1, 0x30, 0x01, 0x14,
+	0x2b, 0x2d, 0xb0, 0x47, 0x2c, 0xb1, 0x00, 0x3a, 0x2b, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d,
+	0xb0, 0x48, 0x2c, 0xb1, 0x00, 0x3b, 0x2b, 0x21, 0x23, 0x20, 0x20, 0x3c, 0xb0, 0x06, 0x23, 0x42,
+	0x23, 0x38, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0xb0, 0x06, 0x43, 0x2e, 0xb0, 0x30, 0x2b, 0x2d, 0xb0,
+	0x49, 0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15,
+	0x14, 0x13, 0x2e, 0xb0, 0x36, 0x2a, 0x2d, 0xb0, 0x4a, 0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0,
+	0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0, 0x36, 0x2a, 0x2d, 0xb0,
+	0x4b, 0x2c, 0xb1, 0x00, 0x01, 0x14, 0x13, 0xb0, 0x37, 0x2a, 0x2d, 0xb0, 0x4c, 0x2c, 0xb0, 0x39,
+	0x2a, 0x2d, 0xb0, 0x4d, 0x2c, 0xb0, 0x00, 0x16, 0x45, 0x23, 0x20, 0x2e, 0x20, 0x46, 0x8a, 0x23,
+	0x61, 0x38, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x4e, 0x2c, 0xb0, 0x0a, 0x23, 0x42, 0xb0,
+	0x4d, 0x2b, 0x2d, 0xb0, 0x4f, 0x2c, 0xb2, 0x00, 0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x50, 0x2c, 0xb2,
+	0x00, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x51, 0x2c, 0xb2, 0x01, 0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x52,
+	0x2c, 0xb2, 0x01, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x53, 0x2c, 0xb2, 0x00, 0x00, 0x47, 0x2b, 0x2d,
+	0xb0, 0x54, 0x2c, 0xb2, 0x00, 0x01, 0x47, 0x2b, 0x2d, 0xb0, 0x55, 0x2c, 0xb2, 0x01, 0x00, 0x47,
+	0x2b, 0x2d, 0xb0, 0x56, 0x2c, 0xb2, 0x01, 0x01, 0x47, 0x2b, 0x2d, 0xb0, 0x57, 0x2c, 0xb3, 0x00,
+	0x00, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x58, 0x2c, 0xb3, 0x00, 0x01, 0x00, 0x43, 0x2b, 0x2d, 0xb0,
+	0x59, 0x2c, 0xb3, 0x01, 0x00, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x5a, 0x2c, 0xb3, 0x01, 0x01, 0x00,
+	0x43, 0x2b, 0x2d, 0xb0, 0x5b, 0x2c, 0xb3, 0x00, 0x00, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5c, 0x2c,
+	0xb3, 0x00, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5d, 0x2c, 0xb3, 0x01, 0x00, 0x01, 0x43, 0x2b,
+	0x2d, 0xb0, 0x5e, 0x2c, 0xb3, 0x01, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5f, 0x2c, 0xb2, 0x00,
+	0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x60, 0x2c, 0xb2, 0x00, 0x01, 0x45, 0x2b, 0x2d, 0xb0, 0x61, 0x2c,
+	0xb2, 0x01, 0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x62, 0x2c, 0xb2, 0x01, 0x01, 0x45, 0x2b, 0x2d, 0xb0,
+	0x63, 0x2c, 0xb2, 0x00, 0x00, 0x48, 0x2b, 0x2d, 0xb0, 0x64, 0x2c, 0xb2, 0x00, 0x01, 0x48, 0x2b,
+	0x2d, 0xb0, 0x65, 0x2c, 0xb2, 0x01, 0x00, 0x48, 0x2b, 0x2d, 0xb0, 0x66, 0x2c, 0xb2, 0x01, 0x01,
+	0x48, 0x2b, 0x2d, 0xb0, 0x67, 0x2c, 0xb3, 0x00, 0x00, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x68, 0x2c,
+	0xb3, 0x00, 0x01, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x69, 0x2c, 0xb3, 0x01, 0x00, 0x00, 0x44, 0x2b,
+	0x2d, 0xb0, 0x6a, 0x2c, 0xb3, 0x01, 0x01, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x6b, 0x2c, 0xb3, 0x00,
+	0x00, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x6c, 0x2c, 0xb3, 0x00, 0x01, 0x01, 0x44, 0x2b, 0x2d, 0xb0,
+	0x6d, 0x2c, 0xb3, 0x01, 0x00, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x6e, 0x2c, 0xb3, 0x01, 0x01, 0x01,
+	0x44, 0x2b, 0x2d, 0xb0, 0x6f, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b,
+	0x2d, 0xb0, 0x70, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x71, 0x2c, 0xb1,
+	0x00, 0x3c, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x72, 0x2c, 0xb0, 0x00, 0x16, 0xb1, 0x00, 0x3c,
+	0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x73, 0x2c, 0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d,
+	0xb0, 0x74, 0x2c, 0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x75, 0x2c, 0xb0, 0x00,
+	0x16, 0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x76, 0x2c, 0xb1, 0x00, 0x3d, 0x2b,
+	0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x77, 0x2c, 0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x40,
+	0x2b, 0x2d, 0xb0, 0x78, 0x2c, 0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x79, 0x2c,
+	0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x7a, 0x2c, 0xb1, 0x01, 0x3d, 0x2b, 0xb0,
+	0x40, 0x2b, 0x2d, 0xb0, 0x7b, 0x2c, 0xb1, 0x01, 0x3d, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x7c,
+	0x2c, 0xb1, 0x01, 0x3d, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x7d, 0x2c, 0xb1, 0x00, 0x3e, 0x2b,
+	0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x7e, 0x2c, 0xb1, 0x00, 0x3e, 0x2b, 0xb0, 0x40,
+	0x2b, 0x2d, 0xb0, 0x7f, 0x2c, 0xb1, 0x00, 0x3e, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x80, 0x2c,
+	0xb1, 0x00, 0x3e, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x81, 0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0,
+	0x40, 0x2b, 0x2d, 0xb0, 0x82, 0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x83,
+	0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x84, 0x2c, 0xb1, 0x00, 0x3f, 0x2b,
+	0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x85, 0x2c, 0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x40,
+	0x2b, 0x2d, 0xb0, 0x86, 0x2c, 0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x87, 0x2c,
+	0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x88, 0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0,
+	0x40, 0x2b, 0x2d, 0xb0, 0x89, 0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x8a,
+	0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x8b, 0x2c, 0xb2, 0x0b, 0x00, 0x03,
+	0x45, 0x50, 0x58, 0xb0, 0x06, 0x1b, 0xb2, 0x04, 0x02, 0x03, 0x45, 0x58, 0x23, 0x21, 0x1b, 0x21,
+	0x59, 0x59, 0x42, 0x2b, 0xb0, 0x08, 0x65, 0xb0, 0x03, 0x24, 0x50, 0x78, 0xb1, 0x05, 0x01, 0x15,
+	0x45, 0x58, 0x30, 0x59, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb8, 0x00, 0xc8, 0x52, 0x58, 0xb1,
+	0x01, 0x01, 0x8e, 0x59, 0xb0, 0x01, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x70, 0xb1, 0x00, 0x07,
+	0x42, 0xb3, 0x00, 0x1a, 0x02, 0x00, 0x2a, 0xb1, 0x00, 0x07, 0x42, 0xb5, 0x1f, 0x04, 0x0f, 0x08,
+	0x02, 0x0a, 0x2a, 0xb1, 0x00, 0x07, 0x42, 0xb5, 0x23, 0x02, 0x17, 0x06, 0x02, 0x0a, 0x2a, 0xb1,
+	0x00, 0x09, 0x42, 0xbb, 0x08, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x0b, 0x2a, 0xb1, 0x00, 0x0b,
+	0x42, 0xbb, 0x00, 0x40, 0x00, 0x40, 0x00, 0x02, 0x00, 0x0b, 0x2a, 0xb9, 0x00, 0x03, 0x00, 0x00,
+	0x44, 0xb1, 0x24, 0x01, 0x88, 0x51, 0x58, 0xb0, 0x40, 0x88, 0x58, 0xb9, 0x00, 0x03, 0x00, 0x64,
+	0x44, 0xb1, 0x28, 0x01, 0x88, 0x51, 0x58, 0xb8, 0x08, 0x00, 0x88, 0x58, 0xb9, 0x00, 0x03, 0x00,
+	0x00, 0x44, 0x59, 0x1b, 0xb1, 0x27, 0x01, 0x88, 0x51, 0x58, 0xba, 0x08, 0x80, 0x00, 0x01, 0x04,
+	0x40, 0x88, 0x63, 0x54, 0x58, 0xb9, 0x00, 0x03, 0x00, 0x00, 0x44, 0x59, 0x59, 0x59, 0x59, 0x59,
+	0xb5, 0x21, 0x02, 0x11, 0x06, 0x02, 0x0e, 0x2a, 0xb8, 0x01, 0xff, 0x85, 0xb0, 0x04, 0x8d, 0xb1,
+	0x02, 0x00, 0x44, 0xb3, 0x05, 0x64, 0x06, 0x00, 0x44, 0x44, 0x00, 0x00
+};
+
+struct EmbeddedAsset {
+	const char* name;
+	const unsigned char* data;
+	std::size_t size;
+};
+
+static const EmbeddedAsset Assets[] = {
+	{ "Snake.png", Snake_png, sizeof(Snake_png) },
+	{ "Food.png", Food_png, sizeof(Food_png) },
+	{ "Snake_Head.png", Snake_Head_png, sizeof(Snake_Head_png) },
+	{ "BigSpace.ttf", BigSpace_ttf, sizeof(BigSpace_ttf) },
+};
+
+bool EmbeddedAssets::find(const char* name, const unsigned char*& data, std::size_t& size) {
+	for (const EmbeddedAsset& asset : Assets) {
+		if (std::strcmp(asset.name, name) == 0) {
+			data = asset.data;
+			size = asset.size;
+			return true;
+		}
+	}
+	return false;
+}
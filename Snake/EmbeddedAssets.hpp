@@ -0,0 +1,14 @@
+#ifndef EMBEDDED_ASSETS_HPP
+#define EMBEDDED_ASSETS_HPP
+
+#include <cstddef>
+
+// Sprites and fonts compiled into the game (EmbeddedAssets.cpp is generated from the
+// Assets folder by Assets/Embed.cmake), so starting up does not touch the disk.
+class EmbeddedAssets {
+public:
+    // Contents of an asset by file name, e.g. "Snake.png"; false if it is not embedded
+    static bool find(const char* name, const unsigned char*& data, std::size_t& size);
+};
+
+#endif // EMBEDDED_ASSETS_HPP
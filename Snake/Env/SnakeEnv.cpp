@@ -0,0 +1,51 @@
+#include "SnakeEnv.h"
+#include "VectorEnv.hpp"
+#include <new>
+
+static const int MaxGridSize = 8192;  // As the game's --board
+
+struct SnakeEnv {
+	explicit SnakeEnv(const VectorEnvConfig& config) : env(config) {}
+
+	VectorEnv env;
+};
+
+// The enum values are part of the C interface
+static_assert(SNAKE_ENV_UP == static_cast<int>(VectorEnv::Up) && SNAKE_ENV_DOWN == static_cast<int>(VectorEnv::Down) &&
+	SNAKE_ENV_LEFT == static_cast<int>(VectorEnv::Left) && SNAKE_ENV_RIGHT == static_cast<int>(VectorEnv::Right) &&
+	SNAKE_ENV_STRAIGHT == static_cast<int>(VectorEnv::Straight), "SnakeEnv.h actions must match VectorEnv::Action");
+
+
+SnakeEnv* snake_env_create(int32_t envCount, int32_t gridWidth, int32_t gridHeight, uint64_t seed, int32_t threads) {
+	if (envCount < 1 || gridWidth < 2 || gridHeight < 2 || gridWidth > MaxGridSize || gridHeight > MaxGridSize || threads < 0) {
+		return nullptr;
+	}
+
+	VectorEnvConfig config = { envCount, gridWidth, gridHeight, seed, threads };
+	return new (std::nothrow) SnakeEnv(config);
+}
+
+void snake_env_destroy(SnakeEnv* env) {
+	delete env;
+}
+
+int32_t snake_env_count(const SnakeEnv* env) {
+	return env->env.getEnvCount();
+}
+
+int32_t snake_env_threads(const SnakeEnv* env) {
+	return env->env.getThreadCount();
+}
+
+int32_t snake_env_observation_size(const SnakeEnv* env) {
+	return env->env.getObservationSize();
+}
+
+void snake_env_reset(SnakeEnv* env, uint8_t* observations) {
+	env->env.reset(observations);
+}
+
+void snake_env_step(SnakeEnv* env, const int32_t* actions, uint8_t* observations, float* rewards,
+	uint8_t* terminals, uint8_t* truncations) {
+	env->env.step(actions, observations, rewards, terminals, truncations);
+}
@@ -0,0 +1,71 @@
+#ifndef SNAKE_ENV_H
+#define SNAKE_ENV_H
+
+/* C interface to VectorEnv for training agents from any language with a C FFI, built as the
+ * snake_env shared library. Every array is owned by the caller and written in place, one entry
+ * per board:
+ *
+ *   SnakeEnv* env = snake_env_create(1024, 19, 12, 42, 0);
+ *   uint8_t* observations = malloc(1024 * snake_env_observation_size(env));
+ *   snake_env_reset(env, observations);
+ *   for (;;) {
+ *       ... pick actions[i] from observations ...
+ *       snake_env_step(env, actions, observations, rewards, terminals, truncations);
+ *   }
+ *   snake_env_destroy(env);
+ */
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(SNAKE_ENV_BUILD)
+#define SNAKE_ENV_API __declspec(dllexport)
+#else
+#define SNAKE_ENV_API __declspec(dllimport)
+#endif
+#else
+#define SNAKE_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Actions; any other value keeps the snake going straight */
+enum {
+    SNAKE_ENV_UP = 0,
+    SNAKE_ENV_DOWN = 1,
+    SNAKE_ENV_LEFT = 2,
+    SNAKE_ENV_RIGHT = 3,
+    SNAKE_ENV_STRAIGHT = 4
+};
+
+typedef struct SnakeEnv SnakeEnv;
+
+/* Boards of gridWidth x gridHeight cells stepped on threads threads (zero uses every core).
+ * Board i always plays the same games for the same seed. Returns NULL for invalid sizes. */
+SNAKE_ENV_API SnakeEnv* snake_env_create(int32_t envCount, int32_t gridWidth, int32_t gridHeight, uint64_t seed, int32_t threads);
+SNAKE_ENV_API void snake_env_destroy(SnakeEnv* env);
+
+SNAKE_ENV_API int32_t snake_env_count(const SnakeEnv* env);
+SNAKE_ENV_API int32_t snake_env_threads(const SnakeEnv* env);
+
+/* Bytes of observation per board: 3 planes of gridHeight x gridWidth, holding 1 where the
+ * snake's body (head included), its head and the food are */
+SNAKE_ENV_API int32_t snake_env_observation_size(const SnakeEnv* env);
+
+/* Start a new game on every board and write envCount observations */
+SNAKE_ENV_API void snake_env_reset(SnakeEnv* env, uint8_t* observations);
+
+/* Apply one action per board and advance them all one tick. Rewards are +1 for eating and -1
+ * for dying. A board whose game ended is flagged in terminals (lost or won) or truncations
+ * (stopped for not eating; may be NULL) and has already started its next game, so its
+ * observation is the new game's first. */
+SNAKE_ENV_API void snake_env_step(SnakeEnv* env, const int32_t* actions, uint8_t* observations, float* rewards,
+    uint8_t* terminals, uint8_t* truncations);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SNAKE_ENV_H */
@@ -0,0 +1,239 @@
+#ifndef FIXED_SIMULATION_HPP
+#define FIXED_SIMULATION_HPP
+
+#include "Bitboard.hpp"
+#include "Cell.hpp"
+#include "Random.hpp"
+#include "Simulation.hpp"
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Simulation's rules for one board size fixed at compile time, e.g. FixedSimulation<19, 12> for
+// the default board. The snake is a ring of cell indices and occupancy is a Bitboard, so a
+// collision is one bit test and picking a free cell for food is a popcount and a select, with
+// no heap memory at all. A seed plays exactly the same game as Simulation; snake_bench checks
+// that tick by tick, so the two must change together.
+template <int Width, int Height>
+class FixedSimulation {
+    static_assert(Width >= 2 && Height >= 2, "The board needs at least 2x2 cells");
+
+public:
+    static const int CellCount = Width * Height;
+
+    explicit FixedSimulation(std::uint64_t seed = 0) : mRandom(seed) { reset(); }
+
+    // Start a fresh game, continuing the random sequence or starting a new one from seed
+    void reset(std::uint64_t seed) {
+        mRandom.seed(seed);
+        reset();
+    }
+
+    void reset() {
+        mIsGameOver = false;
+        mOutcome = Simulation::Playing;
+        mDirectionX = 0;
+        mDirectionY = 0;
+        mTurnCount = 0;
+
+        // Start in the middle of the board
+        mHead = { (Width - 1) / 2, (Height - 1) / 2 };
+        mOccupied.clear();
+        mHeadSlot = 0;
+        mLength = 1;
+        mSlots[0] = static_cast<Slot>(cellIndex(mHead));
+        mOccupied.set(cellIndex(mHead));
+
+        placeFood();
+
+        mScore = 0;
+        mTick = 0;
+        mTimePerTick = Simulation::InitialTimePerTick;
+    }
+
+    // Advance the game by one tick
+    void step() {
+        if (mIsGameOver) {
+            return;
+        }
+
+        // Apply one buffered turn per tick
+        if (mTurnCount > 0) {
+            mDirectionX = mTurns[0].x;
+            mDirectionY = mTurns[0].y;
+            for (int i = 1; i < mTurnCount; ++i) {
+                mTurns[i - 1] = mTurns[i];
+            }
+            mTurnCount--;
+        }
+
+        mTick++;
+
+        Cell head = { mHead.x + mDirectionX, mHead.y + mDirectionY };
+        if (head.x < 0 || head.x >= Width || head.y < 0 || head.y >= Height) {
+            mIsGameOver = true;
+            mOutcome = Simulation::HitWall;
+            return;
+        }
+
+        // Following the tail is allowed, since it leaves before the head arrives
+        int headCell = cellIndex(head);
+        int tailCell = mSlots[slotOf(mLength - 1)];
+        if (mOccupied.test(headCell) && headCell != tailCell) {
+            mIsGameOver = true;
+            mOutcome = Simulation::HitSelf;
+            return;
+        }
+
+        bool ateFood = (head == mFood);
+        if (!ateFood) {
+            mOccupied.reset(tailCell);
+            mLength--;
+        }
+
+        mHeadSlot = mHeadSlot + 1 == CellCount ? 0 : mHeadSlot + 1;
+        mSlots[mHeadSlot] = static_cast<Slot>(headCell);
+        mLength++;
+        mOccupied.set(headCell);
+        mHead = head;
+
+        if (ateFood) {
+            placeFood();
+
+            mScore++;
+            if (mScore % SpeedIncreaseThreshold == 0 && mTimePerTick > 0.080) {
+                mTimePerTick -= 0.010;
+            }
+        }
+    }
+
+    // Request a new direction, buffered and applied one per tick as in Simulation
+    void turnUp() { queueTurn(0, -1); }
+    void turnDown() { queueTurn(0, 1); }
+    void turnLeft() { queueTurn(-1, 0); }
+    void turnRight() { queueTurn(1, 0); }
+
+    // Replace the snake with the given cells, head first. Returns false (and resets) if a cell
+    // is off the board or used twice.
+    bool setSnake(const std::vector<Cell>& cells, int directionX, int directionY) {
+        if (cells.empty() || cells.size() > static_cast<std::size_t>(CellCount) || !rebuildSnake(cells)) {
+            reset();
+            return false;
+        }
+
+        mIsGameOver = false;
+        mOutcome = Simulation::Playing;
+        mDirectionX = directionX;
+        mDirectionY = directionY;
+        mTurnCount = 0;
+
+        if (mOccupied.test(cellIndex(mFood))) {
+            placeFood();
+        }
+        return true;
+    }
+
+    // Pick uniformly among the free cells, consuming random numbers exactly as Simulation does
+    void placeFood() {
+        if (mLength == CellCount) {
+            mOutcome = Simulation::BoardFull;
+            mIsGameOver = true;
+            return;
+        }
+
+        int cell = -1;
+        for (int attempt = 0; attempt < 32 && cell < 0; ++attempt) {
+            int candidate = mRandom.nextBelow(CellCount);
+            if (!mOccupied.test(candidate)) {
+                cell = candidate;
+            }
+        }
+        if (cell < 0) {
+            cell = mOccupied.findClear(mRandom.nextBelow(mOccupied.countClear()));
+        }
+
+        mFood.x = cell % Width;
+        mFood.y = cell / Width;
+    }
+
+    bool isGameOver() const { return mIsGameOver; }
+    Simulation::Outcome getOutcome() const { return mOutcome; }
+    int getScore() const { return mScore; }
+    std::uint64_t getTick() const { return mTick; }
+    double getTimePerTick() const { return mTimePerTick; }
+    int getDirectionX() const { return mDirectionX; }
+    int getDirectionY() const { return mDirectionY; }
+    const Cell& getFood() const { return mFood; }
+    const Cell& getHead() const { return mHead; }
+    int getLength() const { return mLength; }
+    bool isOccupied(const Cell& cell) const { return mOccupied.test(cellIndex(cell)); }
+
+    // Segment i counted from the head
+    Cell getSegment(int i) const {
+        int cell = mSlots[slotOf(i)];
+        Cell segment = { cell % Width, cell / Width };
+        return segment;
+    }
+
+private:
+    typedef typename std::conditional<CellCount <= 65536, std::uint16_t, std::int32_t>::type Slot;
+
+    static int cellIndex(const Cell& cell) { return cell.y * Width + cell.x; }
+    int slotOf(int i) const { return mHeadSlot >= i ? mHeadSlot - i : mHeadSlot + CellCount - i; }
+
+    void queueTurn(int directionX, int directionY) {
+        int lastX = mTurnCount > 0 ? mTurns[mTurnCount - 1].x : mDirectionX;
+        int lastY = mTurnCount > 0 ? mTurns[mTurnCount - 1].y : mDirectionY;
+        if ((directionX != 0 && directionX == -lastX) || (directionY != 0 && directionY == -lastY)) {
+            return;
+        }
+        if (directionX == lastX && directionY == lastY) {
+            return;
+        }
+        if (mTurnCount < MaxQueuedTurns) {
+            mTurns[mTurnCount++] = { directionX, directionY };
+        }
+    }
+
+    // Fill the ring from the tail forwards so segment 0 ends up at the head slot
+    bool rebuildSnake(const std::vector<Cell>& cells) {
+        mOccupied.clear();
+        mHeadSlot = CellCount - 1;
+        mLength = 0;
+        for (std::size_t i = cells.size(); i-- > 0;) {
+            const Cell& cell = cells[i];
+            if (cell.x < 0 || cell.x >= Width || cell.y < 0 || cell.y >= Height || mOccupied.test(cellIndex(cell))) {
+                return false;
+            }
+            mHeadSlot = mHeadSlot + 1 == CellCount ? 0 : mHeadSlot + 1;
+            mSlots[mHeadSlot] = static_cast<Slot>(cellIndex(cell));
+            mLength++;
+            mOccupied.set(cellIndex(cell));
+        }
+        mHead = cells[0];
+        return true;
+    }
+
+private:
+    static const int MaxQueuedTurns = 3;
+    static const int SpeedIncreaseThreshold = 5;  // Points between speed-ups, as in Simulation
+
+    bool mIsGameOver;
+    Simulation::Outcome mOutcome;
+    int mDirectionX, mDirectionY;
+    Cell mTurns[MaxQueuedTurns];
+    int mTurnCount;
+    int mScore;
+    std::uint64_t mTick;
+    double mTimePerTick;
+    Cell mFood;
+    Cell mHead;
+    int mHeadSlot;
+    int mLength;
+    std::array<Slot, CellCount> mSlots;  // Ring of cell indices, head at mHeadSlot
+    Bitboard<CellCount> mOccupied;
+    Random mRandom;
+};
+
+#endif // FIXED_SIMULATION_HPP
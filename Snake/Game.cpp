@@ -1,6 +1,12 @@
 #include "Game.hpp"
+#include "StartupTimer.hpp"
+#include "TickClock.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <string>
+#include <cstdio>
 #include <ctime>   
 #include <cstdlib>
 
@@ -9,65 +15,69 @@
 #endif
 
 const float Game::swipeThreshold = 0.25f;
-const int Game::FPS = 7;
-const int Game::maxSnakeSize = 30;
-const int Game::speedIncreaseThreshold = 5;
-Uint32 Game::TimePerFrame = 1000 / FPS;
+const int Game::MaxCatchUpTicks = 5;
 const int Game::JOYSTICK_THRESHOLD = 25000;  // Joystick threshold (for movement sensitivity)
 
 
-Game::Game()
+Game::Game(int gridWidth, int gridHeight)
 	: mWindow(nullptr)
 	, mRenderer(nullptr)
 	, isRunning(false)
-	, isGameOver(false)
+	, needsRedraw(true)
+	, isWindowVisible(true)
 	, gameOverFont(nullptr)
-	, snakeTexture(nullptr)
-	, foodTexture(nullptr)
+	, atlasTexture(nullptr)
 	, mIsMovingUp(false)
 	, mIsMovingRight(false)
 	, mIsMovingDown(false)
 	, mIsMovingLeft(false)
 	, gameController(nullptr)
-	, mDirectionX(0)
-	, mDirectionY(0)
-	, currentDirectionX(0)
-	, currentDirectionY(0)
-	, mPlayer()
+	, mControllersReady(false)
 	, playAgainButton()
-	, food()
 	, initialTouchX(0.0f)
 	, initialTouchY(0.0f)
-	, score(0)
-	, mGrid(SCREEN_WIDTH, SCREEN_HEIGHT, CELL_SIZE)
+	, joystickAxisState()
+	, mGrid(gridWidth, gridHeight, CELL_SIZE)
+	, mSim(mGrid.getGridWidth(), mGrid.getGridHeight())
+	, mAutopilot(Autopilot::AStarSafe, 2000, mGrid.getGridWidth(), mGrid.getGridHeight())
+	, mAutopilotEnabled(false)
+	, mSeeds(static_cast<std::uint64_t>(time(0)))
+	, mGameSeed(0)
+	, mRecordCount(0)
+	, mIsReplaying(false)
+	, mReplaySpeed(1)
+	, mPreviousCounter(0)
+	, mTimeSinceLastUpdate(0.0)
+	, mBoardEvent(static_cast<Uint32>(-1))
+	, mBoardEventPending(false)
+	, mIsPaused(false)
+	, mDirtyRects(false)
+	, mFramebuffer(nullptr)
+	, mFramebufferWidth(0)
+	, mFramebufferHeight(0)
+	, mFramebufferValid(false)
+	, mDrawnColumns(0)
+	, mDrawnScore(0)
+#if SNAKE_PERF
+	, mShowPerf(false)
+	, mPerfTicksSeen(0)
+	, mPerfUpdateSeen(0.0)
+	, perfFont(nullptr)
+#endif
 {
-	mPlayer = { (SCREEN_WIDTH - CELL_SIZE) / 2, (SCREEN_HEIGHT - CELL_SIZE) / 2, CELL_SIZE, CELL_SIZE };
-
-	snake.push_back(mPlayer);
-
-	srand(time(0));
-	placeFood();
+	startGame();
 }
 
 // Initialize Game
 bool Game::init() {
-	// Initialize SDL
-
-#ifdef __EMSCRIPTEN__
-	if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_GAMECONTROLLER) < 0) {
-		std::cout << "SDL could not be initialized!" << std::endl
-			<< "SDL_Error: " << SDL_GetError() << std::endl;
-		return false;
-	}
-#else
-	if (SDL_Init(SDL_INIT_EVERYTHING) < 0) {
-
+	// Only video (and the events that come with it) is needed to show the first frame.
+	// Controllers start once it is up, and nothing else is used.
+	if (SDL_Init(SDL_INIT_VIDEO) < 0) {
 		std::cout << "SDL could not be initialized!" << std::endl
 			<< "SDL_Error: " << SDL_GetError() << std::endl;
 		return false;
-
 	}
-#endif
+	StartupTimer::mark("SDL video init");
 
 	if (TTF_Init() == -1) {  // Initialize SDL_ttf
 		std::cout << "TTF_Init failed: " << TTF_GetError() << std::endl;
@@ -78,6 +88,10 @@ bool Game::init() {
 		std::cout << "SDL_image could not initialize! SDL_image Error: " << IMG_GetError() << std::endl;
 		return false;
 	}
+	StartupTimer::mark("SDL_ttf and SDL_image init");
+
+	// Decode the sprites and fonts while the window comes up
+	mAssetLoader.start();
 
 	// Create Window
 	mWindow = SDL_CreateWindow("Snake", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_SHOWN);
@@ -88,18 +102,39 @@ bool Game::init() {
 		return false;
 	}
 	else {
+		StartupTimer::mark("create window");
 
 		// Create Renderer
-		mRenderer = SDL_CreateRenderer(mWindow, -1, SDL_RENDERER_ACCELERATED);
+		mRenderer = SDL_CreateRenderer(mWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
 
 		if (!mRenderer) {
 			std::cout << "Renderer could not be created!" << std::endl
 				<< "SDL_Error: " << SDL_GetError() << std::endl;
 			return false;
 		}
+		StartupTimer::mark("create renderer");
 
 	}
 
+	if (!loadMedia()) {
+		std::cout << "Failed to load media!" << std::endl;
+		return false;
+	}
+
+
+	isRunning = true;
+	return true;
+}
+
+// Open the controller subsystem and any controller already plugged in. Enumerating devices
+// can be slow, so this waits until the first frame is on screen.
+void Game::initControllers() {
+	mControllersReady = true;
+	if (SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER) < 0) {
+		std::cout << "Controllers are unavailable: " << SDL_GetError() << std::endl;
+		return;
+	}
+
 	for (int i = 0; i < SDL_NumJoysticks(); ++i) {
 		if (SDL_IsGameController(i)) {
 			std::cout << "Controller found: " << SDL_JoystickNameForIndex(i) << std::endl;
@@ -112,224 +147,765 @@ bool Game::init() {
 	if (gameController == NULL) {
 		std::cout << "No controller detected!" << std::endl;
 	}
+}
+
+// Finish starting up after the first frame has been presented
+void Game::onFrameShown() {
+	if (!mControllersReady) {
+		StartupTimer::firstFrame();
+		initControllers();
+	}
+}
+
+// Draw into a surface through SDL's software renderer instead of a window, e.g. for benchmarks
+bool Game::initOffscreen(SDL_Surface* target) {
+	if (TTF_Init() == -1) {
+		std::cout << "TTF_Init failed: " << TTF_GetError() << std::endl;
+		return false;
+	}
+
+	if (IMG_Init(IMG_INIT_PNG) != IMG_INIT_PNG) {
+		std::cout << "SDL_image could not initialize! SDL_image Error: " << IMG_GetError() << std::endl;
+		return false;
+	}
+
+	mAssetLoader.start();
+
+	mRenderer = SDL_CreateSoftwareRenderer(target);
+	if (!mRenderer) {
+		std::cout << "Software renderer could not be created!" << std::endl
+			<< "SDL_Error: " << SDL_GetError() << std::endl;
+		return false;
+	}
 
 	if (!loadMedia()) {
 		std::cout << "Failed to load media!" << std::endl;
 		return false;
 	}
 
-
 	isRunning = true;
 	return true;
 }
 
-// Make emscripten_loop static
+// Browser frame without a simulation thread: input, every tick that is due, then draw
 void Game::emscripten_loop(void* arg) {
 	Game* game = static_cast<Game*>(arg); // Cast the void pointer to Game* object
 
-	Uint32 currentTime = SDL_GetTicks();
-	static Uint32 previousTime = currentTime;  // Static variable to persist across calls
-	Uint32 elapsedTime = currentTime - previousTime;
-	previousTime = currentTime;
+	Uint64 currentCounter = SDL_GetPerformanceCounter();
+	game->mTimeSinceLastUpdate += static_cast<double>(currentCounter - game->mPreviousCounter) / SDL_GetPerformanceFrequency();
+	game->mPreviousCounter = currentCounter;
 
-	static Uint32 timeSinceLastUpdate = 0;  // Static accumulator for fixed time step
-	timeSinceLastUpdate += elapsedTime;
-
-	game->processEvent(); // Process events in each loop iteration
+	{
+		PERF_SCOPE(game->mPerf, Events);
+		game->processEvent(); // Process events in each loop iteration
+	}
 
 	// Handle fixed time step updates
-	while (timeSinceLastUpdate >= game->TimePerFrame) {
-		timeSinceLastUpdate -= game->TimePerFrame;
-		game->update(game->TimePerFrame / 1000.0f); // Update the game logic
+	game->advanceTicks(game->mTimeSinceLastUpdate);
+
+	{
+		PERF_SCOPE(game->mPerf, Render);
+		game->render(static_cast<float>(game->mTimeSinceLastUpdate / game->mSim.getTimePerTick())); // Render the game
 	}
+	PERF_END_FRAME(game->mPerf);
+	game->onFrameShown();
+}
+
+// Browser frame while a worker steps the game: input, then draw the newest board
+void Game::emscripten_frame(void* arg) {
+	Game* game = static_cast<Game*>(arg);
+
+	{
+		PERF_SCOPE(game->mPerf, Events);
+		game->processEvent();
+	}
+	game->renderNewestBoard();
 
-	game->render(); // Render the game
+	if (!game->isRunning) {
+		game->stopSimulation();
+	}
 }
 
 
 
 // Run Game
 void Game::run() {
-
-	Uint32 previousTime = SDL_GetTicks();
-	Uint32 timeSinceLastUpdate = 0;
+	mPreviousCounter = SDL_GetPerformanceCounter();
+	mTimeSinceLastUpdate = 0.0;
 
 #ifdef __EMSCRIPTEN__
+	// A frame rate of 0 runs the loop from requestAnimationFrame. Built with -pthread, the
+	// game steps in a Web Worker sharing the wasm memory and the page only draws and reads input.
+#ifdef __EMSCRIPTEN_PTHREADS__
+	if (!mArena) {
+		startSimulation();
+		emscripten_set_main_loop_arg(emscripten_frame, this, 0, 1);
+		return;
+	}
+#endif
 	emscripten_set_main_loop_arg(emscripten_loop, this, 0, 1);
 #else
 
-	while (isRunning) {
-		Uint32 currentTime = SDL_GetTicks();
-		Uint32 elapsedTime = currentTime - previousTime;
-		previousTime = currentTime;
-		timeSinceLastUpdate += elapsedTime;
+	// Without vsync, sleep to the display's refresh rate while the snake is moving
+	SDL_RendererInfo rendererInfo;
+	bool hasVsync = SDL_GetRendererInfo(mRenderer, &rendererInfo) == 0 && (rendererInfo.flags & SDL_RENDERER_PRESENTVSYNC);
+
+	SDL_DisplayMode displayMode;
+	int refreshRate = (SDL_GetWindowDisplayMode(mWindow, &displayMode) == 0 && displayMode.refresh_rate > 0) ? displayMode.refresh_rate : 60;
+	double timePerFrame = 1.0 / refreshRate;
 
-		processEvent();
+	// The arena spreads its own ticks over worker threads, so it stays in this loop
+	if (!mArena) {
+		runThreaded(hasVsync, timePerFrame);
+		clean();
+		return;
+	}
+
+	Uint64 frequency = SDL_GetPerformanceFrequency();
+	while (isRunning) {
+		Uint64 frameStart = SDL_GetPerformanceCounter();
+		mTimeSinceLastUpdate += static_cast<double>(frameStart - mPreviousCounter) / frequency;
+		mPreviousCounter = frameStart;
 
-		while (timeSinceLastUpdate >= TimePerFrame) {
-			timeSinceLastUpdate -= TimePerFrame;
+		{
+			PERF_SCOPE(mPerf, Events);
 			processEvent();
-			update(TimePerFrame / 1000.0f);
 		}
 
-		render();
+		advanceTicks(mTimeSinceLastUpdate);
+
+		// While moving, every frame shows a new in-between position
+		bool isMoving = !isPaused() && (mArena != nullptr || (!mDirtyRects && !mSim.isGameOver() && (mSim.getDirectionX() != 0 || mSim.getDirectionY() != 0) && !(mIsReplaying && mReplaySpeed == 0)));
+
+		// Only draw when something changed and the window can be seen
+		if ((needsRedraw || isMoving) && isWindowVisible) {
+			{
+				PERF_SCOPE(mPerf, Render);
+				render(static_cast<float>(mTimeSinceLastUpdate / mSim.getTimePerTick()));
+			}
+			PERF_END_FRAME(mPerf);
+			needsRedraw = false;
+			onFrameShown();
+		}
+
+		// Sleep until the next frame, tick or event instead of spinning.
+		// Nothing moves on the game-over screen or while paused, so just wait for input there;
+		// a server game keeps ticking so its new game shows up.
+		double timeUntilWake;
+		if ((mSim.isGameOver() && !mNetClient) || isPaused()) {
+			timeUntilWake = 1.0;
+		}
+		else if (isMoving && isWindowVisible) {
+			timeUntilWake = hasVsync ? 0.0 : timePerFrame - static_cast<double>(SDL_GetPerformanceCounter() - frameStart) / frequency;
+		}
+		else {
+			timeUntilWake = mSim.getTimePerTick() - mTimeSinceLastUpdate;
+		}
+
+		if (timeUntilWake > 0.0) {
+			SDL_Event event;
+			if (SDL_WaitEventTimeout(&event, static_cast<int>(timeUntilWake * 1000.0))) {
+				handleEvent(event);
+			}
+		}
 	}
 	clean();
 #endif
 }
 
+// Desktop render loop: draw the newest board the simulation thread has published, then sleep
+// until the next frame, the next board or input, whichever comes first
+void Game::runThreaded(bool hasVsync, double timePerFrame) {
+	startSimulation();
 
-// Poll and handle all events, such as input
-void Game::processEvent() {
-	SDL_Event event;
-	if (SDL_PollEvent(&event)) {
-		switch (event.type) {
-
-		case SDL_CONTROLLERDEVICEADDED:
-			// A controller was plugged in, try to open it
-			if (SDL_IsGameController(event.cdevice.which)) {
-				gameController = SDL_GameControllerOpen(event.cdevice.which);
-				if (gameController) {
-					std::cout << "Controller connected: " << SDL_JoystickName(SDL_GameControllerGetJoystick(gameController)) << std::endl;
-				}
-				else {
-					std::cout << "Failed to open controller." << std::endl;
+	Uint64 frequency = SDL_GetPerformanceFrequency();
+	while (isRunning) {
+		Uint64 frameStart = SDL_GetPerformanceCounter();
+		{
+			PERF_SCOPE(mPerf, Events);
+			processEvent();
+		}
+
+		const BoardSnapshot& board = renderNewestBoard();
+
+		// New boards arrive as events, so when nothing moves there is nothing to do but wait.
+		// Dirty rectangle frames only change with the board, so they wait the same way.
+		double timeUntilWake = 1.0;
+		if (board.isMoving && !mDirtyRects && isWindowVisible) {
+			timeUntilWake = hasVsync ? 0.0 : timePerFrame - static_cast<double>(SDL_GetPerformanceCounter() - frameStart) / frequency;
+		}
+		if (timeUntilWake > 0.0) {
+			SDL_Event event;
+			if (SDL_WaitEventTimeout(&event, static_cast<int>(timeUntilWake * 1000.0))) {
+				handleEvent(event);
+			}
+		}
+	}
+
+	stopSimulation();
+}
+
+void Game::startSimulation() {
+#ifndef __EMSCRIPTEN__
+	mBoardEvent = SDL_RegisterEvents(1);  // The browser draws every animation frame anyway
+#endif
+
+	// Something to draw before the first tick; the thread does all publishing from here on
+	captureBoard(mBoards.writeBuffer());
+	mBoards.publish();
+	mSimThread = std::thread(&Game::simulationLoop, this);
+}
+
+void Game::stopSimulation() {
+	if (!mSimThread.joinable()) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mSimMutex);
+		isRunning = false;
+	}
+	mSimWake.notify_one();
+	mSimThread.join();
+}
+
+// Draw the newest board from the simulation thread if anything changed or it is moving
+const BoardSnapshot& Game::renderNewestBoard() {
+	if (mBoards.acquire()) {
+		needsRedraw = true;
+#if SNAKE_PERF
+		const BoardSnapshot& totals = mBoards.readBuffer();
+		for (; mPerfTicksSeen < totals.ticksPlayed; ++mPerfTicksSeen) {
+			mPerf.addTick();
+		}
+		mPerf.addTime(PerfStats::Update, totals.updateSeconds - mPerfUpdateSeen);
+		mPerfUpdateSeen = totals.updateSeconds;
+#endif
+	}
+	const BoardSnapshot& board = mBoards.readBuffer();
+
+	if ((needsRedraw || (board.isMoving && !mDirtyRects)) && isWindowVisible) {
+		double sinceTick = std::chrono::duration<double>(TickClock::Clock::now() - board.tickTime).count();
+		{
+			PERF_SCOPE(mPerf, Render);
+			drawFrame(board, static_cast<float>(sinceTick / board.timePerTick));
+		}
+		PERF_END_FRAME(mPerf);
+		needsRedraw = false;
+		onFrameShown();
+	}
+	return board;
+}
+
+// Step mSim on its own thread (a Web Worker in the browser). Ticks follow a TickClock, so
+// slow frames or a stalled present never stretch or skip one.
+void Game::simulationLoop() {
+	typedef TickClock::Clock Clock;
+	if (Trace::isEnabled()) {
+		Trace::setThreadName("Simulation");
+	}
+
+	// Nothing steps on the game-over screen or while paused until a command starts a new game
+	// or resumes
+	auto isIdle = [this]() { return (mSim.isGameOver() && !mNetClient) || isPaused(); };
+	auto hasWork = [this]() { return !isRunning || !mCommands.isEmpty(); };
+
+	std::uint64_t ticks = 0;
+	double updateSeconds = 0.0;
+	TickClock clock;
+	clock.restart(Clock::now(), mSim.getTimePerTick());
+
+	while (isRunning) {
+		bool wasIdle = isIdle();
+		bool wasPaused = isPaused();
+		{
+			std::unique_lock<std::mutex> lock(mSimMutex);
+			if (wasIdle) {
+				mSimWake.wait(lock, hasWork);
+			}
+			else {
+				mSimWake.wait_until(lock, clock.getNextTick(), hasWork);
+			}
+		}
+
+		bool changed = false;
+		Command command;
+		while (mCommands.pop(command)) {
+			applyCommand(command);
+			changed = true;
+		}
+
+		Clock::time_point now = Clock::now();
+		if (wasIdle && !isIdle()) {
+			// A new game counts its ticks from when it started. A resumed one was drawn a whole
+			// tick along, so its next tick is due now and the snake carries on from where it stopped.
+			Clock::time_point lastTick = wasPaused ? now - TickClock::toDuration(mSim.getTimePerTick()) : now;
+			clock.restart(lastTick, mSim.getTimePerTick());
+		}
+
+		int caughtUp = 0;
+		while (!isIdle() && clock.isDue(now)) {
+			Clock::time_point start = Clock::now();
+			update(static_cast<float>(mSim.getTimePerTick()));
+			updateSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+			ticks++;
+			changed = true;
+
+			clock.advance(mSim.getTimePerTick());
+			if (++caughtUp == MaxCatchUpTicks) {
+				// Drop the rest of the backlog rather than fast-forwarding through it
+				if (clock.isDue(now)) {
+					clock.restart(now, mSim.getTimePerTick());
 				}
+				break;
 			}
-			break;
+		}
 
-		case SDL_CONTROLLERDEVICEREMOVED:
-			// A controller was removed, close it
-			if (gameController && !SDL_GameControllerGetAttached(gameController)) {
-				std::cout << "Controller disconnected: " << SDL_JoystickName(SDL_GameControllerGetJoystick(gameController)) << std::endl;
-				SDL_GameControllerClose(gameController);
-				gameController = nullptr; // Clear the controller object
+		if (changed) {
+			publishBoard(clock.getLastTick(), ticks, updateSeconds);
+		}
+	}
+}
+
+void Game::publishBoard(std::chrono::steady_clock::time_point tickTime, std::uint64_t ticks, double updateSeconds) {
+	BoardSnapshot& board = mBoards.writeBuffer();
+	captureBoard(board);
+	board.tickTime = tickTime;
+	board.ticksPlayed = ticks;
+	board.updateSeconds = updateSeconds;
+	mBoards.publish();
+
+	// Wake the render loop in case it is waiting for input; one pending event is enough
+	if (mBoardEvent != static_cast<Uint32>(-1) && !mBoardEventPending.exchange(true)) {
+		SDL_Event event = {};
+		event.type = mBoardEvent;
+		SDL_PushEvent(&event);
+	}
+}
+
+// Copy what drawing needs from mSim. The camera follows the head part way between two cells,
+// so the window spans the views at both ends, plus a cell for segments sliding in.
+void Game::captureBoard(BoardSnapshot& board) const {
+	captureView(mSim, board);
+	board.isMoving = !isPaused() && !mSim.isGameOver() && (mSim.getDirectionX() != 0 || mSim.getDirectionY() != 0) && !(mIsReplaying && mReplaySpeed == 0);
+	board.snapToTick = mIsReplaying && mReplaySpeed != 1;  // Jumping several ticks at once
+}
+
+void Game::captureView(const Simulation& sim, BoardSnapshot& board) const {
+	int cellSize = mGrid.getCellSize();
+	const Cell& head = sim.getHead();
+	const Cell& from = sim.getPreviousPosition(0);
+
+	int firstCameraX = cameraOffset((std::min(head.x, from.x) + 0.5f) * cellSize, mGrid.getPixelWidth(), SCREEN_WIDTH);
+	int firstCameraY = cameraOffset((std::min(head.y, from.y) + 0.5f) * cellSize, mGrid.getPixelHeight(), SCREEN_HEIGHT);
+	int lastCameraX = cameraOffset((std::max(head.x, from.x) + 0.5f) * cellSize, mGrid.getPixelWidth(), SCREEN_WIDTH);
+	int lastCameraY = cameraOffset((std::max(head.y, from.y) + 0.5f) * cellSize, mGrid.getPixelHeight(), SCREEN_HEIGHT);
+	board.capture(sim, firstCameraX / cellSize - 1, firstCameraY / cellSize - 1,
+		(lastCameraX + SCREEN_WIDTH) / cellSize + 1, (lastCameraY + SCREEN_HEIGHT) / cellSize + 1);
+}
+
+// The board on screen, which is what clicks and buttons act on
+const BoardSnapshot& Game::getShownBoard() const {
+	return mSimThread.joinable() ? mBoards.readBuffer() : mLocalBoard;
+}
+
+// Run every tick that is due, catching up at most MaxCatchUpTicks after a stall
+void Game::advanceTicks(double& timeSinceLastUpdate) {
+	if (isPaused()) {
+		// Hold the snake a whole tick along, so the first update after resuming carries on from there
+		timeSinceLastUpdate = mSim.getTimePerTick();
+		return;
+	}
+
+	int ticks = 0;
+	while (timeSinceLastUpdate >= mSim.getTimePerTick()) {
+		timeSinceLastUpdate -= mSim.getTimePerTick();
+		{
+			PERF_SCOPE(mPerf, Update);
+			PERF_TICK(mPerf);
+			update(static_cast<float>(mSim.getTimePerTick()));
+		}
+
+		if (++ticks == MaxCatchUpTicks) {
+			// Drop the rest of the backlog rather than fast-forwarding through it
+			if (timeSinceLastUpdate > mSim.getTimePerTick()) {
+				timeSinceLastUpdate = 0.0;
 			}
 			break;
+		}
+	}
+}
 
-		case SDL_KEYDOWN:
-			handlePlayerInput(event.key, true);
-			break;
 
-		case SDL_KEYUP:
-			handlePlayerInput(event.key, false);
-			break;
+// Drain and handle every pending event, such as input
+void Game::processEvent() {
+	TRACE_SCOPE("processEvent");
+	SDL_Event event;
+	while (SDL_PollEvent(&event)) {
+		handleEvent(event);
+	}
+}
 
-		case SDL_MOUSEBUTTONDOWN:
-			if (isGameOver) {
-				int mouseX = event.button.x;
-				int mouseY = event.button.y;
+void Game::handleEvent(const SDL_Event& event) {
+	switch (event.type) {
 
-				if (mouseX >= playAgainButton.x && mouseX <= (playAgainButton.x + playAgainButton.w) &&
-					mouseY >= playAgainButton.y && mouseY <= (playAgainButton.y + playAgainButton.h)) {
-					resetGame();
-				}
+	case SDL_CONTROLLERDEVICEADDED:
+		// A controller was plugged in, try to open it
+		if (SDL_IsGameController(event.cdevice.which)) {
+			gameController = SDL_GameControllerOpen(event.cdevice.which);
+			if (gameController) {
+				std::cout << "Controller connected: " << SDL_JoystickName(SDL_GameControllerGetJoystick(gameController)) << std::endl;
 			}
-			break;
+			else {
+				std::cout << "Failed to open controller." << std::endl;
+			}
+		}
+		break;
 
-		case SDL_FINGERDOWN: {			
+	case SDL_CONTROLLERDEVICEREMOVED:
+		// A controller was removed, close it
+		if (gameController && !SDL_GameControllerGetAttached(gameController)) {
+			std::cout << "Controller disconnected: " << SDL_JoystickName(SDL_GameControllerGetJoystick(gameController)) << std::endl;
+			SDL_GameControllerClose(gameController);
+			gameController = nullptr; // Clear the controller object
+			joystickAxisState[0] = joystickAxisState[1] = 0;
+		}
+		break;
 
-			initialTouchX = event.tfinger.x * WINDOW_WIDTH;
-			initialTouchY = event.tfinger.y * WINDOW_HEIGHT;
+	case SDL_KEYDOWN:
+		handlePlayerInput(event.key, true);
+		break;
 
-			break;
+	case SDL_KEYUP:
+		handlePlayerInput(event.key, false);
+		break;
+
+	case SDL_MOUSEBUTTONDOWN:
+		if (getShownBoard().isGameOver) {
+			int mouseX = event.button.x;
+			int mouseY = event.button.y;
+
+			if (mouseX >= playAgainButton.x && mouseX <= (playAgainButton.x + playAgainButton.w) &&
+				mouseY >= playAgainButton.y && mouseY <= (playAgainButton.y + playAgainButton.h)) {
+				sendCommand(Command::NewGame);
+			}
 		}
+		break;
+
+	case SDL_FINGERDOWN: {			
+
+		initialTouchX = event.tfinger.x * WINDOW_WIDTH;
+		initialTouchY = event.tfinger.y * WINDOW_HEIGHT;
+
+		break;
+	}
+
+	
+	case SDL_FINGERMOTION: {
+				
+
+		// Normalize release position
+		float touchX = event.tfinger.x * WINDOW_WIDTH;
+		float touchY = event.tfinger.y * WINDOW_HEIGHT;
 
-		
-		case SDL_FINGERMOTION: {
-					
-
-			// Normalize release position
-			float touchX = event.tfinger.x * WINDOW_WIDTH;
-			float touchY = event.tfinger.y * WINDOW_HEIGHT;
-
-			// Calculate swipe deltas
-			float deltaX = touchX - initialTouchX;
-			float deltaY = touchY - initialTouchY;
-
-			// Determine if swipe exceeds threshold
-			if (std::abs(deltaX) > std::abs(deltaY)) {
-				// Horizontal swipe
-				if (std::abs(deltaX) > swipeThreshold) {
-					if (deltaX > 0) {
-						handleSwipeRight(); // Trigger right swipe
-					}
-					else {
-						handleSwipeLeft();  // Trigger left swipe
-					}
+		// Calculate swipe deltas
+		float deltaX = touchX - initialTouchX;
+		float deltaY = touchY - initialTouchY;
+
+		// Determine if swipe exceeds threshold
+		if (std::abs(deltaX) > std::abs(deltaY)) {
+			// Horizontal swipe
+			if (std::abs(deltaX) > swipeThreshold) {
+				if (deltaX > 0) {
+					handleSwipeRight(); // Trigger right swipe
+				}
+				else {
+					handleSwipeLeft();  // Trigger left swipe
 				}
 			}
-			else {
-				// Vertical swipe
-				if (std::abs(deltaY) > swipeThreshold) {
-					if (deltaY > 0) {
-						handleSwipeDown();  // Trigger down swipe
-					}
-					else {
-						handleSwipeUp();    // Trigger up swipe
-					}
+		}
+		else {
+			// Vertical swipe
+			if (std::abs(deltaY) > swipeThreshold) {
+				if (deltaY > 0) {
+					handleSwipeDown();  // Trigger down swipe
+				}
+				else {
+					handleSwipeUp();    // Trigger up swipe
 				}
 			}
-
-			break;
 		}
 
+		break;
+	}
 
-		case SDL_JOYHATMOTION:
-			handleHatMotion(event.jhat);
-			break;
 
-		case SDL_JOYBUTTONDOWN:
-			handleControllerInput(event.jbutton, true);
-			break;
+	case SDL_JOYHATMOTION:
+		handleHatMotion(event.jhat);
+		break;
 
-		case SDL_JOYBUTTONUP:
-			handleControllerInput(event.jbutton, false);
-			break;
+	case SDL_JOYBUTTONDOWN:
+		handleControllerInput(event.jbutton, true);
+		break;
 
-		case SDL_JOYAXISMOTION:
-			handleJoystickMotion(event.jaxis);
+	case SDL_JOYBUTTONUP:
+		handleControllerInput(event.jbutton, false);
+		break;
+
+	case SDL_JOYAXISMOTION:
+		handleJoystickMotion(event.jaxis);
+		break;
+
+	case SDL_WINDOWEVENT:
+		switch (event.window.event) {
+		case SDL_WINDOWEVENT_MINIMIZED:
+		case SDL_WINDOWEVENT_HIDDEN:
+			isWindowVisible = false;
 			break;
+		case SDL_WINDOWEVENT_SHOWN:
+		case SDL_WINDOWEVENT_RESTORED:
+		case SDL_WINDOWEVENT_EXPOSED:
+		case SDL_WINDOWEVENT_SIZE_CHANGED:
+			isWindowVisible = true;
+			needsRedraw = true;
+			mFramebufferValid = false;
+			break;
+		case SDL_WINDOWEVENT_FOCUS_LOST:
+			// Stop the game while the player is elsewhere; the loops then block waiting for events.
+			// Draw once more to show the snake where it is held.
+			sendCommand(Command::Pause);
+			needsRedraw = true;
+			break;
+		case SDL_WINDOWEVENT_FOCUS_GAINED:
+			if (!mSimThread.joinable() && isPaused()) {
+				// Drop the time spent paused, so the loops without a thread do not catch up on it
+				mPreviousCounter = SDL_GetPerformanceCounter();
+				mTimeSinceLastUpdate = mSim.getTimePerTick();
+			}
+			sendCommand(Command::Resume);
+			break;
+		default:
+			break;
+		}
+		break;
 
-		case SDL_QUIT:
-			isRunning = false;
+	case SDL_RENDER_TARGETS_RESET:
+	case SDL_RENDER_DEVICE_RESET:
+		// The baked board and the framebuffer lived in render targets whose contents are now gone
+		mGrid.invalidate();
+		releaseFramebuffer();
+		needsRedraw = true;
+		break;
+
+	case SDL_QUIT:
+		isRunning = false;
 #ifdef __EMSCRIPTEN__
-			emscripten_cancel_main_loop();
+		emscripten_cancel_main_loop();
 #endif
-			break;
+		break;
 
-		default:
-			break;
+	default:
+		if (event.type == mBoardEvent) {
+			mBoardEventPending = false;  // The loop picks the board up on its next pass
 		}
+		break;
 	}
 }
 
 void Game::handleSwipeUp() {
-	if (currentDirectionY != 1) {  // Prevent the snake from reversing direction
-		mDirectionX = 0;
-		mDirectionY = -1;  // Move up
-	}
+	sendCommand(Command::TurnUp);
 }
 
 void Game::handleSwipeDown() {
-	if (currentDirectionY != -1) {
-		mDirectionX = 0;
-		mDirectionY = 1;  // Move down
-	}
+	sendCommand(Command::TurnDown);
 }
 
 void Game::handleSwipeLeft() {
-	if (currentDirectionX != 1) {
-		mDirectionX = -1;
-		mDirectionY = 0;  // Move left
-	}
+	sendCommand(Command::TurnLeft);
 }
 
 void Game::handleSwipeRight() {
-	if (currentDirectionX != -1) {
-		mDirectionX = 1;
-		mDirectionY = 0;  // Move right
+	sendCommand(Command::TurnRight);
+}
+
+// Queue input for the simulation thread, or apply it straight away when there is none
+void Game::sendCommand(Command::Type type, SDL_Keycode key) {
+	Command command = { type, key };
+	if (!mSimThread.joinable()) {
+		applyCommand(command);
+		return;
 	}
+
+	if (mCommands.push(command)) {
+		{
+			std::lock_guard<std::mutex> lock(mSimMutex);  // So the wake-up cannot slip in before the thread sleeps
+		}
+		mSimWake.notify_one();
+	}
+}
+
+// Runs on whichever thread steps mSim
+void Game::applyCommand(const Command& command) {
+	switch (command.type) {
+	case Command::TurnUp:
+		if (mArena) mArena->turn(0, 0, -1);
+		else if (mNetClient) mNetClient->turn(0, -1);
+		else mSim.turnUp();
+		break;
+	case Command::TurnDown:
+		if (mArena) mArena->turn(0, 0, 1);
+		else if (mNetClient) mNetClient->turn(0, 1);
+		else mSim.turnDown();
+		break;
+	case Command::TurnLeft:
+		if (mArena) mArena->turn(0, -1, 0);
+		else if (mNetClient) mNetClient->turn(-1, 0);
+		else mSim.turnLeft();
+		break;
+	case Command::TurnRight:
+		if (mArena) mArena->turn(0, 1, 0);
+		else if (mNetClient) mNetClient->turn(1, 0);
+		else mSim.turnRight();
+		break;
+	case Command::NewGame:
+		// Clicks act on the board as drawn, which can be a tick behind; only restart a finished game
+		if (mSim.isGameOver()) {
+			resetGame();
+		}
+		break;
+	case Command::ToggleAutopilot:
+		mAutopilotEnabled = !mAutopilotEnabled;
+		std::cout << "Autopilot " << (mAutopilotEnabled ? Autopilot::getStrategyName(mAutopilot.getStrategy()) : "off") << std::endl;
+		break;
+	case Command::ReplayKey:
+		handleReplayInput(command.key);
+		break;
+	case Command::Pause:
+		mIsPaused = true;
+		break;
+	case Command::Resume:
+		mIsPaused = false;
+		break;
+	}
+}
+
+// Let the autopilot pick this tick's turn, as if the player had pressed it
+void Game::steerAutopilot() {
+	Cell direction = mAutopilot.decide(mSim);
+
+	Command command = { Command::TurnUp, 0 };
+	if (direction.y > 0) command.type = Command::TurnDown;
+	else if (direction.x < 0) command.type = Command::TurnLeft;
+	else if (direction.x > 0) command.type = Command::TurnRight;
+	else if (direction.y == 0) return;
+	applyCommand(command);
+}
+
+bool Game::startRecording(const char* path) {
+	mRecordPath = path;
+	mRecordCount = 1;
+	return mRecorder.open(path, mSim, mGameSeed);
+}
+
+bool Game::openPerfCsv(const char* path) {
+#if SNAKE_PERF
+	return mPerf.openCsv(path);
+#else
+	std::cout << "Performance stats are compiled out of this build (define SNAKE_PERF=1)" << std::endl;
+	return false;
+#endif
+}
+
+bool Game::openReplay(const char* path) {
+	if (!mReplay.open(path)) {
+		return false;
+	}
+	if (mReplay.getGridWidth() != mSim.getGridWidth() || mReplay.getGridHeight() != mSim.getGridHeight()) {
+		std::cout << "Replay board does not match the game board" << std::endl;
+		mReplay.close();
+		return false;
+	}
+
+	mIsReplaying = true;
+	mReplaySpeed = 1;
+	needsRedraw = true;
+	return mReplay.seek(mSim, 0);
+}
+
+// Start a new game from a fresh seed, recording it if recording is on
+void Game::startGame() {
+	mGameSeed = mSeeds.next();
+	mSim.reset(mGameSeed);
+
+	if (mRecordCount > 0) {
+		// "session.snr" becomes "session-2.snr" for the second game
+		std::string path = mRecordPath;
+		std::size_t dot = path.find_last_of('.');
+		std::size_t slash = path.find_last_of("/\\");
+		if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+			dot = path.size();
+		}
+		path.insert(dot, "-" + std::to_string(++mRecordCount));
+		mRecorder.open(path.c_str(), mSim, mGameSeed);
+	}
+}
+
+// Advance, fast-forward or rewind the replay by mReplaySpeed ticks
+void Game::playReplay() {
+	if (mReplaySpeed > 0) {
+		for (int i = 0; i < mReplaySpeed && mReplay.step(mSim); ++i) {
+		}
+	}
+	else if (mReplaySpeed < 0) {
+		std::uint64_t back = static_cast<std::uint64_t>(-mReplaySpeed);
+		mReplay.seek(mSim, mSim.getTick() > back ? mSim.getTick() - back : 0);
+	}
+	needsRedraw = true;
+}
+
+// Right fast-forwards, left rewinds, space pauses and home jumps to the start
+void Game::handleReplayInput(SDL_Keycode key) {
+	const int MaxReplaySpeed = 64;
+
+	if (key == SDLK_RIGHT || key == SDLK_d) {
+		mReplaySpeed = mReplaySpeed < 1 ? 1 : std::min(mReplaySpeed * 2, MaxReplaySpeed);
+	}
+	else if (key == SDLK_LEFT || key == SDLK_a) {
+		mReplaySpeed = mReplaySpeed > -1 ? -1 : std::max(mReplaySpeed * 2, -MaxReplaySpeed);
+	}
+	else if (key == SDLK_SPACE) {
+		mReplaySpeed = mReplaySpeed == 0 ? 1 : 0;
+	}
+	else if (key == SDLK_HOME) {
+		mReplay.seek(mSim, 0);
+		needsRedraw = true;
+	}
+	else {
+		return;
+	}
+
+	std::cout << "Replay tick " << mSim.getTick() << " of " << mReplay.getTickCount() << ", speed " << mReplaySpeed << "x" << std::endl;
+}
+
+void Game::setNetClient(NetClient* client) {
+	mNetClient.reset(client);
+	mSim.reset();  // Replaced by the server's first snapshot
+	needsRedraw = true;
+}
+
+void Game::setDirtyRects(bool enabled) {
+	mDirtyRects = enabled;
+	needsRedraw = true;
+}
+
+void Game::setArena(const ArenaConfig& config) {
+	mArena.reset(new Arena(config));
+	needsRedraw = true;
+}
+
+void Game::setAutopilot(Autopilot::Strategy strategy, int budgetMicroseconds) {
+	mAutopilot = Autopilot(strategy, budgetMicroseconds, mSim.getGridWidth(), mSim.getGridHeight());
+	mAutopilotEnabled = true;
 }
 
 
@@ -371,27 +947,45 @@ void Game::handleControllerInput(SDL_JoyButtonEvent button, bool isPressed) {
 			break;
 		}
 
-		if (isGameOver && button.button == SDL_CONTROLLER_BUTTON_A) {
-			resetGame();
+		if (getShownBoard().isGameOver && button.button == SDL_CONTROLLER_BUTTON_A) {
+			sendCommand(Command::NewGame);
 		}
 	}
 }
 
 
+// Only react when the stick crosses the threshold, not on every motion event while it is held
 void Game::handleJoystickMotion(SDL_JoyAxisEvent axis) {
+	if (axis.axis != SDL_CONTROLLER_AXIS_LEFTX && axis.axis != SDL_CONTROLLER_AXIS_LEFTY) {
+		return;
+	}
+
+	int state = 0;
+	if (axis.value < -JOYSTICK_THRESHOLD) {
+		state = -1;
+	}
+	else if (axis.value > JOYSTICK_THRESHOLD) {
+		state = 1;
+	}
+
+	if (state == joystickAxisState[axis.axis]) {
+		return;
+	}
+	joystickAxisState[axis.axis] = state;
+
 	if (axis.axis == SDL_CONTROLLER_AXIS_LEFTX) {
-		if (axis.value < -JOYSTICK_THRESHOLD) {
+		if (state < 0) {
 			handleSwipeLeft();
 		}
-		else if (axis.value > JOYSTICK_THRESHOLD) {
+		else if (state > 0) {
 			handleSwipeRight();
 		}
 	}
-	else if (axis.axis == SDL_CONTROLLER_AXIS_LEFTY) {
-		if (axis.value < -JOYSTICK_THRESHOLD) {
+	else {
+		if (state < 0) {
 			handleSwipeUp();
 		}
-		else if (axis.value > JOYSTICK_THRESHOLD) {
+		else if (state > 0) {
 			handleSwipeDown();
 		}
 	}
@@ -422,19 +1016,35 @@ void Game::handleHatMotion(SDL_JoyHatEvent hat) {
 
 
 void Game::handlePlayerInput(SDL_KeyboardEvent key, bool isPressed) {
+#if SNAKE_PERF
+	if (isPressed && key.keysym.sym == SDLK_F3) {
+		mShowPerf = !mShowPerf;
+		needsRedraw = true;
+		return;
+	}
+#endif
+
+	if (isPressed && mIsReplaying) {
+		sendCommand(Command::ReplayKey, key.keysym.sym);
+		return;
+	}
+
 	if (isPressed) {
-		if ((key.keysym.sym == SDLK_w || key.keysym.sym == SDLK_UP) && currentDirectionY != 1) {
+		if (key.keysym.sym == SDLK_w || key.keysym.sym == SDLK_UP) {
 			handleSwipeUp();
 		}
-		else if ((key.keysym.sym == SDLK_s || key.keysym.sym == SDLK_DOWN) && currentDirectionY != -1) {
+		else if (key.keysym.sym == SDLK_s || key.keysym.sym == SDLK_DOWN) {
 			handleSwipeDown();
 		}
-		else if ((key.keysym.sym == SDLK_a || key.keysym.sym == SDLK_LEFT) && currentDirectionX != 1) {
+		else if (key.keysym.sym == SDLK_a || key.keysym.sym == SDLK_LEFT) {
 			handleSwipeLeft();
 		}
-		else if ((key.keysym.sym == SDLK_d || key.keysym.sym == SDLK_RIGHT) && currentDirectionX != -1) {
+		else if (key.keysym.sym == SDLK_d || key.keysym.sym == SDLK_RIGHT) {
 			handleSwipeRight();
 		}
+		else if (key.keysym.sym == SDLK_p) {
+			sendCommand(Command::ToggleAutopilot);
+		}
 	}
 }
 
@@ -442,103 +1052,106 @@ void Game::handlePlayerInput(SDL_KeyboardEvent key, bool isPressed) {
 
 // Updates the game logic
 void Game::update(float deltaTime) {
-	// Update player position
-	mPlayer.x += mDirectionX * mGrid.getCellSize();
-	mPlayer.y += mDirectionY * mGrid.getCellSize();
-
-	currentDirectionX = mDirectionX;
-	currentDirectionY = mDirectionY;
-
-	// Snap the player's position to the grid
-	SDL_Point snappedPos = mGrid.snapToGrid(mPlayer.x, mPlayer.y);
-	mPlayer.x = snappedPos.x;
-	mPlayer.y = snappedPos.y;
+	TRACE_SCOPE("update");
+	double previousTimePerTick = mSim.getTimePerTick();
 
-	SDL_Rect previousTail = snake.back();
-
-	// Move each segment of the snake to follow the previous one
-	for (size_t i = snake.size() - 1; i > 0; --i) {
-		snake[i] = snake[i - 1];
+	if (mArena) {
+		mArena->step();
+		needsRedraw = true;
 	}
-	snake[0] = mPlayer; // Update the head position in the snake vector
-
-	// Check for food collision
-	if (SDL_HasIntersection(&mPlayer, &food)) {
-
-		// Grow the snake by adding a new segment
-		if (snake.size() < maxSnakeSize) {
-			SDL_Rect newSegment = { previousTail.x, previousTail.y, CELL_SIZE, CELL_SIZE };
-			snake.push_back(newSegment);
+	else if (mNetClient) {
+		// The server plays the game; send it input and show what it sends back
+		if (mAutopilotEnabled && !mSim.isGameOver()) {
+			steerAutopilot();
 		}
-
-		// Place food in a new random location
-		placeFood();
-
-		score++;
-
-		if (snake.size() <= maxSnakeSize && score % speedIncreaseThreshold == 0) {
-			increaseSpeed();
+		if (!mNetClient->update(mSim)) {
+			isRunning = false;
 		}
+		needsRedraw = true;
 	}
-
-	// Game Over if player goes out of screen bounds
-	if (mPlayer.x < 0 || mPlayer.x + mPlayer.w > SCREEN_WIDTH || mPlayer.y < 0 || mPlayer.y + mPlayer.h > SCREEN_HEIGHT)
-
-		isGameOver = true;
-
-
-	// In the main update loop:
-	if (checkSelfCollision()) {
-
-		isGameOver = true; // End game if the snake collides with itself
+	else if (mIsReplaying) {
+		playReplay();
+	}
+	else if (!mSim.isGameOver()) {
+		if (mAutopilotEnabled) {
+			steerAutopilot();
+		}
+		mSim.step();
+		mRecorder.recordTick(mSim);
+		needsRedraw = true;
 	}
-}
-
-void Game::increaseSpeed() {
-	if (TimePerFrame > 80) { // Prevent the game from becoming too fast
-		TimePerFrame -= 10; // Decrease frame time to make it faster
 
+	if (mSim.getTimePerTick() != previousTimePerTick) {
+		std::cout << "Speed increased! Current TimePerFrame: " << mSim.getTimePerTick() * 1000.0 << " ms/frame" << std::endl;
 	}
-	std::cout << "Speed increased! Current TimePerFrame: " << TimePerFrame << " ms/frame" << std::endl;
 }
 
 
-void Game::placeFood() {
-	int gridWidth = SCREEN_WIDTH / CELL_SIZE;
-	int gridHeight = SCREEN_HEIGHT / CELL_SIZE;
 
-	bool isOverlapping;
 
-	do {
+// Head sprite faces down; quarter turns that point it in the direction of travel
+static int headQuarterTurns(int directionX, int directionY) {
+	if (directionX < 0) return 1;
+	if (directionY < 0) return 2;
+	if (directionX > 0) return 3;
+	return 0;
+}
 
-		food.x = (std::rand() % gridWidth) * CELL_SIZE;
-		food.y = (std::rand() % gridHeight) * CELL_SIZE;
-		food.w = CELL_SIZE;
-		food.h = CELL_SIZE;
+// What a cell of the dirty rectangle framebuffer shows; HeadCell plus the head's quarter turns
+static const std::uint8_t EmptyCell = 0, FoodCell = 1, BodyCell = 2, HeadCell = 3, UnknownCell = 255;
 
+// Dirty rectangle framebuffer size along one axis: the view when the board fits in it, otherwise
+// a ring of whole cells, more than the view can show at once
+static int framebufferSize(int boardSize, int viewSize, int cellSize) {
+	return boardSize <= viewSize ? viewSize : (viewSize / cellSize + 2) * cellSize;
+}
 
-		isOverlapping = false;
-		for (const SDL_Rect& segment : snake) {
-			SDL_Rect foodRect = { food.x, food.y, food.w, food.h };
+// Where a board pixel goes in the framebuffer along one axis. A board that fits keeps the view's
+// layout, margins included, since its camera never moves; a longer one wraps around the ring.
+static int framebufferOffset(int boardPixel, int camera, bool wraps, int framebufferSize) {
+	return wraps ? boardPixel % framebufferSize : boardPixel - camera;
+}
 
-			// Check if the food rect intersects with the snake segment
-			if (SDL_HasIntersection(&foodRect, &segment)) {
-				isOverlapping = true;
-				break;
-			}
-		}
-	} while (isOverlapping);
+// The view along one axis as spans of { framebuffer start, view start, length }
+static int viewSpans(int camera, bool wraps, int viewSize, int framebufferSize, int spans[2][3]) {
+	int start = framebufferOffset(camera, camera, wraps, framebufferSize);
+	int length = std::min(viewSize, framebufferSize - start);
+	spans[0][0] = start;
+	spans[0][1] = 0;
+	spans[0][2] = length;
+	if (length == viewSize) {
+		return 1;
+	}
+	spans[1][0] = 0;
+	spans[1][1] = length;
+	spans[1][2] = viewSize - length;
+	return 2;
 }
 
+// Draw mSim from the thread that steps it, e.g. in the browser or a benchmark
+void Game::render(float interpolation) {
+	captureBoard(mLocalBoard);
+	drawFrame(mLocalBoard, interpolation);
+}
 
+void Game::renderBoard(const BoardSnapshot& board, float interpolation) {
+	drawFrame(board, interpolation);
+}
 
+// Renders a board to the window, placing the snake the given fraction of the way into the next tick
+void Game::drawFrame(const BoardSnapshot& board, float interpolation) {
+	TRACE_SCOPE("render");
 
-// Renders Game to the window
-void Game::render() {
-	SDL_SetRenderDrawColor(mRenderer, 75, 105, 47, SDL_ALPHA_OPAQUE);  // Set background to white
-	SDL_RenderClear(mRenderer);
+	// Dirty rectangle frames start from the framebuffer, everything else from a cleared window
+	bool useFramebuffer = mDirtyRects && !mArena && !board.isGameOver && createFramebuffer();
+	if (!useFramebuffer) {
+		mFramebufferValid = false;  // The next dirty rectangle frame starts over
+		SDL_SetRenderDrawColor(mRenderer, 75, 105, 47, SDL_ALPHA_OPAQUE);  // Set background to white
+		SDL_RenderClear(mRenderer);
+		PERF_DRAW_CALLS(1);
+	}
 
-	int gridYOffset = WINDOW_HEIGHT - (mGrid.getCellSize() * mGrid.getGridHeight());
+	int gridYOffset = WINDOW_HEIGHT - SCREEN_HEIGHT;
 
 
 
@@ -546,43 +1159,41 @@ void Game::render() {
 
 	SDL_Color textColor = { 255, 255, 255, SDL_ALPHA_OPAQUE };  // Green color for Game Over text
 	SDL_Color playAgainColor = { 255, 255, 255, SDL_ALPHA_OPAQUE };  // White color for Game Over text
-	SDL_Color scoreColor = { 255, 255, 255, SDL_ALPHA_OPAQUE };
 
 
-	if (isGameOver) {
+	if (mArena) {
+		renderArena();
+	}
+	else if (board.isGameOver) {
 		// Render "Game Over" text
 
 		SDL_SetRenderDrawColor(mRenderer, 153, 229, 80, SDL_ALPHA_OPAQUE);
 		SDL_RenderClear(mRenderer);
+		PERF_DRAW_CALLS(1);
 
-		std::string scoreText = "Score: " + std::to_string(score);
-		SDL_Surface* gameOverSurface = TTF_RenderText_Solid(gameOverFont, scoreText.c_str(), textColor);
+		char scoreText[32];
+		std::snprintf(scoreText, sizeof(scoreText), "%s%d", board.hasWon ? "You Win! Score: " : "Score: ", board.score);
 
+		if (mGameOverText.update(mRenderer, gameOverFont, scoreText, textColor)) {
+			SDL_Rect gameOverRect;
+			gameOverRect.x = (WINDOW_WIDTH - mGameOverText.getWidth()) / 2;  // Center the text
+			gameOverRect.y = (WINDOW_HEIGHT - mGameOverText.getHeight()) / 2 - 50;  // Position above button
+			gameOverRect.w = mGameOverText.getWidth();
+			gameOverRect.h = mGameOverText.getHeight();
 
-		SDL_Texture* gameOverTexture = SDL_CreateTextureFromSurface(mRenderer, gameOverSurface);
-		SDL_Rect gameOverRect;
-		gameOverRect.x = (WINDOW_WIDTH - gameOverSurface->w) / 2;  // Center the text
-		gameOverRect.y = (WINDOW_HEIGHT - gameOverSurface->h) / 2 - 50;  // Position above button
-		gameOverRect.w = gameOverSurface->w;
-		gameOverRect.h = gameOverSurface->h;
-
-		SDL_RenderCopy(mRenderer, gameOverTexture, NULL, &gameOverRect);
-
-		SDL_DestroyTexture(gameOverTexture);
-		SDL_FreeSurface(gameOverSurface);
+			SDL_RenderCopy(mRenderer, mGameOverText.getTexture(), NULL, &gameOverRect);
+			PERF_DRAW_CALLS(1);
+		}
 
 
 		// Centered and below "Game Over"
 
 
 	   // Draw "Play Again" text centered within the button
-		SDL_Surface* playAgainSurface = TTF_RenderText_Solid(gameOverFont, "Play Again", playAgainColor);
-		if (playAgainSurface) {
-			SDL_Texture* playAgainTexture = SDL_CreateTextureFromSurface(mRenderer, playAgainSurface);
-
+		if (mPlayAgainText.update(mRenderer, gameOverFont, "Play Again", playAgainColor)) {
 			const int buttonPadding = 15;
 
-			playAgainButton = { (WINDOW_WIDTH - playAgainSurface->w) / 2, (WINDOW_HEIGHT - playAgainSurface->h) / 2 + 50, playAgainSurface->w, playAgainSurface->h };
+			playAgainButton = { (WINDOW_WIDTH - mPlayAgainText.getWidth()) / 2, (WINDOW_HEIGHT - mPlayAgainText.getHeight()) / 2 + 50, mPlayAgainText.getWidth(), mPlayAgainText.getHeight() };
 
 			SDL_Rect innerButtonRect = {
 			playAgainButton.x + buttonPadding,
@@ -597,151 +1208,444 @@ void Game::render() {
 
 			SDL_SetRenderDrawColor(mRenderer, 75, 105, 47, 255);  // Green color for the button
 			SDL_RenderFillRect(mRenderer, &playAgainButton);
+			PERF_DRAW_CALLS(1);
 			SDL_SetRenderDrawColor(mRenderer, 75, 105, 47, 255);  //  Green for the inner button with padding
 			SDL_RenderFillRect(mRenderer, &innerButtonRect);
-			SDL_RenderCopy(mRenderer, playAgainTexture, NULL, &innerButtonRect);
-
-
-			SDL_DestroyTexture(playAgainTexture);
-			SDL_FreeSurface(playAgainSurface);
+			PERF_DRAW_CALLS(1);
+			SDL_RenderCopy(mRenderer, mPlayAgainText.getTexture(), NULL, &innerButtonRect);
+			PERF_DRAW_CALLS(1);
 		}
 	}
+	else if (useFramebuffer) {
+		drawDirtyBoard(board);
+	}
 	else {
-		mGrid.draw(mRenderer, gridYOffset);
+		// Blend between the last two ticks so movement is smooth at any refresh rate
+		if (board.snapToTick) interpolation = 1.0f;
+		if (interpolation < 0.0f) interpolation = 0.0f;
+		if (interpolation > 1.0f) interpolation = 1.0f;
+
+		int cellSize = mGrid.getCellSize();
+
+		// Keep the camera on the (interpolated) head
+		float headX = board.previousHead.x + (board.head.x - board.previousHead.x) * interpolation;
+		float headY = board.previousHead.y + (board.head.y - board.previousHead.y) * interpolation;
+
+		SDL_Rect viewport = { 0, gridYOffset, SCREEN_WIDTH, SCREEN_HEIGHT };
+		int cameraX = cameraOffset((headX + 0.5f) * cellSize, mGrid.getPixelWidth(), viewport.w);
+		int cameraY = cameraOffset((headY + 0.5f) * cellSize, mGrid.getPixelHeight(), viewport.h);
+		int screenX = viewport.x - cameraX;  // Where board cell (0, 0) lands on screen
+		int screenY = viewport.y - cameraY;
+
+		mGrid.draw(mRenderer, viewport, cameraX, cameraY);
 		// Render the score
-		SDL_Surface* scoreSurface = TTF_RenderText_Solid(gameOverFont, std::to_string(score).c_str(), scoreColor);
-		SDL_Texture* scoreTexture = SDL_CreateTextureFromSurface(mRenderer, scoreSurface);
+		char scoreText[16];
+		std::snprintf(scoreText, sizeof(scoreText), "%d", board.score);
+		drawScore(scoreText);
 
-		SDL_Rect scoreRect;
-		scoreRect.x = 10;  // Position the score at the top left corner
-		scoreRect.y = 0;
-		scoreRect.w = scoreSurface->w;
-		scoreRect.h = scoreSurface->h;
+		int headTurns = headQuarterTurns(board.directionX, board.directionY);
 
-		SDL_RenderCopy(mRenderer, scoreTexture, NULL, &scoreRect);
+		// Queue the segments around the view and the food from the atlas, then draw them in one call.
+		// The board only holds segments near the view, however long the snake is.
+		mSpriteBatch.clear();
+		for (const BoardSegment& segment : board.segments) {
+			addSegmentSprite(segment, interpolation, screenX, screenY, headTurns);
+		}
 
-		// Clean up
-		SDL_DestroyTexture(scoreTexture);
-		SDL_FreeSurface(scoreSurface);
+		const Cell& food = board.food;
+		if (food.x >= cameraX / cellSize - 1 && food.x <= (cameraX + viewport.w) / cellSize + 1 &&
+			food.y >= cameraY / cellSize - 1 && food.y <= (cameraY + viewport.h) / cellSize + 1) {
+			SDL_Rect foodRenderRect = { screenX + food.x * cellSize, screenY + food.y * cellSize, cellSize, cellSize };
+			mSpriteBatch.add(foodRect, foodRenderRect);
+		}
 
+		// Keep sprites at the edge of the view out of the score bar
+		SDL_RenderSetClipRect(mRenderer, &viewport);
+		mSpriteBatch.draw(mRenderer);
+		SDL_RenderSetClipRect(mRenderer, NULL);
+	}
 
-		// Render each segment of the snake using the sprite sheet
-		for (size_t i = 0; i < snake.size(); ++i) {
-			SDL_Rect segment = snake[i];  // The segment's position
+#if SNAKE_PERF
+	if (mShowPerf) {
+		renderPerfOverlay(board);
+	}
+#endif
 
-			segment.y += gridYOffset;
+	PERF_SCOPE(mPerf, Present);
+	TRACE_SCOPE("present");
+	SDL_RenderPresent(mRenderer);
+}
 
+// Score in the bar above the board, or wherever the bar is drawn
+void Game::drawScore(const char* text, int barY) {
+	SDL_Color scoreColor = { 255, 255, 255, SDL_ALPHA_OPAQUE };
+	if (mScoreText.update(mRenderer, gameOverFont, text, scoreColor)) {
+		SDL_Rect scoreRect = { 10, barY, mScoreText.getWidth(), mScoreText.getHeight() };  // Top left corner
+		SDL_RenderCopy(mRenderer, mScoreText.getTexture(), NULL, &scoreRect);
+		PERF_DRAW_CALLS(1);
+	}
+}
+
+// Make the framebuffer on first use. Without render targets every frame is drawn in full instead.
+bool Game::createFramebuffer() {
+	if (mFramebuffer) {
+		return true;
+	}
+
+	int cellSize = mGrid.getCellSize();
+	mFramebufferWidth = framebufferSize(mGrid.getPixelWidth(), SCREEN_WIDTH, cellSize);
+	mFramebufferHeight = framebufferSize(mGrid.getPixelHeight(), SCREEN_HEIGHT, cellSize);
+	if (SDL_RenderTargetSupported(mRenderer)) {
+		mFramebuffer = SDL_CreateTexture(mRenderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+			std::max(mFramebufferWidth, WINDOW_WIDTH), mFramebufferHeight + (WINDOW_HEIGHT - SCREEN_HEIGHT));
+	}
+	if (!mFramebuffer) {
+		std::cout << "Render targets are unavailable, drawing every frame in full" << std::endl;
+		mDirtyRects = false;
+		return false;
+	}
+	PERF_TEXTURE_UPLOAD();
 
-			SDL_Rect* currentSprite = nullptr;
+	// Everything in it is opaque, so copying it out need not blend
+	SDL_SetTextureBlendMode(mFramebuffer, SDL_BLENDMODE_NONE);
 
-			// Select which sprite to use based on the segment's index
-			if (i == 0) {
-				currentSprite = &headRect;  // Head
+	bool wrapsX = mGrid.getPixelWidth() > SCREEN_WIDTH, wrapsY = mGrid.getPixelHeight() > SCREEN_HEIGHT;
+	mDrawnColumns = wrapsX ? mFramebufferWidth / cellSize : mGrid.getGridWidth();
+	int rows = wrapsY ? mFramebufferHeight / cellSize : mGrid.getGridHeight();
+	mDrawnCells.resize(static_cast<std::size_t>(mDrawnColumns) * rows);
+	mFramebufferValid = false;
+	return true;
+}
+
+void Game::releaseFramebuffer() {
+	if (mFramebuffer) {
+		SDL_DestroyTexture(mFramebuffer);
+		mFramebuffer = nullptr;
+	}
+	mFramebufferValid = false;
+}
+
+// Bring the framebuffer up to date with the board and copy the view out of it. A cell is only
+// drawn when its sprite changed or it is new in its slot; the camera follows the head a whole
+// cell at a time, so a tick usually touches the head, the old head, the old tail, the food and
+// the row or column scrolling into view.
+void Game::drawDirtyBoard(const BoardSnapshot& board) {
+	int cellSize = mGrid.getCellSize();
+	int boardWidth = mGrid.getPixelWidth(), boardHeight = mGrid.getPixelHeight();
+	int barHeight = WINDOW_HEIGHT - SCREEN_HEIGHT;
+	int cameraX = cameraOffset((board.head.x + 0.5f) * cellSize, boardWidth, SCREEN_WIDTH);
+	int cameraY = cameraOffset((board.head.y + 0.5f) * cellSize, boardHeight, SCREEN_HEIGHT);
+	bool wrapsX = boardWidth > SCREEN_WIDTH, wrapsY = boardHeight > SCREEN_HEIGHT;
+
+	// Cells in view and what each of them should show
+	int firstX = std::max(cameraX, 0) / cellSize, lastX = (std::min(cameraX + SCREEN_WIDTH, boardWidth) - 1) / cellSize;
+	int firstY = std::max(cameraY, 0) / cellSize, lastY = (std::min(cameraY + SCREEN_HEIGHT, boardHeight) - 1) / cellSize;
+	int columns = lastX - firstX + 1;
+	mWantedCells.assign(static_cast<std::size_t>(columns) * (lastY - firstY + 1), EmptyCell);
+
+	auto wanted = [&](const Cell& cell) -> std::uint8_t* {
+		if (cell.x < firstX || cell.x > lastX || cell.y < firstY || cell.y > lastY) return nullptr;
+		return &mWantedCells[static_cast<std::size_t>(cell.y - firstY) * columns + (cell.x - firstX)];
+	};
+	if (std::uint8_t* food = wanted(board.food)) {
+		*food = FoodCell;
+	}
+	int headTurns = headQuarterTurns(board.directionX, board.directionY);
+	for (const BoardSegment& segment : board.segments) {
+		if (std::uint8_t* cell = wanted(segment.cell)) {
+			*cell = segment.index == 0 ? static_cast<std::uint8_t>(HeadCell + headTurns) : BodyCell;
+		}
+	}
+
+	SDL_SetRenderTarget(mRenderer, mFramebuffer);
+	bool isFull = !mFramebufferValid;
+	if (isFull) {
+		SDL_SetRenderDrawColor(mRenderer, 75, 105, 47, SDL_ALPHA_OPAQUE);
+		SDL_RenderClear(mRenderer);
+		PERF_DRAW_CALLS(1);
+		for (DrawnCell& slot : mDrawnCells) {
+			slot.sprite = UnknownCell;
+		}
+	}
+
+	// Draw the board under each changed cell, then its sprite on top in one batch
+	int slotColumns = wrapsX ? mFramebufferWidth / cellSize : mGrid.getGridWidth();
+	int slotRows = wrapsY ? mFramebufferHeight / cellSize : mGrid.getGridHeight();
+	mSpriteBatch.clear();
+	for (int y = firstY; y <= lastY; ++y) {
+		for (int x = firstX; x <= lastX; ++x) {
+			std::uint8_t sprite = mWantedCells[static_cast<std::size_t>(y - firstY) * columns + (x - firstX)];
+			DrawnCell& slot = mDrawnCells[static_cast<std::size_t>(y % slotRows) * slotColumns + (x % slotColumns)];
+			if (slot.x == x && slot.y == y && slot.sprite == sprite) {
+				continue;
 			}
-			//else if (i == snake.size() - 1) {
-			//	currentSprite = &tailRect;  // Tail
-			//}
-			else {
-				currentSprite = &bodyRect;  // Body
+			slot.x = x;
+			slot.y = y;
+			slot.sprite = sprite;
+
+			SDL_Rect dst = { framebufferOffset(x * cellSize, cameraX, wrapsX, mFramebufferWidth),
+				framebufferOffset(y * cellSize, cameraY, wrapsY, mFramebufferHeight), cellSize, cellSize };
+			SDL_Rect layout = { dst.x, dst.y, SCREEN_WIDTH, SCREEN_HEIGHT };  // Same tile as the full view
+			mGrid.drawArea(mRenderer, layout, x * cellSize, y * cellSize, dst);
+			if (sprite == FoodCell) {
+				mSpriteBatch.add(foodRect, dst);
+			}
+			else if (sprite == BodyCell) {
+				mSpriteBatch.add(bodyRect, dst);
+			}
+			else if (sprite >= HeadCell) {
+				mSpriteBatch.add(headRect, dst, sprite - HeadCell);
 			}
+		}
+	}
+	mSpriteBatch.draw(mRenderer);
+
+	// The score bar is kept below the board
+	SDL_Rect bar = { 0, mFramebufferHeight, WINDOW_WIDTH, barHeight };
+	if (isFull || board.score != mDrawnScore) {
+		SDL_SetRenderDrawColor(mRenderer, 75, 105, 47, SDL_ALPHA_OPAQUE);
+		SDL_RenderFillRect(mRenderer, &bar);
+		PERF_DRAW_CALLS(1);
+
+		char scoreText[16];
+		std::snprintf(scoreText, sizeof(scoreText), "%d", board.score);
+		drawScore(scoreText, mFramebufferHeight);
+		mDrawnScore = board.score;
+	}
+	mFramebufferValid = true;
+
+	// Copy the bar and the view to the window, the view in up to four pieces where the framebuffer wraps
+	SDL_SetRenderTarget(mRenderer, NULL);
+	SDL_Rect barOnScreen = { 0, 0, WINDOW_WIDTH, barHeight };
+	SDL_RenderCopy(mRenderer, mFramebuffer, &bar, &barOnScreen);
+	PERF_DRAW_CALLS(1);
+
+	int spansX[2][3], spansY[2][3];
+	int countX = viewSpans(cameraX, wrapsX, SCREEN_WIDTH, mFramebufferWidth, spansX);
+	int countY = viewSpans(cameraY, wrapsY, SCREEN_HEIGHT, mFramebufferHeight, spansY);
+	for (int i = 0; i < countY; ++i) {
+		for (int j = 0; j < countX; ++j) {
+			SDL_Rect src = { spansX[j][0], spansY[i][0], spansX[j][2], spansY[i][2] };
+			SDL_Rect dst = { spansX[j][1], barHeight + spansY[i][1], spansX[j][2], spansY[i][2] };
+			SDL_RenderCopy(mRenderer, mFramebuffer, &src, &dst);
+			PERF_DRAW_CALLS(1);
+		}
+	}
+}
 
+#if SNAKE_PERF
+// Frame time percentiles, time per stage, render counters and tick rate over the recent frames
+void Game::renderPerfOverlay(const BoardSnapshot& board) {
+	if (!perfFont) {
+		return;
+	}
 
-			// Render the segment of the snake using the sprite
-			SDL_RenderCopy(mRenderer, snakeTexture, currentSprite, &segment);
+	// Refreshing the text every frame would make the overlay its own biggest cost
+	if (mPerf.getFrameCount() % 15 == 0 || !mPerfText[0].getTexture()) {
+		char lines[4][96];
+		std::snprintf(lines[0], sizeof(lines[0]), "Frame ms  p50 %.2f  p99 %.2f  max %.2f",
+			mPerf.getFramePercentile(0.50) * 1000.0, mPerf.getFramePercentile(0.99) * 1000.0, mPerf.getFrameMax() * 1000.0);
+		std::snprintf(lines[1], sizeof(lines[1]), "Events %.2f  Update %.2f  Render %.2f  Present %.2f ms",
+			mPerf.getSectionAverage(PerfStats::Events) * 1000.0, mPerf.getSectionAverage(PerfStats::Update) * 1000.0,
+			mPerf.getSectionAverage(PerfStats::Render) * 1000.0, mPerf.getSectionAverage(PerfStats::Present) * 1000.0);
+		std::snprintf(lines[2], sizeof(lines[2]), "Draw calls %.1f  Texture uploads %.2f per frame",
+			mPerf.getDrawCallsAverage(), mPerf.getTextureUploadsAverage());
+		std::snprintf(lines[3], sizeof(lines[3]), "Ticks/s %.1f  target %.1f",
+			mPerf.getTicksPerSecond(), 1.0 / board.timePerTick);
+
+		SDL_Color color = { 255, 255, 255, SDL_ALPHA_OPAQUE };
+		for (int i = 0; i < 4; ++i) {
+			mPerfText[i].update(mRenderer, perfFont, lines[i], color);
 		}
+	}
 
-		// Render food
-		//SDL_SetRenderDrawColor(mRenderer, 0x00, 0xFF, 0x00, 0xFF);  // Green color for food
-		//SDL_RenderFillRect(mRenderer, &food);
-		SDL_Rect foodRenderRect = food;
-		foodRenderRect.y += gridYOffset;
-
-		// Render food
-		SDL_RenderCopy(mRenderer, foodTexture, NULL, &foodRenderRect);
+	// Dim the board behind the text so it stays readable
+	int y = WINDOW_HEIGHT - SCREEN_HEIGHT + 5;
+	int width = 0, height = 0;
+	for (const TextCache& text : mPerfText) {
+		if (text.getWidth() > width) width = text.getWidth();
+		height += text.getHeight();
 	}
+	SDL_Rect background = { 5, y, width + 10, height + 10 };
+	SDL_SetRenderDrawBlendMode(mRenderer, SDL_BLENDMODE_BLEND);
+	SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 160);
+	SDL_RenderFillRect(mRenderer, &background);
+	SDL_SetRenderDrawBlendMode(mRenderer, SDL_BLENDMODE_NONE);
+	PERF_DRAW_CALLS(1);
+
+	y += 5;
+	for (const TextCache& text : mPerfText) {
+		if (text.getTexture()) {
+			SDL_Rect rect = { 10, y, text.getWidth(), text.getHeight() };
+			SDL_RenderCopy(mRenderer, text.getTexture(), NULL, &rect);
+			PERF_DRAW_CALLS(1);
+		}
+		y += text.getHeight();
+	}
+}
+#endif
 
-	SDL_RenderPresent(mRenderer);
+// Bots get a colour of their own; the player keeps the sprite's colours
+static SDL_Color arenaTint(int snake) {
+	std::uint64_t bits = Random::hash(static_cast<std::uint64_t>(snake));
+	SDL_Color tint = { static_cast<Uint8>(96 + (bits & 127)), static_cast<Uint8>(96 + ((bits >> 8) & 127)),
+		static_cast<Uint8>(96 + ((bits >> 16) & 127)), SDL_ALPHA_OPAQUE };
+	return tint;
 }
 
-bool Game::loadMedia() {
+// Draw the cells of the arena in view, following the player (or the middle of the board)
+void Game::renderArena() {
+	int cellSize = mGrid.getCellSize();
+	SDL_Rect viewport = { 0, WINDOW_HEIGHT - SCREEN_HEIGHT, SCREEN_WIDTH, SCREEN_HEIGHT };
+
+	Cell focus = { mArena->getGridWidth() / 2, mArena->getGridHeight() / 2 };
+	if (mArena->hasPlayer() && mArena->isAlive(0)) {
+		focus = mArena->getBody(0).head();
+	}
+	int cameraX = cameraOffset((focus.x + 0.5f) * cellSize, mGrid.getPixelWidth(), viewport.w);
+	int cameraY = cameraOffset((focus.y + 0.5f) * cellSize, mGrid.getPixelHeight(), viewport.h);
+	int screenX = viewport.x - cameraX;
+	int screenY = viewport.y - cameraY;
+
+	mGrid.draw(mRenderer, viewport, cameraX, cameraY);
 
-	// Load the icon image
-	SDL_Surface* iconSurface = IMG_Load("Assets/Snake_Head.png");
-	if (iconSurface == nullptr) {
-		std::cout << "Failed to load icon image:\n"
-			<< IMG_GetError();
-		// handle error
+	char scoreText[48];
+	if (mArena->hasPlayer()) {
+		std::snprintf(scoreText, sizeof(scoreText), "%d", mArena->getScore(0));
 	}
 	else {
-		// Set the window icon
-		SDL_SetWindowIcon(mWindow, iconSurface);
+		std::snprintf(scoreText, sizeof(scoreText), "%d of %d alive", mArena->getAliveCount(), mArena->getSnakeCount());
+	}
+	drawScore(scoreText);
+
+	int firstX = std::max(cameraX / cellSize, 0), lastX = std::min((cameraX + viewport.w) / cellSize, mGrid.getGridWidth() - 1);
+	int firstY = std::max(cameraY / cellSize, 0), lastY = std::min((cameraY + viewport.h) / cellSize, mGrid.getGridHeight() - 1);
+
+	// The owner grid says what is in each cell, so the cost follows the view, not the snake count
+	mSpriteBatch.clear();
+	for (int y = firstY; y <= lastY; ++y) {
+		for (int x = firstX; x <= lastX; ++x) {
+			Cell cell = { x, y };
+			SDL_Rect dst = { screenX + x * cellSize, screenY + y * cellSize, cellSize, cellSize };
+
+			int owner = mArena->getOwner(cell);
+			if (owner < 0) {
+				if (mArena->hasFood(cell)) {
+					mSpriteBatch.add(foodRect, dst);
+				}
+				continue;
+			}
 
-		// Free the icon surface
-		SDL_FreeSurface(iconSurface);
+			const SDL_Color& tint = (owner == 0 && mArena->hasPlayer()) ? SpriteBatch::White : arenaTint(owner);
+			if (mArena->getBody(owner).head() == cell) {
+				Cell direction = mArena->getDirection(owner);
+				mSpriteBatch.add(headRect, dst, headQuarterTurns(direction.x, direction.y), tint);
+			}
+			else {
+				mSpriteBatch.add(bodyRect, dst, 0, tint);
+			}
+		}
 	}
 
-	// Load sprite sheet as PNG
-	snakeTexture = IMG_LoadTexture(mRenderer, "Assets/Snake.png");  // Path to your PNG file
-	if (!snakeTexture) {
-		std::cout << "Unable to load texture! SDL_image Error: " << IMG_GetError() << std::endl;
-		return false;
+	SDL_RenderSetClipRect(mRenderer, &viewport);
+	mSpriteBatch.draw(mRenderer);
+	SDL_RenderSetClipRect(mRenderer, NULL);
+}
+
+// Queue one snake segment, part way between its previous and current cell
+void Game::addSegmentSprite(const BoardSegment& segment, float interpolation, int screenX, int screenY, int headTurns) {
+	int cellSize = mGrid.getCellSize();
+	const Cell& to = segment.cell;
+	const Cell& from = segment.from;
+	float x = from.x + (to.x - from.x) * interpolation;
+	float y = from.y + (to.y - from.y) * interpolation;
+	SDL_Rect position = { screenX + static_cast<int>(x * cellSize), screenY + static_cast<int>(y * cellSize), cellSize, cellSize };
+
+	// Select which sprite to use based on the segment's index.
+	// The tail slot of the sheet is still blank, so the tail uses the body sprite.
+	if (segment.index == 0) {
+		mSpriteBatch.add(headRect, position, headTurns);  // Head
 	}
+	else {
+		mSpriteBatch.add(bodyRect, position);  // Body
+	}
+}
+
+// Board pixel to show at the start of the view: centered on the focus and clamped to the board,
+// or a negative margin that centers a board smaller than the view
+int Game::cameraOffset(float focus, int boardSize, int viewSize) {
+	if (boardSize <= viewSize) {
+		return -(viewSize - boardSize) / 2;
+	}
+
+	int offset = static_cast<int>(focus) - viewSize / 2;
+	if (offset < 0) offset = 0;
+	if (offset > boardSize - viewSize) offset = boardSize - viewSize;
+	return offset;
+}
 
-	foodTexture = IMG_LoadTexture(mRenderer, "Assets/Food.png");
-	if (!foodTexture) {
-		std::cout << "Unable to load texture! SDL_image Error: " << IMG_GetError() << std::endl;
+bool Game::loadMedia() {
+	// Wait for the sprites and fonts decoded alongside the window
+	DecodedAssets assets;
+	if (!mAssetLoader.finish(assets)) {
 		return false;
 	}
+	StartupTimer::mark("wait for assets");
 
-	gameOverFont = TTF_OpenFont("Assets/BigSpace.ttf", 48);
+	if (assets.icon) {
+		// Set the window icon
+		if (mWindow) {
+			SDL_SetWindowIcon(mWindow, assets.icon);
+		}
+		SDL_FreeSurface(assets.icon);
+	}
 
-	if (!gameOverFont) {
-		std::cout << "Failed to load font: " << TTF_GetError() << std::endl;
+	atlasTexture = SDL_CreateTextureFromSurface(mRenderer, assets.atlas);
+	PERF_TEXTURE_UPLOAD();
+	foodRect = assets.foodRect;
+	SDL_FreeSurface(assets.atlas);
+
+	if (!atlasTexture) {
+		std::cout << "Unable to create sprite atlas! SDL Error: " << SDL_GetError() << std::endl;
+		TTF_CloseFont(assets.font);
+		if (assets.smallFont) {
+			TTF_CloseFont(assets.smallFont);
+		}
 		return false;
 	}
+	mSpriteBatch.setTexture(atlasTexture);
+
+	gameOverFont = assets.font;
+#if SNAKE_PERF
+	perfFont = assets.smallFont;
+#endif
 
 	// Define the source rectangles for the sprite sheet
 	headRect = { 0, 0, 120, 120 };  // Head sprite (0,0) at 120x120
 	bodyRect = { 120, 0, 120, 120 };  // Body sprite (120,0) at 120x120
 	tailRect = { 240, 0, 120, 120 };  // Tail sprite (0,120) at 120x120
 
+	StartupTimer::mark("upload sprites");
 	return true;
 }
 
 
 
-bool Game::checkSelfCollision() {
-	for (size_t i = 1; i < snake.size(); ++i) {
-		if (SDL_HasIntersection(&mPlayer, &snake[i])) {
-			return true;
-		}
-	}
-	return false;
-}
-
-
 void Game::resetGame() {
-	// Reset game state
-	isGameOver = false;
-	isRunning = true;
-
-	// Reset player position and direction
-	mPlayer = { (SCREEN_WIDTH - CELL_SIZE) / 2, (SCREEN_HEIGHT - CELL_SIZE) / 2, CELL_SIZE, CELL_SIZE };
-	mDirectionX = 0;
-	mDirectionY = 0;
-	currentDirectionX = mDirectionX;
-	currentDirectionY = mDirectionY;
-
-	// Clear and reset snake segments
-	snake.clear();
-	snake.push_back(mPlayer);
-
-	// Place the food in a new location
-	placeFood();
-
-	score = 0;
-
-	TimePerFrame = 1000 / FPS;
+	// Reset snake, food, score and speed; a replay starts over instead
+	if (mIsReplaying) {
+		mReplay.seek(mSim, 0);
+		mReplaySpeed = 1;
+	}
+	else if (mNetClient) {
+		mNetClient->newGame();  // The new game arrives as a snapshot
+	}
+	else {
+		mRecorder.close();
+		startGame();
+	}
+	mTimeSinceLastUpdate = 0.0;  // The new game's first tick is a whole tick away
+	needsRedraw = true;
 }
 
 
@@ -752,20 +1656,31 @@ void Game::resetGame() {
 // Cleans up Game 
 void Game::clean()
 {
+	mScoreText.clear();
+	mGameOverText.clear();
+	mPlayAgainText.clear();
+	mGrid.release();
+	releaseFramebuffer();
+	mRecorder.close();
 
 	if (gameOverFont) {
 		TTF_CloseFont(gameOverFont);
 		gameOverFont = nullptr;
 	}
 
-	if (snakeTexture) {
-		SDL_DestroyTexture(snakeTexture);
-		snakeTexture = nullptr;
+#if SNAKE_PERF
+	for (TextCache& text : mPerfText) {
+		text.clear();
+	}
+	if (perfFont) {
+		TTF_CloseFont(perfFont);
+		perfFont = nullptr;
 	}
+#endif
 
-	if (foodTexture) {
-		SDL_DestroyTexture(foodTexture);
-		foodTexture = nullptr;
+	if (atlasTexture) {
+		SDL_DestroyTexture(atlasTexture);
+		atlasTexture = nullptr;
 	}
 
 	if (gameController) {
@@ -4,74 +4,195 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_image.h>
+#include <atomic>
+#include <condition_variable>
 #include <iostream>
-#include "Grid.hpp"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
+#include "Arena.hpp"
+#include "AssetLoader.hpp"
+#include "Autopilot.hpp"
+#include "BoardSnapshot.hpp"
+#include "Grid.hpp"
+#include "NetClient.hpp"
+#include "PerfStats.hpp"
+#include "Random.hpp"
+#include "Replay.hpp"
+#include "Simulation.hpp"
+#include "SpriteBatch.hpp"
+#include "SpscQueue.hpp"
+#include "TextCache.hpp"
+#include "TripleBuffer.hpp"
 
 #define SCREEN_WIDTH    950
 #define SCREEN_HEIGHT   600
 #define WINDOW_WIDTH    SCREEN_WIDTH
 #define WINDOW_HEIGHT   SCREEN_HEIGHT + 50
 #define CELL_SIZE       50
+#define GRID_WIDTH      (SCREEN_WIDTH / CELL_SIZE)   // Default board size in cells; larger boards scroll
+#define GRID_HEIGHT     (SCREEN_HEIGHT / CELL_SIZE)
+#define MAX_GRID_SIZE   8192
 
 class Game {
 private:
-    bool isRunning;
-    bool isGameOver;
+    std::atomic<bool> isRunning;
+    std::atomic<bool> needsRedraw;  // Something changed since the last frame was drawn
+    bool isWindowVisible;           // False while minimized or hidden
     bool mIsMovingUp, mIsMovingDown, mIsMovingLeft, mIsMovingRight;
-    int mDirectionX;
-    int mDirectionY;
-    int currentDirectionX;
-    int currentDirectionY;
-    int score;
     static const float PlayerSpeed;
-    static const int FPS;
-    static const int maxSnakeSize;
-    static const int speedIncreaseThreshold;
-    static Uint32 TimePerFrame;
+    static const int MaxCatchUpTicks;
+    Uint64 mPreviousCounter;      // When the loop last looked at the clock
+    double mTimeSinceLastUpdate;  // Ticks owed to the single-threaded loops, in seconds
     SDL_Window* mWindow;
     SDL_Renderer* mRenderer;
-    SDL_Texture* snakeTexture;
-    SDL_Texture* foodTexture;
-    SDL_Rect headRect, bodyRect, tailRect;
-    SDL_Rect mPlayer;
-    SDL_Rect food;
-    std::vector<SDL_Rect> snake;
+    SDL_Texture* atlasTexture;  // Snake sprite sheet and food packed together
+    SDL_Rect headRect, bodyRect, tailRect, foodRect;
+    SpriteBatch mSpriteBatch;
     TTF_Font* gameOverFont;
+    TextCache mScoreText, mGameOverText, mPlayAgainText;  // Only re-rendered when the text changes
     SDL_Rect playAgainButton;
     Grid mGrid;
+    Simulation mSim;  // Board, snake, food, score and tick rate
+    Autopilot mAutopilot;
+    bool mAutopilotEnabled;  // Toggled with P
+    Random mSeeds;           // One seed per game, so every game can be recorded and replayed
+    std::uint64_t mGameSeed;
+
+    // Recording every game to a file, and playing one back
+    ReplayWriter mRecorder;
+    std::string mRecordPath;
+    int mRecordCount;
+    ReplayPlayer mReplay;
+    bool mIsReplaying;
+    int mReplaySpeed;  // Ticks per update; negative rewinds, zero pauses
+
+    // Many-snake mode, played instead of mSim when set
+    std::unique_ptr<Arena> mArena;
+
+    // Playing on a server: mSim then only mirrors the server's game
+    std::unique_ptr<NetClient> mNetClient;
+
+    // Input on its way to whichever thread steps mSim
+    struct Command {
+        enum Type { TurnUp, TurnDown, TurnLeft, TurnRight, NewGame, ToggleAutopilot, ReplayKey, Pause, Resume };
+        Type type;
+        SDL_Keycode key;  // For ReplayKey
+    };
+
+    // On desktop mSim is stepped on a thread of its own. Input reaches it through mCommands and
+    // it hands each new board back through mBoards; the render loop never touches mSim.
+    std::thread mSimThread;
+    SpscQueue<Command, 64> mCommands;
+    TripleBuffer<BoardSnapshot> mBoards;
+    std::mutex mSimMutex;  // Only for sleeping and waking the thread; the data itself is lock-free
+    std::condition_variable mSimWake;
+    Uint32 mBoardEvent;    // Posted to wake the render loop for a new board
+    std::atomic<bool> mBoardEventPending;
+    BoardSnapshot mLocalBoard;  // Taken just before drawing when mSim is stepped in the render loop
+    bool mIsPaused;             // While the window is unfocused; owned by whichever thread steps mSim
+
+    // Dirty rectangles: the board is kept in a framebuffer between frames and each frame only draws
+    // the cells and score that changed into it. Along an axis where the board is longer than the
+    // view the framebuffer wraps around, so scrolling only draws the cells coming into view.
+    struct DrawnCell { int x, y; std::uint8_t sprite; };
+    bool mDirtyRects;
+    SDL_Texture* mFramebuffer;
+    int mFramebufferWidth, mFramebufferHeight;  // Board part; the score bar is kept below it
+    bool mFramebufferValid;                     // Cleared to draw everything again, e.g. after a resize or another screen
+    int mDrawnColumns;                          // Cell slots per framebuffer row
+    std::vector<DrawnCell> mDrawnCells;         // Which board cell each slot holds and what it shows
+    std::vector<std::uint8_t> mWantedCells;
+    int mDrawnScore;
+
+#if SNAKE_PERF
+    PerfStats mPerf;
+    bool mShowPerf;  // Overlay toggled with F3
+    std::uint64_t mPerfTicksSeen;  // Simulation thread totals already added to mPerf
+    double mPerfUpdateSeen;
+    TTF_Font* perfFont;
+    TextCache mPerfText[4];
+#endif
 
     // Minimal additions for touch input and controller support
     float initialTouchX, initialTouchY;  // For swipe detection
     static const float swipeThreshold;  // Minimum movement for a swipe to be detected
     SDL_GameController* gameController;  // Game controller pointer
+    bool mControllersReady;  // The controller subsystem starts after the first frame
+    AssetLoader mAssetLoader;
     static const int JOYSTICK_THRESHOLD;
+    int joystickAxisState[2];  // Last left stick direction per axis (-1, 0, 1), so held sticks fire once
 
 private:
     void update(float deltaTime);
+    void advanceTicks(double& timeSinceLastUpdate);
+    void runThreaded(bool hasVsync, double timePerFrame);
+    void startSimulation();
+    void stopSimulation();
+    const BoardSnapshot& renderNewestBoard();
+    void simulationLoop();
+    void publishBoard(std::chrono::steady_clock::time_point tickTime, std::uint64_t ticks, double updateSeconds);
+    void captureBoard(BoardSnapshot& board) const;
+    const BoardSnapshot& getShownBoard() const;
+    void sendCommand(Command::Type type, SDL_Keycode key = 0);
+    void applyCommand(const Command& command);
+    bool isPaused() const { return mIsPaused && !mNetClient; }  // A server game goes on regardless
+    void drawFrame(const BoardSnapshot& board, float interpolation);
+    bool createFramebuffer();
+    void releaseFramebuffer();
+    void drawDirtyBoard(const BoardSnapshot& board);
+    void drawScore(const char* text, int barY = 0);
     void processEvent(); // Handle keyboard, touch, and controller input
+    void handleEvent(const SDL_Event& event);
     void handlePlayerInput(SDL_KeyboardEvent key, bool isPressed);
     void handleControllerInput(SDL_JoyButtonEvent button, bool isPressed);  // Handle controller input
     void handleJoystickMotion(SDL_JoyAxisEvent axis);  // Handle joystick motion
     void handleHatMotion(SDL_JoyHatEvent hat); // HAndle hat motion - actually xbox dpad... smh
     bool loadMedia();
-    void placeFood();
-    bool checkSelfCollision();
+    void initControllers();
+    void onFrameShown();
     void resetGame();
-    void render();
-    void clean();
-    void increaseSpeed();
+    void addSegmentSprite(const BoardSegment& segment, float interpolation, int screenX, int screenY, int headTurns);
+    static int cameraOffset(float focus, int boardSize, int viewSize);
     static void emscripten_loop(void* arg);
+    static void emscripten_frame(void* arg);
 
     // Swipe detection functions
     void handleSwipeUp();
     void handleSwipeDown();
     void handleSwipeLeft();
     void handleSwipeRight();
+    void steerAutopilot();
+    void startGame();
+    void playReplay();
+    void handleReplayInput(SDL_Keycode key);
+    void renderArena();
+#if SNAKE_PERF
+    void renderPerfOverlay(const BoardSnapshot& board);
+#endif
 
 public:
-    Game();
+    Game(int gridWidth = GRID_WIDTH, int gridHeight = GRID_HEIGHT);
     bool init();
+    bool initOffscreen(SDL_Surface* target);
+    void clean();
+    void setAutopilot(Autopilot::Strategy strategy, int budgetMicroseconds);
+    bool startRecording(const char* path);  // Later games go to path-2, path-3, ...
+    bool openReplay(const char* path);      // The board must match the replay's size
+    bool openPerfCsv(const char* path);     // Per-frame timings, only in builds with SNAKE_PERF
+    void setArena(const ArenaConfig& config);  // The player is snake 0 if the config has one
+    void setNetClient(NetClient* client);      // Takes ownership; the client must have a board already
+    void setDirtyRects(bool enabled);          // Only redraw what changed; the snake then moves a cell at a time
+
+    // Draw one frame of mSim as it is now, the given fraction of the way into the next tick
+    void render(float interpolation);
+
+    // Draw a board taken with captureView, e.g. from a simulation the game does not own
+    void renderBoard(const BoardSnapshot& board, float interpolation);
+    void captureView(const Simulation& sim, BoardSnapshot& board) const;  // What the view around sim's head needs
+    Simulation& getSimulation() { return mSim; }
     void run();
 };
 
@@ -0,0 +1,176 @@
+#include "GameServer.hpp"
+#include "Net.hpp"
+#include "Trace.hpp"
+#include <chrono>
+#include <iostream>
+
+const std::size_t GameServer::MaxPendingBytes = 256 * 1024;
+
+
+GameServer::GameServer(int gridWidth, int gridHeight, std::uint64_t seed)
+	: mGridWidth(gridWidth)
+	, mGridHeight(gridHeight)
+	, mListener(-1)
+	, mSeeds(seed)
+	, mStats()
+{
+}
+
+GameServer::~GameServer() {
+	for (const std::unique_ptr<Session>& session : mSessions) {
+		Net::closeSocket(session->socket);
+	}
+	Net::closeSocket(mListener);
+}
+
+bool GameServer::listen(const char* address) {
+	Net::raiseSocketLimit();
+	Net::closeSocket(mListener);
+	mListener = Net::listenOn(address);
+	return mListener >= 0;
+}
+
+ServerStats GameServer::run(double seconds) {
+	mStats = ServerStats();
+	auto start = std::chrono::steady_clock::now();
+	auto elapsed = [start]() { return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); };
+
+	std::vector<Net::Wait> waits;
+	while (mListener >= 0) {
+		double now = elapsed();
+		if (seconds > 0.0 && now >= seconds) {
+			break;
+		}
+
+		// Sleep until a socket needs attention or the earliest game is due to tick
+		double wake = now + 0.05;
+		waits.clear();
+		waits.push_back({ mListener, false, false });
+		for (const std::unique_ptr<Session>& session : mSessions) {
+			if (!session->sim.isGameOver() && session->nextTick < wake) {
+				wake = session->nextTick;
+			}
+			waits.push_back({ session->socket, !session->out.empty(), false });
+		}
+		Net::waitFor(waits, wake > now ? static_cast<int>((wake - now) * 1000.0) + 1 : 0);
+
+		TRACE_SCOPE("serverTick");
+		now = elapsed();
+		for (std::size_t i = 1; i < waits.size(); ++i) {
+			if (waits[i].ready) {
+				readInput(*mSessions[i - 1], now);
+			}
+		}
+		if (waits[0].ready) {
+			acceptClients(now);
+		}
+
+		// Everything a session produced since the last pass goes out in one write
+		for (const std::unique_ptr<Session>& session : mSessions) {
+			tick(*session, now);
+			flush(*session);
+		}
+
+		for (std::size_t i = 0; i < mSessions.size();) {
+			if (mSessions[i]->closed) {
+				Net::closeSocket(mSessions[i]->socket);
+				mSessions[i] = std::move(mSessions.back());
+				mSessions.pop_back();
+			}
+			else {
+				++i;
+			}
+		}
+	}
+
+	mStats.seconds = elapsed();
+	return mStats;
+}
+
+void GameServer::acceptClients(double now) {
+	int socket;
+	while ((socket = Net::acceptClient(mListener)) >= 0) {
+		mSessions.emplace_back(new Session(socket, mGridWidth, mGridHeight));
+		startGame(*mSessions.back(), now);
+
+		mStats.sessions++;
+		if (mSessions.size() > mStats.peakSessions) {
+			mStats.peakSessions = mSessions.size();
+		}
+	}
+}
+
+void GameServer::startGame(Session& session, double now) {
+	session.sim.reset(mSeeds.next());
+	session.nextTick = now + session.sim.getTimePerTick();
+	Net::writeSnapshot(session.sim, session.out);
+}
+
+// Turns go straight to the session's game, as keys or swipes would in the window
+void GameServer::readInput(Session& session, double now) {
+	unsigned char input[256];
+	long received = Net::receiveSome(session.socket, input, sizeof(input));
+	if (received < 0) {
+		session.closed = true;
+		return;
+	}
+
+	for (long i = 0; i < received; ++i) {
+		switch (input[i]) {
+		case 'U': session.sim.turnUp(); break;
+		case 'D': session.sim.turnDown(); break;
+		case 'L': session.sim.turnLeft(); break;
+		case 'R': session.sim.turnRight(); break;
+		case 'N':
+			if (session.sim.isGameOver()) {
+				startGame(session, now);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+// Step the game for every tick that is due, catching up at most a few after a stall
+void GameServer::tick(Session& session, double now) {
+	const int MaxCatchUpTicks = 5;
+
+	for (int ticks = 0; !session.sim.isGameOver() && now >= session.nextTick; ++ticks) {
+		if (ticks == MaxCatchUpTicks) {
+			session.nextTick = now + session.sim.getTimePerTick();
+			break;
+		}
+
+		Cell food = session.sim.getFood();
+		std::size_t length = session.sim.getSnake().size();
+		session.sim.step();
+		Net::writeDelta(session.sim, food, length, session.out);
+
+		session.nextTick += session.sim.getTimePerTick();
+		mStats.ticks++;
+	}
+}
+
+void GameServer::flush(Session& session) {
+	if (session.out.empty() || session.closed) {
+		return;
+	}
+
+	long sent = Net::sendSome(session.socket, session.out.data(), session.out.size());
+	if (sent < 0) {
+		session.closed = true;
+		return;
+	}
+	if (sent > 0) {
+		session.out.erase(session.out.begin(), session.out.begin() + sent);
+		mStats.bytesSent += sent;
+		mStats.writes++;
+	}
+
+	// A client that stopped reading would otherwise make the server buffer forever
+	if (session.out.size() > MaxPendingBytes) {
+		session.closed = true;
+		mStats.dropped++;
+	}
+}
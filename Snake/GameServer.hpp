@@ -0,0 +1,64 @@
+#ifndef GAME_SERVER_HPP
+#define GAME_SERVER_HPP
+
+#include "Random.hpp"
+#include "Simulation.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct ServerStats {
+    std::uint64_t sessions;      // Clients accepted
+    std::uint64_t peakSessions;  // Most clients connected at once
+    std::uint64_t dropped;       // Clients cut off for not reading their updates
+    std::uint64_t ticks;         // Over every session
+    std::uint64_t bytesSent;
+    std::uint64_t writes;        // Send calls; at most one per session per tick
+    double seconds;
+};
+
+// Plays one game per connected client with no window. The server owns the games: clients
+// only send turns and receive snapshots and per-tick deltas (see Net.hpp). One thread
+// polls every socket, steps each game when its tick is due and sends everything a
+// session produced in one write.
+class GameServer {
+public:
+    GameServer(int gridWidth, int gridHeight, std::uint64_t seed);
+    ~GameServer();
+
+    bool listen(const char* address);
+
+    // Serve clients for the given time, or until the process is stopped if it is zero
+    ServerStats run(double seconds);
+
+private:
+    GameServer(const GameServer&);             // Not copyable
+    GameServer& operator=(const GameServer&);
+
+    struct Session {
+        Session(int socket, int gridWidth, int gridHeight) : socket(socket), sim(gridWidth, gridHeight), nextTick(0.0), closed(false) {}
+
+        int socket;
+        Simulation sim;
+        double nextTick;                  // Server time the next step is due
+        std::vector<unsigned char> out;   // Written this tick, or still waiting for the socket
+        bool closed;
+    };
+
+    void acceptClients(double now);
+    void startGame(Session& session, double now);
+    void readInput(Session& session, double now);
+    void tick(Session& session, double now);
+    void flush(Session& session);
+
+    static const std::size_t MaxPendingBytes;
+
+private:
+    int mGridWidth, mGridHeight;
+    int mListener;
+    Random mSeeds;
+    std::vector<std::unique_ptr<Session>> mSessions;
+    ServerStats mStats;
+};
+
+#endif // GAME_SERVER_HPP
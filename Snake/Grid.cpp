@@ -1,62 +1,173 @@
 #include "Grid.hpp"
+#include "PerfStats.hpp"
 
 
-Grid::Grid(int screenWidth, int screenHeight, int cellSize)
-	: mScreenWidth(screenWidth)
-	, mScreenHeight(screenHeight)
-	, mCellSize(cellSize)
+Grid::Grid(int gridWidth, int gridHeight, int cellSize)
+	: mCellSize(cellSize)
+	, mGridWidth(gridWidth)
+	, mGridHeight(gridHeight)
+	, mBoardTexture(nullptr)
+	, mTextureWidth(0)
+	, mTextureHeight(0)
+	, mBakedWidth(0)
+	, mBakedHeight(0)
+	, mCanBake(true)
 {
-	mGridWidth = screenWidth / cellSize;
-	mGridHeight = screenHeight / cellSize;
 }
 
-// Draw the grid lines on the renderer
-void Grid::draw(SDL_Renderer* renderer, int offsetY) const {
-    // Define two colors for the checkered pattern
-    SDL_Color lightColor = { 75, 105, 47, SDL_ALPHA_OPAQUE }; // Light gray
-    SDL_Color darkColor = { 34, 47, 23, SDL_ALPHA_OPAQUE };  // Dark gray
-
-    // Loop through the rows and columns of the grid
-    for (int y = 0; y < mScreenHeight; y += mCellSize) {
-        for (int x = 0; x < mScreenWidth; x += mCellSize) {
-
-            // Check if the current cell is in an "even" or "odd" position for checkered pattern
-            bool isDark = ((x / mCellSize + y / mCellSize) % 2 == 0);
-
-            // Set color based on the checkered pattern
-            SDL_SetRenderDrawColor(renderer, isDark ? darkColor.r : lightColor.r,
-                isDark ? darkColor.g : lightColor.g,
-                isDark ? darkColor.b : lightColor.b,
-                SDL_ALPHA_OPAQUE);
-
-            // Draw the filled rectangle for each cell in the grid
-            SDL_Rect cellRect = { x, y + offsetY, mCellSize, mCellSize };
-            SDL_RenderFillRect(renderer, &cellRect);
-        }
-    }
-
-    // Optionally, draw the grid border or outer lines
-    SDL_SetRenderDrawColor(renderer, 34, 47, 23, SDL_ALPHA_OPAQUE);  // Dark gray border
-    //SDL_RenderDrawLine(renderer, 0, offsetY, 0, mScreenHeight + offsetY); // Left edge
-    //SDL_RenderDrawLine(renderer, mScreenWidth, offsetY, mScreenWidth, mScreenHeight + offsetY); // Right edge
-    SDL_RenderDrawLine(renderer, 0, offsetY, mScreenWidth, offsetY); // Top edge
-    //SDL_RenderDrawLine(renderer, 0, mScreenHeight + offsetY, mScreenWidth, mScreenHeight + offsetY); // Bottom edge
+// Define two colors for the checkered pattern
+static const SDL_Color lightColor = { 75, 105, 47, SDL_ALPHA_OPAQUE }; // Light gray
+static const SDL_Color darkColor = { 34, 47, 23, SDL_ALPHA_OPAQUE };  // Dark gray
+
+// Size of the baked tile along one axis. The pattern repeats every two cells, so a tile one
+// period larger than the viewport covers it at any scroll offset. Small boards are baked whole.
+static int tileSize(int boardSize, int viewSize, int period) {
+	int size = (viewSize / period + 2) * period;
+	return size < boardSize ? size : boardSize;
+}
+
+void Grid::draw(SDL_Renderer* renderer, const SDL_Rect& viewport, int cameraX, int cameraY) {
+	drawArea(renderer, viewport, cameraX, cameraY, viewport);
+}
+
+// Draw the visible part of the board inside the clip rectangle with a single copy of the baked texture
+void Grid::drawArea(SDL_Renderer* renderer, const SDL_Rect& viewport, int cameraX, int cameraY, const SDL_Rect& clip) {
+	int screenX = viewport.x - cameraX;  // Where board pixel (0, 0) lands on screen
+	int screenY = viewport.y - cameraY;
+
+	// Visible board area, in board pixels
+	SDL_Rect view = { cameraX, cameraY, viewport.w, viewport.h };
+	SDL_Rect clipArea = { clip.x - screenX, clip.y - screenY, clip.w, clip.h };
+	SDL_Rect board = { 0, 0, getPixelWidth(), getPixelHeight() };
+	SDL_Rect shown, area;
+	if (!SDL_IntersectRect(&view, &clipArea, &shown) || !SDL_IntersectRect(&shown, &board, &area)) {
+		return;
+	}
+
+	// Rebuild the tile when the grid size, cell size or viewport changed
+	int period = 2 * mCellSize;
+	int textureWidth = tileSize(getPixelWidth(), viewport.w, period);
+	int textureHeight = tileSize(getPixelHeight(), viewport.h, period);
+	if (mBakedWidth != textureWidth || mBakedHeight != textureHeight) {
+		invalidate();
+		mBakedWidth = textureWidth;
+		mBakedHeight = textureHeight;
+	}
+
+	if (mCanBake && !mBoardTexture) {
+		mCanBake = bake(renderer);
+	}
+
+	if (mBoardTexture) {
+		// A tile smaller than the board is scrolled modulo the pattern period
+		SDL_Rect src = { area.x, area.y, area.w, area.h };
+		if (mTextureWidth < getPixelWidth()) src.x %= period;
+		if (mTextureHeight < getPixelHeight()) src.y %= period;
+
+		SDL_Rect dst = { screenX + area.x, screenY + area.y, area.w, area.h };
+		SDL_RenderCopy(renderer, mBoardTexture, &src, &dst);
+		PERF_DRAW_CALLS(1);
+	}
+	else {
+		// No render targets, fall back to two batched fills of the visible cells
+		SDL_Rect clip = { screenX + area.x, screenY + area.y, area.w, area.h };
+		SDL_RenderSetClipRect(renderer, &clip);
+		drawCells(renderer, area, screenX, screenY);
+		SDL_RenderSetClipRect(renderer, NULL);
+	}
+
+	// Draw the top edge of the board when it is in view
+	if (area.y == 0) {
+		SDL_SetRenderDrawColor(renderer, 34, 47, 23, SDL_ALPHA_OPAQUE);  // Dark gray border
+		SDL_RenderDrawLine(renderer, screenX + area.x, screenY, screenX + area.x + area.w - 1, screenY); // Top edge
+		PERF_DRAW_CALLS(1);
+	}
+}
+
+bool Grid::bake(SDL_Renderer* renderer) {
+	release();
+
+	if (!SDL_RenderTargetSupported(renderer)) {
+		return false;
+	}
+
+	mBoardTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, mBakedWidth, mBakedHeight);
+	if (!mBoardTexture) {
+		return false;
+	}
+	PERF_TEXTURE_UPLOAD();
+
+	SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+	if (SDL_SetRenderTarget(renderer, mBoardTexture) != 0) {
+		release();
+		return false;
+	}
+
+	SDL_Rect tile = { 0, 0, mBakedWidth, mBakedHeight };
+	drawCells(renderer, tile, 0, 0);
+
+	SDL_SetRenderTarget(renderer, previousTarget);
+
+	mTextureWidth = mBakedWidth;
+	mTextureHeight = mBakedHeight;
+	return true;
+}
+
+void Grid::drawCells(SDL_Renderer* renderer, const SDL_Rect& area, int screenX, int screenY) {
+	mLightCells.clear();
+	mDarkCells.clear();
+
+	// Loop through the rows and columns of the grid that overlap the area
+	int firstX = area.x / mCellSize, lastX = (area.x + area.w - 1) / mCellSize;
+	int firstY = area.y / mCellSize, lastY = (area.y + area.h - 1) / mCellSize;
+	for (int y = firstY; y <= lastY; ++y) {
+		for (int x = firstX; x <= lastX; ++x) {
+
+			// Check if the current cell is in an "even" or "odd" position for checkered pattern
+			bool isDark = ((x + y) % 2 == 0);
+
+			SDL_Rect cellRect = { screenX + x * mCellSize, screenY + y * mCellSize, mCellSize, mCellSize };
+			(isDark ? mDarkCells : mLightCells).push_back(cellRect);
+		}
+	}
+
+	SDL_SetRenderDrawColor(renderer, lightColor.r, lightColor.g, lightColor.b, SDL_ALPHA_OPAQUE);
+	SDL_RenderFillRects(renderer, mLightCells.data(), static_cast<int>(mLightCells.size()));
+
+	SDL_SetRenderDrawColor(renderer, darkColor.r, darkColor.g, darkColor.b, SDL_ALPHA_OPAQUE);
+	SDL_RenderFillRects(renderer, mDarkCells.data(), static_cast<int>(mDarkCells.size()));
+	PERF_DRAW_CALLS(2);
+}
+
+void Grid::invalidate() {
+	release();
+	mCanBake = true;
+}
+
+void Grid::release() {
+	if (mBoardTexture) {
+		SDL_DestroyTexture(mBoardTexture);
+		mBoardTexture = nullptr;
+	}
 }
 
 
 void Grid::drawBoundary(SDL_Renderer* renderer, int offsetY) const {
+	int width = getPixelWidth();
+	int height = getPixelHeight();
+
 	SDL_SetRenderDrawColor(renderer, 211, 211, 211, SDL_ALPHA_OPAQUE); // Light gray color for border
 
 	// Draw the vertical boundary lines (left and right edges) with "thickness"
 	for (int i = -2; i <= 2; ++i) {  // Adjust number of iterations to control thickness
-		SDL_RenderDrawLine(renderer, 0, offsetY + i, 0, mScreenHeight + offsetY + i); // Left edge
-		SDL_RenderDrawLine(renderer, mScreenWidth, offsetY + i, mScreenWidth, mScreenHeight + offsetY + i); // Right edge
+		SDL_RenderDrawLine(renderer, 0, offsetY + i, 0, height + offsetY + i); // Left edge
+		SDL_RenderDrawLine(renderer, width, offsetY + i, width, height + offsetY + i); // Right edge
 	}
 
 	// Draw the horizontal boundary lines (top and bottom edges) with "thickness"
 	for (int i = 0; i <= 4; ++i) {  // Adjust number of iterations to control thickness
-		SDL_RenderDrawLine(renderer, 0, offsetY + i, mScreenWidth, offsetY + i); // Top edge
-		SDL_RenderDrawLine(renderer, 0, mScreenHeight + offsetY + i, mScreenWidth, mScreenHeight + offsetY + i); // Bottom edge
+		SDL_RenderDrawLine(renderer, 0, offsetY + i, width, offsetY + i); // Top edge
+		SDL_RenderDrawLine(renderer, 0, height + offsetY + i, width, height + offsetY + i); // Bottom edge
 	}
 
 }
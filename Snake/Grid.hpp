@@ -2,32 +2,61 @@
 #define GRID_HPP
 
 #include <SDL2/SDL.h>
+#include <vector>
 
 class Grid {
 public:
     // Initialize grid properties
-    Grid(int screenWidth, int screenHeight, int cellSize);
+    Grid(int gridWidth, int gridHeight, int cellSize);
 
-    // Draw the grid
-    void draw(SDL_Renderer* renderer, int offsetY) const;
+    // Draw the part of the board inside the viewport. The camera is the board pixel shown at
+    // the viewport's top left corner; negative values leave a margin around a small board.
+    // Only visible cells are touched, so the cost depends on the viewport and not the board.
+    void draw(SDL_Renderer* renderer, const SDL_Rect& viewport, int cameraX, int cameraY);
+
+    // Draw only the part of the board inside a screen rectangle, e.g. one cell, laid out as draw()
+    // lays out the whole viewport
+    void drawArea(SDL_Renderer* renderer, const SDL_Rect& viewport, int cameraX, int cameraY, const SDL_Rect& clip);
 
     // Draw only outside lines
     void drawBoundary(SDL_Renderer* renderer, int offsetY) const;
 
+    // Drop the baked board so it is rebuilt on the next draw (e.g. after the render targets were reset)
+    void invalidate();
+
+    // Free the baked board; call before the renderer is destroyed
+    void release();
+
     // Getters for cell size and grid width/height in cells
     int getCellSize() const { return mCellSize; }
     int getGridWidth() const { return mGridWidth; }
     int getGridHeight() const { return mGridHeight; }
+    int getPixelWidth() const { return mGridWidth * mCellSize; }
+    int getPixelHeight() const { return mGridHeight * mCellSize; }
 
     // Snap a position to the nearest grid cell
     SDL_Point snapToGrid(int x, int y) const;
 
 private:
-    int mScreenWidth;
-    int mScreenHeight;
+    // Render a checkerboard tile big enough to cover the viewport at any scroll position
+    bool bake(SDL_Renderer* renderer);
+
+    // Fill the cells of a board area one color at a time, used when render targets are not available
+    void drawCells(SDL_Renderer* renderer, const SDL_Rect& area, int screenX, int screenY);
+
+private:
     int mCellSize;
     int mGridWidth;
     int mGridHeight;
+
+    // Baked checkerboard and the layout it was baked for
+    SDL_Texture* mBoardTexture;
+    int mTextureWidth, mTextureHeight;
+    int mBakedWidth, mBakedHeight;
+    bool mCanBake;
+
+    // Batched fallback path
+    std::vector<SDL_Rect> mLightCells, mDarkCells;
 };
 
 #endif
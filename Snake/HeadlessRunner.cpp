@@ -0,0 +1,153 @@
+#include "HeadlessRunner.hpp"
+#include <chrono>
+
+
+HeadlessRunner::HeadlessRunner(int gridWidth, int gridHeight, Autopilot* autopilot, std::uint64_t seed)
+	: mSim(gridWidth, gridHeight, seed)
+	, mAutopilot(autopilot)
+	, mRandom(Random::hash(seed))
+	, mTicksSinceFood(0)
+	, mLastScore(0)
+{
+}
+
+HeadlessStats HeadlessRunner::run(std::uint64_t ticks) {
+	HeadlessStats stats = {};
+
+	auto start = std::chrono::steady_clock::now();
+
+	restart();
+	for (std::uint64_t i = 0; i < ticks; ++i) {
+		playTick(stats);
+	}
+
+	stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return stats;
+}
+
+HeadlessStats HeadlessRunner::runGames(std::uint64_t games) {
+	HeadlessStats stats = {};
+
+	auto start = std::chrono::steady_clock::now();
+
+	restart();
+	while (stats.games < games) {
+		playTick(stats);
+	}
+
+	stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return stats;
+}
+
+bool HeadlessRunner::playTick(HeadlessStats& stats) {
+	if (!advance(stats)) {
+		return false;
+	}
+
+	record(stats);
+	restart();
+	return true;
+}
+
+GameResult HeadlessRunner::playGame(std::uint64_t seed, HeadlessStats& stats) {
+	mSim.reset(seed);
+	mRandom.seed(Random::hash(seed));
+	mTicksSinceFood = 0;
+	mLastScore = 0;
+
+	GameResult result = {};
+	do {
+		result.ticks++;
+	} while (!advance(stats));
+
+	record(stats);
+
+	result.score = mSim.getScore();
+	result.length = static_cast<int>(mSim.getSnake().size());
+	result.stalled = !mSim.isGameOver();
+	result.outcome = mSim.getOutcome();
+	return result;
+}
+
+bool HeadlessRunner::advance(HeadlessStats& stats) {
+	steer(stats);
+	mSim.step();
+	stats.ticks++;
+
+	if (mSim.getScore() != mLastScore) {
+		mLastScore = mSim.getScore();
+		mTicksSinceFood = 0;
+	}
+	else {
+		mTicksSinceFood++;
+	}
+
+	// A snake that has not eaten in two full laps of the board is going in circles
+	std::uint64_t stallLimit = 2ull * mSim.getGridWidth() * mSim.getGridHeight() + 16;
+
+	return mSim.isGameOver() || mTicksSinceFood >= stallLimit;
+}
+
+void HeadlessRunner::restart() {
+	mSim.reset();
+	mTicksSinceFood = 0;
+	mLastScore = 0;
+}
+
+void HeadlessRunner::record(HeadlessStats& stats) const {
+	stats.games++;
+	stats.totalScore += mSim.getScore();
+	stats.totalLength += mSim.getSnake().size();
+	if (mSim.getScore() > stats.bestScore) {
+		stats.bestScore = mSim.getScore();
+	}
+}
+
+void HeadlessRunner::steer(HeadlessStats& stats) {
+	if (!mAutopilot) {
+		wander();
+		return;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	Cell direction = mAutopilot->decide(mSim);
+	stats.decisionSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	stats.decisions++;
+
+	if (direction.y < 0) mSim.turnUp();
+	else if (direction.y > 0) mSim.turnDown();
+	else if (direction.x < 0) mSim.turnLeft();
+	else if (direction.x > 0) mSim.turnRight();
+}
+
+// Wander randomly, turning away from the walls when about to hit one
+void HeadlessRunner::wander() {
+	const Cell& head = mSim.getHead();
+	int dirX = mSim.getDirectionX();
+	int dirY = mSim.getDirectionY();
+
+	int nextX = head.x + dirX;
+	int nextY = head.y + dirY;
+	bool blocked = nextX < 0 || nextX >= mSim.getGridWidth() || nextY < 0 || nextY >= mSim.getGridHeight();
+
+	if (!blocked && (dirX != 0 || dirY != 0) && mRandom.nextBelow(4) != 0) {
+		return;
+	}
+
+	if (dirX == 0) {
+		if (head.x == 0 || (head.x < mSim.getGridWidth() - 1 && mRandom.nextBool())) {
+			mSim.turnRight();
+		}
+		else {
+			mSim.turnLeft();
+		}
+	}
+	else {
+		if (head.y == 0 || (head.y < mSim.getGridHeight() - 1 && mRandom.nextBool())) {
+			mSim.turnDown();
+		}
+		else {
+			mSim.turnUp();
+		}
+	}
+}
@@ -0,0 +1,66 @@
+#ifndef HEADLESS_RUNNER_HPP
+#define HEADLESS_RUNNER_HPP
+
+#include "Autopilot.hpp"
+#include "Random.hpp"
+#include "Simulation.hpp"
+#include <cstdint>
+
+// How a single headless game went
+struct GameResult {
+    int score;
+    int length;
+    std::uint64_t ticks;
+    bool stalled;                 // Stopped for going too long without eating
+    Simulation::Outcome outcome;  // Playing if the game was stopped for stalling
+};
+
+// Totals gathered over a headless run
+struct HeadlessStats {
+    std::uint64_t ticks;
+    std::uint64_t games;
+    std::uint64_t totalScore;
+    std::uint64_t totalLength;     // Snake length when each game ended
+    int bestScore;
+    std::uint64_t decisions;       // Autopilot decisions made
+    double decisionSeconds;        // Time spent deciding
+    double seconds;
+};
+
+// Steps a Simulation as fast as possible with no window, restarting it whenever a game ends.
+// Without an autopilot the snake wanders randomly.
+class HeadlessRunner {
+public:
+    HeadlessRunner(int gridWidth, int gridHeight, Autopilot* autopilot = nullptr, std::uint64_t seed = 0);
+
+    // Play for a fixed number of ticks
+    HeadlessStats run(std::uint64_t ticks);
+
+    // Play a fixed number of complete games
+    HeadlessStats runGames(std::uint64_t games);
+
+    // Play one complete game from the given seed; the same seed always gives the same game
+    // as long as the autopilot is not cut short by its time budget
+    GameResult playGame(std::uint64_t seed, HeadlessStats& stats);
+
+private:
+    // Advance one tick; returns true when a game just ended (and restarts it)
+    bool playTick(HeadlessStats& stats);
+    // Advance one tick; returns true once the game is over or has stalled
+    bool advance(HeadlessStats& stats);
+    void restart();
+    void record(HeadlessStats& stats) const;
+
+    // Pick the next turn for the simulated player
+    void steer(HeadlessStats& stats);
+    void wander();
+
+private:
+    Simulation mSim;
+    Autopilot* mAutopilot;
+    Random mRandom;  // Wandering
+    std::uint64_t mTicksSinceFood;
+    int mLastScore;
+};
+
+#endif // HEADLESS_RUNNER_HPP
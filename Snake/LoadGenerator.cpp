@@ -0,0 +1,127 @@
+#include "LoadGenerator.hpp"
+#include "Net.hpp"
+#include <chrono>
+
+
+LoadGenerator::LoadGenerator(std::uint64_t seed)
+	: mRandom(seed)
+{
+}
+
+LoadStats LoadGenerator::run(const char* address, int clients, double seconds) {
+	LoadStats stats = {};
+	Net::raiseSocketLimit();
+
+	mPlayers.clear();
+	for (int i = 0; i < clients; ++i) {
+		std::unique_ptr<Player> player(new Player());
+		player->nextTurn = 0.0;
+		player->restarting = false;
+		if (!player->net.connect(address)) {
+			stats.failed++;
+			continue;
+		}
+		mPlayers.push_back(std::move(player));
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<Net::Wait> waits;
+	for (;;) {
+		double now = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		if (now >= seconds) {
+			stats.seconds = now;
+			break;
+		}
+
+		for (const std::unique_ptr<Player>& player : mPlayers) {
+			play(*player, now, stats);
+		}
+
+		// Sleep until a server update arrives; turns are not that urgent
+		waits.clear();
+		for (const std::unique_ptr<Player>& player : mPlayers) {
+			if (player->net.isConnected()) {
+				waits.push_back({ player->net.getSocket(), false, false });
+			}
+		}
+		Net::waitFor(waits, 5);
+	}
+
+	for (const std::unique_ptr<Player>& player : mPlayers) {
+		stats.bytesReceived += player->net.getBytesReceived();
+		if (player->mirror) {
+			stats.connected++;
+		}
+	}
+	mPlayers.clear();
+	return stats;
+}
+
+void LoadGenerator::play(Player& player, double now, LoadStats& stats) {
+	if (!player.net.isConnected()) {
+		return;
+	}
+
+	if (!player.mirror) {
+		if (!player.net.receive()) {
+			stats.lost++;
+			return;
+		}
+		if (!player.net.hasBoard()) {
+			return;
+		}
+		player.mirror.reset(new Simulation(player.net.getGridWidth(), player.net.getGridHeight()));
+		stats.games++;
+	}
+
+	Simulation& mirror = *player.mirror;
+	std::uint64_t tick = mirror.getTick();
+	if (!player.net.update(mirror)) {
+		stats.lost++;
+		return;
+	}
+	stats.ticks += mirror.getTick() >= tick ? mirror.getTick() - tick : mirror.getTick();  // A new game starts from zero
+
+	if (mirror.isGameOver()) {
+		if (!player.restarting) {
+			player.net.newGame();
+			player.restarting = true;
+			stats.games++;
+		}
+		return;
+	}
+	player.restarting = false;
+
+	// A few decisions per tick is plenty, and keeps the input stream realistic
+	if (now >= player.nextTurn) {
+		player.nextTurn = now + mirror.getTimePerTick() * 0.5;
+		Cell move = pickMove(mirror);
+		player.net.turn(move.x, move.y);
+	}
+}
+
+// Usually keep going; otherwise any direction that does not run into something
+Cell LoadGenerator::pickMove(const Simulation& mirror) {
+	Cell ahead = { mirror.getDirectionX(), mirror.getDirectionY() };
+	if ((ahead.x != 0 || ahead.y != 0) && mRandom.nextBelow(4) != 0 &&
+		isSafe(mirror, { mirror.getHead().x + ahead.x, mirror.getHead().y + ahead.y })) {
+		return ahead;
+	}
+
+	int first = mRandom.nextBelow(4);
+	for (int i = 0; i < 4; ++i) {
+		const Cell& direction = Net::Directions[(first + i) % 4];
+		if (direction.x == -ahead.x && direction.y == -ahead.y) continue;
+		if (isSafe(mirror, { mirror.getHead().x + direction.x, mirror.getHead().y + direction.y })) {
+			return direction;
+		}
+	}
+	return Net::Directions[first];
+}
+
+bool LoadGenerator::isSafe(const Simulation& mirror, const Cell& cell) const {
+	if (cell.x < 0 || cell.x >= mirror.getGridWidth() || cell.y < 0 || cell.y >= mirror.getGridHeight()) {
+		return false;
+	}
+	return !mirror.isOccupied(cell) || cell == mirror.getSnake().tail();
+}
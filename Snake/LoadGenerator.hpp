@@ -0,0 +1,47 @@
+#ifndef LOAD_GENERATOR_HPP
+#define LOAD_GENERATOR_HPP
+
+#include "NetClient.hpp"
+#include "Random.hpp"
+#include "Simulation.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct LoadStats {
+    int connected;         // Clients that got a board from the server
+    int failed;            // Clients that could not connect
+    int lost;              // Connections dropped, or updates that did not apply to the mirror
+    std::uint64_t games;   // Games started, including each client's first
+    std::uint64_t ticks;   // Ticks applied to the mirrors
+    std::uint64_t bytesReceived;
+    double seconds;
+};
+
+// Stands in for many players at once to load a GameServer. Each client keeps a mirror of its
+// game from the server's updates and steers it away from walls and its own body, starting a
+// new game whenever one ends. Any update that does not fit a mirror counts as a lost client.
+class LoadGenerator {
+public:
+    explicit LoadGenerator(std::uint64_t seed);
+
+    LoadStats run(const char* address, int clients, double seconds);
+
+private:
+    struct Player {
+        NetClient net;
+        std::unique_ptr<Simulation> mirror;  // Created once the board size is known
+        double nextTurn;
+        bool restarting;                     // Asked for a new game, waiting for its snapshot
+    };
+
+    void play(Player& player, double now, LoadStats& stats);
+    Cell pickMove(const Simulation& mirror);
+    bool isSafe(const Simulation& mirror, const Cell& cell) const;
+
+private:
+    Random mRandom;
+    std::vector<std::unique_ptr<Player>> mPlayers;
+};
+
+#endif // LOAD_GENERATOR_HPP
@@ -1,8 +1,453 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include "Arena.hpp"
 #include "Game.hpp"
+#include "GameServer.hpp"
+#include "HeadlessRunner.hpp"
+#include "LoadGenerator.hpp"
+#include "NetClient.hpp"
+#include "Replay.hpp"
+#include "StartupTimer.hpp"
+#include "TickClock.hpp"
+#include "Tournament.hpp"
+#include "Trace.hpp"
+#include "VideoExport.hpp"
+
+// Step the simulation with no window, e.g. "Snake --headless 10000000"
+static int runHeadless(std::uint64_t ticks, int gridWidth, int gridHeight, std::uint64_t seed) {
+	HeadlessRunner runner(gridWidth, gridHeight, nullptr, seed);
+	HeadlessStats stats = runner.run(ticks);
+
+	std::cout << "Ticks: " << stats.ticks << std::endl
+		<< "Games: " << stats.games << std::endl
+		<< "Best score: " << stats.bestScore << std::endl
+		<< "Average score: " << (stats.games ? double(stats.totalScore) / stats.games : 0.0) << std::endl
+		<< "Ticks per second: " << (stats.seconds > 0.0 ? stats.ticks / stats.seconds : 0.0) << std::endl;
+	return 0;
+}
+
+// Play whole games with the autopilot, e.g. "Snake --autopilot astar --autopilot-bench 100"
+static int runAutopilotBench(std::uint64_t games, int gridWidth, int gridHeight, Autopilot::Strategy strategy, int budgetMicroseconds, std::uint64_t seed) {
+	Autopilot autopilot(strategy, budgetMicroseconds, gridWidth, gridHeight);
+	HeadlessRunner runner(gridWidth, gridHeight, &autopilot, seed);
+	HeadlessStats stats = runner.runGames(games);
+
+	std::cout << "Strategy: " << Autopilot::getStrategyName(strategy) << std::endl
+		<< "Games: " << stats.games << std::endl
+		<< "Ticks: " << stats.ticks << std::endl
+		<< "Best score: " << stats.bestScore << std::endl
+		<< "Average final length: " << (stats.games ? double(stats.totalLength) / stats.games : 0.0) << std::endl
+		<< "Decisions per second: " << (stats.decisionSeconds > 0.0 ? stats.decisions / stats.decisionSeconds : 0.0) << std::endl
+		<< "Average decision time (us): " << (stats.decisions ? stats.decisionSeconds * 1e6 / stats.decisions : 0.0) << std::endl;
+	return 0;
+}
+
+// Play many games across every core, e.g. "Snake --autopilot astar --tournament 1000000 --seed 42"
+static int runTournament(const TournamentConfig& config) {
+	TournamentStats stats = Tournament(config).run();
+	double games = stats.games ? double(stats.games) : 1.0;
+
+	std::cout << "Policy: " << (config.useAutopilot ? Autopilot::getStrategyName(config.strategy) : "wander") << std::endl
+		<< "Seed: " << config.seed << std::endl
+		<< "Threads: " << stats.threads << std::endl
+		<< "Games: " << stats.games << std::endl
+		<< "Ticks: " << stats.ticks << std::endl
+		<< "Average score: " << stats.totalScore / games << std::endl
+		<< "Average final length: " << stats.totalLength / games << std::endl
+		<< "Best score: " << stats.bestScore << " (game " << stats.bestGame << ", seed " << Tournament::gameSeed(config.seed, stats.bestGame) << ")" << std::endl
+		<< "Hit wall: " << stats.hitWall << std::endl
+		<< "Hit self: " << stats.hitSelf << std::endl
+		<< "Filled board: " << stats.boardFull << std::endl
+		<< "Stalled: " << stats.stalled << std::endl
+		<< "Games per second: " << (stats.seconds > 0.0 ? stats.games / stats.seconds : 0.0) << std::endl;
+	return 0;
+}
+
+// Step a bot-only arena with no window, e.g. "Snake --arena 10000 --board 4096x4096 --arena-bench 1000"
+static int runArenaBench(const ArenaConfig& config, std::uint64_t ticks) {
+	Arena arena(config);
+
+	auto start = std::chrono::steady_clock::now();
+	std::uint64_t snakeTicks = 0;
+	for (std::uint64_t i = 0; i < ticks; ++i) {
+		snakeTicks += arena.getAliveCount();
+		arena.step();
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Snakes: " << arena.getSnakeCount() << std::endl
+		<< "Threads: " << arena.getThreadCount() << std::endl
+		<< "Ticks: " << arena.getTick() << std::endl
+		<< "Alive: " << arena.getAliveCount() << std::endl
+		<< "Deaths: " << arena.getDeathCount() << std::endl
+		<< "Ticks per second: " << (seconds > 0.0 ? ticks / seconds : 0.0) << std::endl
+		<< "Snake moves per second: " << (seconds > 0.0 ? snakeTicks / seconds : 0.0) << std::endl;
+	return 0;
+}
+
+// Host one game per client with no window, e.g. "Snake --server 7777" or "Snake --server /tmp/snake.sock"
+static int runServer(const char* address, int gridWidth, int gridHeight, std::uint64_t seed, double seconds) {
+	GameServer server(gridWidth, gridHeight, seed);
+	if (!server.listen(address)) {
+		return 1;
+	}
+	std::cout << "Serving " << gridWidth << "x" << gridHeight << " games on " << address << std::endl;
+
+	ServerStats stats = server.run(seconds);
+	std::cout << "Sessions: " << stats.sessions << std::endl
+		<< "Peak sessions: " << stats.peakSessions << std::endl
+		<< "Dropped: " << stats.dropped << std::endl
+		<< "Ticks per second: " << (stats.seconds > 0.0 ? stats.ticks / stats.seconds : 0.0) << std::endl
+		<< "Bytes per tick: " << (stats.ticks ? double(stats.bytesSent) / stats.ticks : 0.0) << std::endl
+		<< "Ticks per write: " << (stats.writes ? double(stats.ticks) / stats.writes : 0.0) << std::endl;
+	return 0;
+}
+
+// Connect many fake players to a server, e.g. "Snake --load-test 7777 5000 --duration 30"
+static int runLoadTest(const char* address, int clients, std::uint64_t seed, double seconds) {
+	LoadStats stats = LoadGenerator(seed).run(address, clients, seconds);
+
+	std::cout << "Clients connected: " << stats.connected << " of " << clients << std::endl
+		<< "Failed to connect: " << stats.failed << std::endl
+		<< "Lost: " << stats.lost << std::endl
+		<< "Games: " << stats.games << std::endl
+		<< "Ticks per second: " << (stats.seconds > 0.0 ? stats.ticks / stats.seconds : 0.0) << std::endl
+		<< "Bytes per second: " << (stats.seconds > 0.0 ? stats.bytesReceived / stats.seconds : 0.0) << std::endl;
+	return stats.lost == 0 && stats.failed == 0 ? 0 : 1;
+}
+
+// How late a simulation thread wakes up for its ticks, e.g. "Snake --tick-jitter 10". The thread
+// sleeps and steps a game the way the window's does; in the web build it is a Web Worker, and
+// Web/harness.mjs runs this under Node.
+static int runTickJitter(double seconds, int gridWidth, int gridHeight, std::uint64_t seed) {
+	typedef TickClock::Clock Clock;
+	const double timePerTick = Simulation::InitialTimePerTick;
+	std::vector<double> lateness;  // Seconds from when each tick was due to when it ran
+
+	std::thread simulation([&]() {
+		Simulation sim(gridWidth, gridHeight, seed);
+		std::mutex mutex;
+		std::condition_variable wake;  // Never signalled; only the deadline wakes the thread
+
+		TickClock clock;
+		clock.restart(Clock::now(), timePerTick);
+		Clock::time_point end = clock.getLastTick() + TickClock::toDuration(seconds);
+		while (clock.getNextTick() < end) {
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				wake.wait_until(lock, clock.getNextTick());
+			}
+
+			Clock::time_point now = Clock::now();
+			while (clock.isDue(now)) {
+				lateness.push_back(std::chrono::duration<double>(now - clock.getNextTick()).count());
+				if (sim.isGameOver()) {
+					sim.reset();
+				}
+				sim.step();
+				clock.advance(timePerTick);
+			}
+		}
+	});
+	simulation.join();
+
+	if (lateness.empty()) {
+		std::cerr << "No ticks were due, run for longer" << std::endl;
+		return 1;
+	}
+	std::sort(lateness.begin(), lateness.end());
+	auto percentile = [&lateness](double fraction) { return lateness[static_cast<std::size_t>(fraction * (lateness.size() - 1))] * 1000.0; };
+	std::size_t missed = lateness.end() - std::upper_bound(lateness.begin(), lateness.end(), timePerTick);
+
+	std::cout << "Ticks: " << lateness.size() << std::endl
+		<< "Tick period (ms): " << timePerTick * 1000.0 << std::endl
+		<< "Lateness p50 (ms): " << percentile(0.50) << std::endl
+		<< "Lateness p99 (ms): " << percentile(0.99) << std::endl
+		<< "Lateness max (ms): " << lateness.back() * 1000.0 << std::endl
+		<< "Ticks over a period late: " << missed << std::endl;
+	return 0;
+}
+
+// Render a replay, or an autopilot game, to an uncompressed Y4M video with no window, e.g.
+// "Snake --replay game.snr --export-video - | ffmpeg -i - game.mp4"
+static int runVideoExport(const VideoConfig& config, const char* replayPath, int gridWidth, int gridHeight,
+	Autopilot::Strategy strategy, int budgetMicroseconds, std::uint64_t seed) {
+	VideoExporter exporter(config);
+	VideoStats stats;
+	bool exported;
+	if (replayPath) {
+		exported = exporter.exportReplay(replayPath, stats);
+	}
+	else {
+		Autopilot autopilot(strategy, budgetMicroseconds, gridWidth, gridHeight);
+		exported = exporter.exportAutopilotGame(gridWidth, gridHeight, seed, autopilot, stats);
+	}
+	if (!exported) {
+		return 1;
+	}
+
+	// Stdout may be the video itself
+	std::cerr << "Frames: " << stats.frames << std::endl
+		<< "Ticks: " << stats.ticks << std::endl
+		<< "Video length (s): " << stats.videoSeconds << std::endl
+		<< "Render threads: " << stats.threads << std::endl
+		<< "Seconds: " << stats.seconds << std::endl
+		<< "Frames per second: " << (stats.seconds > 0.0 ? stats.frames / stats.seconds : 0.0) << std::endl
+		<< "Times real time: " << (stats.seconds > 0.0 ? stats.videoSeconds / stats.seconds : 0.0) << std::endl;
+	return 0;
+}
 
 int main(int argc, char* argv[]) {
-	Game* game = new Game();
+	StartupTimer::begin();
+
+	int gridWidth = GRID_WIDTH;
+	int gridHeight = GRID_HEIGHT;
+	bool headless = false;
+	std::uint64_t headlessTicks = 10000000;
+	bool autopilot = false;
+	bool autopilotBench = false;
+	Autopilot::Strategy strategy = Autopilot::AStarSafe;
+	int budgetMicroseconds = -1;  // Unset; picked per mode below
+	std::uint64_t benchGames = 100;
+	bool tournament = false;
+	std::uint64_t tournamentGames = 100000;
+	int threads = 0;
+	std::uint64_t seed = static_cast<std::uint64_t>(time(0));
+	const char* recordPath = nullptr;
+	const char* replayPath = nullptr;
+	const char* perfCsvPath = nullptr;
+	bool dirtyRects = false;
+	const char* videoPath = nullptr;
+	int videoFps = 30;
+	const char* tracePath = nullptr;
+	const char* serverAddress = nullptr;
+	const char* connectAddress = nullptr;
+	const char* loadTestAddress = nullptr;
+	int loadTestClients = 1000;
+	double duration = 0.0;  // Zero: server runs until stopped, load test for 10 seconds
+	double tickJitterSeconds = 0.0;
+	int arenaSnakes = 0;
+	bool arenaBench = false;
+	std::uint64_t arenaTicks = 1000;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--headless") == 0) {
+			headless = true;
+			if (i + 1 < argc && argv[i + 1][0] != '-') {
+				headlessTicks = std::strtoull(argv[++i], nullptr, 10);
+			}
+		}
+		else if (std::strcmp(argv[i], "--autopilot") == 0 && i + 1 < argc) {
+			autopilot = true;
+			if (!Autopilot::parseStrategy(argv[++i], strategy)) {
+				std::cerr << "Unknown autopilot strategy, expected bfs, astar or hamiltonian" << std::endl;
+				return 1;
+			}
+		}
+		else if (std::strcmp(argv[i], "--autopilot-budget") == 0 && i + 1 < argc) {
+			// Time allowed per decision in microseconds
+			budgetMicroseconds = std::atoi(argv[++i]);
+		}
+		else if (std::strcmp(argv[i], "--autopilot-bench") == 0) {
+			autopilotBench = true;
+			if (i + 1 < argc && argv[i + 1][0] != '-') {
+				benchGames = std::strtoull(argv[++i], nullptr, 10);
+			}
+		}
+		else if (std::strcmp(argv[i], "--tournament") == 0) {
+			tournament = true;
+			if (i + 1 < argc && argv[i + 1][0] != '-') {
+				tournamentGames = std::strtoull(argv[++i], nullptr, 10);
+			}
+		}
+		else if (std::strcmp(argv[i], "--server") == 0 && i + 1 < argc) {
+			// Port, host:port or Unix socket path
+			serverAddress = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "--connect") == 0 && i + 1 < argc) {
+			connectAddress = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "--load-test") == 0 && i + 1 < argc) {
+			loadTestAddress = argv[++i];
+			if (i + 1 < argc && argv[i + 1][0] != '-') {
+				loadTestClients = std::atoi(argv[++i]);
+			}
+		}
+		else if (std::strcmp(argv[i], "--duration") == 0 && i + 1 < argc) {
+			// Seconds to run the server or load test for
+			duration = std::atof(argv[++i]);
+		}
+		else if (std::strcmp(argv[i], "--tick-jitter") == 0) {
+			tickJitterSeconds = 10.0;
+			if (i + 1 < argc && argv[i + 1][0] != '-') {
+				tickJitterSeconds = std::atof(argv[++i]);
+			}
+		}
+		else if (std::strcmp(argv[i], "--arena") == 0 && i + 1 < argc) {
+			// Number of snakes sharing the board, including the player
+			arenaSnakes = std::atoi(argv[++i]);
+		}
+		else if (std::strcmp(argv[i], "--arena-bench") == 0) {
+			arenaBench = true;
+			if (i + 1 < argc && argv[i + 1][0] != '-') {
+				arenaTicks = std::strtoull(argv[++i], nullptr, 10);
+			}
+		}
+		else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			threads = std::atoi(argv[++i]);
+		}
+		else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+			seed = std::strtoull(argv[++i], nullptr, 10);
+		}
+		else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+			recordPath = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+			replayPath = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "--startup-report") == 0) {
+			// Time each step up to the first frame
+			StartupTimer::enableReport();
+		}
+		else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+			// Chrome trace-event JSON of every frame phase
+			tracePath = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "--perf-csv") == 0 && i + 1 < argc) {
+			perfCsvPath = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "--dirty-rects") == 0) {
+			// Keep the board between frames and only redraw the cells that changed
+			dirtyRects = true;
+		}
+		else if (std::strcmp(argv[i], "--export-video") == 0 && i + 1 < argc) {
+			// Y4M file, or "-" for stdout
+			videoPath = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+			videoFps = std::max(1, std::atoi(argv[++i]));
+		}
+		else if (std::strcmp(argv[i], "--board") == 0 && i + 1 < argc) {
+			// Board size in cells, e.g. "--board 4096x4096"
+			if (std::sscanf(argv[++i], "%dx%d", &gridWidth, &gridHeight) != 2 ||
+				gridWidth < 2 || gridHeight < 2 || gridWidth > MAX_GRID_SIZE || gridHeight > MAX_GRID_SIZE) {
+				std::cerr << "Invalid board size, expected WIDTHxHEIGHT between 2 and " << MAX_GRID_SIZE << std::endl;
+				return 1;
+			}
+		}
+	}
+
+	if (tracePath && Trace::start(tracePath)) {
+		Trace::setThreadName("Main");
+		std::atexit(Trace::stop);  // Every mode below returns from main
+	}
+
+	if (serverAddress) {
+		return runServer(serverAddress, gridWidth, gridHeight, seed, duration);
+	}
+
+	if (loadTestAddress) {
+		return runLoadTest(loadTestAddress, loadTestClients, seed, duration > 0.0 ? duration : 10.0);
+	}
+
+	if (tournament) {
+		// Without a budget every decision runs to completion, so a seed always gives the same totals
+		TournamentConfig config = { gridWidth, gridHeight, autopilot, strategy, budgetMicroseconds < 0 ? 0 : budgetMicroseconds, tournamentGames, seed, threads };
+		return runTournament(config);
+	}
+
+	// One piece of food per snake, and snakes capped at a quarter of the shorter board side
+	ArenaConfig arenaConfig = { gridWidth, gridHeight, arenaSnakes, arenaSnakes, std::max(4, std::min(gridWidth, gridHeight) / 4), 20, !arenaBench, seed, threads };
+	if (arenaBench) {
+		if (arenaSnakes <= 0) {
+			arenaConfig.snakeCount = arenaConfig.foodCount = 1000;
+		}
+		return runArenaBench(arenaConfig, arenaTicks);
+	}
+
+	if (videoPath) {
+		// Without a budget every decision runs to completion, so a seed always gives the same video
+		VideoConfig config = { videoPath, videoFps, duration, threads };
+		return runVideoExport(config, replayPath, gridWidth, gridHeight, strategy, budgetMicroseconds < 0 ? 0 : budgetMicroseconds, seed);
+	}
+
+	if (budgetMicroseconds < 0) {
+		budgetMicroseconds = 2000;
+	}
+
+	if (autopilotBench) {
+		return runAutopilotBench(benchGames, gridWidth, gridHeight, strategy, budgetMicroseconds, seed);
+	}
+
+	if (headless) {
+		return runHeadless(headlessTicks, gridWidth, gridHeight, seed);
+	}
+
+	if (tickJitterSeconds > 0.0) {
+		return runTickJitter(tickJitterSeconds, gridWidth, gridHeight, seed);
+	}
+
+	NetClient* client = nullptr;
+	if (connectAddress) {
+		// The board size comes from the server
+		client = new NetClient();
+		if (!client->connect(connectAddress) || !client->waitForBoard(5000)) {
+			delete client;
+			return 1;
+		}
+		gridWidth = client->getGridWidth();
+		gridHeight = client->getGridHeight();
+		if (gridWidth < 2 || gridHeight < 2 || gridWidth > MAX_GRID_SIZE || gridHeight > MAX_GRID_SIZE) {
+			std::cerr << "The server's board is too large to show" << std::endl;
+			delete client;
+			return 1;
+		}
+	}
+
+	if (replayPath) {
+		// The board size comes from the replay
+		ReplayPlayer replay;
+		if (!replay.open(replayPath)) {
+			return 1;
+		}
+		gridWidth = replay.getGridWidth();
+		gridHeight = replay.getGridHeight();
+	}
+
+	StartupTimer::mark("parse arguments");
+	Game* game = new Game(gridWidth, gridHeight);
+	if (replayPath && !game->openReplay(replayPath)) {
+		return 1;
+	}
+	if (recordPath && !replayPath) {
+		game->startRecording(recordPath);
+	}
+	if (perfCsvPath) {
+		game->openPerfCsv(perfCsvPath);
+	}
+	if (dirtyRects) {
+		game->setDirtyRects(true);
+	}
+	if (client) {
+		game->setNetClient(client);
+	}
+	if (arenaSnakes > 0) {
+		game->setArena(arenaConfig);
+	}
+	if (autopilot) {
+		game->setAutopilot(strategy, budgetMicroseconds);
+	}
+
+	StartupTimer::mark("create game");
 
 	if (!game->init()) {
 		std::cerr << "Game could not be initialized" << std::endl;
@@ -12,4 +457,3 @@ int main(int argc, char* argv[]) {
 
 	return 0;
 }
-
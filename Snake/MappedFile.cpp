@@ -0,0 +1,116 @@
+#include "MappedFile.hpp"
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+MappedFile::MappedFile()
+	: mData(nullptr)
+	, mSize(0)
+#ifdef _WIN32
+	, mFile(INVALID_HANDLE_VALUE)
+	, mMapping(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile() {
+	close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const char* path) {
+	close();
+
+	mFile = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+	if (mFile == INVALID_HANDLE_VALUE) {
+		std::cout << "Could not open " << path << std::endl;
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(mFile, &size) || size.QuadPart == 0) {
+		std::cout << "Could not map empty file " << path << std::endl;
+		close();
+		return false;
+	}
+
+	mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mMapping) {
+		mData = static_cast<const unsigned char*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+	}
+	if (!mData) {
+		std::cout << "Could not map " << path << std::endl;
+		close();
+		return false;
+	}
+
+	mSize = static_cast<std::size_t>(size.QuadPart);
+	return true;
+}
+
+void MappedFile::close() {
+	if (mData) {
+		UnmapViewOfFile(mData);
+	}
+	if (mMapping) {
+		CloseHandle(mMapping);
+	}
+	if (mFile != INVALID_HANDLE_VALUE) {
+		CloseHandle(mFile);
+	}
+	mData = nullptr;
+	mSize = 0;
+	mMapping = nullptr;
+	mFile = INVALID_HANDLE_VALUE;
+}
+
+#else
+
+bool MappedFile::open(const char* path) {
+	close();
+
+	int file = ::open(path, O_RDONLY);
+	if (file < 0) {
+		std::cout << "Could not open " << path << std::endl;
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(file, &info) != 0 || info.st_size == 0) {
+		std::cout << "Could not map empty file " << path << std::endl;
+		::close(file);
+		return false;
+	}
+
+	// The mapping keeps its own reference to the file
+	void* data = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	::close(file);
+	if (data == MAP_FAILED) {
+		std::cout << "Could not map " << path << std::endl;
+		return false;
+	}
+
+	mData = static_cast<const unsigned char*>(data);
+	mSize = static_cast<std::size_t>(info.st_size);
+	return true;
+}
+
+void MappedFile::close() {
+	if (mData) {
+		munmap(const_cast<unsigned char*>(mData), mSize);
+	}
+	mData = nullptr;
+	mSize = 0;
+}
+
+#endif
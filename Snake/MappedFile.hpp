@@ -0,0 +1,33 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+
+// A read-only view of a whole file mapped into memory. Opening is instant regardless of size;
+// pages are only read from disk when they are touched.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    bool open(const char* path);
+    void close();
+
+    bool isOpen() const { return mData != nullptr; }
+    const unsigned char* getData() const { return mData; }
+    std::size_t getSize() const { return mSize; }
+
+private:
+    MappedFile(const MappedFile&);             // Not copyable
+    MappedFile& operator=(const MappedFile&);
+
+private:
+    const unsigned char* mData;
+    std::size_t mSize;
+#ifdef _WIN32
+    void* mFile;
+    void* mMapping;
+#endif
+};
+
+#endif // MAPPED_FILE_HPP
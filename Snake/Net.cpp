@@ -0,0 +1,313 @@
+#include "Net.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+const Cell Net::Directions[4] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 } };
+
+static void writeU16(std::vector<unsigned char>& out, unsigned value) {
+	out.push_back(static_cast<unsigned char>(value));
+	out.push_back(static_cast<unsigned char>(value >> 8));
+}
+
+static unsigned readU16(const unsigned char* data) {
+	return data[0] | (data[1] << 8);
+}
+
+static std::uint32_t readU32(const unsigned char* data) {
+	return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+
+void Net::writeSnapshot(const Simulation& sim, std::vector<unsigned char>& out) {
+	out.push_back(SnapshotByte);
+	writeU16(out, sim.getGridWidth());
+	writeU16(out, sim.getGridHeight());
+
+	std::size_t sizeAt = out.size();
+	out.resize(sizeAt + 4);
+	sim.writeState(out);
+
+	std::uint32_t size = static_cast<std::uint32_t>(out.size() - sizeAt - 4);
+	for (int i = 0; i < 4; ++i) {
+		out[sizeAt + i] = static_cast<unsigned char>(size >> (8 * i));
+	}
+}
+
+void Net::writeDelta(const Simulation& sim, const Cell& previousFood, std::size_t previousLength, std::vector<unsigned char>& out) {
+	unsigned char flags = 0;
+
+	// After a move the head's previous position is the cell behind it
+	if (sim.getPreviousPosition(0) != sim.getHead()) {
+		for (unsigned char i = 0; i < 4; ++i) {
+			if (Directions[i].x == sim.getDirectionX() && Directions[i].y == sim.getDirectionY()) {
+				flags = DeltaHead | i;
+			}
+		}
+		if (sim.getSnake().size() == previousLength) {
+			flags |= DeltaTail;
+		}
+	}
+	if (sim.getFood() != previousFood) {
+		flags |= DeltaFood;
+	}
+	if (sim.isGameOver()) {
+		flags |= DeltaOver;
+	}
+	if (flags == 0) {
+		return;
+	}
+
+	out.push_back(flags);
+	if (flags & DeltaFood) {
+		writeU16(out, sim.getFood().x);
+		writeU16(out, sim.getFood().y);
+	}
+	if (flags & DeltaOver) {
+		out.push_back(static_cast<unsigned char>(sim.getOutcome()));
+	}
+}
+
+long Net::readMessages(Simulation& mirror, const unsigned char* data, std::size_t size) {
+	std::size_t used = 0;
+	while (used < size) {
+		const unsigned char* message = data + used;
+		std::size_t left = size - used;
+		unsigned char flags = message[0];
+
+		if (flags & SnapshotByte) {
+			if (left < SnapshotHeaderSize) {
+				break;
+			}
+			std::uint32_t stateSize = readU32(message + 5);
+			if (left < SnapshotHeaderSize + stateSize) {
+				break;
+			}
+			if (static_cast<int>(readU16(message + 1)) != mirror.getGridWidth() || static_cast<int>(readU16(message + 3)) != mirror.getGridHeight() ||
+				!mirror.readState(message + SnapshotHeaderSize, stateSize)) {
+				return -1;
+			}
+			used += SnapshotHeaderSize + stateSize;
+			continue;
+		}
+
+		std::size_t length = 1 + ((flags & DeltaFood) ? 4 : 0) + ((flags & DeltaOver) ? 1 : 0);
+		if (left < length) {
+			break;
+		}
+
+		// Same order as a server tick: move, then new food, then the outcome
+		const unsigned char* extra = message + 1;
+		if (flags & DeltaHead) {
+			const Cell& direction = Directions[flags & DeltaDirection];
+			if (!mirror.applyMove(direction.x, direction.y, (flags & DeltaTail) == 0)) {
+				return -1;
+			}
+		}
+		if (flags & DeltaFood) {
+			Cell food = { static_cast<int>(readU16(extra)), static_cast<int>(readU16(extra + 2)) };
+			if (food.x >= mirror.getGridWidth() || food.y >= mirror.getGridHeight()) {
+				return -1;
+			}
+			mirror.setFood(food);
+			extra += 4;
+		}
+		if (flags & DeltaOver) {
+			if (*extra > Simulation::BoardFull) {
+				return -1;
+			}
+			mirror.endGame(static_cast<Simulation::Outcome>(*extra));
+		}
+		used += length;
+	}
+	return static_cast<long>(used);
+}
+
+
+#ifdef _WIN32
+
+int Net::listenOn(const char*) {
+	std::cout << "Networking is not supported on this platform" << std::endl;
+	return -1;
+}
+
+int Net::connectTo(const char*) {
+	std::cout << "Networking is not supported on this platform" << std::endl;
+	return -1;
+}
+
+int Net::acceptClient(int) { return -1; }
+long Net::sendSome(int, const unsigned char*, std::size_t) { return -1; }
+long Net::receiveSome(int, unsigned char*, std::size_t) { return -1; }
+void Net::closeSocket(int) {}
+bool Net::waitFor(std::vector<Wait>&, int) { return false; }
+void Net::raiseSocketLimit() {}
+
+#else
+
+// Small frames are the point of batching per tick, so do not let the kernel hold them back
+static void prepareSocket(int fd) {
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+	int on = 1;
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));  // Fails harmlessly on Unix sockets
+#ifdef SO_NOSIGPIPE
+	setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+}
+
+// Fill in a TCP or Unix socket address; TCP defaults to the loopback interface
+static bool parseAddress(const char* address, sockaddr_storage& storage, socklen_t& length) {
+	std::memset(&storage, 0, sizeof(storage));
+
+	if (std::strchr(address, '/')) {
+		sockaddr_un& unixAddress = reinterpret_cast<sockaddr_un&>(storage);
+		if (std::strlen(address) >= sizeof(unixAddress.sun_path)) {
+			std::cout << "Socket path is too long: " << address << std::endl;
+			return false;
+		}
+		unixAddress.sun_family = AF_UNIX;
+		std::strcpy(unixAddress.sun_path, address);
+		length = sizeof(unixAddress);
+		return true;
+	}
+
+	std::string host = "127.0.0.1";
+	const char* port = address;
+	if (const char* colon = std::strrchr(address, ':')) {
+		host.assign(address, colon);
+		port = colon + 1;
+	}
+
+	sockaddr_in& ipAddress = reinterpret_cast<sockaddr_in&>(storage);
+	ipAddress.sin_family = AF_INET;
+	ipAddress.sin_port = htons(static_cast<std::uint16_t>(std::atoi(port)));
+	if (std::atoi(port) <= 0 || inet_pton(AF_INET, host.c_str(), &ipAddress.sin_addr) != 1) {
+		std::cout << "Invalid address, expected a port, host:port or a socket path: " << address << std::endl;
+		return false;
+	}
+	length = sizeof(ipAddress);
+	return true;
+}
+
+int Net::listenOn(const char* address) {
+	sockaddr_storage storage;
+	socklen_t length;
+	if (!parseAddress(address, storage, length)) {
+		return -1;
+	}
+
+	int fd = socket(storage.ss_family, SOCK_STREAM, 0);
+	if (fd < 0) {
+		std::cout << "Could not create a socket: " << std::strerror(errno) << std::endl;
+		return -1;
+	}
+
+	if (storage.ss_family == AF_UNIX) {
+		unlink(address);  // Left behind by an earlier server
+	}
+	else {
+		int on = 1;
+		setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+	}
+
+	if (bind(fd, reinterpret_cast<sockaddr*>(&storage), length) != 0 || listen(fd, SOMAXCONN) != 0) {
+		std::cout << "Could not listen on " << address << ": " << std::strerror(errno) << std::endl;
+		close(fd);
+		return -1;
+	}
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+	return fd;
+}
+
+int Net::connectTo(const char* address) {
+	sockaddr_storage storage;
+	socklen_t length;
+	if (!parseAddress(address, storage, length)) {
+		return -1;
+	}
+
+	int fd = socket(storage.ss_family, SOCK_STREAM, 0);
+	if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&storage), length) != 0) {
+		std::cout << "Could not connect to " << address << ": " << std::strerror(errno) << std::endl;
+		if (fd >= 0) {
+			close(fd);
+		}
+		return -1;
+	}
+	prepareSocket(fd);
+	return fd;
+}
+
+int Net::acceptClient(int listener) {
+	int fd = accept(listener, nullptr, nullptr);
+	if (fd >= 0) {
+		prepareSocket(fd);
+	}
+	return fd;
+}
+
+long Net::sendSome(int socket, const unsigned char* data, std::size_t size) {
+#ifdef MSG_NOSIGNAL
+	long sent = static_cast<long>(send(socket, data, size, MSG_NOSIGNAL));
+#else
+	long sent = static_cast<long>(send(socket, data, size, 0));
+#endif
+	if (sent < 0) {
+		return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+	}
+	return sent;
+}
+
+long Net::receiveSome(int socket, unsigned char* data, std::size_t size) {
+	long received = static_cast<long>(recv(socket, data, size, 0));
+	if (received < 0) {
+		return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+	}
+	return received > 0 ? received : -1;  // Zero means the other side closed
+}
+
+void Net::closeSocket(int socket) {
+	if (socket >= 0) {
+		close(socket);
+	}
+}
+
+bool Net::waitFor(std::vector<Wait>& sockets, int timeoutMilliseconds) {
+	std::vector<pollfd> fds(sockets.size());
+	for (std::size_t i = 0; i < sockets.size(); ++i) {
+		fds[i].fd = sockets[i].socket;
+		fds[i].events = POLLIN | (sockets[i].wantWrite ? POLLOUT : 0);
+		fds[i].revents = 0;
+	}
+
+	int ready = poll(fds.data(), static_cast<nfds_t>(fds.size()), timeoutMilliseconds);
+	for (std::size_t i = 0; i < sockets.size(); ++i) {
+		sockets[i].ready = ready > 0 && fds[i].revents != 0;
+	}
+	return ready > 0;
+}
+
+void Net::raiseSocketLimit() {
+	rlimit limit;
+	if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+		limit.rlim_cur = limit.rlim_max;
+		setrlimit(RLIMIT_NOFILE, &limit);
+	}
+}
+
+#endif
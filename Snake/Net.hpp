@@ -0,0 +1,69 @@
+#ifndef NET_HPP
+#define NET_HPP
+
+#include "Cell.hpp"
+#include "Simulation.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Wire format between GameServer and NetClient, and the socket calls both of them use.
+//
+// Client to server, one byte per input: 'U', 'D', 'L' or 'R' to turn, 'N' for a new game.
+//
+// Server to client: whenever a game starts, a snapshot: SnapshotByte, board width and height
+// (u16 each), a u32 size and that many bytes of Simulation::writeState. After that, one delta
+// per tick that changed anything: a flags byte, then the new food cell (two u16) if DeltaFood
+// is set and the outcome (u8) if DeltaOver is set. Most ticks cost a single byte.
+// Numbers are little-endian.
+//
+// Sockets are plain POSIX ones; other platforms get -1 from every call.
+class Net {
+public:
+    enum {
+        DeltaDirection = 0x03,  // Index into Directions of the head's move, with DeltaHead
+        DeltaHead = 0x04,       // The head moved one cell
+        DeltaTail = 0x08,       // The tail followed; without it the snake ate and grew
+        DeltaFood = 0x10,       // The food moved
+        DeltaOver = 0x20,       // The game ended
+        SnapshotByte = 0x80
+    };
+    static const std::size_t SnapshotHeaderSize = 9;
+    static const Cell Directions[4];
+
+    static void writeSnapshot(const Simulation& sim, std::vector<unsigned char>& out);
+
+    // Append what the last step changed, given the food and length from before it
+    static void writeDelta(const Simulation& sim, const Cell& previousFood, std::size_t previousLength, std::vector<unsigned char>& out);
+
+    // Apply the complete messages at the start of data to a mirror of the server's game.
+    // Returns the number of bytes used, or -1 if the data does not make sense.
+    static long readMessages(Simulation& mirror, const unsigned char* data, std::size_t size);
+
+    // A port number ("7777") or host and port ("127.0.0.1:7777") is TCP, a path is a Unix socket.
+    // Both return a non-blocking socket, or -1 after printing why.
+    static int listenOn(const char* address);
+    static int connectTo(const char* address);
+
+    // Next pending connection on a listening socket, or -1 if there is none
+    static int acceptClient(int listener);
+
+    // Bytes moved, 0 if the call would block, -1 once the connection is closed or broken
+    static long sendSome(int socket, const unsigned char* data, std::size_t size);
+    static long receiveSome(int socket, unsigned char* data, std::size_t size);
+
+    static void closeSocket(int socket);
+
+    // Wait until one of the sockets can be read (or written, if asked) or the timeout passes
+    struct Wait {
+        int socket;
+        bool wantWrite;
+        bool ready;  // Set by waitFor
+    };
+    static bool waitFor(std::vector<Wait>& sockets, int timeoutMilliseconds);
+
+    // Let the process hold as many sockets as the system allows
+    static void raiseSocketLimit();
+};
+
+#endif // NET_HPP
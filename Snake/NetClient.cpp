@@ -0,0 +1,126 @@
+#include "NetClient.hpp"
+#include "Net.hpp"
+#include <chrono>
+#include <iostream>
+
+
+NetClient::NetClient()
+	: mSocket(-1)
+	, mGridWidth(0)
+	, mGridHeight(0)
+	, mBytesReceived(0)
+{
+}
+
+NetClient::~NetClient() {
+	close();
+}
+
+bool NetClient::connect(const char* address) {
+	close();
+	mSocket = Net::connectTo(address);
+	return mSocket >= 0;
+}
+
+void NetClient::close() {
+	Net::closeSocket(mSocket);
+	mSocket = -1;
+	mIn.clear();
+	mOut.clear();
+	mGridWidth = mGridHeight = 0;
+}
+
+bool NetClient::waitForBoard(int timeoutMilliseconds) {
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMilliseconds);
+	while (isConnected() && !hasBoard()) {
+		auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+		if (left <= 0) {
+			std::cout << "The server did not send a board in time" << std::endl;
+			return false;
+		}
+
+		std::vector<Net::Wait> wait(1, Net::Wait{ mSocket, false, false });
+		Net::waitFor(wait, static_cast<int>(left));
+		if (!receive()) {
+			return false;
+		}
+	}
+	return hasBoard();
+}
+
+void NetClient::turn(int directionX, int directionY) {
+	if (directionY < 0) mOut.push_back('U');
+	else if (directionY > 0) mOut.push_back('D');
+	else if (directionX < 0) mOut.push_back('L');
+	else if (directionX > 0) mOut.push_back('R');
+}
+
+void NetClient::newGame() {
+	mOut.push_back('N');
+}
+
+bool NetClient::receive() {
+	if (!isConnected() || !flush()) {
+		return false;
+	}
+
+	for (;;) {
+		std::size_t start = mIn.size();
+		mIn.resize(start + 4096);
+		long received = Net::receiveSome(mSocket, &mIn[start], 4096);
+		mIn.resize(start + (received > 0 ? received : 0));
+
+		if (received < 0) {
+			std::cout << "Lost the connection to the server" << std::endl;
+			close();
+			return false;
+		}
+		if (received == 0) {
+			break;
+		}
+		mBytesReceived += received;
+	}
+
+	// The board size is in the header of the first snapshot
+	if (!hasBoard() && mIn.size() >= Net::SnapshotHeaderSize) {
+		if (!(mIn[0] & Net::SnapshotByte)) {
+			std::cout << "The server did not start with a snapshot" << std::endl;
+			close();
+			return false;
+		}
+		mGridWidth = mIn[1] | (mIn[2] << 8);
+		mGridHeight = mIn[3] | (mIn[4] << 8);
+	}
+	return true;
+}
+
+bool NetClient::update(Simulation& mirror) {
+	if (!receive()) {
+		return false;
+	}
+
+	long used = Net::readMessages(mirror, mIn.data(), mIn.size());
+	if (used < 0) {
+		std::cout << "The server sent something this client does not understand" << std::endl;
+		close();
+		return false;
+	}
+	mIn.erase(mIn.begin(), mIn.begin() + used);
+	return true;
+}
+
+bool NetClient::flush() {
+	while (!mOut.empty()) {
+		long sent = Net::sendSome(mSocket, mOut.data(), mOut.size());
+		if (sent < 0) {
+			std::cout << "Lost the connection to the server" << std::endl;
+			close();
+			return false;
+		}
+		if (sent == 0) {
+			break;  // Try again next update
+		}
+		mOut.erase(mOut.begin(), mOut.begin() + sent);
+	}
+	return true;
+}
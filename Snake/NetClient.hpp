@@ -0,0 +1,51 @@
+#ifndef NET_CLIENT_HPP
+#define NET_CLIENT_HPP
+
+#include "Simulation.hpp"
+#include <cstdint>
+#include <vector>
+
+// One player's connection to a GameServer. Turns are sent as input and the server's snapshots
+// are applied to a local Simulation, which is only ever drawn, never stepped.
+class NetClient {
+public:
+    NetClient();
+    ~NetClient();
+
+    bool connect(const char* address);
+    void close();
+    bool isConnected() const { return mSocket >= 0; }
+    int getSocket() const { return mSocket; }  // For waiting on several clients at once
+
+    // Block until the first snapshot arrives, which says how large the board is
+    bool waitForBoard(int timeoutMilliseconds);
+    bool hasBoard() const { return mGridWidth > 0; }
+    int getGridWidth() const { return mGridWidth; }
+    int getGridHeight() const { return mGridHeight; }
+
+    // Queue input for the next update
+    void turn(int directionX, int directionY);
+    void newGame();
+
+    // Send queued input and read whatever has arrived without blocking. update also applies
+    // every complete message to the mirror. Both return false once the connection is gone.
+    bool receive();
+    bool update(Simulation& mirror);
+
+    std::uint64_t getBytesReceived() const { return mBytesReceived; }
+
+private:
+    NetClient(const NetClient&);             // Not copyable
+    NetClient& operator=(const NetClient&);
+
+    bool flush();
+
+private:
+    int mSocket;
+    std::vector<unsigned char> mIn;   // Received but not applied yet
+    std::vector<unsigned char> mOut;  // Input not sent yet
+    int mGridWidth, mGridHeight;      // Zero until the first snapshot
+    std::uint64_t mBytesReceived;
+};
+
+#endif // NET_CLIENT_HPP
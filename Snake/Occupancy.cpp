@@ -0,0 +1,82 @@
+#include "Occupancy.hpp"
+#include "Bitboard.hpp"
+
+
+Occupancy::Occupancy(int cellCount)
+	: mOwners(cellCount)
+	, mFreeBits((cellCount + 63) / 64)
+	, mLevelCount(0)
+	, mFreeCount(0)
+{
+	// Add levels until one fits in a single scan
+	int total = 0;
+	for (int entries = static_cast<int>(mFreeBits.size()); ; entries = (entries + 63) / 64) {
+		mLevelStart[mLevelCount] = total;
+		mLevelSize[mLevelCount] = entries;
+		mLevelCount++;
+		total += entries;
+		if (entries <= 64) {
+			break;
+		}
+	}
+	mFreeCounts.resize(total);
+	clear();
+}
+
+void Occupancy::clear() {
+	int cellCount = static_cast<int>(mOwners.size());
+	for (int cell = 0; cell < cellCount; ++cell) {
+		mOwners[cell] = -1;
+	}
+	for (std::size_t word = 0; word < mFreeBits.size(); ++word) {
+		mFreeBits[word] = word + 1 < mFreeBits.size() || cellCount % 64 == 0 ? ~0ull : (1ull << (cellCount % 64)) - 1;
+	}
+
+	// Level l entry i covers cells [i * 64^(l+1), (i + 1) * 64^(l+1))
+	long long span = 64;
+	for (int level = 0; level < mLevelCount; ++level) {
+		int* counts = &mFreeCounts[mLevelStart[level]];
+		for (int i = 0; i < mLevelSize[level]; ++i) {
+			long long first = i * span;
+			counts[i] = static_cast<int>(first + span <= cellCount ? span : cellCount - first);
+		}
+		span *= 64;
+	}
+	mFreeCount = cellCount;
+}
+
+void Occupancy::occupy(int cell, int owner) {
+	mOwners[cell] = owner;
+	mFreeBits[cell >> 6] &= ~(1ull << (cell & 63));
+	addFree(cell, -1);
+}
+
+void Occupancy::release(int cell) {
+	mOwners[cell] = -1;
+	mFreeBits[cell >> 6] |= 1ull << (cell & 63);
+	addFree(cell, 1);
+}
+
+// Walk down from the top level, skipping whole runs of cells, then select within one word
+int Occupancy::findFreeCell(int n) const {
+	int index = 0;  // Run at the current level holding the n-th free cell
+	for (int level = mLevelCount; level-- > 0;) {
+		const int* counts = &mFreeCounts[mLevelStart[level]];
+		int child = index * 64;
+		while (child + 1 < mLevelSize[level] && counts[child] <= n) {
+			n -= counts[child];
+			child++;
+		}
+		index = child;
+	}
+	return index * 64 + selectBit64(mFreeBits[index], n);
+}
+
+void Occupancy::addFree(int cell, int delta) {
+	int* counts = mFreeCounts.data();
+	for (int level = 0; level < mLevelCount; ++level) {
+		cell >>= 6;
+		counts[mLevelStart[level] + cell] += delta;
+	}
+	mFreeCount += delta;
+}
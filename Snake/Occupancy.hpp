@@ -0,0 +1,46 @@
+#ifndef OCCUPANCY_HPP
+#define OCCUPANCY_HPP
+
+#include <cstdint>
+#include <vector>
+
+// Tracks which board cells are taken and by whom, plus a tree of free cell counts where each
+// level counts 64 times as many cells as the one below. Lookups are O(1); taking or freeing a
+// cell costs one update per level and picking the n-th free cell scans at most 64 counts per
+// level, so both stay O(log N) with a small constant.
+// Picking only depends on which cells are free, not on the order they were taken in, so a
+// board restored from a snapshot picks the same cells as the original.
+class Occupancy {
+public:
+    explicit Occupancy(int cellCount);
+
+    // Mark every cell as free
+    void clear();
+
+    // Take a cell, tagging it with a non-negative owner value
+    void occupy(int cell, int owner = 0);
+    void release(int cell);
+
+    bool isOccupied(int cell) const { return mOwners[cell] >= 0; }
+    int getOwner(int cell) const { return mOwners[cell]; }  // Only valid for occupied cells
+    int getFreeCount() const { return mFreeCount; }
+
+    // The n-th free cell in board order, for n < getFreeCount()
+    int findFreeCell(int n) const;
+
+private:
+    void addFree(int cell, int delta);
+
+private:
+    std::vector<int> mOwners;                  // Owner of each cell, or -1 when free
+    std::vector<std::uint64_t> mFreeBits;      // One bit per free cell, 64 cells per word
+    static const int MaxLevels = 5;            // Enough for 2^31 cells
+
+    std::vector<int> mFreeCounts;              // Level l counts the free cells in each run of 64^(l+1)
+    int mLevelStart[MaxLevels];                // Where each level starts in mFreeCounts
+    int mLevelSize[MaxLevels];
+    int mLevelCount;
+    int mFreeCount;
+};
+
+#endif // OCCUPANCY_HPP
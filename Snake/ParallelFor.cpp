@@ -0,0 +1,95 @@
+#include "ParallelFor.hpp"
+
+
+ParallelFor::ParallelFor(int threads)
+	: mGeneration(0)
+	, mPending(0)
+	, mStopping(false)
+	, mBody(nullptr)
+	, mCount(0)
+	, mShares(1)
+{
+	if (threads <= 0) {
+		threads = static_cast<int>(std::thread::hardware_concurrency());
+	}
+#ifdef __EMSCRIPTEN__
+	threads = 1;  // Built without pthreads
+#endif
+
+	for (int i = 1; i < threads; ++i) {
+		mWorkers.emplace_back(&ParallelFor::workerLoop, this, i);
+	}
+}
+
+ParallelFor::~ParallelFor() {
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopping = true;
+	}
+	mWake.notify_all();
+	for (std::thread& worker : mWorkers) {
+		worker.join();
+	}
+}
+
+void ParallelFor::run(int count, int minChunk, const std::function<void(int, int)>& body) {
+	if (count <= 0) {
+		return;
+	}
+
+	int shares = getThreadCount();
+	if (minChunk > 0 && count / minChunk < shares) {
+		shares = count / minChunk;
+	}
+	if (shares <= 1) {
+		body(0, count);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mBody = &body;
+		mCount = count;
+		mShares = shares;
+		mPending = static_cast<int>(mWorkers.size());
+		mGeneration++;
+	}
+	mWake.notify_all();
+
+	runShare(0);
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	mDone.wait(lock, [this] { return mPending == 0; });
+	mBody = nullptr;
+}
+
+void ParallelFor::workerLoop(int index) {
+	unsigned seen = 0;
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mWake.wait(lock, [this, seen] { return mStopping || mGeneration != seen; });
+			if (mStopping) {
+				return;
+			}
+			seen = mGeneration;
+		}
+
+		runShare(index);
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (--mPending == 0) {
+			mDone.notify_one();
+		}
+	}
+}
+
+// Workers past the number of shares in this pass have nothing to do
+void ParallelFor::runShare(int share) {
+	if (share >= mShares) {
+		return;
+	}
+	int begin = static_cast<int>(static_cast<long long>(mCount) * share / mShares);
+	int end = static_cast<int>(static_cast<long long>(mCount) * (share + 1) / mShares);
+	(*mBody)(begin, end);
+}
@@ -0,0 +1,46 @@
+#ifndef PARALLEL_FOR_HPP
+#define PARALLEL_FOR_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed set of worker threads that split index ranges between them. Meant for many short
+// passes (several per game tick), so the threads stay alive and wait between passes instead
+// of being started each time. The calling thread takes a share of the work too.
+class ParallelFor {
+public:
+    // Zero uses every core; one runs everything on the calling thread
+    explicit ParallelFor(int threads);
+    ~ParallelFor();
+
+    // Call body(begin, end) over [0, count) in chunks of at least minChunk and wait for all of them
+    void run(int count, int minChunk, const std::function<void(int, int)>& body);
+
+    int getThreadCount() const { return static_cast<int>(mWorkers.size()) + 1; }
+
+private:
+    ParallelFor(const ParallelFor&);
+    ParallelFor& operator=(const ParallelFor&);
+
+    void workerLoop(int index);
+    void runShare(int share);
+
+private:
+    std::vector<std::thread> mWorkers;
+    std::mutex mMutex;
+    std::condition_variable mWake;
+    std::condition_variable mDone;
+    unsigned mGeneration;  // Bumped for every pass
+    int mPending;          // Workers still busy with the current pass
+    bool mStopping;
+
+    // The current pass
+    const std::function<void(int, int)>* mBody;
+    int mCount;
+    int mShares;
+};
+
+#endif // PARALLEL_FOR_HPP
@@ -0,0 +1,126 @@
+#include "PerfStats.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+thread_local int PerfStats::drawCalls = 0;
+thread_local int PerfStats::textureUploads = 0;
+
+
+PerfStats::PerfStats()
+	: mCurrent()
+	, mHistory()
+	, mHistoryCount(0)
+	, mHistoryNext(0)
+	, mFrameCount(0)
+	, mLastFrameEnd(std::chrono::steady_clock::now())
+	, mCsv(nullptr)
+{
+}
+
+PerfStats::~PerfStats() {
+	if (mCsv) {
+		std::fclose(mCsv);
+	}
+}
+
+void PerfStats::endFrame() {
+	auto now = std::chrono::steady_clock::now();
+	mCurrent.frameSeconds = std::chrono::duration<double>(now - mLastFrameEnd).count();
+	mLastFrameEnd = now;
+
+	// Render is timed around the whole draw, Present included
+	mCurrent.sectionSeconds[Render] = std::max(0.0, mCurrent.sectionSeconds[Render] - mCurrent.sectionSeconds[Present]);
+	mCurrent.drawCalls = drawCalls;
+	mCurrent.textureUploads = textureUploads;
+	drawCalls = 0;
+	textureUploads = 0;
+
+	if (mCsv) {
+		std::fprintf(mCsv, "%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%d,%d\n", static_cast<unsigned long long>(mFrameCount),
+			mCurrent.frameSeconds * 1000.0, mCurrent.sectionSeconds[Events] * 1000.0, mCurrent.sectionSeconds[Update] * 1000.0,
+			mCurrent.sectionSeconds[Render] * 1000.0, mCurrent.sectionSeconds[Present] * 1000.0,
+			mCurrent.drawCalls, mCurrent.textureUploads, mCurrent.ticks);
+	}
+
+	mHistory[mHistoryNext] = mCurrent;
+	mHistoryNext = (mHistoryNext + 1) % HistoryLength;
+	if (mHistoryCount < HistoryLength) {
+		mHistoryCount++;
+	}
+	mFrameCount++;
+
+	std::memset(&mCurrent, 0, sizeof(mCurrent));
+}
+
+bool PerfStats::openCsv(const char* path) {
+	if (mCsv) {
+		std::fclose(mCsv);
+	}
+
+	mCsv = std::fopen(path, "w");
+	if (!mCsv) {
+		std::cout << "Could not create " << path << std::endl;
+		return false;
+	}
+
+	std::fprintf(mCsv, "frame,frame_ms,events_ms,update_ms,render_ms,present_ms,draw_calls,texture_uploads,ticks\n");
+	return true;
+}
+
+double PerfStats::getFramePercentile(double fraction) {
+	if (mHistoryCount == 0) {
+		return 0.0;
+	}
+
+	mSorted.clear();
+	for (int i = 0; i < mHistoryCount; ++i) {
+		mSorted.push_back(mHistory[i].frameSeconds);
+	}
+
+	std::size_t n = static_cast<std::size_t>(fraction * (mSorted.size() - 1) + 0.5);
+	std::nth_element(mSorted.begin(), mSorted.begin() + n, mSorted.end());
+	return mSorted[n];
+}
+
+double PerfStats::getFrameMax() const {
+	double longest = 0.0;
+	for (int i = 0; i < mHistoryCount; ++i) {
+		longest = std::max(longest, mHistory[i].frameSeconds);
+	}
+	return longest;
+}
+
+double PerfStats::getSectionAverage(Section section) const {
+	double total = 0.0;
+	for (int i = 0; i < mHistoryCount; ++i) {
+		total += mHistory[i].sectionSeconds[section];
+	}
+	return mHistoryCount ? total / mHistoryCount : 0.0;
+}
+
+double PerfStats::getDrawCallsAverage() const {
+	double total = 0.0;
+	for (int i = 0; i < mHistoryCount; ++i) {
+		total += mHistory[i].drawCalls;
+	}
+	return mHistoryCount ? total / mHistoryCount : 0.0;
+}
+
+double PerfStats::getTextureUploadsAverage() const {
+	double total = 0.0;
+	for (int i = 0; i < mHistoryCount; ++i) {
+		total += mHistory[i].textureUploads;
+	}
+	return mHistoryCount ? total / mHistoryCount : 0.0;
+}
+
+double PerfStats::getTicksPerSecond() const {
+	double seconds = 0.0;
+	int ticks = 0;
+	for (int i = 0; i < mHistoryCount; ++i) {
+		seconds += mHistory[i].frameSeconds;
+		ticks += mHistory[i].ticks;
+	}
+	return seconds > 0.0 ? ticks / seconds : 0.0;
+}
@@ -0,0 +1,113 @@
+#ifndef PERF_STATS_HPP
+#define PERF_STATS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Frame timing and render counters for the performance overlay. On by default in debug
+// builds; define SNAKE_PERF=1 to keep them in a release build. When off, the PERF_ macros
+// expand to nothing and the game holds no PerfStats at all.
+#ifndef SNAKE_PERF
+#ifdef NDEBUG
+#define SNAKE_PERF 0
+#else
+#define SNAKE_PERF 1
+#endif
+#endif
+
+class PerfStats {
+public:
+    enum Section {
+        Events,
+        Update,
+        Render,   // Drawing, not counting Present
+        Present,
+        SectionCount
+    };
+
+    struct Sample {
+        double frameSeconds;  // Since the previous frame was shown
+        double sectionSeconds[SectionCount];
+        int drawCalls;
+        int textureUploads;
+        int ticks;
+    };
+
+    PerfStats();
+    ~PerfStats();
+
+    void addTime(Section section, double seconds) { mCurrent.sectionSeconds[section] += seconds; }
+    void addTick() { mCurrent.ticks++; }
+
+    // Close the sample for the frame that was just presented
+    void endFrame();
+
+    // Append every frame's sample to a CSV file as it is taken
+    bool openCsv(const char* path);
+
+    // Summaries over the last HistoryLength frames, in seconds
+    double getFramePercentile(double fraction);
+    double getFrameMax() const;
+    double getSectionAverage(Section section) const;
+    double getDrawCallsAverage() const;
+    double getTextureUploadsAverage() const;
+    double getTicksPerSecond() const;
+    std::uint64_t getFrameCount() const { return mFrameCount; }
+
+    // Bumped by the render code through the macros below, collected at the end of each frame.
+    // One count per thread, since offscreen games (e.g. video export) draw on several at once;
+    // endFrame runs on the thread that drew the frame.
+    static thread_local int drawCalls;
+    static thread_local int textureUploads;
+
+    static const int HistoryLength = 240;
+
+private:
+    PerfStats(const PerfStats&);
+    PerfStats& operator=(const PerfStats&);
+
+private:
+    Sample mCurrent;
+    Sample mHistory[HistoryLength];  // Ring of the most recent frames
+    int mHistoryCount;
+    int mHistoryNext;
+    std::uint64_t mFrameCount;
+    std::chrono::steady_clock::time_point mLastFrameEnd;
+    std::vector<double> mSorted;     // Scratch for percentiles
+    std::FILE* mCsv;
+};
+
+// Adds the time until the end of the enclosing scope to a section
+class PerfScope {
+public:
+    PerfScope(PerfStats& stats, PerfStats::Section section)
+        : mStats(stats), mSection(section), mStart(std::chrono::steady_clock::now()) {}
+    ~PerfScope() {
+        mStats.addTime(mSection, std::chrono::duration<double>(std::chrono::steady_clock::now() - mStart).count());
+    }
+
+private:
+    PerfStats& mStats;
+    PerfStats::Section mSection;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+#if SNAKE_PERF
+#define PERF_CONCAT_INNER(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_INNER(a, b)
+#define PERF_SCOPE(stats, section) PerfScope PERF_CONCAT(perfScope, __LINE__)(stats, PerfStats::section)
+#define PERF_DRAW_CALLS(count) (PerfStats::drawCalls += (count))
+#define PERF_TEXTURE_UPLOAD() (PerfStats::textureUploads++)
+#define PERF_TICK(stats) (stats).addTick()
+#define PERF_END_FRAME(stats) (stats).endFrame()
+#else
+#define PERF_SCOPE(stats, section) ((void)0)
+#define PERF_DRAW_CALLS(count) ((void)0)
+#define PERF_TEXTURE_UPLOAD() ((void)0)
+#define PERF_TICK(stats) ((void)0)
+#define PERF_END_FRAME(stats) ((void)0)
+#endif
+
+#endif // PERF_STATS_HPP
@@ -0,0 +1,38 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+
+// Small seedable random number generator (SplitMix64). Each simulation owns one,
+// so games on different threads never share state and a seed always replays the same game.
+class Random {
+public:
+    explicit Random(std::uint64_t seed = 0) : mState(seed) {}
+
+    void seed(std::uint64_t seed) { mState = seed; }
+    std::uint64_t getState() const { return mState; }  // Seeding with this resumes the sequence
+
+    std::uint64_t next() {
+        mState += 0x9E3779B97F4A7C15ull;
+        return hash(mState);
+    }
+
+    // Uniform value in [0, bound) for bound > 0
+    int nextBelow(int bound) {
+        return static_cast<int>(((next() >> 32) * static_cast<std::uint64_t>(bound)) >> 32);
+    }
+
+    bool nextBool() { return (next() >> 63) != 0; }
+
+    // Mix a value into a well distributed 64-bit hash, e.g. to derive one seed per game
+    static std::uint64_t hash(std::uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+private:
+    std::uint64_t mState;
+};
+
+#endif // RANDOM_HPP
@@ -0,0 +1,243 @@
+#include "Replay.hpp"
+#include <cstring>
+#include <iostream>
+
+static const char ReplayMagic[4] = { 'S', 'N', 'K', 'R' };
+static const std::uint32_t ReplayVersion = 1;
+
+const std::uint32_t ReplayWriter::KeyframeInterval = 256;
+
+// Keep events 8-byte aligned so the mapped file can be read in place
+static std::size_t padTo8(std::size_t size) {
+	return (size + 7) & ~static_cast<std::size_t>(7);
+}
+
+
+ReplayWriter::ReplayWriter()
+	: mFile(nullptr)
+	, mHeader()
+	, mOffset(0)
+	, mLastDirectionX(0)
+	, mLastDirectionY(0)
+{
+}
+
+ReplayWriter::~ReplayWriter() {
+	close();
+}
+
+bool ReplayWriter::open(const char* path, const Simulation& sim, std::uint64_t seed) {
+	close();
+
+	mFile = std::fopen(path, "wb");
+	if (!mFile) {
+		std::cout << "Could not create replay " << path << std::endl;
+		return false;
+	}
+
+	std::memset(&mHeader, 0, sizeof(mHeader));
+	std::memcpy(mHeader.magic, ReplayMagic, sizeof(ReplayMagic));
+	mHeader.version = ReplayVersion;
+	mHeader.gridWidth = static_cast<std::uint32_t>(sim.getGridWidth());
+	mHeader.gridHeight = static_cast<std::uint32_t>(sim.getGridHeight());
+	mHeader.seed = seed;
+	mHeader.tickCount = sim.getTick();
+	mHeader.keyframeInterval = KeyframeInterval;
+
+	// Written again with the totals on close
+	std::fwrite(&mHeader, sizeof(mHeader), 1, mFile);
+	mOffset = sizeof(mHeader);
+
+	mBlocks.clear();
+	mLastDirectionX = sim.getDirectionX();
+	mLastDirectionY = sim.getDirectionY();
+	startBlock(sim);
+	return true;
+}
+
+void ReplayWriter::recordTick(const Simulation& sim) {
+	if (!mFile || sim.getTick() == mHeader.tickCount) {
+		return;
+	}
+	mHeader.tickCount = sim.getTick();
+
+	if (sim.getDirectionX() != mLastDirectionX || sim.getDirectionY() != mLastDirectionY) {
+		mLastDirectionX = sim.getDirectionX();
+		mLastDirectionY = sim.getDirectionY();
+
+		ReplayEvent event = {};
+		event.tickOffset = static_cast<std::uint32_t>(sim.getTick() - mBlocks.back().tick);
+		event.directionX = static_cast<std::int8_t>(mLastDirectionX);
+		event.directionY = static_cast<std::int8_t>(mLastDirectionY);
+		mEvents.push_back(event);
+	}
+
+	if (sim.getTick() % KeyframeInterval == 0) {
+		finishBlock();
+		startBlock(sim);
+	}
+}
+
+void ReplayWriter::close() {
+	if (!mFile) {
+		return;
+	}
+
+	finishBlock();
+
+	mHeader.indexOffset = mOffset;
+	mHeader.blockCount = mBlocks.size();
+	std::fwrite(mBlocks.data(), sizeof(ReplayBlock), mBlocks.size(), mFile);
+
+	std::fseek(mFile, 0, SEEK_SET);
+	std::fwrite(&mHeader, sizeof(mHeader), 1, mFile);
+
+	if (std::fclose(mFile) != 0) {
+		std::cout << "Failed to finish writing the replay" << std::endl;
+	}
+	mFile = nullptr;
+}
+
+// Write the keyframe now; its events follow once the block is finished
+void ReplayWriter::startBlock(const Simulation& sim) {
+	mState.clear();
+	sim.writeState(mState);
+
+	ReplayBlock block = {};
+	block.tick = sim.getTick();
+	block.stateOffset = mOffset;
+	block.stateSize = mState.size();
+	mBlocks.push_back(block);
+
+	mState.resize(padTo8(mState.size()), 0);
+	std::fwrite(mState.data(), 1, mState.size(), mFile);
+	mOffset += mState.size();
+	mEvents.clear();
+}
+
+void ReplayWriter::finishBlock() {
+	ReplayBlock& block = mBlocks.back();
+	block.eventsOffset = mOffset;
+	block.eventCount = mEvents.size();
+
+	std::fwrite(mEvents.data(), sizeof(ReplayEvent), mEvents.size(), mFile);
+	mOffset += mEvents.size() * sizeof(ReplayEvent);
+	mEvents.clear();
+}
+
+
+ReplayPlayer::ReplayPlayer()
+	: mHeader(nullptr)
+	, mBlocks(nullptr)
+	, mBlock(0)
+	, mEvent(0)
+{
+}
+
+bool ReplayPlayer::open(const char* path) {
+	close();
+
+	if (!mFile.open(path)) {
+		return false;
+	}
+
+	const unsigned char* data = mFile.getData();
+	std::size_t size = mFile.getSize();
+	const ReplayHeader* header = reinterpret_cast<const ReplayHeader*>(data);
+
+	if (size < sizeof(ReplayHeader) || std::memcmp(header->magic, ReplayMagic, sizeof(ReplayMagic)) != 0 ||
+		header->version != ReplayVersion) {
+		std::cout << path << " is not a replay" << std::endl;
+		mFile.close();
+		return false;
+	}
+	if (header->indexOffset == 0 || header->blockCount == 0 || header->indexOffset % 8 != 0 ||
+		header->indexOffset > size || header->blockCount > (size - header->indexOffset) / sizeof(ReplayBlock)) {
+		std::cout << path << " was not finished recording" << std::endl;
+		mFile.close();
+		return false;
+	}
+
+	// Check every block lies inside the file once, so seeking can trust them
+	const ReplayBlock* blocks = reinterpret_cast<const ReplayBlock*>(data + header->indexOffset);
+	for (std::uint64_t i = 0; i < header->blockCount; ++i) {
+		const ReplayBlock& block = blocks[i];
+		bool valid = block.stateOffset <= size && block.stateSize <= size - block.stateOffset &&
+			block.eventsOffset % 8 == 0 && block.eventsOffset <= size &&
+			block.eventCount <= (size - block.eventsOffset) / sizeof(ReplayEvent) &&
+			(i == 0 || block.tick > blocks[i - 1].tick);
+		if (!valid) {
+			std::cout << path << " is damaged" << std::endl;
+			mFile.close();
+			return false;
+		}
+	}
+
+	mHeader = header;
+	mBlocks = blocks;
+	mBlock = 0;
+	mEvent = 0;
+	return true;
+}
+
+void ReplayPlayer::close() {
+	mFile.close();
+	mHeader = nullptr;
+	mBlocks = nullptr;
+}
+
+bool ReplayPlayer::seek(Simulation& sim, std::uint64_t tick) {
+	if (tick > mHeader->tickCount) {
+		tick = mHeader->tickCount;
+	}
+
+	// Last keyframe at or before the tick
+	std::size_t low = 0, high = static_cast<std::size_t>(mHeader->blockCount);
+	while (high - low > 1) {
+		std::size_t middle = (low + high) / 2;
+		if (mBlocks[middle].tick <= tick) low = middle;
+		else high = middle;
+	}
+
+	const ReplayBlock& block = mBlocks[low];
+	if (!sim.readState(mFile.getData() + block.stateOffset, static_cast<std::size_t>(block.stateSize))) {
+		std::cout << "Replay keyframe does not fit the board" << std::endl;
+		return false;
+	}
+	mBlock = low;
+	mEvent = 0;
+
+	while (sim.getTick() < tick) {
+		if (!step(sim)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ReplayPlayer::step(Simulation& sim) {
+	if (sim.getTick() >= mHeader->tickCount || sim.isGameOver()) {
+		return false;
+	}
+
+	// Move on to the next block once its keyframe tick is reached
+	while (mBlock + 1 < mHeader->blockCount && mBlocks[mBlock + 1].tick <= sim.getTick()) {
+		mBlock++;
+		mEvent = 0;
+	}
+
+	const ReplayBlock& block = mBlocks[mBlock];
+	const ReplayEvent* events = reinterpret_cast<const ReplayEvent*>(mFile.getData() + block.eventsOffset);
+	std::uint64_t nextTick = sim.getTick() + 1;
+
+	if (mEvent < block.eventCount && block.tick + events[mEvent].tickOffset == nextTick) {
+		const ReplayEvent& event = events[mEvent++];
+		if (event.directionY < 0) sim.turnUp();
+		else if (event.directionY > 0) sim.turnDown();
+		else if (event.directionX < 0) sim.turnLeft();
+		else if (event.directionX > 0) sim.turnRight();
+	}
+
+	sim.step();
+	return true;
+}
@@ -0,0 +1,110 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include "MappedFile.hpp"
+#include "Simulation.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Replay file layout, all little-endian:
+//   ReplayHeader
+//   One block per keyframe: the Simulation state at the keyframe tick (padded to 8 bytes),
+//   then a ReplayEvent for every tick up to the next keyframe where the direction changed
+//   ReplayBlock index, one entry per block, at header.indexOffset
+
+struct ReplayHeader {
+    char magic[4];                 // "SNKR"
+    std::uint32_t version;
+    std::uint32_t gridWidth;
+    std::uint32_t gridHeight;
+    std::uint64_t seed;            // Seed the game was started from
+    std::uint64_t tickCount;       // Last tick recorded
+    std::uint64_t indexOffset;     // Zero if the recording was never finished
+    std::uint64_t blockCount;
+    std::uint32_t keyframeInterval;
+    std::uint32_t reserved;
+};
+
+// The direction the snake turned to on a tick
+struct ReplayEvent {
+    std::uint32_t tickOffset;      // Ticks after the block's keyframe
+    std::int8_t directionX;
+    std::int8_t directionY;
+    std::uint16_t reserved;
+};
+
+struct ReplayBlock {
+    std::uint64_t tick;            // Tick of the keyframe
+    std::uint64_t stateOffset;
+    std::uint64_t stateSize;
+    std::uint64_t eventsOffset;
+    std::uint64_t eventCount;      // Events for the ticks after the keyframe, up to the next one
+};
+
+// Records a game as it is played, one call per tick
+class ReplayWriter {
+public:
+    ReplayWriter();
+    ~ReplayWriter();
+
+    // Start recording a game that was just reset from seed
+    bool open(const char* path, const Simulation& sim, std::uint64_t seed);
+
+    // Call after every step; ticks where the game did not advance are skipped
+    void recordTick(const Simulation& sim);
+
+    // Write the index and header. The file cannot be played back until this is done.
+    void close();
+
+    bool isOpen() const { return mFile != nullptr; }
+
+    static const std::uint32_t KeyframeInterval;
+
+private:
+    ReplayWriter(const ReplayWriter&);
+    ReplayWriter& operator=(const ReplayWriter&);
+
+    void startBlock(const Simulation& sim);
+    void finishBlock();
+
+private:
+    std::FILE* mFile;
+    ReplayHeader mHeader;
+    std::vector<ReplayBlock> mBlocks;
+    std::vector<ReplayEvent> mEvents;  // Events of the block being recorded
+    std::vector<unsigned char> mState;
+    std::uint64_t mOffset;             // Bytes written so far
+    int mLastDirectionX, mLastDirectionY;
+};
+
+// Plays a replay back straight out of a memory-mapped file, without copying the events
+class ReplayPlayer {
+public:
+    ReplayPlayer();
+
+    bool open(const char* path);
+    void close();
+
+    bool isOpen() const { return mHeader != nullptr; }
+    int getGridWidth() const { return static_cast<int>(mHeader->gridWidth); }
+    int getGridHeight() const { return static_cast<int>(mHeader->gridHeight); }
+    std::uint64_t getSeed() const { return mHeader->seed; }
+    std::uint64_t getTickCount() const { return mHeader->tickCount; }
+
+    // Put the simulation into its state after the given tick, starting from the nearest
+    // keyframe so at most one keyframe interval is simulated
+    bool seek(Simulation& sim, std::uint64_t tick);
+
+    // Play the next recorded tick; returns false at the end of the recording
+    bool step(Simulation& sim);
+
+private:
+    MappedFile mFile;
+    const ReplayHeader* mHeader;
+    const ReplayBlock* mBlocks;
+    std::size_t mBlock;  // Block the simulation is currently in
+    std::size_t mEvent;  // Next event within that block
+};
+
+#endif // REPLAY_HPP
@@ -0,0 +1,344 @@
+#include "Simulation.hpp"
+#include "Trace.hpp"
+#include <cstring>
+
+const double Simulation::InitialTimePerTick = 1.0 / 7.0;
+const int Simulation::speedIncreaseThreshold = 5;
+
+
+Simulation::Simulation(int gridWidth, int gridHeight, std::uint64_t seed)
+	: mGridWidth(gridWidth)
+	, mGridHeight(gridHeight)
+	, mIsGameOver(false)
+	, mOutcome(Playing)
+	, mCurrentDirectionX(0)
+	, mCurrentDirectionY(0)
+	, mTurns()
+	, mTurnCount(0)
+	, mScore(0)
+	, mTick(0)
+	, mTimePerTick(InitialTimePerTick)
+	, mFood()
+	, mSnake(static_cast<std::size_t>(gridWidth) * gridHeight)
+	, mPreviousTail()
+	, mMovedLastTick(false)
+	, mOccupancy(gridWidth * gridHeight)
+	, mRandom(seed)
+{
+	reset();
+}
+
+void Simulation::reset(std::uint64_t seed) {
+	mRandom.seed(seed);
+	reset();
+}
+
+void Simulation::reset() {
+	mIsGameOver = false;
+	mOutcome = Playing;
+
+	mCurrentDirectionX = 0;
+	mCurrentDirectionY = 0;
+	mTurnCount = 0;
+
+	// Start in the middle of the board
+	Cell start = { (mGridWidth - 1) / 2, (mGridHeight - 1) / 2 };
+	mSnake.clear();
+	mSnake.pushHead(start);
+	mPreviousTail = start;
+	mMovedLastTick = false;
+	mOccupancy.clear();
+	mOccupancy.occupy(cellIndex(start), static_cast<int>(mSnake.getHeadSlot()));
+
+	placeFood();
+
+	mScore = 0;
+	mTick = 0;
+	mTimePerTick = InitialTimePerTick;
+}
+
+
+void Simulation::turnUp() {
+	queueTurn(0, -1);
+}
+
+void Simulation::turnDown() {
+	queueTurn(0, 1);
+}
+
+void Simulation::turnLeft() {
+	queueTurn(-1, 0);
+}
+
+void Simulation::turnRight() {
+	queueTurn(1, 0);
+}
+
+// Buffer a turn so quick presses within one tick are applied on the following ticks
+void Simulation::queueTurn(int directionX, int directionY) {
+	// Compare against the direction the snake will have once the earlier turns are applied
+	int lastX = mTurnCount > 0 ? mTurns[mTurnCount - 1].x : mCurrentDirectionX;
+	int lastY = mTurnCount > 0 ? mTurns[mTurnCount - 1].y : mCurrentDirectionY;
+
+	// Prevent the snake from reversing direction, and merge repeats of the same input
+	if ((directionX != 0 && directionX == -lastX) || (directionY != 0 && directionY == -lastY)) {
+		return;
+	}
+	if (directionX == lastX && directionY == lastY) {
+		return;
+	}
+
+	if (mTurnCount < MaxQueuedTurns) {
+		mTurns[mTurnCount++] = { directionX, directionY };
+	}
+}
+
+
+void Simulation::step() {
+	mMovedLastTick = false;
+
+	if (mIsGameOver) {
+		return;
+	}
+
+	// Apply one buffered turn per tick
+	if (mTurnCount > 0) {
+		mCurrentDirectionX = mTurns[0].x;
+		mCurrentDirectionY = mTurns[0].y;
+		for (int i = 1; i < mTurnCount; ++i) {
+			mTurns[i - 1] = mTurns[i];
+		}
+		mTurnCount--;
+	}
+
+	mTick++;
+
+	Cell head = { mSnake.head().x + mCurrentDirectionX, mSnake.head().y + mCurrentDirectionY };
+
+	// Game Over if the head leaves the board
+	if (head.x < 0 || head.x >= mGridWidth || head.y < 0 || head.y >= mGridHeight) {
+		mIsGameOver = true;
+		mOutcome = HitWall;
+		return;
+	}
+
+	// End game if the snake collides with itself. The tail leaves before the head
+	// arrives, so following it is allowed (food is never under the snake).
+	if (mOccupancy.isOccupied(cellIndex(head)) && head != mSnake.tail()) {
+		mIsGameOver = true;
+		mOutcome = HitSelf;
+		return;
+	}
+
+	bool ateFood = (head == mFood);
+
+	// Move by writing the new head; the tail stays put when the snake grows
+	mPreviousTail = mSnake.tail();
+	if (!ateFood) {
+		mOccupancy.release(cellIndex(mSnake.popTail()));
+	}
+
+	mSnake.pushHead(head);
+	mOccupancy.occupy(cellIndex(head), static_cast<int>(mSnake.getHeadSlot()));
+	mMovedLastTick = (mCurrentDirectionX != 0 || mCurrentDirectionY != 0);
+
+	if (ateFood) {
+		placeFood();
+
+		mScore++;
+
+		if (mScore % speedIncreaseThreshold == 0) {
+			increaseSpeed();
+		}
+	}
+}
+
+bool Simulation::applyMove(int directionX, int directionY, bool ate) {
+	Cell head = { mSnake.head().x + directionX, mSnake.head().y + directionY };
+	if (mIsGameOver || head.x < 0 || head.x >= mGridWidth || head.y < 0 || head.y >= mGridHeight) {
+		return false;
+	}
+	if (mOccupancy.isOccupied(cellIndex(head)) && (ate || head != mSnake.tail())) {
+		return false;
+	}
+
+	mTick++;
+	mCurrentDirectionX = directionX;
+	mCurrentDirectionY = directionY;
+	mPreviousTail = mSnake.tail();
+	if (!ate) {
+		mOccupancy.release(cellIndex(mSnake.popTail()));
+	}
+	mSnake.pushHead(head);
+	mOccupancy.occupy(cellIndex(head), static_cast<int>(mSnake.getHeadSlot()));
+	mMovedLastTick = true;
+
+	if (ate) {
+		mScore++;
+		if (mScore % speedIncreaseThreshold == 0) {
+			increaseSpeed();
+		}
+	}
+	return true;
+}
+
+void Simulation::endGame(Outcome outcome) {
+	mIsGameOver = true;
+	mOutcome = outcome;
+	mMovedLastTick = false;
+}
+
+void Simulation::increaseSpeed() {
+	if (mTimePerTick > 0.080) {  // Prevent the game from becoming too fast
+		mTimePerTick -= 0.010;
+	}
+}
+
+
+// Pick uniformly among the free cells; a full board means the player has won.
+// The choice only depends on which cells are free, not on the order they were taken in,
+// so a game restored from a snapshot places the same food as the original.
+void Simulation::placeFood() {
+	TRACE_SCOPE("placeFood");
+
+	int freeCount = mOccupancy.getFreeCount();
+	if (freeCount == 0) {
+		mOutcome = BoardFull;
+		mIsGameOver = true;
+		return;
+	}
+
+	int cellCount = mGridWidth * mGridHeight;
+	int cell = -1;
+
+	// Random cells are almost always free; a nearly full board picks the n-th free cell instead
+	for (int attempt = 0; attempt < 32 && cell < 0; ++attempt) {
+		int candidate = mRandom.nextBelow(cellCount);
+		if (!mOccupancy.isOccupied(candidate)) {
+			cell = candidate;
+		}
+	}
+	if (cell < 0) {
+		cell = mOccupancy.findFreeCell(mRandom.nextBelow(freeCount));
+	}
+
+	mFood.x = cell % mGridWidth;
+	mFood.y = cell / mGridWidth;
+}
+
+// Fixed-size part of a snapshot; the snake's cells follow it, head first
+struct SimulationStateHeader {
+	std::uint64_t tick;
+	std::uint64_t random;
+	double timePerTick;
+	std::int32_t score;
+	std::uint32_t length;
+	std::uint16_t foodX, foodY;
+	std::uint16_t previousTailX, previousTailY;
+	std::int8_t directionX, directionY;
+	std::uint8_t outcome;
+	std::uint8_t flags;  // 1 = game over, 2 = moved last tick
+};
+
+void Simulation::writeState(std::vector<unsigned char>& out) const {
+	SimulationStateHeader header = {};
+	header.tick = mTick;
+	header.random = mRandom.getState();
+	header.timePerTick = mTimePerTick;
+	header.score = mScore;
+	header.length = static_cast<std::uint32_t>(mSnake.size());
+	header.foodX = static_cast<std::uint16_t>(mFood.x);
+	header.foodY = static_cast<std::uint16_t>(mFood.y);
+	header.previousTailX = static_cast<std::uint16_t>(mPreviousTail.x);
+	header.previousTailY = static_cast<std::uint16_t>(mPreviousTail.y);
+	header.directionX = static_cast<std::int8_t>(mCurrentDirectionX);
+	header.directionY = static_cast<std::int8_t>(mCurrentDirectionY);
+	header.outcome = static_cast<std::uint8_t>(mOutcome);
+	header.flags = (mIsGameOver ? 1 : 0) | (mMovedLastTick ? 2 : 0);
+
+	std::size_t start = out.size();
+	out.resize(start + sizeof(header) + mSnake.size() * 2 * sizeof(std::uint16_t));
+	std::memcpy(&out[start], &header, sizeof(header));
+
+	unsigned char* cells = &out[start + sizeof(header)];
+	for (std::size_t i = 0; i < mSnake.size(); ++i) {
+		std::uint16_t xy[2] = { static_cast<std::uint16_t>(mSnake[i].x), static_cast<std::uint16_t>(mSnake[i].y) };
+		std::memcpy(cells + i * sizeof(xy), xy, sizeof(xy));
+	}
+}
+
+bool Simulation::readState(const unsigned char* data, std::size_t size) {
+	SimulationStateHeader header;
+	if (size < sizeof(header)) {
+		return false;
+	}
+	std::memcpy(&header, data, sizeof(header));
+
+	std::size_t cellCount = static_cast<std::size_t>(mGridWidth) * mGridHeight;
+	if (header.length == 0 || header.length > cellCount ||
+		size < sizeof(header) + header.length * 2 * sizeof(std::uint16_t) || header.outcome > BoardFull ||
+		header.foodX >= mGridWidth || header.foodY >= mGridHeight) {
+		return false;
+	}
+
+	const unsigned char* cells = data + sizeof(header);
+	mScratchCells.resize(header.length);
+	for (std::size_t i = 0; i < header.length; ++i) {
+		std::uint16_t xy[2];
+		std::memcpy(xy, cells + i * sizeof(xy), sizeof(xy));
+		mScratchCells[i] = { xy[0], xy[1] };
+	}
+	if (!rebuildSnake(mScratchCells)) {
+		reset();
+		return false;
+	}
+
+	mTick = header.tick;
+	mRandom.seed(header.random);
+	mTimePerTick = header.timePerTick;
+	mScore = header.score;
+	mFood = { header.foodX, header.foodY };
+	mPreviousTail = { header.previousTailX, header.previousTailY };
+	mCurrentDirectionX = header.directionX;
+	mCurrentDirectionY = header.directionY;
+	mOutcome = static_cast<Outcome>(header.outcome);
+	mIsGameOver = (header.flags & 1) != 0;
+	mMovedLastTick = (header.flags & 2) != 0;
+	mTurnCount = 0;
+	return true;
+}
+
+bool Simulation::setSnake(const std::vector<Cell>& cells, int directionX, int directionY) {
+	if (cells.empty() || !rebuildSnake(cells)) {
+		reset();
+		return false;
+	}
+
+	mIsGameOver = false;
+	mOutcome = Playing;
+	mCurrentDirectionX = directionX;
+	mCurrentDirectionY = directionY;
+	mTurnCount = 0;
+	mPreviousTail = mSnake.tail();
+	mMovedLastTick = false;
+
+	if (mOccupancy.isOccupied(cellIndex(mFood))) {
+		placeFood();
+	}
+	return true;
+}
+
+// Refill the ring buffer and occupancy from the tail forwards so the ring slots line up
+bool Simulation::rebuildSnake(const std::vector<Cell>& cells) {
+	mSnake.clear();
+	mOccupancy.clear();
+	for (std::size_t i = cells.size(); i-- > 0;) {
+		const Cell& cell = cells[i];
+		if (cell.x < 0 || cell.x >= mGridWidth || cell.y < 0 || cell.y >= mGridHeight || mOccupancy.isOccupied(cellIndex(cell))) {
+			return false;
+		}
+		mSnake.pushHead(cell);
+		mOccupancy.occupy(cellIndex(cell), static_cast<int>(mSnake.getHeadSlot()));
+	}
+	return true;
+}
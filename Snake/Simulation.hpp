@@ -0,0 +1,117 @@
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include "Cell.hpp"
+#include "Occupancy.hpp"
+#include "Random.hpp"
+#include "SnakeBody.hpp"
+#include <cstdint>
+#include <vector>
+
+// The game rules without any window, renderer or font attached.
+// Everything is measured in cells, so one process can step as many boards as it likes.
+class Simulation {
+public:
+    // Why a game ended
+    enum Outcome {
+        Playing,
+        HitWall,
+        HitSelf,
+        BoardFull  // The player won
+    };
+
+    Simulation(int gridWidth, int gridHeight, std::uint64_t seed = 0);
+
+    // Start a fresh game, continuing the random sequence or starting a new one from seed
+    void reset();
+    void reset(std::uint64_t seed);
+
+    // Advance the game by one tick
+    void step();
+
+    // Request a new direction. Turns are buffered and applied one per tick;
+    // a turn that would reverse the snake or repeats the previous one is ignored.
+    void turnUp();
+    void turnDown();
+    void turnLeft();
+    void turnRight();
+
+    // Snapshot everything but the buffered turns, e.g. for replay keyframes.
+    // readState returns false if the data does not fit this board.
+    void writeState(std::vector<unsigned char>& out) const;
+    bool readState(const unsigned char* data, std::size_t size);
+
+    // Replace the snake with the given cells, head first, e.g. to set up a position to benchmark.
+    // Returns false (and resets) if a cell is off the board or used twice.
+    bool setSnake(const std::vector<Cell>& cells, int directionX, int directionY);
+
+    // Move the food to a random free cell
+    void placeFood();
+
+    // Mirror a game played elsewhere, e.g. on a server. applyMove moves the head one cell and
+    // drops the tail unless the snake ate; it returns false if the move does not fit this board.
+    bool applyMove(int directionX, int directionY, bool ate);
+    void setFood(const Cell& food) { mFood = food; }
+    void endGame(Outcome outcome);
+
+    bool isGameOver() const { return mIsGameOver; }
+    bool hasWon() const { return mOutcome == BoardFull; }  // The snake filled the whole board
+    Outcome getOutcome() const { return mOutcome; }
+    int getScore() const { return mScore; }
+    std::uint64_t getTick() const { return mTick; }  // Ticks played since the game started
+    double getTimePerTick() const { return mTimePerTick; }  // Seconds between ticks
+    int getGridWidth() const { return mGridWidth; }
+    int getGridHeight() const { return mGridHeight; }
+    int getDirectionX() const { return mCurrentDirectionX; }
+    int getDirectionY() const { return mCurrentDirectionY; }
+    const Cell& getFood() const { return mFood; }
+    const Cell& getHead() const { return mSnake.head(); }
+    const SnakeBody& getSnake() const { return mSnake; }  // Head first
+
+    // Where segment i was before the last tick, for drawing in-between positions
+    const Cell& getPreviousPosition(std::size_t i) const {
+        if (!mMovedLastTick) return mSnake[i];
+        return i + 1 < mSnake.size() ? mSnake[i + 1] : mPreviousTail;
+    }
+    bool isOccupied(const Cell& cell) const { return mOccupancy.isOccupied(cellIndex(cell)); }
+
+    // Which segment covers the cell, counted from the head, or -1 if it is free
+    int getSegmentIndex(const Cell& cell) const {
+        int index = cellIndex(cell);
+        if (!mOccupancy.isOccupied(index)) return -1;
+        return static_cast<int>(mSnake.indexOfSlot(mOccupancy.getOwner(index)));
+    }
+
+    static const double InitialTimePerTick;
+
+private:
+    int cellIndex(const Cell& cell) const { return cell.y * mGridWidth + cell.x; }
+    void queueTurn(int directionX, int directionY);
+    bool rebuildSnake(const std::vector<Cell>& cells);
+    void increaseSpeed();
+
+private:
+    static const int MaxQueuedTurns = 3;
+
+    int mGridWidth;
+    int mGridHeight;
+    bool mIsGameOver;
+    Outcome mOutcome;
+    int mCurrentDirectionX, mCurrentDirectionY;  // Direction applied on the last tick
+    Cell mTurns[MaxQueuedTurns];                 // Buffered turns as direction vectors, oldest first
+    int mTurnCount;
+    int mScore;
+    std::uint64_t mTick;
+    double mTimePerTick;
+    Cell mFood;
+    SnakeBody mSnake;
+    Cell mPreviousTail;    // Tail cell before the last tick (unchanged if the snake grew)
+    bool mMovedLastTick;
+    Occupancy mOccupancy;  // Cells covered by the snake
+    Random mRandom;        // Food placement
+    std::vector<Cell> mScratchCells;  // Reused when restoring snapshots
+
+    static const int speedIncreaseThreshold;
+};
+
+#endif // SIMULATION_HPP
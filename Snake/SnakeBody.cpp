@@ -0,0 +1,26 @@
+#include "SnakeBody.hpp"
+
+
+SnakeBody::SnakeBody(std::size_t capacity)
+	: mCells(capacity)
+	, mHead(0)
+	, mSize(0)
+{
+}
+
+void SnakeBody::clear() {
+	mHead = 0;
+	mSize = 0;
+}
+
+void SnakeBody::pushHead(const Cell& cell) {
+	mHead = (mHead + 1 == mCells.size()) ? 0 : mHead + 1;
+	mCells[mHead] = cell;
+	mSize++;
+}
+
+Cell SnakeBody::popTail() {
+	Cell tail = (*this)[mSize - 1];
+	mSize--;
+	return tail;
+}
@@ -0,0 +1,46 @@
+#ifndef SNAKE_BODY_HPP
+#define SNAKE_BODY_HPP
+
+#include "Cell.hpp"
+#include <cstddef>
+#include <vector>
+
+// The snake's segments stored in a ring buffer sized for the whole board.
+// Moving writes the new head and drops the tail, so a tick costs the same at any length.
+class SnakeBody {
+public:
+    explicit SnakeBody(std::size_t capacity);
+
+    void clear();
+
+    // Add a segment in front of the head
+    void pushHead(const Cell& cell);
+
+    // Remove the last segment and return where it was
+    Cell popTail();
+
+    std::size_t size() const { return mSize; }
+    std::size_t capacity() const { return mCells.size(); }
+    bool isFull() const { return mSize == mCells.size(); }
+
+    const Cell& head() const { return mCells[mHead]; }
+    const Cell& tail() const { return (*this)[mSize - 1]; }
+
+    // Ring slots stay fixed while a segment lives, so they can be stored per cell
+    std::size_t getHeadSlot() const { return mHead; }
+    std::size_t indexOfSlot(std::size_t slot) const {
+        return mHead >= slot ? mHead - slot : mHead + mCells.size() - slot;
+    }
+
+    // Segment i counted from the head
+    const Cell& operator[](std::size_t i) const {
+        return mCells[mHead >= i ? mHead - i : mHead + mCells.size() - i];
+    }
+
+private:
+    std::vector<Cell> mCells;
+    std::size_t mHead;  // Slot holding the head
+    std::size_t mSize;
+};
+
+#endif // SNAKE_BODY_HPP
@@ -0,0 +1,66 @@
+#include "SpriteBatch.hpp"
+#include "PerfStats.hpp"
+#include <iostream>
+
+const SDL_Color SpriteBatch::White = { 255, 255, 255, SDL_ALPHA_OPAQUE };
+
+
+SpriteBatch::SpriteBatch()
+	: mTexture(nullptr)
+	, mTextureWidth(1.0f)
+	, mTextureHeight(1.0f)
+{
+}
+
+void SpriteBatch::setTexture(SDL_Texture* texture) {
+	mTexture = texture;
+
+	int width = 1, height = 1;
+	if (texture) {
+		SDL_QueryTexture(texture, NULL, NULL, &width, &height);
+	}
+	mTextureWidth = static_cast<float>(width);
+	mTextureHeight = static_cast<float>(height);
+}
+
+void SpriteBatch::clear() {
+	mVertices.clear();
+}
+
+void SpriteBatch::add(const SDL_Rect& src, const SDL_Rect& dst, int quarterTurns, const SDL_Color& tint) {
+	// Source corners in clockwise order: top left, top right, bottom right, bottom left
+	float u0 = src.x / mTextureWidth, u1 = (src.x + src.w) / mTextureWidth;
+	float v0 = src.y / mTextureHeight, v1 = (src.y + src.h) / mTextureHeight;
+	const SDL_FPoint uv[4] = { { u0, v0 }, { u1, v0 }, { u1, v1 }, { u0, v1 } };
+
+	float x0 = static_cast<float>(dst.x), x1 = static_cast<float>(dst.x + dst.w);
+	float y0 = static_cast<float>(dst.y), y1 = static_cast<float>(dst.y + dst.h);
+	const SDL_FPoint corners[4] = { { x0, y0 }, { x1, y0 }, { x1, y1 }, { x0, y1 } };
+
+	// Rotating clockwise shows the source corner one step behind at each destination corner
+	int turns = ((quarterTurns % 4) + 4) % 4;
+	for (int i = 0; i < 4; ++i) {
+		mVertices.push_back({ corners[i], tint, uv[(i - turns + 4) % 4] });
+	}
+
+	// Extend the shared index list the first time the batch reaches this size
+	int first = static_cast<int>(mVertices.size()) - 4;
+	if (mIndices.size() < mVertices.size() / 4 * 6) {
+		const int quad[6] = { first, first + 1, first + 2, first, first + 2, first + 3 };
+		mIndices.insert(mIndices.end(), quad, quad + 6);
+	}
+}
+
+bool SpriteBatch::draw(SDL_Renderer* renderer) const {
+	if (mVertices.empty()) {
+		return true;
+	}
+
+	int indexCount = static_cast<int>(mVertices.size() / 4 * 6);
+	if (SDL_RenderGeometry(renderer, mTexture, mVertices.data(), static_cast<int>(mVertices.size()), mIndices.data(), indexCount) != 0) {
+		std::cout << "Failed to draw sprites: " << SDL_GetError() << std::endl;
+		return false;
+	}
+	PERF_DRAW_CALLS(1);
+	return true;
+}
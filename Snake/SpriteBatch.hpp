@@ -0,0 +1,37 @@
+#ifndef SPRITE_BATCH_HPP
+#define SPRITE_BATCH_HPP
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// Collects sprites from one texture atlas and submits them all with a single
+// SDL_RenderGeometry call, so the number of draw calls does not grow with the snake.
+class SpriteBatch {
+public:
+    SpriteBatch();
+
+    // Atlas the sprites are cut from
+    void setTexture(SDL_Texture* texture);
+
+    // Start a new batch
+    void clear();
+
+    // Queue a sprite, rotating the source clockwise by the given number of quarter turns
+    // and multiplying its colours by the tint
+    void add(const SDL_Rect& src, const SDL_Rect& dst, int quarterTurns = 0, const SDL_Color& tint = White);
+
+    // Draw everything queued since the last clear
+    bool draw(SDL_Renderer* renderer) const;
+
+    std::size_t getSpriteCount() const { return mVertices.size() / 4; }
+
+    static const SDL_Color White;
+
+private:
+    SDL_Texture* mTexture;
+    float mTextureWidth, mTextureHeight;
+    std::vector<SDL_Vertex> mVertices;
+    std::vector<int> mIndices;  // Two triangles per sprite, only ever grows
+};
+
+#endif // SPRITE_BATCH_HPP
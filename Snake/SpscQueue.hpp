@@ -0,0 +1,62 @@
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+
+// Fixed-size ring for passing items from exactly one producer thread to exactly one consumer
+// thread without locks. Each side keeps a copy of the other's position and only re-reads the
+// shared one when its copy says the ring is full (or empty), so most calls touch no shared line.
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscQueue() : mTail(0), mHeadSeen(0), mHead(0), mTailSeen(0) {}
+
+    // Producer: returns false, dropping the item, if the ring is full
+    bool push(const T& item) {
+        std::size_t tail = mTail.load(std::memory_order_relaxed);
+        if (tail - mHeadSeen == Capacity) {
+            mHeadSeen = mHead.load(std::memory_order_acquire);
+            if (tail - mHeadSeen == Capacity) {
+                return false;
+            }
+        }
+        mItems[tail & (Capacity - 1)] = item;
+        mTail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer: returns false if there is nothing to take
+    bool pop(T& item) {
+        std::size_t head = mHead.load(std::memory_order_relaxed);
+        if (head == mTailSeen) {
+            mTailSeen = mTail.load(std::memory_order_acquire);
+            if (head == mTailSeen) {
+                return false;
+            }
+        }
+        item = mItems[head & (Capacity - 1)];
+        mHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer: whether pop would fail right now
+    bool isEmpty() const {
+        return mHead.load(std::memory_order_relaxed) == mTail.load(std::memory_order_acquire);
+    }
+
+private:
+    SpscQueue(const SpscQueue&);             // Not copyable
+    SpscQueue& operator=(const SpscQueue&);
+
+private:
+    T mItems[Capacity];
+    alignas(64) std::atomic<std::size_t> mTail;  // Written by the producer
+    std::size_t mHeadSeen;                       // Producer's copy of mHead
+    alignas(64) std::atomic<std::size_t> mHead;  // Written by the consumer
+    std::size_t mTailSeen;                       // Consumer's copy of mTail
+};
+
+#endif // SPSC_QUEUE_HPP
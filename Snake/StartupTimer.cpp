@@ -0,0 +1,78 @@
+#include "StartupTimer.hpp"
+#include "Trace.hpp"
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+struct StartupPhase {
+	const char* name;
+	std::uint64_t start;
+	std::uint64_t end;
+	bool background;
+};
+
+static std::mutex sMutex;
+static std::vector<StartupPhase> sPhases;
+static std::uint64_t sBegin = 0;
+static std::uint64_t sLastMark = 0;
+static bool sPrint = false;
+static bool sDone = false;
+
+
+void StartupTimer::begin() {
+	std::lock_guard<std::mutex> lock(sMutex);
+	sBegin = sLastMark = Trace::now();
+	sPhases.clear();
+	sDone = false;
+}
+
+void StartupTimer::enableReport() {
+	std::lock_guard<std::mutex> lock(sMutex);
+	sPrint = true;
+}
+
+void StartupTimer::mark(const char* phase) {
+	std::uint64_t now = Trace::now();
+	std::lock_guard<std::mutex> lock(sMutex);
+	if (sDone) {
+		return;
+	}
+	sPhases.push_back({ phase, sLastMark, now, false });
+	if (Trace::isEnabled()) {
+		Trace::record(phase, sLastMark, now);
+	}
+	sLastMark = now;
+}
+
+void StartupTimer::record(const char* phase, std::uint64_t startNanoseconds, std::uint64_t endNanoseconds) {
+	std::lock_guard<std::mutex> lock(sMutex);
+	if (sDone) {
+		return;
+	}
+	sPhases.push_back({ phase, startNanoseconds, endNanoseconds, true });
+	if (Trace::isEnabled()) {
+		Trace::record(phase, startNanoseconds, endNanoseconds);  // On the calling thread's track
+	}
+}
+
+void StartupTimer::firstFrame() {
+	mark("first frame");
+
+	std::lock_guard<std::mutex> lock(sMutex);
+	if (sDone) {
+		return;
+	}
+	sDone = true;
+	if (!sPrint) {
+		return;
+	}
+
+	// Times in milliseconds since main started; background phases overlap the others
+	std::printf("Startup phase                   took ms    ends at ms\n");
+	for (const StartupPhase& phase : sPhases) {
+		std::printf("%s%-30s %8.2f    %8.2f\n", phase.background ? "  " : "", phase.name,
+			(phase.end - phase.start) / 1e6, (phase.end - sBegin) / 1e6);
+	}
+	std::printf("Time to first frame: %.2f ms\n", (sLastMark - sBegin) / 1e6);
+	std::fflush(stdout);
+}
@@ -0,0 +1,27 @@
+#ifndef STARTUP_TIMER_HPP
+#define STARTUP_TIMER_HPP
+
+#include <cstdint>
+
+// How long each step of starting the game takes, from the top of main to the first frame
+// on screen. Phases also go to the Chrome trace when one is being recorded. Phase names
+// must outlive the program, e.g. string literals.
+class StartupTimer {
+public:
+    // Start the clock, first thing in main
+    static void begin();
+
+    // Print the phases once the first frame is shown
+    static void enableReport();
+
+    // End the current phase on the main thread and start the next
+    static void mark(const char* phase);
+
+    // A phase that ran alongside the others, e.g. on a worker thread (Trace::now times)
+    static void record(const char* phase, std::uint64_t startNanoseconds, std::uint64_t endNanoseconds);
+
+    // Mark the first frame and print the report; later calls do nothing
+    static void firstFrame();
+};
+
+#endif // STARTUP_TIMER_HPP
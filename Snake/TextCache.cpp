@@ -0,0 +1,57 @@
+#include "TextCache.hpp"
+#include "PerfStats.hpp"
+#include "Trace.hpp"
+#include <iostream>
+
+
+TextCache::TextCache()
+	: mColor()
+	, mTexture(nullptr)
+	, mWidth(0)
+	, mHeight(0)
+{
+}
+
+TextCache::~TextCache() {
+	clear();
+}
+
+bool TextCache::update(SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_Color color) {
+	if (mTexture && text == mText && color.r == mColor.r && color.g == mColor.g && color.b == mColor.b && color.a == mColor.a) {
+		return true;
+	}
+
+	TRACE_SCOPE("renderText");
+	clear();
+
+	SDL_Surface* surface = TTF_RenderText_Solid(font, text, color);
+	if (!surface) {
+		std::cout << "Failed to render text: " << TTF_GetError() << std::endl;
+		return false;
+	}
+
+	mTexture = SDL_CreateTextureFromSurface(renderer, surface);
+	PERF_TEXTURE_UPLOAD();
+	mWidth = surface->w;
+	mHeight = surface->h;
+	SDL_FreeSurface(surface);
+
+	if (!mTexture) {
+		std::cout << "Failed to create text texture: " << SDL_GetError() << std::endl;
+		return false;
+	}
+
+	mText = text;
+	mColor = color;
+	return true;
+}
+
+void TextCache::clear() {
+	if (mTexture) {
+		SDL_DestroyTexture(mTexture);
+		mTexture = nullptr;
+	}
+	mText.clear();
+	mWidth = 0;
+	mHeight = 0;
+}
@@ -0,0 +1,37 @@
+#ifndef TEXT_CACHE_HPP
+#define TEXT_CACHE_HPP
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <string>
+
+// A line of text kept as a texture. The glyphs are only rasterized and uploaded
+// again when the string or color changes, so drawing it every frame is just a copy.
+class TextCache {
+public:
+    TextCache();
+    ~TextCache();
+
+    // Make sure the cached texture shows this text; returns false if rendering failed
+    bool update(SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_Color color);
+
+    SDL_Texture* getTexture() const { return mTexture; }
+    int getWidth() const { return mWidth; }
+    int getHeight() const { return mHeight; }
+
+    // Release the texture, e.g. before the renderer is destroyed
+    void clear();
+
+private:
+    TextCache(const TextCache&) = delete;
+    TextCache& operator=(const TextCache&) = delete;
+
+private:
+    std::string mText;
+    SDL_Color mColor;
+    SDL_Texture* mTexture;
+    int mWidth;
+    int mHeight;
+};
+
+#endif // TEXT_CACHE_HPP
@@ -0,0 +1,22 @@
+#include "TickClock.hpp"
+
+
+TickClock::TickClock()
+	: mLastTick(Clock::now())
+	, mNextTick(mLastTick)
+{
+}
+
+void TickClock::restart(Clock::time_point now, double timePerTick) {
+	mLastTick = now;
+	mNextTick = now + toDuration(timePerTick);
+}
+
+void TickClock::advance(double timePerTick) {
+	mLastTick = mNextTick;
+	mNextTick += toDuration(timePerTick);
+}
+
+TickClock::Clock::duration TickClock::toDuration(double seconds) {
+	return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+}
@@ -0,0 +1,32 @@
+#ifndef TICK_CLOCK_HPP
+#define TICK_CLOCK_HPP
+
+#include <chrono>
+
+// Fixed-step schedule on the steady clock. Each tick is due one period after the previous tick
+// was due, not after it actually ran, so waking up late never pushes the later ticks back.
+class TickClock {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    TickClock();
+
+    // Count from now: the last tick counts as due now and the next is a period later.
+    // Used to start, and to drop a backlog instead of fast-forwarding through it.
+    void restart(Clock::time_point now, double timePerTick);
+
+    // Whether the next tick is due; after stepping it, advance with the (possibly new) period
+    bool isDue(Clock::time_point now) const { return now >= mNextTick; }
+    void advance(double timePerTick);
+
+    Clock::time_point getLastTick() const { return mLastTick; }  // When the latest tick was due
+    Clock::time_point getNextTick() const { return mNextTick; }
+
+    static Clock::duration toDuration(double seconds);
+
+private:
+    Clock::time_point mLastTick;
+    Clock::time_point mNextTick;
+};
+
+#endif // TICK_CLOCK_HPP
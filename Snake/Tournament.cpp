@@ -0,0 +1,159 @@
+#include "Tournament.hpp"
+#include "HeadlessRunner.hpp"
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The games a worker still has to play, [begin, end)
+struct WorkRange {
+	std::mutex mutex;
+	std::uint64_t begin;
+	std::uint64_t end;
+};
+
+struct WorkerStats {
+	TournamentStats totals;
+	HeadlessStats headless;
+};
+
+static void addResult(TournamentStats& totals, std::uint64_t game, const GameResult& result) {
+	if (totals.games == 0 || result.score > totals.bestScore || (result.score == totals.bestScore && game < totals.bestGame)) {
+		totals.bestScore = result.score;
+		totals.bestGame = game;
+	}
+	totals.games++;
+	totals.ticks += result.ticks;
+	totals.totalScore += result.score;
+	totals.totalLength += result.length;
+
+	if (result.stalled) totals.stalled++;
+	else if (result.outcome == Simulation::HitWall) totals.hitWall++;
+	else if (result.outcome == Simulation::HitSelf) totals.hitSelf++;
+	else if (result.outcome == Simulation::BoardFull) totals.boardFull++;
+}
+
+// Take the next game from our own range
+static bool popGame(WorkRange& range, std::uint64_t& game) {
+	std::lock_guard<std::mutex> lock(range.mutex);
+	if (range.begin == range.end) {
+		return false;
+	}
+	game = range.begin++;
+	return true;
+}
+
+// Move the back half of another worker's range into ours. Only one lock is held at a time.
+static bool steal(std::vector<std::unique_ptr<WorkRange>>& ranges, std::size_t self) {
+	for (std::size_t offset = 1; offset < ranges.size(); ++offset) {
+		WorkRange& victim = *ranges[(self + offset) % ranges.size()];
+
+		std::uint64_t begin, end;
+		{
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			std::uint64_t remaining = victim.end - victim.begin;
+			if (remaining == 0) {
+				continue;
+			}
+			begin = victim.end - (remaining + 1) / 2;
+			end = victim.end;
+			victim.end = begin;
+		}
+
+		std::lock_guard<std::mutex> lock(ranges[self]->mutex);
+		ranges[self]->begin = begin;
+		ranges[self]->end = end;
+		return true;
+	}
+	return false;
+}
+
+static void work(const TournamentConfig& config, std::vector<std::unique_ptr<WorkRange>>& ranges, std::size_t self, WorkerStats& stats) {
+	// Every worker has its own autopilot and simulation; nothing is shared but the ranges
+	Autopilot autopilot(config.strategy, config.budgetMicroseconds, config.gridWidth, config.gridHeight);
+	HeadlessRunner runner(config.gridWidth, config.gridHeight, config.useAutopilot ? &autopilot : nullptr);
+
+	std::uint64_t game;
+	do {
+		while (popGame(*ranges[self], game)) {
+			GameResult result = runner.playGame(Tournament::gameSeed(config.seed, game), stats.headless);
+			addResult(stats.totals, game, result);
+		}
+	} while (steal(ranges, self));
+}
+
+
+Tournament::Tournament(const TournamentConfig& config)
+	: mConfig(config)
+{
+}
+
+std::uint64_t Tournament::gameSeed(std::uint64_t seed, std::uint64_t game) {
+	return Random::hash(seed ^ Random::hash(game));
+}
+
+TournamentStats Tournament::run() {
+	int threads = mConfig.threads;
+	if (threads <= 0) {
+		threads = static_cast<int>(std::thread::hardware_concurrency());
+	}
+#ifdef __EMSCRIPTEN__
+	threads = 1;  // Built without pthreads
+#endif
+	if (threads < 1) {
+		threads = 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	// Start with an even split; stealing evens out games that run long
+	std::vector<std::unique_ptr<WorkRange>> ranges;
+	for (int i = 0; i < threads; ++i) {
+		std::unique_ptr<WorkRange> range(new WorkRange());
+		range->begin = mConfig.games * i / threads;
+		range->end = mConfig.games * (i + 1) / threads;
+		ranges.push_back(std::move(range));
+	}
+
+	std::vector<WorkerStats> workerStats(threads);
+	if (threads == 1) {
+		work(mConfig, ranges, 0, workerStats[0]);
+	}
+	else {
+		std::vector<std::thread> workers;
+		for (int i = 0; i < threads; ++i) {
+			workers.emplace_back(work, std::cref(mConfig), std::ref(ranges), static_cast<std::size_t>(i), std::ref(workerStats[i]));
+		}
+		for (std::thread& worker : workers) {
+			worker.join();
+		}
+	}
+
+	// Integer sums and the lowest-index tie break make the totals independent of the split
+	TournamentStats totals = {};
+	for (const WorkerStats& worker : workerStats) {
+		const TournamentStats& part = worker.totals;
+		if (part.games == 0) {
+			continue;
+		}
+		if (totals.games == 0 || part.bestScore > totals.bestScore || (part.bestScore == totals.bestScore && part.bestGame < totals.bestGame)) {
+			totals.bestScore = part.bestScore;
+			totals.bestGame = part.bestGame;
+		}
+		totals.games += part.games;
+		totals.ticks += part.ticks;
+		totals.totalScore += part.totalScore;
+		totals.totalLength += part.totalLength;
+		totals.hitWall += part.hitWall;
+		totals.hitSelf += part.hitSelf;
+		totals.boardFull += part.boardFull;
+		totals.stalled += part.stalled;
+		totals.decisions += worker.headless.decisions;
+		totals.decisionSeconds += worker.headless.decisionSeconds;
+	}
+
+	totals.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	totals.threads = threads;
+	return totals;
+}
@@ -0,0 +1,52 @@
+#ifndef TOURNAMENT_HPP
+#define TOURNAMENT_HPP
+
+#include "Autopilot.hpp"
+#include <cstdint>
+
+struct TournamentConfig {
+    int gridWidth;
+    int gridHeight;
+    bool useAutopilot;            // Otherwise the snakes wander randomly
+    Autopilot::Strategy strategy;
+    int budgetMicroseconds;       // Per decision; zero or less for reproducible results
+    std::uint64_t games;
+    std::uint64_t seed;           // Game i is always played from the same seed derived from this
+    int threads;                  // Zero uses every core
+};
+
+// Totals over every game. These only depend on the config, not on how the games were
+// spread over threads, as long as the autopilot budget never runs out.
+struct TournamentStats {
+    std::uint64_t games;
+    std::uint64_t ticks;
+    std::uint64_t totalScore;
+    std::uint64_t totalLength;
+    int bestScore;
+    std::uint64_t bestGame;       // Lowest game index reaching bestScore
+    std::uint64_t hitWall;
+    std::uint64_t hitSelf;
+    std::uint64_t boardFull;
+    std::uint64_t stalled;
+    std::uint64_t decisions;
+    double decisionSeconds;       // Summed over all threads
+    double seconds;               // Wall clock
+    int threads;
+};
+
+// Plays many independent headless games across all cores. Each worker owns a range of
+// game indices; once its range runs out it steals the back half of another worker's range.
+class Tournament {
+public:
+    explicit Tournament(const TournamentConfig& config);
+
+    TournamentStats run();
+
+    // Seed used for a single game, so an interesting game can be replayed on its own
+    static std::uint64_t gameSeed(std::uint64_t seed, std::uint64_t game);
+
+private:
+    TournamentConfig mConfig;
+};
+
+#endif // TOURNAMENT_HPP
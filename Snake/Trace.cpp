@@ -0,0 +1,187 @@
+#include "Trace.hpp"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+std::atomic<bool> Trace::sEnabled(false);
+
+struct TraceEvent {
+	const char* name;
+	std::uint64_t start;
+	std::uint64_t end;
+};
+
+// Single producer (the owning thread), single consumer (the writer). The producer only moves
+// mHead and the consumer only moves mTail; a full ring drops new events rather than waiting.
+struct TraceBuffer {
+	static const std::uint32_t Capacity = 1u << 16;
+
+	TraceEvent events[Capacity];
+	std::atomic<std::uint32_t> head;
+	std::atomic<std::uint32_t> tail;
+	std::atomic<std::uint32_t> dropped;
+	int threadId;
+	std::string threadName;
+	bool nameWritten;
+	std::mutex nameMutex;
+};
+
+// Shared between recording threads and the writer; only touched under sMutex
+static std::mutex sMutex;
+static std::vector<std::unique_ptr<TraceBuffer>> sBuffers;
+static std::FILE* sFile = nullptr;
+static bool sFirstEvent = true;
+static std::uint64_t sStartTime = 0;
+static std::thread sWriter;
+static std::atomic<bool> sWriterRunning(false);
+
+static thread_local TraceBuffer* tBuffer = nullptr;
+
+static TraceBuffer* threadBuffer() {
+	if (!tBuffer) {
+		std::unique_ptr<TraceBuffer> buffer(new TraceBuffer());
+		buffer->head = 0;
+		buffer->tail = 0;
+		buffer->dropped = 0;
+		buffer->nameWritten = false;
+
+		std::lock_guard<std::mutex> lock(sMutex);
+		buffer->threadId = static_cast<int>(sBuffers.size()) + 1;
+		buffer->threadName = "Thread " + std::to_string(buffer->threadId);
+		tBuffer = buffer.get();
+		sBuffers.push_back(std::move(buffer));
+	}
+	return tBuffer;
+}
+
+static void writeEvent(const char* json) {
+	std::fputs(sFirstEvent ? "\n" : ",\n", sFile);
+	std::fputs(json, sFile);
+	sFirstEvent = false;
+}
+
+// Move everything recorded so far into the file. Called with sMutex held.
+static void drain() {
+	char json[256];
+	for (const std::unique_ptr<TraceBuffer>& buffer : sBuffers) {
+		{
+			std::lock_guard<std::mutex> lock(buffer->nameMutex);
+			if (!buffer->nameWritten) {
+				std::snprintf(json, sizeof(json), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+					buffer->threadId, buffer->threadName.c_str());
+				writeEvent(json);
+				buffer->nameWritten = true;
+			}
+		}
+
+		std::uint32_t tail = buffer->tail.load(std::memory_order_relaxed);
+		std::uint32_t head = buffer->head.load(std::memory_order_acquire);
+		for (; tail != head; ++tail) {
+			const TraceEvent& event = buffer->events[tail % TraceBuffer::Capacity];
+			if (event.start < sStartTime) {
+				continue;  // Left over from an earlier trace
+			}
+			std::snprintf(json, sizeof(json), "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+				event.name, buffer->threadId, (event.start - sStartTime) / 1000.0, (event.end - event.start) / 1000.0);
+			writeEvent(json);
+		}
+		buffer->tail.store(tail, std::memory_order_release);
+	}
+}
+
+static void writerLoop() {
+	while (sWriterRunning.load()) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		std::lock_guard<std::mutex> lock(sMutex);
+		drain();
+	}
+}
+
+
+bool Trace::start(const char* path) {
+	stop();
+
+	std::lock_guard<std::mutex> lock(sMutex);
+	sFile = std::fopen(path, "w");
+	if (!sFile) {
+		std::cout << "Could not create trace " << path << std::endl;
+		return false;
+	}
+	std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", sFile);
+	sFirstEvent = true;
+	sStartTime = now();
+
+	// Events from an earlier trace are skipped by their timestamps
+	for (const std::unique_ptr<TraceBuffer>& buffer : sBuffers) {
+		std::lock_guard<std::mutex> nameLock(buffer->nameMutex);
+		buffer->nameWritten = false;
+	}
+
+#ifndef __EMSCRIPTEN__
+	sWriterRunning = true;
+	sWriter = std::thread(writerLoop);
+#endif
+	sEnabled = true;
+	return true;
+}
+
+void Trace::stop() {
+	sEnabled = false;
+
+	if (sWriter.joinable()) {
+		sWriterRunning = false;
+		sWriter.join();
+	}
+
+	std::lock_guard<std::mutex> lock(sMutex);
+	if (!sFile) {
+		return;
+	}
+
+	drain();
+
+	std::uint32_t dropped = 0;
+	for (const std::unique_ptr<TraceBuffer>& buffer : sBuffers) {
+		dropped += buffer->dropped.exchange(0);
+	}
+	if (dropped > 0) {
+		std::cout << "Trace dropped " << dropped << " events from full buffers" << std::endl;
+	}
+
+	std::fputs("\n]}\n", sFile);
+	std::fclose(sFile);
+	sFile = nullptr;
+}
+
+void Trace::setThreadName(const char* name) {
+	TraceBuffer* buffer = threadBuffer();
+	std::lock_guard<std::mutex> lock(buffer->nameMutex);
+	buffer->threadName = name;
+	buffer->nameWritten = false;
+}
+
+std::uint64_t Trace::now() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Trace::record(const char* name, std::uint64_t startNanoseconds, std::uint64_t endNanoseconds) {
+	TraceBuffer* buffer = threadBuffer();
+
+	std::uint32_t head = buffer->head.load(std::memory_order_relaxed);
+	if (head - buffer->tail.load(std::memory_order_acquire) >= TraceBuffer::Capacity) {
+		buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	TraceEvent& event = buffer->events[head % TraceBuffer::Capacity];
+	event.name = name;
+	event.start = startNanoseconds;
+	event.end = endNanoseconds;
+	buffer->head.store(head + 1, std::memory_order_release);
+}
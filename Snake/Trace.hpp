@@ -0,0 +1,60 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+
+// Chrome / Perfetto trace-event export (open the file in chrome://tracing or ui.perfetto.dev).
+// TRACE_SCOPE("name") records how long the enclosing scope took. Each thread writes into its
+// own lock-free ring and a background thread turns the rings into JSON, so recording an event
+// is two clock reads and a store. While tracing is off a scope costs one relaxed load;
+// define SNAKE_TRACE=0 to remove the markers entirely.
+#ifndef SNAKE_TRACE
+#define SNAKE_TRACE 1
+#endif
+
+class Trace {
+public:
+    // Begin writing events to path; returns false if the file cannot be created
+    static bool start(const char* path);
+
+    // Write out everything recorded so far and close the file
+    static void stop();
+
+    static bool isEnabled() { return sEnabled.load(std::memory_order_relaxed); }
+
+    // Name shown for the calling thread in the trace viewer
+    static void setThreadName(const char* name);
+
+    // Nanoseconds on the steady clock
+    static std::uint64_t now();
+
+    // name must outlive the trace, e.g. a string literal
+    static void record(const char* name, std::uint64_t startNanoseconds, std::uint64_t endNanoseconds);
+
+private:
+    static std::atomic<bool> sEnabled;
+};
+
+class TraceScope {
+public:
+    explicit TraceScope(const char* name)
+        : mName(Trace::isEnabled() ? name : nullptr), mStart(mName ? Trace::now() : 0) {}
+    ~TraceScope() {
+        if (mName) Trace::record(mName, mStart, Trace::now());
+    }
+
+private:
+    const char* mName;
+    std::uint64_t mStart;
+};
+
+#if SNAKE_TRACE
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#else
+#define TRACE_SCOPE(name) ((void)0)
+#endif
+
+#endif // TRACE_HPP
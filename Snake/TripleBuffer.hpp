@@ -0,0 +1,45 @@
+#ifndef TRIPLE_BUFFER_HPP
+#define TRIPLE_BUFFER_HPP
+
+#include <atomic>
+
+// Hands the newest value from one writer thread to one reader thread without locks or copies.
+// The writer fills its own slot and publishes it; the reader picks up the most recently
+// published slot, skipping any it was too slow to see. Neither side ever waits for the other.
+// Slots are reused, so values that keep their storage (e.g. vectors) stop allocating once warm.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : mWrite(0), mMiddle(1), mRead(2) {}
+
+    // Writer: fill this, then publish it
+    T& writeBuffer() { return mSlots[mWrite]; }
+    void publish() {
+        mWrite = mMiddle.exchange(mWrite | Fresh, std::memory_order_acq_rel) & IndexMask;
+    }
+
+    // Reader: switch to the newest published value, if there is one since the last call
+    bool acquire() {
+        if (!(mMiddle.load(std::memory_order_relaxed) & Fresh)) {
+            return false;
+        }
+        mRead = mMiddle.exchange(mRead, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+    const T& readBuffer() const { return mSlots[mRead]; }
+
+private:
+    TripleBuffer(const TripleBuffer&);             // Not copyable
+    TripleBuffer& operator=(const TripleBuffer&);
+
+    static const unsigned IndexMask = 3;
+    static const unsigned Fresh = 4;  // Set on the middle slot until the reader takes it
+
+private:
+    T mSlots[3];
+    alignas(64) unsigned mWrite;            // Only touched by the writer
+    alignas(64) std::atomic<unsigned> mMiddle;
+    alignas(64) unsigned mRead;             // Only touched by the reader
+};
+
+#endif // TRIPLE_BUFFER_HPP
@@ -0,0 +1,97 @@
+#include "VectorEnv.hpp"
+#include <cstring>
+
+// Boards per chunk handed to a thread; enough that the threads rarely write into the same
+// cache line of the per-board arrays
+static const int MinBoardsPerChunk = 64;
+
+
+VectorEnv::VectorEnv(const VectorEnvConfig& config)
+	: mConfig(config)
+	, mPool(config.threads)
+	, mStallLimit(2ull * config.gridWidth * config.gridHeight + 16)  // Two laps of the board, as HeadlessRunner
+{
+	mBoards.reserve(config.envCount);
+	for (int i = 0; i < config.envCount; ++i) {
+		mBoards.emplace_back(new Board(config.gridWidth, config.gridHeight, Random::hash(config.seed + i)));
+	}
+}
+
+void VectorEnv::reset(std::uint8_t* observations) {
+	std::size_t observationSize = getObservationSize();
+	mPool.run(getEnvCount(), MinBoardsPerChunk, [&](int begin, int end) {
+		for (int i = begin; i < end; ++i) {
+			restart(*mBoards[i]);
+			observe(*mBoards[i], observations + i * observationSize);
+		}
+	});
+}
+
+void VectorEnv::step(const std::int32_t* actions, std::uint8_t* observations, float* rewards,
+	std::uint8_t* terminals, std::uint8_t* truncations) {
+	std::size_t observationSize = getObservationSize();
+	mPool.run(getEnvCount(), MinBoardsPerChunk, [&](int begin, int end) {
+		for (int i = begin; i < end; ++i) {
+			Board& board = *mBoards[i];
+			Simulation& sim = board.sim;
+
+			switch (actions[i]) {
+			case Up: sim.turnUp(); break;
+			case Down: sim.turnDown(); break;
+			case Left: sim.turnLeft(); break;
+			case Right: sim.turnRight(); break;
+			default: break;
+			}
+
+			int score = sim.getScore();
+			sim.step();
+
+			float reward = static_cast<float>(sim.getScore() - score);
+			if (sim.getScore() != score) {
+				board.ticksSinceFood = 0;
+			}
+			else {
+				board.ticksSinceFood++;
+			}
+
+			bool isTerminal = sim.isGameOver();
+			bool isTruncated = !isTerminal && board.ticksSinceFood >= mStallLimit;
+			if (isTerminal && !sim.hasWon()) {
+				reward -= 1.0f;
+			}
+			if (isTerminal || isTruncated) {
+				restart(board);
+			}
+
+			rewards[i] = reward;
+			terminals[i] = isTerminal ? 1 : 0;
+			if (truncations) {
+				truncations[i] = isTruncated ? 1 : 0;
+			}
+			observe(board, observations + i * observationSize);
+		}
+	});
+}
+
+void VectorEnv::restart(Board& board) {
+	board.sim.reset(board.seeds.next());
+	board.ticksSinceFood = 0;
+}
+
+void VectorEnv::observe(const Board& board, std::uint8_t* observation) const {
+	const Simulation& sim = board.sim;
+	int planeSize = mConfig.gridWidth * mConfig.gridHeight;
+	std::memset(observation, 0, static_cast<std::size_t>(planeSize) * ObservationPlanes);
+
+	std::uint8_t* body = observation;
+	std::uint8_t* head = body + planeSize;
+	std::uint8_t* food = head + planeSize;
+	const SnakeBody& snake = sim.getSnake();
+	for (std::size_t i = 0; i < snake.size(); ++i) {
+		body[snake[i].y * mConfig.gridWidth + snake[i].x] = 1;
+	}
+	head[sim.getHead().y * mConfig.gridWidth + sim.getHead().x] = 1;
+	if (!sim.isGameOver()) {
+		food[sim.getFood().y * mConfig.gridWidth + sim.getFood().x] = 1;
+	}
+}
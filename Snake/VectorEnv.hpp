@@ -0,0 +1,76 @@
+#ifndef VECTOR_ENV_HPP
+#define VECTOR_ENV_HPP
+
+#include "ParallelFor.hpp"
+#include "Random.hpp"
+#include "Simulation.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct VectorEnvConfig {
+    int envCount;
+    int gridWidth;
+    int gridHeight;
+    std::uint64_t seed;           // Board i always plays the same games, however many threads
+    int threads;                  // Zero uses every core
+};
+
+// Many boards stepped together for training agents, each with one action per step. Results go
+// straight into caller-owned arrays with one entry per board (structure of arrays), and a board
+// whose game ends starts a new one at once, so every step returns a full batch.
+//
+// Observations are ObservationPlanes planes of gridHeight x gridWidth bytes per board, 1 where
+// the plane's feature is: the snake's body (head included), its head, then the food.
+// Rewards are +1 for eating and -1 for dying.
+class VectorEnv {
+public:
+    enum Action {
+        Up,
+        Down,
+        Left,
+        Right,
+        Straight  // Keep going; any value past Right counts as this
+    };
+
+    static const int ObservationPlanes = 3;
+
+    explicit VectorEnv(const VectorEnvConfig& config);
+
+    // Start a new game on every board
+    void reset(std::uint8_t* observations);
+
+    // Apply actions[i] to board i and advance every board one tick. A board that ended is
+    // reset before its observation is written, and flagged in terminals (the game was lost or
+    // won) or truncations (the snake went too long without eating). truncations may be null.
+    void step(const std::int32_t* actions, std::uint8_t* observations, float* rewards,
+        std::uint8_t* terminals, std::uint8_t* truncations);
+
+    int getEnvCount() const { return static_cast<int>(mBoards.size()); }
+    int getObservationSize() const { return ObservationPlanes * mConfig.gridWidth * mConfig.gridHeight; }  // Bytes per board
+    int getThreadCount() const { return mPool.getThreadCount(); }
+
+private:
+    VectorEnv(const VectorEnv&);
+    VectorEnv& operator=(const VectorEnv&);
+
+    struct Board {
+        Board(int gridWidth, int gridHeight, std::uint64_t seed)
+            : sim(gridWidth, gridHeight), seeds(seed), ticksSinceFood(0) {}
+
+        Simulation sim;
+        Random seeds;  // One seed per game
+        std::uint64_t ticksSinceFood;
+    };
+
+    void restart(Board& board);
+    void observe(const Board& board, std::uint8_t* observation) const;
+
+private:
+    VectorEnvConfig mConfig;
+    std::vector<std::unique_ptr<Board>> mBoards;  // Separate allocations, so threads never share a board's cache lines
+    ParallelFor mPool;
+    std::uint64_t mStallLimit;
+};
+
+#endif // VECTOR_ENV_HPP
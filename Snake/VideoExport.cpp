@@ -0,0 +1,245 @@
+#include "VideoExport.hpp"
+#include "Game.hpp"
+#include "Replay.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+// Frames per batch for every render thread. More keeps the threads busier between batches,
+// at the cost of two batches of frames held in memory.
+static const int FramesPerThread = 2;
+
+// Bytes in the Y, U and V planes of one 4:2:0 frame
+static std::size_t planeBytes(int width, int height) {
+	std::size_t chroma = static_cast<std::size_t>((width + 1) / 2) * ((height + 1) / 2);
+	return static_cast<std::size_t>(width) * height + 2 * chroma;
+}
+
+
+VideoExporter::VideoExporter(const VideoConfig& config)
+	: mConfig(config)
+	, mPool(config.threads)
+	, mOutput(nullptr)
+	, mWriteFailed(false)
+{
+}
+
+VideoExporter::~VideoExporter() {
+	close();
+}
+
+bool VideoExporter::exportReplay(const char* path, VideoStats& stats) {
+	ReplayPlayer replay;
+	if (!replay.open(path)) {
+		return false;
+	}
+
+	Simulation sim(replay.getGridWidth(), replay.getGridHeight());
+	if (!replay.seek(sim, 0)) {
+		return false;
+	}
+	return run(sim, [&replay](Simulation& played) { return replay.step(played) && !played.isGameOver(); }, stats);
+}
+
+bool VideoExporter::exportAutopilotGame(int gridWidth, int gridHeight, std::uint64_t seed, Autopilot& autopilot, VideoStats& stats) {
+	Simulation sim(gridWidth, gridHeight, seed);
+	return run(sim, [&autopilot](Simulation& played) {
+		Cell direction = autopilot.decide(played);
+		if (direction.y < 0) played.turnUp();
+		else if (direction.y > 0) played.turnDown();
+		else if (direction.x < 0) played.turnLeft();
+		else if (direction.x > 0) played.turnRight();
+		played.step();
+		return !played.isGameOver();
+	}, stats);
+}
+
+// Step the game in video time: frame f shows the game 1/fps * f seconds in, the snake part way
+// between its last two cells just like the window shows it
+bool VideoExporter::run(Simulation& sim, const std::function<bool(Simulation&)>& step, VideoStats& stats) {
+	if (!open(sim.getGridWidth(), sim.getGridHeight())) {
+		close();
+		return false;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	stats = VideoStats();
+	stats.threads = static_cast<int>(mRenderers.size());
+
+	int batchSize = static_cast<int>(mRenderers.size()) * FramesPerThread;
+	std::vector<Frame> batches[2];
+	batches[0].resize(batchSize);
+	batches[1].resize(batchSize);
+	std::thread writer;
+
+	double secondsPerFrame = 1.0 / mConfig.framesPerSecond;
+	double lastTick = 0.0;                          // Video time of the tick the board is at
+	double nextTick = sim.getTimePerTick();
+	bool isPlaying = !sim.isGameOver();
+	std::uint64_t maxFrames = mConfig.maxSeconds > 0.0 ? static_cast<std::uint64_t>(mConfig.maxSeconds * mConfig.framesPerSecond) : 0;
+
+	// Show the end of the game for a second before stopping
+	int holdFrames = mConfig.framesPerSecond;
+	int current = 0;
+	while (holdFrames > 0 && !mWriteFailed && (maxFrames == 0 || stats.frames < maxFrames)) {
+		std::vector<Frame>& frames = batches[current];
+		int count = 0;
+		while (count < batchSize && holdFrames > 0 && (maxFrames == 0 || stats.frames < maxFrames)) {
+			double now = stats.frames * secondsPerFrame;
+			while (isPlaying && now >= nextTick) {
+				isPlaying = step(sim);
+				stats.ticks++;
+				lastTick = nextTick;
+				nextTick += sim.getTimePerTick();
+			}
+			if (!isPlaying) {
+				holdFrames--;
+			}
+
+			Frame& frame = frames[count++];
+			mRenderers[0].game->captureView(sim, frame.board);
+			frame.board.isMoving = isPlaying;
+			frame.board.snapToTick = false;
+			frame.interpolation = static_cast<float>(std::min(1.0, (now - lastTick) / sim.getTimePerTick()));
+			stats.frames++;
+		}
+
+		renderBatch(frames, count);
+
+		// The other batch is free to fill once its frames are out
+		if (writer.joinable()) {
+			writer.join();
+		}
+		writer = std::thread(&VideoExporter::writeBatch, this, std::cref(frames), count);
+		current = 1 - current;
+	}
+	if (writer.joinable()) {
+		writer.join();
+	}
+
+	stats.videoSeconds = stats.frames * secondsPerFrame;
+	stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	bool isWritten = !mWriteFailed && std::fflush(mOutput) == 0;
+	close();
+	if (!isWritten) {
+		std::cerr << "Could not write the video" << std::endl;
+	}
+	return isWritten;
+}
+
+bool VideoExporter::open(int gridWidth, int gridHeight) {
+	// Every pool thread draws into a surface of its own
+	for (int i = 0; i < mPool.getThreadCount(); ++i) {
+		Renderer renderer = { nullptr, SDL_CreateRGBSurfaceWithFormat(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, SDL_PIXELFORMAT_RGBA32) };
+		if (!renderer.target) {
+			std::cerr << "Could not create a frame surface: " << SDL_GetError() << std::endl;
+			return false;
+		}
+		renderer.game = new Game(gridWidth, gridHeight);
+		mRenderers.push_back(renderer);
+		if (!renderer.game->initOffscreen(renderer.target)) {
+			return false;
+		}
+	}
+
+	if (std::string(mConfig.outputPath) == "-") {
+		mOutput = stdout;
+#ifdef _WIN32
+		_setmode(_fileno(stdout), _O_BINARY);
+#endif
+	}
+	else {
+		mOutput = std::fopen(mConfig.outputPath, "wb");
+		if (!mOutput) {
+			std::cerr << "Could not open " << mConfig.outputPath << " for writing" << std::endl;
+			return false;
+		}
+	}
+
+	// C420jpeg: full range 4:2:0 with centered chroma, as convert() writes it
+	std::fprintf(mOutput, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", WINDOW_WIDTH, WINDOW_HEIGHT, mConfig.framesPerSecond);
+	mWriteFailed = false;
+	return true;
+}
+
+void VideoExporter::close() {
+	for (Renderer& renderer : mRenderers) {
+		if (renderer.game) {
+			renderer.game->clean();
+			delete renderer.game;
+		}
+		SDL_FreeSurface(renderer.target);
+	}
+	mRenderers.clear();
+
+	if (mOutput && mOutput != stdout) {
+		std::fclose(mOutput);
+	}
+	mOutput = nullptr;
+}
+
+// Thread i draws frames i, i + threads, ... so the threads finish at about the same time
+void VideoExporter::renderBatch(std::vector<Frame>& frames, int count) {
+	int threads = static_cast<int>(mRenderers.size());
+	mPool.run(threads, 1, [&](int begin, int end) {
+		for (int i = begin; i < end; ++i) {
+			Renderer& renderer = mRenderers[i];
+			for (int f = i; f < count; f += threads) {
+				renderer.game->renderBoard(frames[f].board, frames[f].interpolation);
+				convert(renderer.target, frames[f].planes);
+			}
+		}
+	});
+}
+
+void VideoExporter::writeBatch(const std::vector<Frame>& frames, int count) {
+	for (int i = 0; i < count && !mWriteFailed; ++i) {
+		const std::vector<unsigned char>& planes = frames[i].planes;
+		if (std::fputs("FRAME\n", mOutput) < 0 || std::fwrite(planes.data(), 1, planes.size(), mOutput) != planes.size()) {
+			mWriteFailed = true;
+		}
+	}
+}
+
+void VideoExporter::convert(const SDL_Surface* surface, std::vector<unsigned char>& planes) {
+	int width = surface->w, height = surface->h;
+	int chromaWidth = (width + 1) / 2, chromaHeight = (height + 1) / 2;
+	planes.resize(planeBytes(width, height));
+	unsigned char* lumaPlane = planes.data();
+	unsigned char* uPlane = lumaPlane + static_cast<std::size_t>(width) * height;
+	unsigned char* vPlane = uPlane + static_cast<std::size_t>(chromaWidth) * chromaHeight;
+
+	// BT.601 full range in 8.8 fixed point; chroma is taken from the average of each 2x2 block
+	const unsigned char* pixels = static_cast<const unsigned char*>(surface->pixels);
+	for (int y = 0; y < height; y += 2) {
+		const unsigned char* rows[2] = { pixels + static_cast<std::size_t>(y) * surface->pitch,
+			pixels + static_cast<std::size_t>(std::min(y + 1, height - 1)) * surface->pitch };
+		unsigned char* lumaRows[2] = { lumaPlane + static_cast<std::size_t>(y) * width,
+			lumaPlane + static_cast<std::size_t>(std::min(y + 1, height - 1)) * width };
+
+		for (int x = 0; x < width; x += 2) {
+			int red = 0, green = 0, blue = 0;
+			for (int row = 0; row < 2; ++row) {
+				for (int column = x; column < x + 2; ++column) {
+					const unsigned char* pixel = rows[row] + std::min(column, width - 1) * 4;  // RGBA in memory
+					lumaRows[row][std::min(column, width - 1)] = static_cast<unsigned char>((77 * pixel[0] + 150 * pixel[1] + 29 * pixel[2] + 128) >> 8);
+					red += pixel[0];
+					green += pixel[1];
+					blue += pixel[2];
+				}
+			}
+
+			// Sums of four pixels, so 10.8 fixed point; the offset keeps the sums positive
+			std::size_t chroma = static_cast<std::size_t>(y / 2) * chromaWidth + x / 2;
+			uPlane[chroma] = static_cast<unsigned char>((-43 * red - 85 * green + 128 * blue + (128 << 10) + 512) >> 10);
+			vPlane[chroma] = static_cast<unsigned char>((128 * red - 107 * green - 21 * blue + (128 << 10) + 512) >> 10);
+		}
+	}
+}
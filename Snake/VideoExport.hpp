@@ -0,0 +1,83 @@
+#ifndef VIDEO_EXPORT_HPP
+#define VIDEO_EXPORT_HPP
+
+#include "Autopilot.hpp"
+#include "BoardSnapshot.hpp"
+#include "ParallelFor.hpp"
+#include "Simulation.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+class Game;
+struct SDL_Surface;
+
+struct VideoConfig {
+    const char* outputPath;       // "-" writes to stdout, e.g. to pipe into an encoder
+    int framesPerSecond;
+    double maxSeconds;            // Of video; zero runs until the game ends
+    int threads;                  // Zero uses every core
+};
+
+// Throughput of an export
+struct VideoStats {
+    std::uint64_t frames;
+    std::uint64_t ticks;
+    double videoSeconds;
+    double seconds;               // Wall clock
+    int threads;
+};
+
+// Turns a game into an uncompressed YUV4MPEG2 (Y4M) stream with no window. Every thread draws
+// with an offscreen Game on SDL's software renderer, so frames match the window exactly.
+// The simulation is stepped on the calling thread in video time, a batch of frames is captured
+// and drawn in parallel, and a writer thread streams the previous batch out in order meanwhile.
+class VideoExporter {
+public:
+    explicit VideoExporter(const VideoConfig& config);
+    ~VideoExporter();
+
+    // Play a replay from its first tick to its last
+    bool exportReplay(const char* path, VideoStats& stats);
+
+    // Play one game from seed with the autopilot
+    bool exportAutopilotGame(int gridWidth, int gridHeight, std::uint64_t seed, Autopilot& autopilot, VideoStats& stats);
+
+private:
+    VideoExporter(const VideoExporter&);
+    VideoExporter& operator=(const VideoExporter&);
+
+    // One frame of a batch: the board to draw and the frame as Y4M planes
+    struct Frame {
+        BoardSnapshot board;
+        float interpolation;
+        std::vector<unsigned char> planes;
+    };
+
+    // Offscreen game drawing into its own surface
+    struct Renderer {
+        Game* game;
+        SDL_Surface* target;
+    };
+
+    // step advances the simulation one tick and returns false once the game is over
+    bool run(Simulation& sim, const std::function<bool(Simulation&)>& step, VideoStats& stats);
+    bool open(int gridWidth, int gridHeight);
+    void close();
+    void renderBatch(std::vector<Frame>& frames, int count);
+    void writeBatch(const std::vector<Frame>& frames, int count);
+
+    // RGBA pixels to full range BT.601 4:2:0 planes
+    static void convert(const SDL_Surface* surface, std::vector<unsigned char>& planes);
+
+private:
+    VideoConfig mConfig;
+    ParallelFor mPool;
+    std::vector<Renderer> mRenderers;  // One per pool thread
+    std::FILE* mOutput;
+    std::atomic<bool> mWriteFailed;  // Set by the writer thread, read while it runs
+};
+
+#endif // VIDEO_EXPORT_HPP
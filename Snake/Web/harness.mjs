@@ -0,0 +1,71 @@
+// Headless checks for the web build, run from the Snake directory after building with Web/emcc.txt:
+//   node Web/harness.mjs [seconds] > web.json
+// Prints the size of the wasm (raw and gzipped, as served) and the JS glue, then runs the
+// build's --tick-jitter mode under Node, where the simulation thread is a worker just as it
+// is in the browser, and reports how late its ticks ran.
+import { spawn } from 'node:child_process';
+import { readFileSync, existsSync } from 'node:fs';
+import { gzipSync } from 'node:zlib';
+import { dirname, join } from 'node:path';
+import { fileURLToPath } from 'node:url';
+
+const webDir = dirname(fileURLToPath(import.meta.url));
+const seconds = process.argv[2] || '20';
+
+function fileSizes(name) {
+  const path = join(webDir, name);
+  if (!existsSync(path)) {
+    return null;
+  }
+  const bytes = readFileSync(path);
+  return { bytes: bytes.length, gzipBytes: gzipSync(bytes, { level: 9 }).length };
+}
+
+// Lines like "Lateness p99 (ms): 0.25" become { latenessP99Ms: 0.25 }
+function parseReport(text) {
+  const report = {};
+  for (const line of text.split('\n')) {
+    const match = line.match(/^([^:]+):\s*([-\d.e+]+)\s*$/);
+    if (!match) continue;
+    const key = match[1].replace(/\(ms\)/, 'ms').trim().split(/\s+/)
+      .map((word, i) => i === 0 ? word.toLowerCase() : word[0].toUpperCase() + word.slice(1)).join('');
+    report[key] = Number(match[2]);
+  }
+  return report;
+}
+
+function runTickJitter() {
+  return new Promise((resolve, reject) => {
+    const child = spawn(process.execPath, [join(webDir, 'index.js'), '--tick-jitter', seconds],
+      { cwd: webDir, stdio: ['ignore', 'pipe', 'inherit'] });
+    let output = '';
+    child.stdout.on('data', (data) => {
+      output += data;
+      // The runtime stays up for its worker pool once main returns, so stop at the last line
+      if (/Ticks over a period late:.*\n/.test(output)) child.kill();
+    });
+    child.on('error', reject);
+    child.on('close', () => {
+      const report = parseReport(output);
+      if (report.ticks === undefined) reject(new Error('No tick report from index.js:\n' + output));
+      else resolve(report);
+    });
+  });
+}
+
+const result = {
+  wasm: fileSizes('index.wasm'),
+  js: fileSizes('index.js'),
+  tickJitter: null,
+};
+if (!result.wasm || !result.js) {
+  console.error('Web/index.wasm and Web/index.js not found; build with Web/emcc.txt first');
+  process.exit(1);
+}
+try {
+  result.tickJitter = await runTickJitter();
+} catch (error) {
+  console.error(error.message);
+  process.exitCode = 1;
+}
+console.log(JSON.stringify(result, null, 2));